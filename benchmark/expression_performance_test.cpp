@@ -0,0 +1,192 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+//
+// Created by agent on 2026/10/18
+//
+
+#include <string.h>
+#include <memory>
+#include <random>
+#include <vector>
+#include <benchmark/benchmark.h>
+
+#include "sql/expr/expr_program.h"
+#include "sql/expr/expression.h"
+#include "sql/expr/tuple.h"
+#include "storage/common/chunk.h"
+
+using namespace std;
+using namespace benchmark;
+
+/**
+ * 对比表达式树和编译后的表达式(ExprProgram)的计算速度。
+ * 数据是 (id int, f float)，表达式有两个：
+ * - 0: id > 500 AND f < 250
+ * - 1: (id + 3) * 2 > f
+ * 分别在tuple上逐行计算、在记录上逐行计算(只有编译后的表达式支持)和在chunk上按批计算。
+ */
+
+static const int kRows = 1024;
+
+static FieldMeta id_field("id", INTS, 0, 4, true);
+static FieldMeta f_field("f", FLOATS, 4, 4, true);
+
+struct Data
+{
+  vector<ValueListTuple> tuples;
+  vector<char>           records;  ///< 每条记录8个字节
+  Chunk                  chunk;
+};
+
+static void make_data(Data &data)
+{
+  mt19937 rng(0);
+  uniform_int_distribution<int32_t> int_dist(0, 1000);
+  uniform_real_distribution<float>  float_dist(0, 1000);
+
+  auto id_column = make_unique<Column>(INTS, 4, kRows);
+  auto f_column  = make_unique<Column>(FLOATS, 4, kRows);
+  data.tuples.resize(kRows);
+  for (int i = 0; i < kRows; i++) {
+    const int32_t id = int_dist(rng);
+    const float   f  = float_dist(rng);
+    data.tuples[i].set_cells({Value(id), Value(f)});
+
+    char record[8];
+    memcpy(record, &id, 4);
+    memcpy(record + 4, &f, 4);
+    data.records.insert(data.records.end(), record, record + sizeof(record));
+    id_column->append_one(record);
+    f_column->append_one(record + 4);
+  }
+  data.chunk.add_column(std::move(id_column), 0);
+  data.chunk.add_column(std::move(f_column), 1);
+}
+
+static unique_ptr<Expression> make_field(FieldMeta &meta, int index)
+{
+  auto field_expr = make_unique<FieldExpr>(nullptr, &meta);
+  field_expr->set_cell_index(index);
+  field_expr->set_pos(index);
+  return field_expr;
+}
+
+static unique_ptr<Expression> make_expression(int64_t which)
+{
+  if (which == 0) {
+    vector<unique_ptr<Expression>> children;
+    children.emplace_back(
+        new ComparisonExpr(GREAT_THAN, make_field(id_field, 0), make_unique<ValueExpr>(Value(500))));
+    children.emplace_back(
+        new ComparisonExpr(LESS_THAN, make_field(f_field, 1), make_unique<ValueExpr>(Value(250.0f))));
+    return make_unique<ConjunctionExpr>(ConjunctionExpr::Type::AND, children);
+  }
+
+  auto add = make_unique<ArithmeticExpr>(
+      ArithmeticExpr::Type::ADD, make_field(id_field, 0), make_unique<ValueExpr>(Value(3)));
+  auto mul = make_unique<ArithmeticExpr>(ArithmeticExpr::Type::MUL, std::move(add), make_unique<ValueExpr>(Value(2)));
+  return make_unique<ComparisonExpr>(GREAT_THAN, std::move(mul), make_field(f_field, 1));
+}
+
+static void BM_TreeTuple(State &state)
+{
+  Data data;
+  make_data(data);
+  unique_ptr<Expression> expr = make_expression(state.range(0));
+  vector<uint8_t> result(kRows);
+
+  for (auto _ : state) {
+    Value value;
+    for (int i = 0; i < kRows; i++) {
+      expr->get_value(data.tuples[i], value);
+      result[i] = value.get_boolean();
+    }
+    DoNotOptimize(result.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kRows);
+}
+
+static void BM_ProgramTuple(State &state)
+{
+  Data data;
+  make_data(data);
+  unique_ptr<Expression> expr = make_expression(state.range(0));
+  ExprProgram program;
+  program.compile(*expr, ExprProgram::FieldSource::TUPLE);
+  vector<uint8_t> result(kRows);
+
+  for (auto _ : state) {
+    Value value;
+    for (int i = 0; i < kRows; i++) {
+      program.eval(data.tuples[i], value);
+      result[i] = value.get_boolean();
+    }
+    DoNotOptimize(result.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kRows);
+}
+
+static void BM_ProgramRecord(State &state)
+{
+  Data data;
+  make_data(data);
+  unique_ptr<Expression> expr = make_expression(state.range(0));
+  ExprProgram program;
+  program.compile(*expr, ExprProgram::FieldSource::RECORD);
+  vector<uint8_t> result(kRows);
+
+  for (auto _ : state) {
+    Value value;
+    for (int i = 0; i < kRows; i++) {
+      program.eval(&data.records[i * 8], value);
+      result[i] = value.get_boolean();
+    }
+    DoNotOptimize(result.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kRows);
+}
+
+static void BM_TreeChunk(State &state)
+{
+  Data data;
+  make_data(data);
+  unique_ptr<Expression> expr = make_expression(state.range(0));
+  vector<uint8_t> select;
+
+  for (auto _ : state) {
+    expr->eval(data.chunk, select);
+    DoNotOptimize(select.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kRows);
+}
+
+static void BM_ProgramChunk(State &state)
+{
+  Data data;
+  make_data(data);
+  unique_ptr<Expression> expr = make_expression(state.range(0));
+  ExprProgram program;
+  program.compile(*expr, ExprProgram::FieldSource::CHUNK);
+  vector<uint8_t> select;
+
+  for (auto _ : state) {
+    program.eval(data.chunk, select);
+    DoNotOptimize(select.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kRows);
+}
+
+BENCHMARK(BM_TreeTuple)->Arg(0)->Arg(1);
+BENCHMARK(BM_ProgramTuple)->Arg(0)->Arg(1);
+BENCHMARK(BM_ProgramRecord)->Arg(0)->Arg(1);
+BENCHMARK(BM_TreeChunk)->Arg(0)->Arg(1);
+BENCHMARK(BM_ProgramChunk)->Arg(0)->Arg(1);
+
+BENCHMARK_MAIN();
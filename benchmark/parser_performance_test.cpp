@@ -0,0 +1,65 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18
+//
+
+#include <benchmark/benchmark.h>
+
+#include "sql/parser/fast_parser.h"
+#include "sql/parser/parse.h"
+
+using namespace std;
+using namespace benchmark;
+
+/**
+ * 对比完整的语法解析(flex + bison)和手写的快速解析的吞吐。
+ * 前三种是快速解析可以识别的语句，最后两种需要回退到完整的语法解析，用来观察回退的额外开销：
+ * 一种在解析到ORDER BY时才放弃，另一种第一个关键字就不能识别。
+ */
+
+static const char *const SQLS[] = {
+    "select id, name, age from users where id = 12345;",
+    "insert into users values(12345, 'user name', 30, 1.5);",
+    "delete from users where id = 12345 and name = 'user name';",
+    "select id, name from users where id > 100 order by name limit 10;",
+    "update users set age = 31 where id = 12345;",
+};
+
+static void BM_Parser(State &state)
+{
+  const char *sql = SQLS[state.range(0)];
+  for (auto _ : state) {
+    ParsedSqlResult result;
+    parse(sql, &result);
+    DoNotOptimize(result.sql_nodes().data());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_FastParser(State &state)
+{
+  const char *sql = SQLS[state.range(0)];
+  for (auto _ : state) {
+    // 与ParseStage相同，不能识别时回退到完整的语法解析
+    ParsedSqlResult result;
+    if (!fast_parse(sql, &result)) {
+      parse(sql, &result);
+    }
+    DoNotOptimize(result.sql_nodes().data());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_Parser)->DenseRange(0, 4);
+BENCHMARK(BM_FastParser)->DenseRange(0, 4);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,146 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+//
+// Created by agent on 2026/10/18
+//
+
+#include <random>
+#include <vector>
+#include <benchmark/benchmark.h>
+
+#include "sql/expr/select_kernel.h"
+#include "sql/expr/expression.h"
+
+using namespace std;
+using namespace benchmark;
+using namespace select_kernel;
+
+/**
+ * 对比列与常量比较的几种实现：
+ * - Value：当前按行执行时的路径，每行构造Value后调用 ComparisonExpr::compare_value
+ * - scalar/sse4.2/avx2：select_kernel中不同指令集的实现
+ */
+
+static const int kRows = 1024;
+
+static vector<int32_t> make_int_data()
+{
+  mt19937 rng(0);
+  uniform_int_distribution<int32_t> dist(0, 1000);
+  vector<int32_t> data(kRows);
+  for (int32_t &v : data) {
+    v = dist(rng);
+  }
+  return data;
+}
+
+static vector<float> make_float_data()
+{
+  mt19937 rng(0);
+  uniform_real_distribution<float> dist(0, 1000);
+  vector<float> data(kRows);
+  for (float &v : data) {
+    v = dist(rng);
+  }
+  return data;
+}
+
+static void BM_CompareValueInt(State &state)
+{
+  vector<int32_t> data = make_int_data();
+  vector<uint8_t> result(kRows);
+  ComparisonExpr expr(LESS_THAN, nullptr, nullptr);
+  const Value constant(500);
+
+  for (auto _ : state) {
+    bool bool_value = false;
+    for (int i = 0; i < kRows; i++) {
+      Value value(data[i]);
+      expr.compare_value(value, constant, bool_value);
+      result[i] = bool_value;
+    }
+    DoNotOptimize(result.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kRows);
+}
+
+static void BM_SelectInt(State &state)
+{
+  vector<int32_t> data = make_int_data();
+  vector<uint8_t> bitmap(kRows / 8);
+  const SimdLevel level = set_simd_level(static_cast<SimdLevel>(state.range(0)));
+  state.SetLabel(simd_level_name(level));
+
+  for (auto _ : state) {
+    int matched = select_int32(LESS_THAN, data.data(), kRows, 500, bitmap.data());
+    DoNotOptimize(matched);
+  }
+  state.SetItemsProcessed(state.iterations() * kRows);
+}
+
+static void BM_SelectIntBetween(State &state)
+{
+  vector<int32_t> data = make_int_data();
+  vector<uint8_t> bitmap(kRows / 8);
+  const SimdLevel level = set_simd_level(static_cast<SimdLevel>(state.range(0)));
+  state.SetLabel(simd_level_name(level));
+
+  for (auto _ : state) {
+    int matched = select_int32_between(data.data(), kRows, 250, 750, bitmap.data());
+    DoNotOptimize(matched);
+  }
+  state.SetItemsProcessed(state.iterations() * kRows);
+}
+
+static void BM_CompareValueFloat(State &state)
+{
+  vector<float> data = make_float_data();
+  vector<uint8_t> result(kRows);
+  ComparisonExpr expr(GREAT_EQUAL, nullptr, nullptr);
+  const Value constant(500.0f);
+
+  for (auto _ : state) {
+    bool bool_value = false;
+    for (int i = 0; i < kRows; i++) {
+      Value value(data[i]);
+      expr.compare_value(value, constant, bool_value);
+      result[i] = bool_value;
+    }
+    DoNotOptimize(result.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kRows);
+}
+
+static void BM_SelectFloat(State &state)
+{
+  vector<float> data = make_float_data();
+  vector<uint8_t> bitmap(kRows / 8);
+  const SimdLevel level = set_simd_level(static_cast<SimdLevel>(state.range(0)));
+  state.SetLabel(simd_level_name(level));
+
+  for (auto _ : state) {
+    int matched = select_float(GREAT_EQUAL, data.data(), kRows, 500.0f, bitmap.data());
+    DoNotOptimize(matched);
+  }
+  state.SetItemsProcessed(state.iterations() * kRows);
+}
+
+#define SIMD_LEVELS                                       \
+  Arg(static_cast<int>(SimdLevel::SCALAR))                \
+      ->Arg(static_cast<int>(SimdLevel::SSE42))           \
+      ->Arg(static_cast<int>(SimdLevel::AVX2))
+
+BENCHMARK(BM_CompareValueInt);
+BENCHMARK(BM_SelectInt)->SIMD_LEVELS;
+BENCHMARK(BM_SelectIntBetween)->SIMD_LEVELS;
+BENCHMARK(BM_CompareValueFloat);
+BENCHMARK(BM_SelectFloat)->SIMD_LEVELS;
+
+BENCHMARK_MAIN();
@@ -23,7 +23,8 @@ int compare_int(void *arg1, void *arg2)
 {
   int v1 = *(int *)arg1;
   int v2 = *(int *)arg2;
-  return v1 - v2;
+  // 不能直接相减，差值可能溢出
+  return v1 < v2 ? -1 : (v1 > v2 ? 1 : 0);
 }
 
 int compare_float(void *arg1, void *arg2)
@@ -50,12 +51,13 @@ int compare_string(void *arg1, int arg1_max_length, void *arg2, int arg2_max_len
     return result;
   }
 
+  // 与strncmp一样按照无符号字符比较
   if (arg1_max_length > maxlen) {
-    return s1[maxlen] - 0;
+    return static_cast<unsigned char>(s1[maxlen]) - 0;
   }
 
   if (arg2_max_length > maxlen) {
-    return 0 - s2[maxlen];
+    return 0 - static_cast<unsigned char>(s2[maxlen]);
   }
   return 0;
 }
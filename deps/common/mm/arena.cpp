@@ -0,0 +1,149 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#include <stdlib.h>
+#include <stddef.h>
+
+#include "common/mm/arena.h"
+#include "common/mm/memory_tracker.h"
+
+namespace common {
+
+static constexpr size_t ALIGNMENT = alignof(max_align_t);
+
+static inline size_t align_up(size_t size)
+{
+  return (size + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+}
+
+Arena::Arena(size_t block_size) : block_size_(align_up(block_size))
+{}
+
+Arena::~Arena()
+{
+  reset();
+}
+
+void *Arena::alloc(size_t size)
+{
+  size = align_up(size == 0 ? 1 : size);
+  used_size_ += size;
+  if (size > block_size_ / 4) {
+    // 比较大的内存单独申请一块，不浪费当前块中剩余的空间
+    return alloc_block(size);
+  }
+
+  if (size > remain_) {
+    ptr_    = alloc_block(block_size_);
+    remain_ = block_size_;
+  }
+
+  void *result = ptr_;
+  ptr_ += size;
+  remain_ -= size;
+  return result;
+}
+
+char *Arena::alloc_block(size_t size)
+{
+  char *block = source_ != nullptr ? source_->acquire_block(size) : static_cast<char *>(malloc(size));
+  blocks_.push_back({block, size});
+  memory_size_ += size;
+  return block;
+}
+
+void Arena::reset()
+{
+  for (const Block &block : blocks_) {
+    if (source_ != nullptr) {
+      source_->release_block(block.data, block.size);
+    } else {
+      free(block.data);
+    }
+  }
+  blocks_.clear();
+  ptr_         = nullptr;
+  remain_      = 0;
+  memory_size_ = 0;
+  used_size_   = 0;
+}
+
+static thread_local QueryArena *current_query_arena = nullptr;
+
+QueryArena::~QueryArena()
+{
+  for (char *block : free_blocks_) {
+    free(block);
+  }
+  if (memory_tracker_ != nullptr) {
+    memory_tracker_->release(static_cast<int64_t>(free_blocks_.size() * Arena::DEFAULT_BLOCK_SIZE));
+  }
+}
+
+char *QueryArena::acquire_block(size_t size)
+{
+  std::lock_guard<std::mutex> guard(mutex_);
+  if (size == Arena::DEFAULT_BLOCK_SIZE && !free_blocks_.empty()) {
+    char *block = free_blocks_.back();
+    free_blocks_.pop_back();
+    if (memory_tracker_ != nullptr) {
+      memory_tracker_->release(static_cast<int64_t>(size));
+    }
+    return block;
+  }
+
+  memory_size_ += size;
+  return static_cast<char *>(malloc(size));
+}
+
+void QueryArena::release_block(char *block, size_t size)
+{
+  std::lock_guard<std::mutex> guard(mutex_);
+  // 其它大小的块很少能复用。空闲的块也算作查询使用的内存，会超过查询的内存限制时直接释放
+  if (size != Arena::DEFAULT_BLOCK_SIZE ||
+      (memory_tracker_ != nullptr && memory_tracker_->used() + static_cast<int64_t>(size) > memory_tracker_->limit())) {
+    memory_size_ -= size;
+    free(block);
+    return;
+  }
+
+  free_blocks_.push_back(block);
+  if (memory_tracker_ != nullptr) {
+    memory_tracker_->consume(static_cast<int64_t>(size));
+  }
+}
+
+size_t QueryArena::memory_size() const
+{
+  std::lock_guard<std::mutex> guard(mutex_);
+  return memory_size_;
+}
+
+size_t QueryArena::free_blocks() const
+{
+  std::lock_guard<std::mutex> guard(mutex_);
+  return free_blocks_.size();
+}
+
+QueryArena *QueryArena::current()
+{
+  return current_query_arena;
+}
+
+void QueryArena::set_current(QueryArena *arena)
+{
+  current_query_arena = arena;
+}
+
+}  // namespace common
@@ -0,0 +1,142 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#pragma once
+
+#include <stddef.h>
+#include <mutex>
+#include <vector>
+
+namespace common {
+
+class MemoryTracker;
+class QueryArena;
+
+/**
+ * @brief 顺序分配的内存区域
+ * @details 从大块内存中依次切分出小块内存，不能单独释放，只能通过reset一次释放所有内存。
+ * 适合生命周期相同的大量小对象，比如聚合算子中每个分组的聚合状态。
+ * 在Arena中构造的对象，需要调用方在reset之前自己调用析构函数。
+ * 可以从查询的QueryArena中获取整块的内存，见 set_source。
+ * 非线程安全。
+ */
+class Arena
+{
+public:
+  static constexpr size_t DEFAULT_BLOCK_SIZE = 64 * 1024;
+
+  explicit Arena(size_t block_size = DEFAULT_BLOCK_SIZE);
+  ~Arena();
+
+  Arena(const Arena &) = delete;
+  Arena &operator=(const Arena &) = delete;
+
+  /**
+   * @brief 分配指定大小的内存，按照alignof(max_align_t)对齐
+   */
+  void *alloc(size_t size);
+
+  /**
+   * @brief 释放所有的内存，从QueryArena获取的块还给QueryArena
+   */
+  void reset();
+
+  /**
+   * @brief 之后从source中获取整块的内存，为空时直接从系统申请
+   * @details 只能在没有分配内存时设置。从source中获取的块需要在source销毁之前reset
+   */
+  void set_source(QueryArena *source) { source_ = source; }
+
+  /**
+   * @brief 当前从系统申请的内存总量，包含块中还没有分配出去的部分
+   */
+  size_t memory_size() const { return memory_size_; }
+
+  /**
+   * @brief 已经分配出去的内存(按照对齐之后的大小)，用于统计实际使用的内存
+   */
+  size_t used_size() const { return used_size_; }
+
+private:
+  char *alloc_block(size_t size);
+
+private:
+  struct Block
+  {
+    char  *data;
+    size_t size;
+  };
+
+  size_t              block_size_  = DEFAULT_BLOCK_SIZE;
+  QueryArena         *source_      = nullptr;
+  std::vector<Block>  blocks_;
+  char               *ptr_         = nullptr;  ///< 当前块中下一次分配的位置
+  size_t              remain_      = 0;        ///< 当前块中剩余的内存
+  size_t              memory_size_ = 0;
+  size_t              used_size_   = 0;
+};
+
+/**
+ * @brief 一个查询使用的内存区域
+ * @details 由SQLStageEvent持有，查询结束时一次释放所有的内存。
+ * 执行计划中算子的Arena(比如分组聚合中保存聚合器的Arena)从这里获取整块的内存，reset时还回来，
+ * 给后面的分区或者其它算子复用，同一个查询中不会反复向系统申请和释放。
+ * 空闲的块记录到查询的MemoryTracker中，会超过查询的内存限制时不保留，直接释放。
+ * 分配出去的块由使用的算子按照实际使用的大小记录。
+ * 并行执行时工作线程共享，是线程安全的。
+ *
+ * 只用于算子在一次执行中批量保存、一起释放的数据，包括其中较长的字符串：
+ * 分组聚合的key和聚合器(AggregateHashTable)，hash join build端的行(JoinHashTable)，
+ * 排序算子内存中的行和key(SortPhysicalOperator)，多次遍历的行(RowBuffer，比如nested loop join的内表)。
+ *
+ * 其它内存仍然直接使用系统的内存分配：
+ * - 算子对象和编译后的表达式会随执行计划缓存保留到之后的执行，SessionEvent比查询的生命周期长；
+ * - Exchange中的batch在线程之间传递，每个batch被消费后就单独释放，每个batch占用一个块会浪费内存；
+ * - 逐行计算的临时数据(比如ValueListTuple中的值)很快就释放，放到这里只会增加查询占用的内存。
+ */
+class QueryArena
+{
+public:
+  explicit QueryArena(MemoryTracker *memory_tracker = nullptr) : memory_tracker_(memory_tracker) {}
+  ~QueryArena();
+
+  QueryArena(const QueryArena &)            = delete;
+  QueryArena &operator=(const QueryArena &) = delete;
+
+  /**
+   * @brief 获取一块内存，Arena::DEFAULT_BLOCK_SIZE大小的块优先使用空闲的块
+   */
+  char *acquire_block(size_t size);
+  void  release_block(char *block, size_t size);
+
+  /**
+   * @brief 当前从系统申请的内存总量，包括空闲的和分配出去的块
+   */
+  size_t memory_size() const;
+  size_t free_blocks() const;
+
+  /**
+   * @brief 当前线程正在执行的查询的QueryArena，可能为空
+   */
+  static QueryArena *current();
+  static void        set_current(QueryArena *arena);
+
+private:
+  MemoryTracker      *memory_tracker_ = nullptr;
+  mutable std::mutex  mutex_;
+  std::vector<char *> free_blocks_;  ///< 大小是Arena::DEFAULT_BLOCK_SIZE的空闲块
+  size_t              memory_size_ = 0;
+};
+
+}  // namespace common
@@ -0,0 +1,102 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#include "common/mm/memory_tracker.h"
+
+namespace common {
+
+static thread_local MemoryTracker *current_tracker = nullptr;
+
+bool MemoryTracker::consume(int64_t bytes)
+{
+  const int64_t used = used_.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+  update_peak(used);
+  return used <= limit_;
+}
+
+void MemoryTracker::update_peak(int64_t used)
+{
+  int64_t peak = peak_.load(std::memory_order_relaxed);
+  while (used > peak && !peak_.compare_exchange_weak(peak, used, std::memory_order_relaxed)) {
+  }
+}
+
+MemoryTracker *MemoryTracker::current()
+{
+  return current_tracker;
+}
+
+void MemoryTracker::set_current(MemoryTracker *tracker)
+{
+  current_tracker = tracker;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void MemoryReservation::reset(MemoryTracker *tracker)
+{
+  if (tracker_ != nullptr) {
+    sync(0);
+  }
+  tracker_       = tracker;
+  size_          = 0;
+  reported_      = 0;
+  unsynced_peak_ = 0;
+}
+
+bool MemoryReservation::update(int64_t size)
+{
+  size_ = size;
+  if (size > peak_) {
+    peak_ = size;
+  }
+  if (tracker_ == nullptr) {
+    return true;
+  }
+  if (size > unsynced_peak_) {
+    unsynced_peak_ = size;
+  }
+
+  // 增长累计到SYNC_BYTES才同步。同步之后可能超过限制时立即同步，比SYNC_BYTES小的限制也能准确生效
+  const int64_t delta = size - reported_;
+  if (delta >= SYNC_BYTES || (delta > 0 && tracker_->used() + delta > tracker_->limit())) {
+    return sync(size);
+  }
+  if (delta <= -SYNC_BYTES || (size == 0 && unsynced_peak_ != 0)) {
+    sync(size);
+  }
+  return !tracker_->exceeded();
+}
+
+/**
+ * @brief 把当前的大小记录到MemoryTracker中
+ * @return 查询使用的内存是否没有超过限制
+ */
+bool MemoryReservation::sync(int64_t size)
+{
+  if (unsynced_peak_ > size && unsynced_peak_ > reported_) {
+    // 其它算子的内存按照现在的值估算
+    tracker_->update_peak(tracker_->used() - reported_ + unsynced_peak_);
+  }
+
+  const int64_t delta = size - reported_;
+  reported_      = size;
+  unsynced_peak_ = size;
+  if (delta >= 0) {
+    return tracker_->consume(delta);
+  }
+  tracker_->release(-delta);
+  return !tracker_->exceeded();
+}
+
+}  // namespace common
@@ -0,0 +1,119 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#pragma once
+
+#include <stdint.h>
+#include <atomic>
+
+namespace common {
+
+/**
+ * @brief 统计一个查询使用的内存
+ * @details 查询中的算子把自己占用的内存记录到同一个MemoryTracker中，超过限制时，
+ * 可以把数据写到临时文件的算子先写临时文件，不能写的算子返回错误。
+ * 同时记录使用内存的峰值。并行执行的多个线程共享一个MemoryTracker，是线程安全的。
+ */
+class MemoryTracker
+{
+public:
+  explicit MemoryTracker(int64_t limit = INT64_MAX) : limit_(limit) {}
+  ~MemoryTracker() = default;
+
+  MemoryTracker(const MemoryTracker &)            = delete;
+  MemoryTracker &operator=(const MemoryTracker &) = delete;
+
+  void    set_limit(int64_t limit) { limit_ = limit; }
+  int64_t limit() const { return limit_; }
+
+  /**
+   * @brief 记录新申请的内存，即使超过了限制也会记录
+   * @return 是否没有超过限制
+   */
+  bool consume(int64_t bytes);
+
+  void release(int64_t bytes) { used_.fetch_sub(bytes, std::memory_order_relaxed); }
+
+  /**
+   * @brief 记录一次使用内存的峰值，只在比当前的峰值大时更新
+   */
+  void update_peak(int64_t used);
+
+  int64_t used() const { return used_.load(std::memory_order_relaxed); }
+  int64_t peak() const { return peak_.load(std::memory_order_relaxed); }
+  bool    exceeded() const { return used() > limit_; }
+
+  /**
+   * @brief 当前线程正在执行的查询的MemoryTracker，可能为空
+   * @details 查询开始执行时设置，算子在open时获取
+   */
+  static MemoryTracker *current();
+  static void           set_current(MemoryTracker *tracker);
+
+private:
+  int64_t              limit_ = INT64_MAX;
+  std::atomic<int64_t> used_{0};
+  std::atomic<int64_t> peak_{0};
+};
+
+/**
+ * @brief 一个算子或者数据结构占用的内存
+ * @details 调用方在内存变化时更新当前的大小，变化累计超过一定的量才同步到MemoryTracker中，
+ * 避免每一行都访问共享的计数器。析构或者更换MemoryTracker时释放记录的内存。
+ * 两次同步之间没有记录到MemoryTracker中的最大值，在下一次同步或者释放时计入查询的峰值。
+ */
+class MemoryReservation
+{
+public:
+  MemoryReservation() = default;
+  ~MemoryReservation() { reset(nullptr); }
+
+  MemoryReservation(const MemoryReservation &)            = delete;
+  MemoryReservation &operator=(const MemoryReservation &) = delete;
+
+  /**
+   * @brief 释放已经记录的内存，之后记录到新的MemoryTracker中
+   */
+  void reset(MemoryTracker *tracker);
+
+  /**
+   * @brief 更新当前占用的内存
+   * @return 查询使用的内存是否没有超过限制，没有MemoryTracker时总是true
+   */
+  bool update(int64_t size);
+
+  int64_t size() const { return size_; }
+
+  /**
+   * @brief 记录过的最大的大小，reset之后也保留
+   */
+  int64_t peak() const { return peak_; }
+
+  /**
+   * @brief 变化超过这个值时才同步到MemoryTracker，会超过查询的内存限制时不受这个值的约束
+   */
+  static constexpr int64_t SYNC_BYTES = 64 * 1024;
+
+private:
+  bool sync(int64_t size);
+
+private:
+  MemoryTracker *tracker_       = nullptr;
+  int64_t        size_          = 0;
+  int64_t        peak_          = 0;
+  int64_t        reported_      = 0;  ///< 已经记录到MemoryTracker中的大小
+  int64_t        unsynced_peak_ = 0;  ///< 上次同步之后的最大值，同步时计入MemoryTracker的峰值
+};
+
+}  // namespace common
@@ -0,0 +1,64 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+//
+// Created by agent on 2026/10/18.
+//
+
+#include <chrono>
+#include <thread>
+
+#if defined(__x86_64__)
+#include <x86intrin.h>
+#endif
+
+#include "common/time/cycle_timer.h"
+
+namespace common {
+
+static uint64_t steady_nanos()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+uint64_t CycleTimer::now()
+{
+#if defined(__x86_64__)
+  return __rdtsc();
+#else
+  return steady_nanos();
+#endif
+}
+
+/**
+ * @brief 每个周期对应的纳秒数
+ * @details 对照steady_clock测量一小段时间。现代CPU的TSC频率是固定的，不受变频影响
+ */
+static double calibrate()
+{
+#if defined(__x86_64__)
+  const uint64_t start_nanos  = steady_nanos();
+  const uint64_t start_cycles = CycleTimer::now();
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  const uint64_t nanos  = steady_nanos() - start_nanos;
+  const uint64_t cycles = CycleTimer::now() - start_cycles;
+  return cycles == 0 ? 1.0 : static_cast<double>(nanos) / cycles;
+#else
+  return 1.0;
+#endif
+}
+
+double CycleTimer::to_nanos(uint64_t cycles)
+{
+  static const double nanos_per_cycle = calibrate();
+  return cycles * nanos_per_cycle;
+}
+
+}  // namespace common
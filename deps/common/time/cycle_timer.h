@@ -0,0 +1,39 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+//
+// Created by agent on 2026/10/18.
+//
+
+#pragma once
+
+#include <stdint.h>
+
+namespace common {
+
+/**
+ * @brief 开销很小的计时器，用来统计执行计划中每个算子的耗时
+ * @details x86_64上直接读取TSC寄存器，其它平台使用steady_clock。
+ * 计时时只记录周期数，需要输出时再转换成纳秒，转换比例在第一次使用时校准。
+ */
+class CycleTimer
+{
+public:
+  /**
+   * @brief 当前的周期数，只能用来计算时间间隔
+   */
+  static uint64_t now();
+
+  /**
+   * @brief 把周期数转换成纳秒
+   */
+  static double to_nanos(uint64_t cycles);
+};
+
+}  // namespace common
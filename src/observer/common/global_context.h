@@ -17,6 +17,9 @@ See the Mulan PSL v2 for more details. */
 class BufferPoolManager;
 class DefaultHandler;
 class TrxKit;
+class TempFileManager;
+class ExchangeWorkerPool;
+class QueryCache;
 
 /**
  * @brief 放一些全局对象
@@ -27,6 +30,9 @@ struct GlobalContext
   BufferPoolManager *buffer_pool_manager_ = nullptr;
   DefaultHandler *handler_ = nullptr;
   TrxKit *trx_kit_ = nullptr;
+  TempFileManager *temp_file_manager_ = nullptr;  ///< 算子落盘使用的临时文件
+  ExchangeWorkerPool *exchange_worker_pool_ = nullptr;  ///< 并行查询使用的线程
+  QueryCache *query_cache_ = nullptr;  ///< 只读查询的结果缓存
 
   static GlobalContext &instance();
 };
@@ -25,3 +25,8 @@ See the Mulan PSL v2 for more details. */
 #define SOCKET_BUFFER_SIZE 8192
 
 #define SESSION_STAGE_NAME "SessionStage"
+
+#define QUERY_CACHE "QUERY_CACHE"
+#define QUERY_CACHE_MEMORY_LIMIT "MEMORY_LIMIT"
+#define QUERY_CACHE_RESULT_LIMIT "RESULT_LIMIT"
+#define QUERY_CACHE_MAX_ENTRIES "MAX_ENTRIES"
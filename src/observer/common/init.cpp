@@ -18,6 +18,7 @@ See the Mulan PSL v2 for more details. */
 #include "common/conf/ini.h"
 #include "common/lang/string.h"
 #include "common/log/log.h"
+#include "common/os/os.h"
 #include "common/os/path.h"
 #include "common/os/pidfile.h"
 #include "common/os/process.h"
@@ -26,13 +27,16 @@ See the Mulan PSL v2 for more details. */
 #include "common/seda/stage_factory.h"
 #include "session/session.h"
 #include "session/session_stage.h"
+#include "sql/operator/exchange_worker_pool.h"
 #include "sql/executor/execute_stage.h"
 #include "sql/optimizer/optimize_stage.h"
 #include "sql/parser/parse_stage.h"
 #include "sql/parser/resolve_stage.h"
 #include "sql/plan_cache/plan_cache_stage.h"
+#include "sql/query_cache/query_cache.h"
 #include "sql/query_cache/query_cache_stage.h"
 #include "storage/buffer/disk_buffer_pool.h"
+#include "storage/common/temp_file.h"
 #include "storage/default/default_handler.h"
 #include "storage/trx/trx.h"
 #include "global_context.h"
@@ -173,6 +177,30 @@ int init_global_objects(ProcessParam *process_param, Ini &properties)
     LOG_ERROR("failed to init handler. rc=%s", strrc(rc));
     return -1;
   }
+
+  GCTX.temp_file_manager_ = new TempFileManager();
+  rc = GCTX.temp_file_manager_->init("miniob/tmp");
+  if (OB_FAIL(rc)) {
+    LOG_ERROR("failed to init temp file manager. rc=%s", strrc(rc));
+    return -1;
+  }
+
+  // 并行查询的片段之间通过队列相互等待，线程数多于CPU数
+  GCTX.exchange_worker_pool_ = new ExchangeWorkerPool();
+  rc = GCTX.exchange_worker_pool_->init(std::max(static_cast<int>(common::getCpuNum()) * 4, 8));
+  if (OB_FAIL(rc)) {
+    LOG_ERROR("failed to init exchange worker pool. rc=%s", strrc(rc));
+    return -1;
+  }
+
+  int64_t memory_limit = QueryCache::DEFAULT_MEMORY_LIMIT;
+  int64_t result_limit = QueryCache::DEFAULT_RESULT_LIMIT;
+  size_t  max_entries  = QueryCache::DEFAULT_MAX_ENTRIES;
+  str_to_val(properties.get(QUERY_CACHE_MEMORY_LIMIT, std::to_string(memory_limit), QUERY_CACHE), memory_limit);
+  str_to_val(properties.get(QUERY_CACHE_RESULT_LIMIT, std::to_string(result_limit), QUERY_CACHE), result_limit);
+  str_to_val(properties.get(QUERY_CACHE_MAX_ENTRIES, std::to_string(max_entries), QUERY_CACHE), max_entries);
+  GCTX.query_cache_ = new QueryCache(memory_limit, result_limit, max_entries);
+  LOG_INFO("query cache memory limit=%ld, result limit=%ld, max entries=%lu", memory_limit, result_limit, max_entries);
   return ret;
 }
 
@@ -185,6 +213,21 @@ int uninit_global_objects()
     delete default_handler;
   }
 
+  if (GCTX.query_cache_ != nullptr) {
+    delete GCTX.query_cache_;
+    GCTX.query_cache_ = nullptr;
+  }
+
+  if (GCTX.exchange_worker_pool_ != nullptr) {
+    delete GCTX.exchange_worker_pool_;
+    GCTX.exchange_worker_pool_ = nullptr;
+  }
+
+  if (GCTX.temp_file_manager_ != nullptr) {
+    delete GCTX.temp_file_manager_;
+    GCTX.temp_file_manager_ = nullptr;
+  }
+
   BufferPoolManager *bpm = &BufferPoolManager::instance();
   if (bpm != nullptr) {
     BufferPoolManager::set_instance(nullptr);
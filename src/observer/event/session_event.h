@@ -16,6 +16,7 @@ See the Mulan PSL v2 for more details. */
 
 #include <string.h>
 #include <string>
+#include <vector>
 
 #include "common/seda/stage_event.h"
 #include "sql/executor/sql_result.h"
@@ -23,6 +24,7 @@ See the Mulan PSL v2 for more details. */
 
 class Session;
 class Communicator;
+class PreparedStmt;
 
 /**
  * @brief 表示一个SQL请求
@@ -45,9 +47,22 @@ public:
 
   SqlDebug &sql_debug() { return sql_debug_; }
 
+  /**
+   * @brief 通过MySQL协议的COM_STMT_EXECUTE执行预编译的语句，不需要解析SQL
+   */
+  void set_prepared_execution(PreparedStmt *stmt, std::vector<Value> params)
+  {
+    prepared_stmt_ = stmt;
+    params_        = std::move(params);
+  }
+  PreparedStmt             *prepared_stmt() const { return prepared_stmt_; }
+  const std::vector<Value> &params() const { return params_; }
+
 private:
   Communicator *communicator_ = nullptr;  ///< 与客户端通讯的对象
   SqlResult     sql_result_;              ///< SQL执行结果
   SqlDebug      sql_debug_;               ///< SQL调试信息
   std::string   query_;                   ///< SQL语句
+  PreparedStmt *prepared_stmt_ = nullptr; ///< 执行的预编译语句，不是预编译语句时为空
+  std::vector<Value> params_;             ///< 预编译语句的参数
 };
@@ -18,6 +18,7 @@ See the Mulan PSL v2 for more details. */
 
 #include "event/session_event.h"
 #include "sql/parser/parse_defs.h"
+#include "sql/plan_cache/plan_cache.h"
 #include "sql/stmt/stmt.h"
 
 SQLStageEvent::SQLStageEvent(SessionEvent *event, const std::string &sql) : session_event_(event), sql_(sql)
@@ -34,3 +35,8 @@ SQLStageEvent::~SQLStageEvent() noexcept
     stmt_ = nullptr;
   }
 }
+
+void SQLStageEvent::set_cached_plan(std::unique_ptr<CachedPlan> plan)
+{
+  cached_plan_ = std::move(plan);
+}
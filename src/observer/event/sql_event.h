@@ -16,12 +16,15 @@ See the Mulan PSL v2 for more details. */
 
 #include <string>
 #include <memory>
+#include "common/mm/arena.h"
+#include "common/mm/memory_tracker.h"
 #include "common/seda/stage_event.h"
 #include "sql/operator/physical_operator.h"
 
 class SessionEvent;
 class Stmt;
 class ParsedSqlNode;
+class CachedPlan;
 
 /**
  * @brief 与SessionEvent类似，也是处理SQL请求的事件，只是用在SQL的不同阶段
@@ -75,10 +78,35 @@ public:
     operator_ = std::move(oper);
   }
 
+  /**
+   * @brief 执行预编译语句时没有命中缓存，生成的执行计划保存到这里，执行之后放到缓存中，见 PlanCacheStage
+   */
+  void set_cached_plan(std::unique_ptr<CachedPlan> plan);
+  std::unique_ptr<CachedPlan> &cached_plan() { return cached_plan_; }
+
+  /**
+   * @brief 这个查询使用的内存，执行计划中的算子都记录在这里
+   */
+  common::MemoryTracker &memory_tracker()
+  {
+    return memory_tracker_;
+  }
+
+  /**
+   * @brief 这个查询使用的内存区域，算子中的Arena从这里获取内存，查询结束时一次释放
+   */
+  common::QueryArena &query_arena()
+  {
+    return query_arena_;
+  }
+
 private:
   SessionEvent *session_event_ = nullptr;
   std::string sql_;  ///< 处理的SQL语句
   std::unique_ptr<ParsedSqlNode> sql_node_;  ///< 语法解析后的SQL命令
   Stmt *stmt_ = nullptr;  ///< Resolver之后生成的数据结构
+  std::unique_ptr<CachedPlan> cached_plan_;  ///< 预编译语句的参数保存在这里，在执行计划之后析构
+  common::MemoryTracker memory_tracker_;  ///< 在执行计划之后销毁，算子析构时会释放记录的内存
+  common::QueryArena query_arena_{&memory_tracker_};  ///< 在执行计划之后、memory_tracker_之前销毁
   std::unique_ptr<PhysicalOperator> operator_; ///< 生成的执行计划，也可能没有
 };
@@ -12,7 +12,11 @@ See the Mulan PSL v2 for more details. */
 // Created by Wangyunlai on 2022/11/22.
 //
 
+#include <errno.h>
+#include <float.h>
+#include <stdlib.h>
 #include <string.h>
+#include <cmath>
 #include <vector>
 
 #include "common/log/log.h"
@@ -20,7 +24,9 @@ See the Mulan PSL v2 for more details. */
 #include "net/mysql_communicator.h"
 #include "net/buffered_writer.h"
 #include "event/session_event.h"
+#include "session/session.h"
 #include "sql/operator/string_list_physical_operator.h"
+#include "sql/plan_cache/prepared_stmt.h"
 
 /**
  * @brief MySQL协议相关实现
@@ -278,6 +284,57 @@ int store_lenenc_string(char *buf, const char *s)
   return pos + len;
 }
 
+/**
+ * @brief 从网络包中按照MySQL协议读取数据
+ * @details 与store函数对应，读取的数据超出包的长度时返回false
+ * @ingroup MySQLProtocol
+ */
+class PacketReader
+{
+public:
+  PacketReader(const std::vector<char> &packet, int pos) : packet_(packet), pos_(pos) {}
+
+  bool read_bytes(void *value, int len)
+  {
+    if (len < 0 || pos_ + len > static_cast<int>(packet_.size())) {
+      return false;
+    }
+    memcpy(value, packet_.data() + pos_, len);
+    pos_ += len;
+    return true;
+  }
+
+  bool read_lenenc_int(uint64_t &value)
+  {
+    uint8_t first = 0;
+    if (!read_bytes(&first, 1)) {
+      return false;
+    }
+
+    value = 0;
+    switch (first) {
+      case 0xFC: return read_bytes(&value, 2);
+      case 0xFD: return read_bytes(&value, 3);
+      case 0xFE: return read_bytes(&value, 8);
+      default: value = first; return first < 0xFB;
+    }
+  }
+
+  bool read_lenenc_string(std::string &value)
+  {
+    uint64_t len = 0;
+    if (!read_lenenc_int(len) || len > packet_.size()) {
+      return false;
+    }
+    value.resize(len);
+    return read_bytes(value.data(), static_cast<int>(len));
+  }
+
+private:
+  const std::vector<char> &packet_;
+  int                      pos_ = 0;
+};
+
 /**
  * @brief 每个包都有一个包头
  * @details [MySQL Basic Packet](https://dev.mysql.com/doc/dev/mysql-server/latest/page_protocol_basic_packets.html)
@@ -542,6 +599,173 @@ RC decode_query_packet(std::vector<char> &net_packet, QueryPacket &query_packet)
   return RC::SUCCESS;
 }
 
+/**
+ * @brief 编码一个列定义包的内容，不包含包头
+ * @details [Column Definition](https://dev.mysql.com/doc/dev/mysql-server/latest/page_protocol_com_query_response_text_resultset_column_definition.html)
+ * @ingroup MySQLProtocol
+ */
+int store_column_definition(char *buf, const char *table, const char *name, int type)
+{
+  const char *catalog = "def";  // The catalog used. Currently always "def"
+  const char *schema = "sys";   // schema name
+  int fixed_len_fields = 0x0c;
+  int character_set = 33;
+  int column_length = 16384;
+  int16_t flags = 0;
+  int8_t decimals = (type == MYSQL_TYPE_LONG || type == MYSQL_TYPE_TINY) ? 0 : 0x1f;
+
+  int pos = 0;
+  pos += store_lenenc_string(buf + pos, catalog);
+  pos += store_lenenc_string(buf + pos, schema);
+  pos += store_lenenc_string(buf + pos, table);
+  pos += store_lenenc_string(buf + pos, table);  // org_table
+  pos += store_lenenc_string(buf + pos, name);
+  pos += store_lenenc_string(buf + pos, name);   // org_name
+  pos += store_lenenc_int(buf + pos, fixed_len_fields);
+  store_int2(buf + pos, character_set);
+  pos += 2;
+  store_int4(buf + pos, column_length);
+  pos += 4;
+  store_int1(buf + pos, type);
+  pos += 1;
+  store_int2(buf + pos, flags);
+  pos += 2;
+  store_int1(buf + pos, decimals);
+  pos += 1;
+  store_int2(buf + pos, 0);  // 按照mariadb的文档描述，最后还有一个unused字段int<2>，不过mysql的文档没有给出这样的描述
+  pos += 2;
+  return pos;
+}
+
+/**
+ * @brief 把double类型的参数转换成FLOATS
+ * @details 与SQL文本中的浮点数一样按照float保存，精度会降低，但是超出float范围的值返回错误
+ * @ingroup MySQLProtocol
+ */
+RC double_to_value(double v, Value &value)
+{
+  if (!std::isfinite(v) || std::fabs(v) > FLT_MAX) {
+    LOG_WARN("parameter out of float range. value=%g", v);
+    return RC::INVALID_ARGUMENT;
+  }
+  value = Value(static_cast<float>(v));
+  return RC::SUCCESS;
+}
+
+/**
+ * @brief 按照二进制协议读取一个预编译语句的参数
+ * @details [Binary Protocol Value](https://dev.mysql.com/doc/dev/mysql-server/latest/page_protocol_binary_resultset.html)
+ * 只支持可以转换成整数、浮点数和字符串的类型，超出INTS和FLOATS范围的数值返回RC::INVALID_ARGUMENT
+ * @ingroup MySQLProtocol
+ */
+RC decode_binary_value(PacketReader &reader, uint8_t type, bool is_unsigned, Value &value)
+{
+  switch (type) {
+    case MYSQL_TYPE_TINY: {
+      int8_t v = 0;
+      if (!reader.read_bytes(&v, 1)) {
+        return RC::INVALID_ARGUMENT;
+      }
+      value = Value(is_unsigned ? static_cast<int>(static_cast<uint8_t>(v)) : static_cast<int>(v));
+    } break;
+    case MYSQL_TYPE_SHORT:
+    case MYSQL_TYPE_YEAR: {
+      int16_t v = 0;
+      if (!reader.read_bytes(&v, 2)) {
+        return RC::INVALID_ARGUMENT;
+      }
+      value = Value(is_unsigned ? static_cast<int>(static_cast<uint16_t>(v)) : static_cast<int>(v));
+    } break;
+    case MYSQL_TYPE_LONG:
+    case MYSQL_TYPE_INT24: {
+      int32_t v = 0;
+      if (!reader.read_bytes(&v, 4)) {
+        return RC::INVALID_ARGUMENT;
+      }
+      if (is_unsigned && v < 0) {
+        LOG_WARN("parameter out of int range. value=%u", static_cast<uint32_t>(v));
+        return RC::INVALID_ARGUMENT;
+      }
+      value = Value(static_cast<int>(v));
+    } break;
+    case MYSQL_TYPE_LONGLONG: {
+      int64_t v = 0;
+      if (!reader.read_bytes(&v, 8)) {
+        return RC::INVALID_ARGUMENT;
+      }
+      if ((is_unsigned && static_cast<uint64_t>(v) > INT32_MAX) ||
+          (!is_unsigned && (v < INT32_MIN || v > INT32_MAX))) {
+        LOG_WARN("parameter out of int range. value=%s",
+                 is_unsigned ? std::to_string(static_cast<uint64_t>(v)).c_str() : std::to_string(v).c_str());
+        return RC::INVALID_ARGUMENT;
+      }
+      value = Value(static_cast<int>(v));
+    } break;
+    case MYSQL_TYPE_FLOAT: {
+      float v = 0;
+      if (!reader.read_bytes(&v, 4)) {
+        return RC::INVALID_ARGUMENT;
+      }
+      value = Value(v);
+    } break;
+    case MYSQL_TYPE_DOUBLE: {
+      double v = 0;
+      if (!reader.read_bytes(&v, 8)) {
+        return RC::INVALID_ARGUMENT;
+      }
+      return double_to_value(v, value);
+    }
+    case MYSQL_TYPE_NEWDECIMAL:
+    case MYSQL_TYPE_DECIMAL: {
+      std::string str;
+      if (!reader.read_lenenc_string(str)) {
+        return RC::INVALID_ARGUMENT;
+      }
+
+      char  *end = nullptr;
+      errno = 0;
+      const double v = strtod(str.c_str(), &end);
+      if (str.empty() || *end != '\0' || errno == ERANGE) {
+        LOG_WARN("invalid decimal parameter. value=%s", str.c_str());
+        return RC::INVALID_ARGUMENT;
+      }
+      return double_to_value(v, value);
+    }
+    case MYSQL_TYPE_VARCHAR:
+    case MYSQL_TYPE_VAR_STRING:
+    case MYSQL_TYPE_STRING:
+    case MYSQL_TYPE_TINY_BLOB:
+    case MYSQL_TYPE_MEDIUM_BLOB:
+    case MYSQL_TYPE_LONG_BLOB:
+    case MYSQL_TYPE_BLOB: {
+      std::string str;
+      if (!reader.read_lenenc_string(str)) {
+        return RC::INVALID_ARGUMENT;
+      }
+      value = Value(str.c_str(), static_cast<int>(str.length()));
+    } break;
+    default: {
+      LOG_WARN("unsupported parameter type %d", type);
+      return RC::UNIMPLENMENT;
+    }
+  }
+  return RC::SUCCESS;
+}
+
+/**
+ * @brief 二进制协议中结果集每列的类型，由第一行数据确定，没有数据时都作为字符串
+ * @ingroup MySQLProtocol
+ */
+int binary_column_type(const Value &value)
+{
+  switch (value.attr_type()) {
+    case INTS: return MYSQL_TYPE_LONG;
+    case FLOATS: return MYSQL_TYPE_FLOAT;
+    case BOOLEANS: return MYSQL_TYPE_TINY;
+    default: return MYSQL_TYPE_VAR_STRING;
+  }
+}
+
 /**
  * @brief MySQL客户端连接时会发起一个"select @@version_comment"的查询，这里对这个查询进行特殊处理
  * @param[out] sql_result 生成的结果
@@ -681,6 +905,19 @@ RC MysqlCommunicator::read_event(SessionEvent *&event)
 
     event = new SessionEvent(this);
     event->set_query(query_packet.query);
+  } else if (command_type == 0x16) {  // COM_STMT_PREPARE，预编译一个SQL
+    return handle_stmt_prepare(buf);
+  } else if (command_type == 0x17) {  // COM_STMT_EXECUTE，执行预编译的SQL
+    return handle_stmt_execute(buf, event);
+  } else if (command_type == 0x19) {  // COM_STMT_CLOSE，删除预编译的SQL，不需要回复
+    PacketReader reader(buf, 1);
+    uint32_t stmt_id = 0;
+    if (reader.read_bytes(&stmt_id, 4)) {
+      session_->remove_prepared_stmt(stmt_id);
+      stmt_param_types_.erase(stmt_id);
+    }
+  } else if (command_type == 0x18) {  // COM_STMT_SEND_LONG_DATA，不需要回复
+    LOG_WARN("long data of prepared statement is not supported. addr=%s", addr());
   } else {
     /// 其它的非文本请求，暂时不支持
     OkPacket ok_packet(sequence_id_);
@@ -694,6 +931,134 @@ RC MysqlCommunicator::read_event(SessionEvent *&event)
   return rc;
 }
 
+/**
+ * @brief 预编译一个SQL，返回语句的编号和参数的个数
+ * @details [COM_STMT_PREPARE](https://dev.mysql.com/doc/dev/mysql-server/latest/page_protocol_com_stmt_prepare.html)
+ * 结果的列在执行时才能确定，这里返回的列数为0，客户端在执行时从结果集中获取列的信息
+ */
+RC MysqlCommunicator::handle_stmt_prepare(const std::vector<char> &buf)
+{
+  const std::string sql(buf.data() + 1, buf.size() - 1);
+
+  std::unique_ptr<ParsedSqlNode> sql_node;
+  int param_num = 0;
+  RC rc = PreparedStmt::parse(sql, sql_node, param_num);
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to prepare sql. sql=%s, rc=%s", sql.c_str(), strrc(rc));
+    SessionEvent session_event(this);
+    session_event.sql_result()->set_return_code(rc);
+    session_event.sql_result()->set_state_string("Failed to prepare sql");
+    bool need_disconnect = false;
+    return write_state(&session_event, need_disconnect);
+  }
+
+  PreparedStmt *stmt = session_->add_prepared_stmt("", sql, param_num);
+
+  std::vector<char> net_packet(1024);
+  char *net_buf = net_packet.data();
+  int pos = 3;
+  pos += store_int1(net_buf + pos, sequence_id_++);
+  pos += store_int1(net_buf + pos, 0x00);  // status: OK
+  pos += store_int4(net_buf + pos, static_cast<int32_t>(stmt->id()));
+  pos += store_int2(net_buf + pos, 0);  // num_columns
+  pos += store_int2(net_buf + pos, static_cast<int16_t>(param_num));
+  pos += store_int1(net_buf + pos, 0x00);  // reserved
+  pos += store_int2(net_buf + pos, 0);  // warning_count
+  if (client_capabilities_flag_ & CLIENT_OPTIONAL_RESULTSET_METADATA) {
+    pos += store_int1(net_buf + pos, static_cast<int>(ResultSetMetaData::RESULTSET_METADATA_FULL));
+  }
+  store_int3(net_buf, pos - 4);
+  rc = writer_->writen(net_buf, pos);
+
+  // 每个参数一个列定义，参数的类型在执行时由客户端指定
+  for (int i = 0; OB_SUCC(rc) && i < param_num; i++) {
+    pos = 3;
+    pos += store_int1(net_buf + pos, sequence_id_++);
+    pos += store_column_definition(net_buf + pos, "", "?", MYSQL_TYPE_VAR_STRING);
+    store_int3(net_buf, pos - 4);
+    rc = writer_->writen(net_buf, pos);
+  }
+
+  if (OB_SUCC(rc) && param_num > 0 && !(client_capabilities_flag_ & CLIENT_DEPRECATE_EOF)) {
+    EofPacket eof_packet(sequence_id_++);
+    rc = send_packet(eof_packet);
+  }
+
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to send prepare response to client. addr=%s, rc=%s", addr(), strrc(rc));
+    return rc;
+  }
+  writer_->flush();
+  return rc;
+}
+
+/**
+ * @brief 解析执行预编译SQL的请求，生成执行的事件
+ * @details [COM_STMT_EXECUTE](https://dev.mysql.com/doc/dev/mysql-server/latest/page_protocol_com_stmt_execute.html)
+ * 参数的类型只在第一次执行或者客户端重新绑定参数时发送，需要记录下来
+ */
+RC MysqlCommunicator::handle_stmt_execute(const std::vector<char> &buf, SessionEvent *&event)
+{
+  PacketReader reader(buf, 1);
+  uint32_t stmt_id = 0;
+  int8_t   flags = 0;
+  uint32_t iteration_count = 0;
+
+  RC rc = RC::SUCCESS;
+  PreparedStmt *stmt = nullptr;
+  std::vector<Value> params;
+  if (!reader.read_bytes(&stmt_id, 4) || !reader.read_bytes(&flags, 1) || !reader.read_bytes(&iteration_count, 4)) {
+    rc = RC::INVALID_ARGUMENT;
+  } else if (nullptr == (stmt = session_->find_prepared_stmt(stmt_id))) {
+    rc = RC::NOTFOUND;
+  } else if (stmt->param_num() > 0) {
+    const int param_num = stmt->param_num();
+    std::vector<uint8_t> null_bitmap((param_num + 7) / 8);
+    int8_t new_params_bound = 0;
+    if (!reader.read_bytes(null_bitmap.data(), null_bitmap.size()) || !reader.read_bytes(&new_params_bound, 1)) {
+      rc = RC::INVALID_ARGUMENT;
+    }
+
+    // 每个参数的类型占两个字节：类型和是否为无符号数
+    std::vector<uint8_t> &types = stmt_param_types_[stmt_id];
+    if (OB_SUCC(rc) && new_params_bound == 1) {
+      types.resize(param_num * 2);
+      if (!reader.read_bytes(types.data(), types.size())) {
+        rc = RC::INVALID_ARGUMENT;
+      }
+    }
+    if (OB_SUCC(rc) && static_cast<int>(types.size()) != param_num * 2) {
+      rc = RC::INVALID_ARGUMENT;
+    }
+
+    for (int i = 0; OB_SUCC(rc) && i < param_num; i++) {
+      if (null_bitmap[i / 8] & (1 << (i % 8))) {
+        LOG_WARN("null parameter is not supported");
+        rc = RC::UNIMPLENMENT;
+        break;
+      }
+
+      Value value;
+      rc = decode_binary_value(reader, types[i * 2], (types[i * 2 + 1] & 0x80) != 0, value);
+      params.emplace_back(std::move(value));
+    }
+  }
+
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to decode execute packet. stmt id=%u, addr=%s, rc=%s", stmt_id, addr(), strrc(rc));
+    SessionEvent session_event(this);
+    session_event.sql_result()->set_return_code(rc);
+    session_event.sql_result()->set_state_string("Failed to execute prepared statement");
+    bool need_disconnect = false;
+    return write_state(&session_event, need_disconnect);
+  }
+
+  event = new SessionEvent(this);
+  event->set_query(stmt->sql());
+  event->set_prepared_execution(stmt, std::move(params));
+  return RC::SUCCESS;
+}
+
 RC MysqlCommunicator::write_state(SessionEvent *event, bool &need_disconnect)
 {
   SqlResult *sql_result = event->sql_result();
@@ -768,19 +1133,42 @@ RC MysqlCommunicator::write_result(SessionEvent *event, bool &need_disconnect)
 
     const TupleSchema &tuple_schema = sql_result->tuple_schema();
     const int cell_num = tuple_schema.cell_num();
+
+    // 执行预编译语句时使用二进制协议返回结果，列定义中需要给出每列的类型，先读取第一行来确定类型
+    // https://dev.mysql.com/doc/dev/mysql-server/latest/page_protocol_binary_resultset.html
+    std::vector<int> column_types;
+    Tuple *first_tuple = nullptr;
+    if (event->prepared_stmt() != nullptr && cell_num > 0) {
+      rc = sql_result->next_tuple(first_tuple);
+      if (rc != RC::SUCCESS && rc != RC::RECORD_EOF) {
+        sql_result->close();
+        sql_result->set_return_code(rc);
+        return write_state(event, need_disconnect);
+      }
+
+      Value value;
+      for (int i = 0; i < cell_num; i++) {
+        if (first_tuple != nullptr && OB_SUCC(first_tuple->cell_at(i, value))) {
+          column_types.push_back(binary_column_type(value));
+        } else {
+          column_types.push_back(MYSQL_TYPE_VAR_STRING);
+        }
+      }
+    }
+
     if (cell_num == 0) {
       // maybe a dml that send nothing to client
     } else {
 
       // send metadata : Column Definition
-      rc = send_column_definition(sql_result, need_disconnect);
+      rc = send_column_definition(sql_result, column_types, need_disconnect);
       if (rc != RC::SUCCESS) {
         sql_result->close();
         return rc;
       }
     }
 
-    rc = send_result_rows(sql_result, cell_num == 0, need_disconnect);
+    rc = send_result_rows(sql_result, column_types, first_tuple, cell_num == 0, need_disconnect);
   }
 
   RC close_rc = sql_result->close();
@@ -818,7 +1206,8 @@ RC MysqlCommunicator::send_packet(const BasePacket &packet)
  * 先发送当前有多少个列
  * 然后发送N个包，告诉客户端每个列的信息
  */
-RC MysqlCommunicator::send_column_definition(SqlResult *sql_result, bool &need_disconnect)
+RC MysqlCommunicator::send_column_definition(
+    SqlResult *sql_result, const std::vector<int> &column_types, bool &need_disconnect)
 {
   RC rc = RC::SUCCESS;
   const TupleSchema &tuple_schema = sql_result->tuple_schema();
@@ -868,39 +1257,8 @@ RC MysqlCommunicator::send_column_definition(SqlResult *sql_result, bool &need_d
     pos += 1;
 
     const TupleCellSpec &spec = tuple_schema.cell_at(i);
-    const char *catalog = "def";  // The catalog used. Currently always "def"
-    const char *schema = "sys";   // schema name
-    const char *table = spec.table_name();
-    const char *org_table = spec.table_name();
-    const char *name = spec.alias();
-    // const char *org_name = spec.field_name();
-    const char *org_name = spec.alias();
-    int fixed_len_fields = 0x0c;
-    int character_set = 33;
-    int column_length = 16384;
-    int type = MYSQL_TYPE_VAR_STRING;
-    int16_t flags = 0;
-    int8_t decimals = 0x1f;
-
-    pos += store_lenenc_string(buf + pos, catalog);
-    pos += store_lenenc_string(buf + pos, schema);
-    pos += store_lenenc_string(buf + pos, table);
-    pos += store_lenenc_string(buf + pos, org_table);
-    pos += store_lenenc_string(buf + pos, name);
-    pos += store_lenenc_string(buf + pos, org_name);
-    pos += store_lenenc_int(buf + pos, fixed_len_fields);
-    store_int2(buf + pos, character_set);
-    pos += 2;
-    store_int4(buf + pos, column_length);
-    pos += 4;
-    store_int1(buf + pos, type);
-    pos += 1;
-    store_int2(buf + pos, flags);
-    pos += 2;
-    store_int1(buf + pos, decimals);
-    pos += 1;
-    store_int2(buf + pos, 0);  // 按照mariadb的文档描述，最后还有一个unused字段int<2>，不过mysql的文档没有给出这样的描述
-    pos += 2;
+    const int type = column_types.empty() ? MYSQL_TYPE_VAR_STRING : column_types[i];
+    pos += store_column_definition(buf + pos, spec.table_name(), spec.alias(), type);
 
     payload_length = pos - 4;
     store_int3(buf, payload_length);
@@ -938,15 +1296,20 @@ RC MysqlCommunicator::send_column_definition(SqlResult *sql_result, bool &need_d
  * @param no_column_def 为了特殊处理没有返回值的语句，比如insert/delete，需要做特殊处理。
  *                      这种语句只需要返回一个ok packet即可
  */
-RC MysqlCommunicator::send_result_rows(SqlResult *sql_result, bool no_column_def, bool &need_disconnect)
+RC MysqlCommunicator::send_result_rows(SqlResult *sql_result, const std::vector<int> &column_types,
+    Tuple *first_tuple, bool no_column_def, bool &need_disconnect)
 {
   RC rc = RC::SUCCESS;
   std::vector<char> packet;
   packet.resize(4 * 1024 * 1024);  // TODO warning: length cannot be fix
 
+  // 二进制协议已经读取了第一行，first_tuple为空表示没有数据
+  const bool binary = !column_types.empty();
+  bool eof = binary && first_tuple == nullptr;
+
   int affected_rows = 0;
-  Tuple *tuple = nullptr;
-  while (RC::SUCCESS == (rc = sql_result->next_tuple(tuple))) {
+  Tuple *tuple = first_tuple;
+  for (; !eof && (tuple != nullptr || RC::SUCCESS == (rc = sql_result->next_tuple(tuple))); tuple = nullptr) {
     assert(tuple != nullptr);
 
     affected_rows++;
@@ -965,6 +1328,15 @@ RC MysqlCommunicator::send_result_rows(SqlResult *sql_result, bool no_column_def
     pos += 3;
     pos += store_int1(buf + pos, sequence_id_++);
 
+    if (binary) {
+      // 二进制协议的行以0x00开头，然后是NULL的位图，前两位保留，当前没有NULL
+      // https://dev.mysql.com/doc/dev/mysql-server/latest/page_protocol_binary_resultset.html#sect_protocol_binary_resultset_row
+      pos += store_int1(buf + pos, 0x00);
+      const int null_bitmap_len = (cell_num + 7 + 2) / 8;
+      memset(buf + pos, 0, null_bitmap_len);
+      pos += null_bitmap_len;
+    }
+
     Value value;
     for (int i = 0; i < cell_num; i++) {
       rc = tuple->cell_at(i, value);
@@ -973,7 +1345,21 @@ RC MysqlCommunicator::send_result_rows(SqlResult *sql_result, bool no_column_def
         break;  // TODO send error packet
       }
 
-      pos += store_lenenc_string(buf + pos, value.to_string().c_str());
+      if (!binary) {
+        pos += store_lenenc_string(buf + pos, value.to_string().c_str());
+        continue;
+      }
+
+      switch (column_types[i]) {
+        case MYSQL_TYPE_LONG: pos += store_int4(buf + pos, value.get_int()); break;
+        case MYSQL_TYPE_TINY: pos += store_int1(buf + pos, value.get_boolean() ? 1 : 0); break;
+        case MYSQL_TYPE_FLOAT: {
+          const float f = value.get_float();
+          memcpy(buf + pos, &f, sizeof(f));
+          pos += sizeof(f);
+        } break;
+        default: pos += store_lenenc_string(buf + pos, value.to_string().c_str()); break;
+      }
     }
 
     int payload_length = pos - 4;
@@ -14,10 +14,14 @@ See the Mulan PSL v2 for more details. */
 
 #pragma once
 
+#include <map>
+#include <vector>
+
 #include "net/communicator.h"
 
 class SqlResult;
 class BasePacket;
+class Tuple;
 
 /**
  * @brief 与客户端通讯
@@ -70,18 +74,22 @@ private:
    * @brief 返回客户端列描述信息
    * @details 根据MySQL text protocol 描述，普通的结果分为列信息描述和行数据。
    * 这里就分为两个函数
+   * @param column_types 二进制协议中每列的类型，文本协议时为空
    */
-  RC send_column_definition(SqlResult *sql_result, bool &need_disconnect);
+  RC send_column_definition(SqlResult *sql_result, const std::vector<int> &column_types, bool &need_disconnect);
 
   /**
    * @brief 返回客户端行数据
    * 
    * @param[in] sql_result 返回的结果
+   * @param column_types 二进制协议中每列的类型，不为空时按照二进制协议发送
+   * @param first_tuple 二进制协议中已经读取的第一行
    * @param no_column_def 是否没有列描述信息
    * @param[out] need_disconnect 是否需要断开连接
    * @return RC 
    */
-  RC send_result_rows(SqlResult *sql_result, bool no_column_def, bool &need_disconnect);
+  RC send_result_rows(SqlResult *sql_result, const std::vector<int> &column_types, Tuple *first_tuple,
+      bool no_column_def, bool &need_disconnect);
 
   /**
    * @brief 根据实际测试，客户端在连接上来时，会发起一个 version_comment的查询
@@ -89,6 +97,13 @@ private:
    */
   RC handle_version_comment(bool &need_disconnect);
 
+  /**
+   * @brief 处理预编译语句的请求：COM_STMT_PREPARE 和 COM_STMT_EXECUTE
+   * @details 预编译的语句保存在会话中，执行时通过 PlanCacheStage 使用缓存的执行计划
+   */
+  RC handle_stmt_prepare(const std::vector<char> &buf);
+  RC handle_stmt_execute(const std::vector<char> &buf, SessionEvent *&event);
+
 private:
   //! 握手阶段(鉴权)，需要做一些特殊处理，所以加个字段单独标记
   bool authed_ = false;
@@ -99,4 +114,7 @@ private:
   //! 在一次通讯过程中(一个任务的请求与处理)，每个包(packet)都有一个sequence id
   //! 这个sequence id是递增的
   int8_t sequence_id_ = 0;
+
+  //! 预编译语句参数的类型，客户端只在第一次执行时发送
+  std::map<uint32_t, std::vector<uint8_t>> stmt_param_types_;
 };
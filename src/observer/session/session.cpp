@@ -17,6 +17,7 @@ See the Mulan PSL v2 for more details. */
 #include "storage/db/db.h"
 #include "storage/default/default_handler.h"
 #include "common/global_context.h"
+#include "sql/plan_cache/prepared_stmt.h"
 
 Session &Session::default_session()
 {
@@ -24,7 +25,12 @@ Session &Session::default_session()
   return session;
 }
 
-Session::Session(const Session &other) : db_(other.db_)
+Session::Session(const Session &other)
+    : db_(other.db_),
+      execution_mode_(other.execution_mode_),
+      operator_memory_limit_(other.operator_memory_limit_),
+      query_memory_limit_(other.query_memory_limit_),
+      parallel_workers_(other.parallel_workers_)
 {}
 
 Session::~Session()
@@ -35,6 +41,50 @@ Session::~Session()
   }
 }
 
+PreparedStmt *Session::add_prepared_stmt(const std::string &name, const std::string &sql, int param_num)
+{
+  if (!name.empty()) {
+    remove_prepared_stmt(name);
+  }
+
+  const uint32_t id = next_prepared_stmt_id_++;
+  auto stmt = std::make_unique<PreparedStmt>(id, name, sql, param_num);
+  PreparedStmt *result = stmt.get();
+  prepared_stmts_.emplace(id, std::move(stmt));
+  return result;
+}
+
+PreparedStmt *Session::find_prepared_stmt(const std::string &name) const
+{
+  for (const auto &pair : prepared_stmts_) {
+    if (pair.second->name() == name) {
+      return pair.second.get();
+    }
+  }
+  return nullptr;
+}
+
+PreparedStmt *Session::find_prepared_stmt(uint32_t id) const
+{
+  auto iter = prepared_stmts_.find(id);
+  return iter == prepared_stmts_.end() ? nullptr : iter->second.get();
+}
+
+RC Session::remove_prepared_stmt(const std::string &name)
+{
+  PreparedStmt *stmt = find_prepared_stmt(name);
+  if (stmt == nullptr) {
+    return RC::NOTFOUND;
+  }
+  prepared_stmts_.erase(stmt->id());
+  return RC::SUCCESS;
+}
+
+RC Session::remove_prepared_stmt(uint32_t id)
+{
+  return prepared_stmts_.erase(id) > 0 ? RC::SUCCESS : RC::NOTFOUND;
+}
+
 const char *Session::get_current_db_name() const
 {
   if (db_ != nullptr)
@@ -14,11 +14,26 @@ See the Mulan PSL v2 for more details. */
 
 #pragma once
 
+#include <stdint.h>
+#include <map>
+#include <memory>
 #include <string>
 
+#include "common/rc.h"
+
 class Trx;
 class Db;
 class SessionEvent;
+class PreparedStmt;
+
+/**
+ * @brief 查询的执行方式
+ */
+enum class ExecutionMode
+{
+  TUPLE_ITERATOR,  ///< 火山模型，算子之间每次传递一行数据
+  CHUNK_ITERATOR,  ///< 向量化执行，算子之间每次传递一批数据(Chunk)
+};
 
 /**
  * @brief 表示会话
@@ -79,6 +94,53 @@ public:
   void set_sql_debug(bool sql_debug) { sql_debug_ = sql_debug; }
   bool sql_debug_on() const { return sql_debug_; }
 
+  void set_execution_mode(ExecutionMode mode) { execution_mode_ = mode; }
+  ExecutionMode execution_mode() const { return execution_mode_; }
+
+  /**
+   * @brief hash join等算子可以使用的内存上限(字节)，超过后将数据写到临时文件中
+   */
+  void set_operator_memory_limit(int64_t limit) { operator_memory_limit_ = limit; }
+  int64_t operator_memory_limit() const { return operator_memory_limit_; }
+
+  static constexpr int64_t DEFAULT_OPERATOR_MEMORY_LIMIT = 64 * 1024 * 1024;
+
+  /**
+   * @brief 一个查询中所有算子可以使用的内存上限(字节)
+   * @details 超过后可以写临时文件的算子写临时文件，其它算子返回错误，见 common::MemoryTracker
+   */
+  void set_query_memory_limit(int64_t limit) { query_memory_limit_ = limit; }
+  int64_t query_memory_limit() const { return query_memory_limit_; }
+
+  static constexpr int64_t DEFAULT_QUERY_MEMORY_LIMIT = 1024 * 1024 * 1024;
+
+  /**
+   * @brief 上一个语句使用内存的峰值(字节)，通过 SHOW STATUS 查看
+   */
+  void set_last_query_memory_peak(int64_t peak) { last_query_memory_peak_ = peak; }
+  int64_t last_query_memory_peak() const { return last_query_memory_peak_; }
+
+  /**
+   * @brief 查询最多使用的并行线程数，为1时不并行执行
+   */
+  void set_parallel_workers(int workers) { parallel_workers_ = workers; }
+  int parallel_workers() const { return parallel_workers_; }
+
+  /**
+   * @brief 添加一个预编译的语句，替换同名的语句
+   * @details 预编译的语句只在当前会话中可见
+   */
+  PreparedStmt *add_prepared_stmt(const std::string &name, const std::string &sql, int param_num);
+
+  /**
+   * @brief 按照名字(PREPARE语句)或者编号(MySQL协议)查找预编译的语句
+   */
+  PreparedStmt *find_prepared_stmt(const std::string &name) const;
+  PreparedStmt *find_prepared_stmt(uint32_t id) const;
+
+  RC remove_prepared_stmt(const std::string &name);
+  RC remove_prepared_stmt(uint32_t id);
+
   /**
    * @brief 将指定会话设置到线程变量中
    * 
@@ -97,4 +159,12 @@ private:
   SessionEvent *current_request_ = nullptr; ///< 当前正在处理的请求
   bool trx_multi_operation_mode_ = false;   ///< 当前事务的模式，是否多语句模式. 单语句模式自动提交
   bool sql_debug_ = false;                  ///< 是否输出SQL调试信息
+  ExecutionMode execution_mode_ = ExecutionMode::TUPLE_ITERATOR;  ///< 查询的执行方式
+  int64_t operator_memory_limit_ = DEFAULT_OPERATOR_MEMORY_LIMIT;  ///< 单个算子可以使用的内存
+  int64_t query_memory_limit_ = DEFAULT_QUERY_MEMORY_LIMIT;  ///< 一个查询可以使用的内存
+  int64_t last_query_memory_peak_ = 0;
+  int parallel_workers_ = 1;  ///< 并行执行的线程数
+
+  std::map<uint32_t, std::unique_ptr<PreparedStmt>> prepared_stmts_;  ///< 按照编号保存的预编译语句
+  uint32_t next_prepared_stmt_id_ = 1;
 };
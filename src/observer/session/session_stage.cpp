@@ -101,12 +101,25 @@ void SessionStage::handle_request(StageEvent *event)
   Session::set_current_session(sev->session());
   sev->session()->set_current_request(sev);
   SQLStageEvent sql_event(sev, sql);
+  common::MemoryTracker &memory_tracker = sql_event.memory_tracker();
+  memory_tracker.set_limit(sev->session()->query_memory_limit());
+  common::MemoryTracker::set_current(&memory_tracker);
+  common::QueryArena::set_current(&sql_event.query_arena());
   (void)handle_sql(&sql_event);
 
   Communicator *communicator = sev->get_communicator();
   bool need_disconnect = false;
   RC rc = communicator->write_result(sev, need_disconnect);
   LOG_INFO("write result return %s", strrc(rc));
+
+  // 执行计划中的算子会访问memory_tracker和query_arena，需要在sql_event销毁之前释放
+  sev->sql_result()->reset_operator();
+  common::QueryArena::set_current(nullptr);
+  common::MemoryTracker::set_current(nullptr);
+  sev->session()->set_last_query_memory_peak(memory_tracker.peak());
+  if (memory_tracker.peak() > 0) {
+    LOG_INFO("query memory peak=%ld, limit=%ld", memory_tracker.peak(), memory_tracker.limit());
+  }
   if (need_disconnect) {
     Server::close_connection(communicator);
   }
@@ -132,9 +145,35 @@ RC SessionStage::handle_sql(SQLStageEvent *sql_event)
     return rc;
   }
 
-  rc = parse_stage_.handle_request(sql_event);
-  if (OB_FAIL(rc)) {
-    LOG_TRACE("failed to do parse. rc=%s", strrc(rc));
+  SessionEvent *session_event = sql_event->session_event();
+  if (session_event->sql_result()->has_operator()) {
+    // 命中了查询缓存
+    return rc;
+  }
+
+  if (session_event->prepared_stmt() != nullptr) {
+    // MySQL协议中执行预编译的语句，不需要解析
+    rc = plan_cache_stage_.execute(sql_event, session_event->prepared_stmt(), session_event->params());
+    if (OB_FAIL(rc)) {
+      LOG_TRACE("failed to execute prepared statement. rc=%s", strrc(rc));
+      return rc;
+    }
+  } else {
+    rc = parse_stage_.handle_request(sql_event);
+    if (OB_FAIL(rc)) {
+      LOG_TRACE("failed to do parse. rc=%s", strrc(rc));
+      return rc;
+    }
+
+    rc = plan_cache_stage_.handle_request(sql_event);
+    if (OB_FAIL(rc)) {
+      LOG_TRACE("failed to do plan cache. rc=%s", strrc(rc));
+      return rc;
+    }
+  }
+
+  if (session_event->sql_result()->has_operator()) {
+    // 命中了执行计划缓存
     return rc;
   }
 
@@ -156,5 +195,13 @@ RC SessionStage::handle_sql(SQLStageEvent *sql_event)
     return rc;
   }
 
+  rc = query_cache_stage_.add_result(sql_event);
+  if (OB_FAIL(rc)) {
+    LOG_TRACE("failed to add query result to cache. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  rc = plan_cache_stage_.add_plan(sql_event);
+
   return rc;
 }
@@ -18,6 +18,7 @@ See the Mulan PSL v2 for more details. */
 #include "sql/query_cache/query_cache_stage.h"
 #include "sql/parser/parse_stage.h"
 #include "sql/parser/resolve_stage.h"
+#include "sql/plan_cache/plan_cache_stage.h"
 #include "sql/optimizer/optimize_stage.h"
 #include "sql/executor/execute_stage.h"
 
@@ -59,6 +60,7 @@ protected:
 private:
   QueryCacheStage query_cache_stage_;
   ParseStage      parse_stage_;
+  PlanCacheStage  plan_cache_stage_;
   ResolveStage    resolve_stage_;
   OptimizeStage   optimize_stage_;
   ExecuteStage    execute_stage_;
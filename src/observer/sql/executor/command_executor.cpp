@@ -18,12 +18,15 @@ See the Mulan PSL v2 for more details. */
 #include "sql/executor/create_index_executor.h"
 #include "sql/executor/create_table_executor.h"
 #include "sql/executor/desc_table_executor.h"
+#include "sql/executor/analyze_table_executor.h"
 #include "sql/executor/help_executor.h"
 #include "sql/executor/show_tables_executor.h"
+#include "sql/executor/show_status_executor.h"
 #include "sql/executor/trx_begin_executor.h"
 #include "sql/executor/trx_end_executor.h"
 #include "sql/executor/set_variable_executor.h"
 #include "sql/executor/load_data_executor.h"
+#include "sql/executor/prepare_executor.h"
 #include "common/log/log.h"
 
 RC CommandExecutor::execute(SQLStageEvent *sql_event)
@@ -46,6 +49,11 @@ RC CommandExecutor::execute(SQLStageEvent *sql_event)
       return executor.execute(sql_event);
     }
 
+    case StmtType::ANALYZE_TABLE: {
+      AnalyzeTableExecutor executor;
+      return executor.execute(sql_event);
+    }
+
     case StmtType::HELP: {
       HelpExecutor executor;
       return executor.execute(sql_event);
@@ -56,6 +64,11 @@ RC CommandExecutor::execute(SQLStageEvent *sql_event)
       return executor.execute(sql_event);
     }
 
+    case StmtType::SHOW_STATUS: {
+      ShowStatusExecutor executor;
+      return executor.execute(sql_event);
+    }
+
     case StmtType::BEGIN: {
       TrxBeginExecutor executor;
       return executor.execute(sql_event);
@@ -72,6 +85,16 @@ RC CommandExecutor::execute(SQLStageEvent *sql_event)
       return executor.execute(sql_event);
     }
 
+    case StmtType::PREPARE: {
+      PrepareExecutor executor;
+      return executor.execute(sql_event);
+    }
+
+    case StmtType::DEALLOCATE: {
+      DeallocateExecutor executor;
+      return executor.execute(sql_event);
+    }
+
     case StmtType::LOAD_DATA: {
       LoadDataExecutor executor;
       return executor.execute(sql_event);
@@ -18,6 +18,7 @@ See the Mulan PSL v2 for more details. */
 #include "event/session_event.h"
 #include "session/session.h"
 #include "common/log/log.h"
+#include "storage/db/db.h"
 #include "storage/table/table.h"
 
 RC CreateIndexExecutor::execute(SQLStageEvent *sql_event)
@@ -31,5 +32,10 @@ RC CreateIndexExecutor::execute(SQLStageEvent *sql_event)
   
   Trx *trx = session->current_trx();
   Table *table = create_index_stmt->table();
-  return table->create_index(trx, create_index_stmt->field_meta(), create_index_stmt->index_name().c_str());
+  RC rc = table->create_index(trx, create_index_stmt->field_meta(), create_index_stmt->index_name().c_str());
+  if (OB_SUCC(rc)) {
+    // 缓存的执行计划没有考虑新的索引，需要重新生成
+    session->get_current_db()->increase_schema_version();
+  }
+  return rc;
 }
\ No newline at end of file
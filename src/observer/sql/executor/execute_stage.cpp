@@ -69,6 +69,20 @@ RC ExecuteStage::handle_request_with_physical_operator(SQLStageEvent *sql_event)
       SelectStmt *select_stmt = static_cast<SelectStmt *>(stmt);
       bool with_table_name = select_stmt->tables().size() > 1;
 
+      if (select_stmt->has_aggregation()) {
+        for (const unique_ptr<Expression> &expr : select_stmt->query_expressions()) {
+          if (expr->type() != ExprType::FIELD) {
+            schema.append_cell(expr->name().c_str());
+          } else if (with_table_name) {
+            const Field &field = static_cast<FieldExpr *>(expr.get())->field();
+            schema.append_cell(field.table_name(), field.field_name());
+          } else {
+            schema.append_cell(static_cast<FieldExpr *>(expr.get())->field().field_name());
+          }
+        }
+        break;
+      }
+
       for (const Field &field : select_stmt->query_fields()) {
         if (with_table_name) {
           schema.append_cell(field.table_name(), field.field_name());
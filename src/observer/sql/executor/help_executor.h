@@ -35,9 +35,11 @@ public:
   {
     const char *strings[] = {
         "show tables;",
+        "show status;",
         "desc `table name`;",
         "create table `table name` (`column name` `column type`, ...);",
         "create index `index name` on `table` (`column`);",
+        "analyze table `table name`;",
         "insert into `table` values(`value1`,`value2`);",
         "update `table` set column=value [where `column`=`value`];",
         "delete from `table` [where `column`=`value`];",
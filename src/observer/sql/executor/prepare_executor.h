@@ -0,0 +1,72 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#pragma once
+
+#include "common/rc.h"
+#include "common/log/log.h"
+#include "event/sql_event.h"
+#include "event/session_event.h"
+#include "session/session.h"
+#include "sql/plan_cache/prepared_stmt.h"
+#include "sql/stmt/prepare_stmt.h"
+
+/**
+ * @brief PREPARE语句执行器
+ * @ingroup Executor
+ * @details 检查SQL能否预编译，然后保存到会话中。执行计划在第一次执行时生成，见 PlanCacheStage
+ */
+class PrepareExecutor
+{
+public:
+  PrepareExecutor() = default;
+  virtual ~PrepareExecutor() = default;
+
+  RC execute(SQLStageEvent *sql_event)
+  {
+    Session *session = sql_event->session_event()->session();
+    PrepareStmt *stmt = static_cast<PrepareStmt *>(sql_event->stmt());
+
+    std::unique_ptr<ParsedSqlNode> sql_node;
+    int param_num = 0;
+    RC rc = PreparedStmt::parse(stmt->sql(), sql_node, param_num);
+    if (OB_FAIL(rc)) {
+      LOG_WARN("failed to prepare sql. name=%s, sql=%s, rc=%s", stmt->name().c_str(), stmt->sql().c_str(), strrc(rc));
+      return rc;
+    }
+
+    session->add_prepared_stmt(stmt->name(), stmt->sql(), param_num);
+    LOG_TRACE("prepare sql. name=%s, param num=%d", stmt->name().c_str(), param_num);
+    return RC::SUCCESS;
+  }
+};
+
+/**
+ * @brief DEALLOCATE PREPARE语句执行器
+ * @ingroup Executor
+ */
+class DeallocateExecutor
+{
+public:
+  DeallocateExecutor() = default;
+  virtual ~DeallocateExecutor() = default;
+
+  RC execute(SQLStageEvent *sql_event)
+  {
+    Session *session = sql_event->session_event()->session();
+    DeallocateStmt *stmt = static_cast<DeallocateStmt *>(sql_event->stmt());
+    return session->remove_prepared_stmt(stmt->name());
+  }
+};
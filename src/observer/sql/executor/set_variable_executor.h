@@ -49,6 +49,36 @@ public:
 
       session->set_sql_debug(bool_value);
       LOG_TRACE("set sql_debug to %d", bool_value);
+    } else if (strcasecmp(var_name, "execution_mode") == 0) {
+      ExecutionMode mode = ExecutionMode::TUPLE_ITERATOR;
+      rc = var_value_to_execution_mode(var_value, mode);
+      if (rc != RC::SUCCESS) {
+        return rc;
+      }
+
+      session->set_execution_mode(mode);
+      LOG_TRACE("set execution_mode to %d", static_cast<int>(mode));
+    } else if (strcasecmp(var_name, "operator_memory_limit") == 0) {
+      if (var_value.attr_type() != AttrType::INTS || var_value.get_int() <= 0) {
+        return RC::VARIABLE_NOT_VALID;
+      }
+
+      session->set_operator_memory_limit(var_value.get_int());
+      LOG_TRACE("set operator_memory_limit to %d", var_value.get_int());
+    } else if (strcasecmp(var_name, "query_memory_limit") == 0) {
+      if (var_value.attr_type() != AttrType::INTS || var_value.get_int() <= 0) {
+        return RC::VARIABLE_NOT_VALID;
+      }
+
+      session->set_query_memory_limit(var_value.get_int());
+      LOG_TRACE("set query_memory_limit to %d", var_value.get_int());
+    } else if (strcasecmp(var_name, "parallel_workers") == 0) {
+      if (var_value.attr_type() != AttrType::INTS || var_value.get_int() <= 0) {
+        return RC::VARIABLE_NOT_VALID;
+      }
+
+      session->set_parallel_workers(var_value.get_int());
+      LOG_TRACE("set parallel_workers to %d", var_value.get_int());
     } else {
       rc = RC::VARIABLE_NOT_EXISTS;
     }
@@ -57,6 +87,23 @@ public:
   }
 
 private:
+  RC var_value_to_execution_mode(const Value &var_value, ExecutionMode &mode) const
+  {
+    if (var_value.attr_type() != AttrType::CHARS) {
+      return RC::VARIABLE_NOT_VALID;
+    }
+
+    std::string str = var_value.get_string();
+    if (strcasecmp(str.c_str(), "tuple_iterator") == 0) {
+      mode = ExecutionMode::TUPLE_ITERATOR;
+    } else if (strcasecmp(str.c_str(), "chunk_iterator") == 0) {
+      mode = ExecutionMode::CHUNK_ITERATOR;
+    } else {
+      return RC::VARIABLE_NOT_VALID;
+    }
+    return RC::SUCCESS;
+  }
+
   RC var_value_to_boolean(const Value &var_value, bool &bool_value) const
   {
     RC rc = RC::SUCCESS;
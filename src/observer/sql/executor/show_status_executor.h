@@ -0,0 +1,72 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#pragma once
+
+#include <string>
+
+#include "common/global_context.h"
+#include "common/rc.h"
+#include "event/session_event.h"
+#include "event/sql_event.h"
+#include "session/session.h"
+#include "sql/executor/sql_result.h"
+#include "sql/operator/string_list_physical_operator.h"
+#include "sql/query_cache/query_cache.h"
+
+/**
+ * @brief 显示服务端统计信息的执行器
+ * @ingroup Executor
+ * @details 包括查询缓存的统计信息和当前会话上一个语句使用内存的峰值，名字参考了MySQL
+ */
+class ShowStatusExecutor
+{
+public:
+  ShowStatusExecutor() = default;
+  virtual ~ShowStatusExecutor() = default;
+
+  RC execute(SQLStageEvent *sql_event)
+  {
+    QueryCacheStats stats;
+    if (GCTX.query_cache_ != nullptr) {
+      stats = GCTX.query_cache_->stats();
+    }
+
+    const std::pair<const char *, int64_t> variables[] = {
+        {"Qcache_hits", stats.hits},
+        {"Qcache_misses", stats.misses},
+        {"Qcache_inserts", stats.inserts},
+        {"Qcache_lowmem_prunes", stats.evictions},
+        {"Qcache_invalidations", stats.invalidations},
+        {"Qcache_queries_in_cache", stats.entries},
+        {"Qcache_memory_used", stats.memory_size},
+        {"Last_query_memory_peak", sql_event->session_event()->session()->last_query_memory_peak()},
+    };
+
+    auto oper = new StringListPhysicalOperator;
+    for (const auto &[name, value] : variables) {
+      oper->append({name, std::to_string(value)});
+    }
+
+    TupleSchema schema;
+    schema.append_cell("Variable_name");
+    schema.append_cell("Value");
+
+    SqlResult *sql_result = sql_event->session_event()->sql_result();
+    sql_result->set_tuple_schema(schema);
+    sql_result->set_operator(std::unique_ptr<PhysicalOperator>(oper));
+    return RC::SUCCESS;
+  }
+};
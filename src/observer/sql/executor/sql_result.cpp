@@ -17,10 +17,17 @@ See the Mulan PSL v2 for more details. */
 #include "session/session.h"
 #include "storage/trx/trx.h"
 #include "common/log/log.h"
+#include "sql/plan_cache/plan_cache.h"
+#include "sql/query_cache/query_cache.h"
 
 SqlResult::SqlResult(Session *session) : session_(session)
 {}
 
+SqlResult::~SqlResult()
+{
+  reset_operator();
+}
+
 void SqlResult::set_tuple_schema(const TupleSchema &schema)
 {
   tuple_schema_ = schema;
@@ -47,7 +54,11 @@ RC SqlResult::close()
     LOG_WARN("failed to close operator. rc=%s", strrc(rc));
   }
 
-  operator_.reset();
+  if (rc == RC::SUCCESS && cached_plan_ != nullptr) {
+    cached_plan_->return_operator(std::move(operator_));
+    plan_cache_->release(std::move(cached_plan_));
+  }
+  reset_operator();
 
   if (session_ && !session_->is_trx_multi_operation_mode()) {
     if (rc == RC::SUCCESS) {
@@ -59,6 +70,11 @@ RC SqlResult::close()
       }
     }
   }
+
+  if (rc == RC::SUCCESS && query_result_ != nullptr && query_result_complete_) {
+    query_cache_->insert(query_cache_key_, std::move(query_result_));
+  }
+  query_result_.reset();
   return rc;
 }
 
@@ -66,13 +82,56 @@ RC SqlResult::next_tuple(Tuple *&tuple)
 {
   RC rc = operator_->next();
   if (rc != RC::SUCCESS) {
+    query_result_complete_ = (rc == RC::RECORD_EOF);
     return rc;
   }
 
   tuple = operator_->current_tuple();
+  if (query_result_ != nullptr) {
+    cache_tuple(*tuple);
+  }
   return rc;
 }
 
+void SqlResult::cache_tuple(const Tuple &tuple)
+{
+  std::vector<Value> row(tuple.cell_num());
+  for (int i = 0; i < tuple.cell_num(); i++) {
+    if (OB_FAIL(tuple.cell_at(i, row[i]))) {
+      query_result_.reset();
+      return;
+    }
+    // 字符串可能引用的是记录中的数据
+    row[i].make_owned();
+  }
+
+  query_result_->append_row(std::move(row));
+  if (query_result_->memory_size() > query_cache_->result_limit()) {
+    LOG_TRACE("query result is too large to cache. memory size=%ld", query_result_->memory_size());
+    query_result_.reset();
+  }
+}
+
+void SqlResult::set_query_cache(QueryCache *query_cache, const std::string &key, std::unique_ptr<QueryResult> result)
+{
+  query_cache_           = query_cache;
+  query_cache_key_       = key;
+  query_result_          = std::move(result);
+  query_result_complete_ = false;
+}
+
+void SqlResult::set_cached_plan(PlanCache *plan_cache, std::unique_ptr<CachedPlan> plan)
+{
+  plan_cache_  = plan_cache;
+  cached_plan_ = std::move(plan);
+}
+
+void SqlResult::reset_operator()
+{
+  operator_.reset();
+  cached_plan_.reset();
+}
+
 void SqlResult::set_operator(std::unique_ptr<PhysicalOperator> oper)
 {
   ASSERT(operator_ == nullptr, "current operator is not null. Result is not closed?");
@@ -21,6 +21,10 @@ See the Mulan PSL v2 for more details. */
 #include "sql/operator/physical_operator.h"
 
 class Session;
+class CachedPlan;
+class PlanCache;
+class QueryCache;
+class QueryResult;
 
 /**
  * @brief SQL执行结果
@@ -33,8 +37,7 @@ class SqlResult
 {
 public:
   SqlResult(Session *session);
-  ~SqlResult()
-  {}
+  ~SqlResult();
 
   void set_tuple_schema(const TupleSchema &schema);
   void set_return_code(RC rc)
@@ -52,6 +55,24 @@ public:
   {
     return operator_ != nullptr;
   }
+  PhysicalOperator *get_operator() const { return operator_.get(); }
+
+  /**
+   * @brief 执行计划来自执行计划缓存
+   * @details 执行成功关闭后把执行计划放回缓存，否则丢弃
+   */
+  void set_cached_plan(PlanCache *plan_cache, std::unique_ptr<CachedPlan> plan);
+
+  /**
+   * @brief 把返回的结果保存到查询缓存中
+   * @details 返回了所有的行并且执行成功，在close时放到缓存中。结果超过缓存的大小限制时不再保存
+   */
+  void set_query_cache(QueryCache *query_cache, const std::string &key, std::unique_ptr<QueryResult> result);
+
+  /**
+   * @brief 丢弃没有关闭的执行计划，比如执行出错没有打开的计划
+   */
+  void reset_operator();
   const TupleSchema &tuple_schema() const
   {
     return tuple_schema_;
@@ -69,8 +90,17 @@ public:
   RC close();
   RC next_tuple(Tuple *&tuple);
 
+private:
+  void cache_tuple(const Tuple &tuple);
+
 private:
   Session *session_ = nullptr; ///< 当前所属会话
+  PlanCache *plan_cache_ = nullptr;
+  std::unique_ptr<CachedPlan> cached_plan_;  ///< 执行计划所属的缓存项，在operator_之后析构
+  QueryCache *query_cache_ = nullptr;
+  std::string query_cache_key_;
+  std::unique_ptr<QueryResult> query_result_;  ///< 正在收集的查询结果
+  bool query_result_complete_ = false;  ///< 已经返回了所有的行
   std::unique_ptr<PhysicalOperator> operator_;  ///< 执行计划
   TupleSchema tuple_schema_;   ///< 返回的表头信息。可能有也可能没有
   RC return_code_ = RC::SUCCESS;
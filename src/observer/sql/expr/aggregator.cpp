@@ -0,0 +1,238 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#include "sql/expr/aggregator.h"
+#include "storage/common/chunk.h"
+#include "common/log/log.h"
+
+/**
+ * @brief 没有任何输入时，除COUNT外的聚合结果
+ * @details miniob 当前没有NULL类型，这里使用字符串表示
+ */
+static void set_null_result(Value &result)
+{
+  result.set_string("NULL");
+}
+
+RC Aggregator::accumulate(const Chunk &chunk, const Column &column)
+{
+  RC rc = RC::SUCCESS;
+  const int rows = chunk.active_rows();
+  for (int i = 0; i < rows && OB_SUCC(rc); i++) {
+    rc = accumulate(column.get_value(chunk.active_row(i)));
+  }
+  return rc;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+RC CountAggregator::accumulate(const Value &value)
+{
+  count_++;
+  return RC::SUCCESS;
+}
+
+RC CountAggregator::accumulate(const Chunk &chunk, const Column &column)
+{
+  count_ += chunk.active_rows();
+  return RC::SUCCESS;
+}
+
+RC CountAggregator::evaluate(Value &result)
+{
+  result.set_int(static_cast<int>(count_));
+  return RC::SUCCESS;
+}
+
+RC CountAggregator::partial_evaluate(Value *values)
+{
+  return evaluate(values[0]);
+}
+
+RC CountAggregator::merge(const Value *values)
+{
+  count_ += values[0].get_int();
+  return RC::SUCCESS;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void SumAggregator::add(const Value &value)
+{
+  if (value.attr_type() == INTS && attr_type_ != FLOATS) {
+    attr_type_ = INTS;
+    int_sum_ += value.get_int();
+  } else {
+    if (attr_type_ == INTS) {
+      float_sum_ += static_cast<double>(int_sum_);
+      int_sum_ = 0;
+    }
+    attr_type_ = FLOATS;
+    float_sum_ += value.get_float();
+  }
+}
+
+RC SumAggregator::accumulate(const Value &value)
+{
+  add(value);
+  count_++;
+  return RC::SUCCESS;
+}
+
+RC SumAggregator::accumulate(const Chunk &chunk, const Column &column)
+{
+  const int rows = chunk.active_rows();
+  if (column.attr_type() == INTS && attr_type_ != FLOATS) {
+    attr_type_ = INTS;
+    if (column.column_type() == Column::Type::CONSTANT_COLUMN) {
+      int_sum_ += static_cast<int64_t>(*(const int *)column.data()) * rows;
+    } else {
+      const int *data = (const int *)column.data();
+      int64_t sum = 0;
+      if (chunk.has_selection()) {
+        for (int i = 0; i < rows; i++) {
+          sum += data[chunk.active_row(i)];
+        }
+      } else {
+        for (int i = 0; i < rows; i++) {
+          sum += data[i];
+        }
+      }
+      int_sum_ += sum;
+    }
+    count_ += rows;
+    return RC::SUCCESS;
+  }
+
+  if (column.attr_type() == FLOATS && column.column_type() == Column::Type::NORMAL_COLUMN) {
+    if (attr_type_ == INTS) {
+      float_sum_ += static_cast<double>(int_sum_);
+      int_sum_ = 0;
+    }
+    attr_type_ = FLOATS;
+    const float *data = (const float *)column.data();
+    double sum = 0;
+    for (int i = 0; i < rows; i++) {
+      sum += data[chunk.active_row(i)];
+    }
+    float_sum_ += sum;
+    count_ += rows;
+    return RC::SUCCESS;
+  }
+
+  return Aggregator::accumulate(chunk, column);
+}
+
+RC SumAggregator::evaluate(Value &result)
+{
+  if (count_ == 0) {
+    set_null_result(result);
+  } else if (attr_type_ == INTS) {
+    result.set_int(static_cast<int>(int_sum_));
+  } else {
+    result.set_float(static_cast<float>(float_sum_));
+  }
+  return RC::SUCCESS;
+}
+
+/**
+ * 没有累加过任何值时，中间状态是UNDEFINED，合并时跳过
+ */
+RC SumAggregator::partial_evaluate(Value *values)
+{
+  if (count_ == 0) {
+    values[0] = Value();
+  } else if (attr_type_ == INTS) {
+    values[0].set_int(static_cast<int>(int_sum_));
+  } else {
+    values[0].set_float(static_cast<float>(float_sum_));
+  }
+  return RC::SUCCESS;
+}
+
+RC SumAggregator::merge(const Value *values)
+{
+  if (values[0].attr_type() != UNDEFINED) {
+    add(values[0]);
+    count_++;
+  }
+  return RC::SUCCESS;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+RC AvgAggregator::evaluate(Value &result)
+{
+  if (count_ == 0) {
+    set_null_result(result);
+    return RC::SUCCESS;
+  }
+
+  double sum = (attr_type_ == INTS) ? static_cast<double>(int_sum_) : float_sum_;
+  result.set_float(static_cast<float>(sum / count_));
+  return RC::SUCCESS;
+}
+
+RC AvgAggregator::partial_evaluate(Value *values)
+{
+  SumAggregator::partial_evaluate(values);
+  values[1].set_int(static_cast<int>(count_));
+  return RC::SUCCESS;
+}
+
+RC AvgAggregator::merge(const Value *values)
+{
+  if (values[0].attr_type() != UNDEFINED) {
+    add(values[0]);
+    count_ += values[1].get_int();
+  }
+  return RC::SUCCESS;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+RC MinMaxAggregator::accumulate(const Value &value)
+{
+  if (!has_value_) {
+    value_     = value;
+    has_value_ = true;
+    return RC::SUCCESS;
+  }
+
+  int cmp = value.compare(value_);
+  if ((is_max_ && cmp > 0) || (!is_max_ && cmp < 0)) {
+    value_ = value;
+  }
+  return RC::SUCCESS;
+}
+
+RC MinMaxAggregator::evaluate(Value &result)
+{
+  if (!has_value_) {
+    set_null_result(result);
+  } else {
+    result = value_;
+  }
+  return RC::SUCCESS;
+}
+
+RC MinMaxAggregator::partial_evaluate(Value *values)
+{
+  values[0] = has_value_ ? value_ : Value();
+  return RC::SUCCESS;
+}
+
+RC MinMaxAggregator::merge(const Value *values)
+{
+  if (values[0].attr_type() == UNDEFINED) {
+    return RC::SUCCESS;
+  }
+  return accumulate(values[0]);
+}
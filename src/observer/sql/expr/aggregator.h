@@ -0,0 +1,125 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#pragma once
+
+#include <stdint.h>
+
+#include "common/rc.h"
+#include "sql/parser/value.h"
+
+class Chunk;
+class Column;
+
+/**
+ * @brief 聚合器，保存一个聚合函数的中间状态
+ * @ingroup Expression
+ * @details 每个聚合函数(以及分组聚合中的每个分组)对应一个聚合器。
+ * 可以逐个值累加，也可以一次累加一列数据(向量化执行)。
+ * 两阶段聚合时，第一阶段通过partial_evaluate输出中间状态，第二阶段通过merge合并中间状态。
+ */
+class Aggregator
+{
+public:
+  virtual ~Aggregator() = default;
+
+  virtual RC accumulate(const Value &value) = 0;
+
+  /**
+   * @brief 累加chunk中所有有效行的值
+   * @param column 聚合参数的计算结果，与chunk的物理行一一对应
+   */
+  virtual RC accumulate(const Chunk &chunk, const Column &column);
+
+  /**
+   * @brief 获取聚合结果
+   */
+  virtual RC evaluate(Value &result) = 0;
+
+  /**
+   * @brief 输出中间状态
+   * @param values 中间状态的值，个数是 AggregateExpr::partial_value_num
+   */
+  virtual RC partial_evaluate(Value *values) = 0;
+
+  /**
+   * @brief 合并另一个聚合器通过partial_evaluate输出的中间状态
+   */
+  virtual RC merge(const Value *values) = 0;
+};
+
+class CountAggregator : public Aggregator
+{
+public:
+  RC accumulate(const Value &value) override;
+  RC accumulate(const Chunk &chunk, const Column &column) override;
+  RC evaluate(Value &result) override;
+  RC partial_evaluate(Value *values) override;
+  RC merge(const Value *values) override;
+
+private:
+  int64_t count_ = 0;
+};
+
+class SumAggregator : public Aggregator
+{
+public:
+  RC accumulate(const Value &value) override;
+  RC accumulate(const Chunk &chunk, const Column &column) override;
+  RC evaluate(Value &result) override;
+  RC partial_evaluate(Value *values) override;
+  RC merge(const Value *values) override;
+
+protected:
+  /**
+   * @brief 累加到和中，不增加计数
+   */
+  void add(const Value &value);
+
+protected:
+  AttrType attr_type_   = UNDEFINED;  ///< 第一个值的类型，整数累加时保持整数类型
+  int64_t  int_sum_     = 0;
+  double   float_sum_   = 0;
+  int64_t  count_       = 0;
+};
+
+/**
+ * @brief AVG的聚合器，中间状态是和与计数两个值
+ */
+class AvgAggregator : public SumAggregator
+{
+public:
+  RC evaluate(Value &result) override;
+  RC partial_evaluate(Value *values) override;
+  RC merge(const Value *values) override;
+};
+
+/**
+ * @brief MAX和MIN的聚合器
+ */
+class MinMaxAggregator : public Aggregator
+{
+public:
+  explicit MinMaxAggregator(bool is_max) : is_max_(is_max) {}
+
+  RC accumulate(const Value &value) override;
+  RC evaluate(Value &result) override;
+  RC partial_evaluate(Value *values) override;
+  RC merge(const Value *values) override;
+
+private:
+  bool  is_max_    = true;
+  bool  has_value_ = false;
+  Value value_;
+};
@@ -0,0 +1,845 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+//
+// Created by agent on 2026/10/18.
+//
+#include <string.h>
+#include <limits>
+
+#include "sql/expr/expr_program.h"
+#include "common/defs.h"
+#include "common/lang/comparator.h"
+#include "common/log/log.h"
+#include "sql/expr/expression.h"
+#include "sql/expr/tuple.h"
+#include "storage/common/chunk.h"
+
+using namespace std;
+
+using Reg     = ExprProgram::Reg;
+using Instr   = ExprProgram::Instr;
+using Handler = ExprProgram::Handler;
+
+/**
+ * @brief 执行时的状态
+ * @details 每个寄存器有rows个值，按行计算时rows是1
+ */
+struct ExprProgram::Context
+{
+  Reg         *regs      = nullptr;
+  const Reg   *constants = nullptr;
+  int          rows      = 1;
+  const Tuple *tuple     = nullptr;
+  const char  *record    = nullptr;
+  Chunk       *chunk     = nullptr;
+  Value       *boxes     = nullptr;  ///< 从tuple中读取的字符串保存在这里
+  int          pc        = 0;
+  int          end       = 0;
+  RC           rc        = RC::SUCCESS;
+};
+
+using Context = ExprProgram::Context;
+
+namespace {
+
+struct Operand
+{
+  const Reg *base;
+  int        step;  ///< 常量的step是0
+
+  const Reg &operator[](int i) const { return base[i * step]; }
+};
+
+inline Operand operand(const Context &ctx, int index)
+{
+  if (index < 0) {
+    return Operand{&ctx.constants[-index - 1], 0};
+  }
+  return Operand{ctx.regs + static_cast<size_t>(index) * ctx.rows, 1};
+}
+
+inline Reg *dest(const Context &ctx, int index) { return ctx.regs + static_cast<size_t>(index) * ctx.rows; }
+
+////////////////////////////////////////////////////////////////////////////////
+// 每种类型的取值和三路比较，与Value中的实现保持一致
+
+struct IntType
+{
+  static int compare(const Reg &l, const Reg &r) { return l.i < r.i ? -1 : (l.i > r.i ? 1 : 0); }
+  static void load(const char *data, int /*len*/, Reg &reg) { memcpy(&reg.i, data, sizeof(reg.i)); }
+  static void unbox(const Value &value, Value & /*box*/, Reg &reg) { reg.i = value.get_int(); }
+};
+
+struct FloatType
+{
+  static int compare(const Reg &l, const Reg &r)
+  {
+    float cmp = l.f - r.f;
+    return cmp > EPSILON ? 1 : (cmp < -EPSILON ? -1 : 0);
+  }
+  static void load(const char *data, int /*len*/, Reg &reg) { memcpy(&reg.f, data, sizeof(reg.f)); }
+  static void unbox(const Value &value, Value & /*box*/, Reg &reg) { reg.f = value.get_float(); }
+};
+
+struct BoolType
+{
+  static int compare(const Reg &l, const Reg &r) { return IntType::compare(l, r); }
+  static void load(const char *data, int /*len*/, Reg &reg)
+  {
+    int32_t value = 0;
+    memcpy(&value, data, sizeof(value));
+    reg.i = value != 0 ? 1 : 0;
+  }
+  static void unbox(const Value &value, Value & /*box*/, Reg &reg) { reg.i = value.get_boolean() ? 1 : 0; }
+};
+
+struct StringType
+{
+  static int compare(const Reg &l, const Reg &r)
+  {
+    return common::compare_string((void *)l.s.ptr, l.s.len, (void *)r.s.ptr, r.s.len);
+  }
+  static void load(const char *data, int len, Reg &reg)
+  {
+    reg.s.ptr = data;
+    reg.s.len = static_cast<int32_t>(strnlen(data, len));
+  }
+  static void unbox(const Value &value, Value &box, Reg &reg)
+  {
+    if (value.borrowed()) {
+      // 引用的是记录中的数据，在计算期间一直有效
+      reg.s.ptr = value.data();
+      reg.s.len = value.length();
+      return;
+    }
+    box       = value;
+    reg.s.ptr = box.data();
+    reg.s.len = box.length();
+  }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// 读取字段
+
+template <typename T>
+void load_cell(const Instr &instr, Context &ctx)
+{
+  Value value;
+  RC rc = ctx.tuple->cell_at(instr.arg, value);
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to get cell. index=%d, rc=%s", instr.arg, strrc(rc));
+    ctx.rc = rc;
+    ctx.pc = ctx.end;
+    return;
+  }
+  T::unbox(value, ctx.boxes[instr.dst], dest(ctx, instr.dst)[0]);
+}
+
+template <typename T>
+void load_record(const Instr &instr, Context &ctx)
+{
+  T::load(ctx.record + instr.arg, instr.arg_len, dest(ctx, instr.dst)[0]);
+}
+
+template <typename T>
+void load_column(const Instr &instr, Context &ctx)
+{
+  const int index = ctx.chunk->column_index(instr.arg);
+  if (index < 0) {
+    LOG_WARN("field is not bound to a chunk column. pos=%d", instr.arg);
+    ctx.rc = RC::INTERNAL;
+    ctx.pc = ctx.end;
+    return;
+  }
+
+  const Column &column = ctx.chunk->column(index);
+  Reg *d = dest(ctx, instr.dst);
+  for (int i = 0; i < ctx.rows; i++) {
+    T::load(column.value_at(i), column.attr_len(), d[i]);
+  }
+}
+
+template <typename T>
+Handler load_handler(ExprProgram::FieldSource source)
+{
+  switch (source) {
+    case ExprProgram::FieldSource::TUPLE: return load_cell<T>;
+    case ExprProgram::FieldSource::RECORD: return load_record<T>;
+    case ExprProgram::FieldSource::CHUNK: return load_column<T>;
+  }
+  return nullptr;
+}
+
+Handler load_handler(AttrType type, ExprProgram::FieldSource source)
+{
+  switch (type) {
+    case INTS: return load_handler<IntType>(source);
+    case FLOATS: return load_handler<FloatType>(source);
+    case BOOLEANS: return load_handler<BoolType>(source);
+    case CHARS: return load_handler<StringType>(source);
+    default: return nullptr;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// 比较
+
+template <CompOp OP>
+inline int32_t test_compare(int cmp)
+{
+  switch (OP) {
+    case EQUAL_TO: return cmp == 0;
+    case LESS_EQUAL: return cmp <= 0;
+    case NOT_EQUAL: return cmp != 0;
+    case LESS_THAN: return cmp < 0;
+    case GREAT_EQUAL: return cmp >= 0;
+    case GREAT_THAN: return cmp > 0;
+    default: return 0;
+  }
+}
+
+template <typename T, CompOp OP>
+void compare(const Instr &instr, Context &ctx)
+{
+  const Operand l = operand(ctx, instr.left);
+  const Operand r = operand(ctx, instr.right);
+  Reg *d = dest(ctx, instr.dst);
+  for (int i = 0; i < ctx.rows; i++) {
+    d[i].i = test_compare<OP>(T::compare(l[i], r[i]));
+  }
+}
+
+template <typename T>
+Handler compare_handler(CompOp op)
+{
+  switch (op) {
+    case EQUAL_TO: return compare<T, EQUAL_TO>;
+    case LESS_EQUAL: return compare<T, LESS_EQUAL>;
+    case NOT_EQUAL: return compare<T, NOT_EQUAL>;
+    case LESS_THAN: return compare<T, LESS_THAN>;
+    case GREAT_EQUAL: return compare<T, GREAT_EQUAL>;
+    case GREAT_THAN: return compare<T, GREAT_THAN>;
+    default: return nullptr;
+  }
+}
+
+Handler compare_handler(AttrType type, CompOp op)
+{
+  switch (type) {
+    case INTS: return compare_handler<IntType>(op);
+    case FLOATS: return compare_handler<FloatType>(op);
+    case BOOLEANS: return compare_handler<BoolType>(op);
+    case CHARS: return compare_handler<StringType>(op);
+    default: return nullptr;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// 算术运算，与 ArithmeticExpr::calc_value 一致
+
+struct AddOp
+{
+  static int32_t apply(int32_t l, int32_t r) { return l + r; }
+  static float   apply(float l, float r) { return l + r; }
+};
+
+struct SubOp
+{
+  static int32_t apply(int32_t l, int32_t r) { return l - r; }
+  static float   apply(float l, float r) { return l - r; }
+};
+
+struct MulOp
+{
+  static int32_t apply(int32_t l, int32_t r) { return l * r; }
+  static float   apply(float l, float r) { return l * r; }
+};
+
+struct DivOp
+{
+  static int32_t apply(int32_t l, int32_t r) { return r == 0 ? numeric_limits<int32_t>::max() : l / r; }
+  static float   apply(float l, float r)
+  {
+    return (r > -EPSILON && r < EPSILON) ? numeric_limits<float>::max() : l / r;
+  }
+};
+
+template <typename Op>
+void int_arithmetic(const Instr &instr, Context &ctx)
+{
+  const Operand l = operand(ctx, instr.left);
+  const Operand r = operand(ctx, instr.right);
+  Reg *d = dest(ctx, instr.dst);
+  for (int i = 0; i < ctx.rows; i++) {
+    d[i].i = Op::apply(l[i].i, r[i].i);
+  }
+}
+
+template <typename Op>
+void float_arithmetic(const Instr &instr, Context &ctx)
+{
+  const Operand l = operand(ctx, instr.left);
+  const Operand r = operand(ctx, instr.right);
+  Reg *d = dest(ctx, instr.dst);
+  for (int i = 0; i < ctx.rows; i++) {
+    d[i].f = Op::apply(l[i].f, r[i].f);
+  }
+}
+
+void int_negative(const Instr &instr, Context &ctx)
+{
+  const Operand l = operand(ctx, instr.left);
+  Reg *d = dest(ctx, instr.dst);
+  for (int i = 0; i < ctx.rows; i++) {
+    d[i].i = -l[i].i;
+  }
+}
+
+void float_negative(const Instr &instr, Context &ctx)
+{
+  const Operand l = operand(ctx, instr.left);
+  Reg *d = dest(ctx, instr.dst);
+  for (int i = 0; i < ctx.rows; i++) {
+    d[i].f = -l[i].f;
+  }
+}
+
+template <typename Op>
+Handler arithmetic_handler(AttrType type)
+{
+  return type == INTS ? int_arithmetic<Op> : float_arithmetic<Op>;
+}
+
+Handler arithmetic_handler(ArithmeticExpr::Type op, AttrType type)
+{
+  switch (op) {
+    case ArithmeticExpr::Type::ADD: return arithmetic_handler<AddOp>(type);
+    case ArithmeticExpr::Type::SUB: return arithmetic_handler<SubOp>(type);
+    case ArithmeticExpr::Type::MUL: return arithmetic_handler<MulOp>(type);
+    case ArithmeticExpr::Type::DIV: return arithmetic_handler<DivOp>(type);
+    case ArithmeticExpr::Type::NEGATIVE: return type == INTS ? int_negative : float_negative;
+    default: return nullptr;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// 类型转换、逻辑运算和跳转
+
+void int_to_float(const Instr &instr, Context &ctx)
+{
+  const Operand l = operand(ctx, instr.left);
+  Reg *d = dest(ctx, instr.dst);
+  for (int i = 0; i < ctx.rows; i++) {
+    d[i].f = static_cast<float>(l[i].i);
+  }
+}
+
+void int_to_bool(const Instr &instr, Context &ctx)
+{
+  const Operand l = operand(ctx, instr.left);
+  Reg *d = dest(ctx, instr.dst);
+  for (int i = 0; i < ctx.rows; i++) {
+    d[i].i = l[i].i != 0 ? 1 : 0;
+  }
+}
+
+void float_to_bool(const Instr &instr, Context &ctx)
+{
+  const Operand l = operand(ctx, instr.left);
+  Reg *d = dest(ctx, instr.dst);
+  for (int i = 0; i < ctx.rows; i++) {
+    d[i].i = (l[i].f >= EPSILON || l[i].f <= -EPSILON) ? 1 : 0;
+  }
+}
+
+void and_values(const Instr &instr, Context &ctx)
+{
+  const Operand l = operand(ctx, instr.left);
+  const Operand r = operand(ctx, instr.right);
+  Reg *d = dest(ctx, instr.dst);
+  for (int i = 0; i < ctx.rows; i++) {
+    d[i].i = l[i].i & r[i].i;
+  }
+}
+
+void or_values(const Instr &instr, Context &ctx)
+{
+  const Operand l = operand(ctx, instr.left);
+  const Operand r = operand(ctx, instr.right);
+  Reg *d = dest(ctx, instr.dst);
+  for (int i = 0; i < ctx.rows; i++) {
+    d[i].i = l[i].i | r[i].i;
+  }
+}
+
+/**
+ * @brief 按行计算时AND/OR的短路，一次计算一批数据时不跳转，所有的子表达式都会计算
+ */
+template <int32_t VALUE>
+void jump_if(const Instr &instr, Context &ctx)
+{
+  if (ctx.rows == 1 && operand(ctx, instr.left)[0].i == VALUE) {
+    ctx.pc = instr.arg;
+  }
+}
+
+}  // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+void ExprProgram::clear()
+{
+  result_type_  = UNDEFINED;
+  result_reg_   = -1;
+  register_num_ = 0;
+  instrs_.clear();
+  constants_.clear();
+  constant_values_.clear();
+  param_constants_.clear();
+  compiled_exprs_.clear();
+}
+
+unique_ptr<ExprProgram> ExprProgram::try_compile(Expression &expr, FieldSource source)
+{
+  auto program = make_unique<ExprProgram>();
+  if (OB_FAIL(program->compile(expr, source))) {
+    return nullptr;
+  }
+  return program;
+}
+
+RC ExprProgram::compile(Expression &expr, FieldSource source)
+{
+  clear();
+  source_ = source;
+
+  int reg = -1;
+  AttrType type = UNDEFINED;
+  RC rc = compile_expr(expr, reg, type);
+  if (OB_FAIL(rc)) {
+    clear();
+    return rc;
+  }
+
+  compiled_exprs_.clear();
+  result_reg_  = reg;
+  result_type_ = type;
+  if (instrs_.empty()) {
+    // 常量表达式，增加一个空操作，便于使用 compiled() 判断
+    emit(jump_if<-1>, -1, reg, -1);
+  }
+  regs_.resize(register_num_);
+  boxes_.resize(register_num_);
+  return RC::SUCCESS;
+}
+
+void ExprProgram::emit(Handler handler, int dst, int left, int right, int arg, int arg_len)
+{
+  Instr instr;
+  instr.handler = handler;
+  instr.dst     = dst;
+  instr.left    = left;
+  instr.right   = right;
+  instr.arg     = arg;
+  instr.arg_len = arg_len;
+  instrs_.push_back(instr);
+}
+
+int ExprProgram::add_constant(const Value &value)
+{
+  Reg reg;
+  memset(&reg, 0, sizeof(reg));
+  switch (value.attr_type()) {
+    case INTS: reg.i = value.get_int(); break;
+    case FLOATS: reg.f = value.get_float(); break;
+    case BOOLEANS: reg.i = value.get_boolean() ? 1 : 0; break;
+    case CHARS: {
+      constant_values_.push_back(value);
+      reg.s.ptr = constant_values_.back().data();
+      reg.s.len = constant_values_.back().length();
+    } break;
+    default: break;
+  }
+  constants_.push_back(reg);
+  return -static_cast<int>(constants_.size());
+}
+
+RC ExprProgram::compile_expr(Expression &expr, int &reg, AttrType &type)
+{
+  if (expr.type() == ExprType::VALUE) {
+    return compile_node(expr, reg, type);
+  }
+
+  for (const CompiledExpr &compiled : compiled_exprs_) {
+    if (compiled.expr->equal(expr)) {
+      reg  = compiled.reg;
+      type = compiled.type;
+      return RC::SUCCESS;
+    }
+  }
+
+  RC rc = compile_node(expr, reg, type);
+  if (OB_SUCC(rc)) {
+    compiled_exprs_.push_back(CompiledExpr{&expr, reg, type});
+  }
+  return rc;
+}
+
+RC ExprProgram::compile_node(Expression &expr, int &reg, AttrType &type)
+{
+  switch (expr.type()) {
+    case ExprType::FIELD: {
+      return compile_field(expr, reg, type);
+    }
+    case ExprType::VALUE: {
+      const Value &value = static_cast<ValueExpr &>(expr).get_value();
+      type = value.attr_type();
+      if (type != INTS && type != FLOATS && type != BOOLEANS && type != CHARS) {
+        return RC::UNIMPLENMENT;
+      }
+      reg = add_constant(value);
+      return RC::SUCCESS;
+    }
+    case ExprType::PARAM: {
+      auto &param_expr = static_cast<ParamExpr &>(expr);
+      type = param_expr.value_type();
+      if (type != INTS && type != FLOATS && type != BOOLEANS && type != CHARS) {
+        return RC::UNIMPLENMENT;
+      }
+      reg = add_constant(param_expr.get_value());
+      param_constants_.push_back(ParamConstant{-reg - 1, param_expr.param()});
+      return RC::SUCCESS;
+    }
+    case ExprType::CAST: {
+      auto &cast_expr = static_cast<CastExpr &>(expr);
+      if (!cast_expr.child()) {
+        return RC::UNIMPLENMENT;
+      }
+      // 与 CastExpr::cast 一致，只支持转换成布尔类型
+      if (cast_expr.value_type() != BOOLEANS && cast_expr.value_type() != cast_expr.child()->value_type()) {
+        return RC::UNIMPLENMENT;
+      }
+      AttrType child_type = UNDEFINED;
+      RC rc = compile_expr(*cast_expr.child(), reg, child_type);
+      if (OB_SUCC(rc)) {
+        rc = compile_convert(reg, child_type, cast_expr.value_type());
+        type = cast_expr.value_type();
+      }
+      return rc;
+    }
+    case ExprType::COMPARISON: {
+      type = BOOLEANS;
+      return compile_comparison(expr, reg);
+    }
+    case ExprType::CONJUNCTION: {
+      type = BOOLEANS;
+      return compile_conjunction(expr, reg);
+    }
+    case ExprType::ARITHMETIC: {
+      return compile_arithmetic(expr, reg, type);
+    }
+    default: {
+      return RC::UNIMPLENMENT;
+    }
+  }
+}
+
+RC ExprProgram::compile_field(Expression &expr, int &reg, AttrType &type)
+{
+  auto &field_expr = static_cast<FieldExpr &>(expr);
+  const FieldMeta *field_meta = field_expr.field().meta();
+  type = field_expr.value_type();
+
+  Handler handler = load_handler(type, source_);
+  if (handler == nullptr) {
+    return RC::UNIMPLENMENT;
+  }
+
+  int arg = 0;
+  switch (source_) {
+    case FieldSource::TUPLE: arg = field_expr.cell_index(); break;
+    case FieldSource::RECORD: arg = field_meta != nullptr ? field_meta->offset() : -1; break;
+    case FieldSource::CHUNK: arg = field_expr.pos(); break;
+  }
+  // 没有绑定位置的字段只能按照名字查找。按记录读取时也要求字段已经绑定到表的schema上，
+  // 避免把其它表的字段按照偏移读取
+  if (arg < 0 || (source_ == FieldSource::RECORD && field_expr.cell_index() < 0)) {
+    return RC::UNIMPLENMENT;
+  }
+
+  reg = new_register();
+  emit(handler, reg, -1, -1, arg, field_meta != nullptr ? field_meta->len() : 0);
+  return RC::SUCCESS;
+}
+
+/**
+ * @brief 转换成指定的类型，只支持整数到浮点数，以及数值到布尔
+ */
+RC ExprProgram::compile_convert(int &reg, AttrType from, AttrType to)
+{
+  if (from == to) {
+    return RC::SUCCESS;
+  }
+
+  Handler handler = nullptr;
+  if (from == INTS && to == FLOATS) {
+    handler = int_to_float;
+  } else if (to == BOOLEANS && from == INTS) {
+    handler = int_to_bool;
+  } else if (to == BOOLEANS && from == FLOATS) {
+    handler = float_to_bool;
+  } else {
+    return RC::UNIMPLENMENT;
+  }
+
+  const int dst = new_register();
+  emit(handler, dst, reg, -1);
+  reg = dst;
+  return RC::SUCCESS;
+}
+
+RC ExprProgram::compile_comparison(Expression &expr, int &reg)
+{
+  auto &comparison_expr = static_cast<ComparisonExpr &>(expr);
+  int left = -1;
+  int right = -1;
+  AttrType left_type = UNDEFINED;
+  AttrType right_type = UNDEFINED;
+  RC rc = compile_expr(*comparison_expr.left(), left, left_type);
+  if (OB_SUCC(rc)) {
+    rc = compile_expr(*comparison_expr.right(), right, right_type);
+  }
+  if (OB_FAIL(rc)) {
+    return rc;
+  }
+
+  // 与 Value::compare 一样，整数和浮点数比较时按照浮点数比较，其它不同类型之间的比较不支持
+  AttrType type = left_type;
+  if (left_type != right_type) {
+    if (left_type == INTS && right_type == FLOATS) {
+      rc = compile_convert(left, INTS, FLOATS);
+    } else if (left_type == FLOATS && right_type == INTS) {
+      rc = compile_convert(right, INTS, FLOATS);
+    } else {
+      rc = RC::UNIMPLENMENT;
+    }
+    type = FLOATS;
+  }
+  if (OB_FAIL(rc)) {
+    return rc;
+  }
+
+  Handler handler = compare_handler(type, comparison_expr.comp());
+  if (handler == nullptr) {
+    return RC::UNIMPLENMENT;
+  }
+
+  reg = new_register();
+  emit(handler, reg, left, right);
+  return RC::SUCCESS;
+}
+
+/**
+ * @details 生成的指令：
+ *   r = child0; if (r == 短路值) goto end; t = child1; r = r op t; if (r == 短路值) goto end; ...
+ */
+RC ExprProgram::compile_conjunction(Expression &expr, int &reg)
+{
+  auto &conjunction_expr = static_cast<ConjunctionExpr &>(expr);
+  const bool is_and = conjunction_expr.conjunction_type() == ConjunctionExpr::Type::AND;
+  vector<unique_ptr<Expression>> &children = conjunction_expr.children();
+  if (children.empty()) {
+    reg = add_constant(Value(true));
+    return RC::SUCCESS;
+  }
+
+  vector<size_t> jumps;
+  const int result = new_register();
+  for (size_t i = 0; i < children.size(); i++) {
+    // 除了第一个子表达式，其它的可能因为短路而不执行，其中计算的结果不能给后面的表达式使用
+    const size_t compiled_num = compiled_exprs_.size();
+    int child = -1;
+    AttrType child_type = UNDEFINED;
+    RC rc = compile_expr(*children[i], child, child_type);
+    if (OB_SUCC(rc)) {
+      rc = compile_convert(child, child_type, BOOLEANS);
+    }
+    if (OB_FAIL(rc)) {
+      return rc;
+    }
+
+    if (i == 0) {
+      emit(is_and ? and_values : or_values, result, child, child);
+    } else {
+      emit(is_and ? and_values : or_values, result, result, child);
+    }
+    if (i > 0) {
+      compiled_exprs_.resize(compiled_num);
+    }
+    if (i + 1 < children.size()) {
+      jumps.push_back(instrs_.size());
+      emit(is_and ? jump_if<0> : jump_if<1>, -1, result, -1);
+    }
+  }
+
+  for (size_t jump : jumps) {
+    instrs_[jump].arg = static_cast<int>(instrs_.size());
+  }
+  reg = result;
+  return RC::SUCCESS;
+}
+
+RC ExprProgram::compile_arithmetic(Expression &expr, int &reg, AttrType &type)
+{
+  auto &arithmetic_expr = static_cast<ArithmeticExpr &>(expr);
+  const ArithmeticExpr::Type op = arithmetic_expr.arithmetic_type();
+  type = arithmetic_expr.value_type();
+  if (type != INTS && type != FLOATS) {
+    return RC::UNIMPLENMENT;
+  }
+
+  int left = -1;
+  int right = -1;
+  AttrType left_type = UNDEFINED;
+  AttrType right_type = UNDEFINED;
+  RC rc = compile_expr(*arithmetic_expr.left(), left, left_type);
+  if (OB_SUCC(rc) && (left_type == INTS || left_type == FLOATS)) {
+    rc = compile_convert(left, left_type, type);
+  } else if (OB_SUCC(rc)) {
+    rc = RC::UNIMPLENMENT;
+  }
+  if (OB_SUCC(rc) && op != ArithmeticExpr::Type::NEGATIVE) {
+    if (!arithmetic_expr.right()) {
+      return RC::UNIMPLENMENT;
+    }
+    rc = compile_expr(*arithmetic_expr.right(), right, right_type);
+    if (OB_SUCC(rc) && (right_type == INTS || right_type == FLOATS)) {
+      rc = compile_convert(right, right_type, type);
+    } else if (OB_SUCC(rc)) {
+      rc = RC::UNIMPLENMENT;
+    }
+  }
+  if (OB_FAIL(rc)) {
+    return rc;
+  }
+
+  Handler handler = arithmetic_handler(op, type);
+  if (handler == nullptr) {
+    return RC::UNIMPLENMENT;
+  }
+  reg = new_register();
+  emit(handler, reg, left, right);
+  return RC::SUCCESS;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void ExprProgram::load_params() const
+{
+  // 同一个执行计划使用不同的参数执行，参数的类型不会变化，见 PlanCache
+  for (const ParamConstant &param_constant : param_constants_) {
+    const Value &param = *param_constant.param;
+    Reg         &reg   = constants_[param_constant.index];
+    switch (param.attr_type()) {
+      case INTS: reg.i = param.get_int(); break;
+      case FLOATS: reg.f = param.get_float(); break;
+      case BOOLEANS: reg.i = param.get_boolean() ? 1 : 0; break;
+      case CHARS: {
+        reg.s.ptr = param.data();
+        reg.s.len = param.length();
+      } break;
+      default: break;
+    }
+  }
+}
+
+void ExprProgram::run(Context &ctx) const
+{
+  load_params();
+  ctx.constants = constants_.data();
+  ctx.end       = static_cast<int>(instrs_.size());
+  ctx.pc        = 0;
+  const Instr *instrs = instrs_.data();
+  while (ctx.pc < ctx.end) {
+    const Instr &instr = instrs[ctx.pc++];
+    instr.handler(instr, ctx);
+  }
+}
+
+void ExprProgram::result_value(const Context &ctx, Value &value) const
+{
+  const Reg &reg = operand(ctx, result_reg_)[0];
+  switch (result_type_) {
+    case INTS: value.set_int(reg.i); break;
+    case FLOATS: value.set_float(reg.f); break;
+    case BOOLEANS: value.set_boolean(reg.i != 0); break;
+    case CHARS: value.set_string(reg.s.ptr, reg.s.len); break;
+    default: break;
+  }
+}
+
+RC ExprProgram::eval(const Tuple &tuple, Value &value) const
+{
+  ASSERT(source_ == FieldSource::TUPLE, "program is not compiled for tuple");
+  Context ctx;
+  ctx.regs  = regs_.data();
+  ctx.boxes = boxes_.data();
+  ctx.tuple = &tuple;
+  run(ctx);
+  if (OB_SUCC(ctx.rc)) {
+    result_value(ctx, value);
+  }
+  return ctx.rc;
+}
+
+RC ExprProgram::eval(const char *record, Value &value) const
+{
+  ASSERT(source_ == FieldSource::RECORD, "program is not compiled for record");
+  Context ctx;
+  ctx.regs   = regs_.data();
+  ctx.record = record;
+  run(ctx);
+  if (OB_SUCC(ctx.rc)) {
+    result_value(ctx, value);
+  }
+  return ctx.rc;
+}
+
+RC ExprProgram::eval(Chunk &chunk, vector<uint8_t> &select) const
+{
+  ASSERT(source_ == FieldSource::CHUNK, "program is not compiled for chunk");
+  if (result_type_ != BOOLEANS) {
+    return RC::INVALID_ARGUMENT;
+  }
+
+  const int rows = chunk.rows();
+  select.resize(rows);
+  if (rows == 0) {
+    return RC::SUCCESS;
+  }
+
+  regs_.resize(static_cast<size_t>(register_num_) * rows);
+  Context ctx;
+  ctx.regs  = regs_.data();
+  ctx.rows  = rows;
+  ctx.chunk = &chunk;
+  run(ctx);
+  if (OB_FAIL(ctx.rc)) {
+    return ctx.rc;
+  }
+
+  const Operand result = operand(ctx, result_reg_);
+  for (int i = 0; i < rows; i++) {
+    select[i] = result[i].i != 0 ? 1 : 0;
+  }
+  return RC::SUCCESS;
+}
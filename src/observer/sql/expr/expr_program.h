@@ -0,0 +1,175 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+//
+// Created by agent on 2026/10/18.
+//
+
+#pragma once
+
+#include <stdint.h>
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include "common/rc.h"
+#include "sql/parser/value.h"
+
+class Chunk;
+class Expression;
+class Tuple;
+
+/**
+ * @brief 编译后的表达式
+ * @ingroup Expression
+ * @details 表达式树按照后序遍历展开成一组指令，每条指令从寄存器中读取操作数，结果写到另一个寄存器。
+ * 编译时就确定了每个寄存器的类型，每条指令都是针对具体类型和运算的实现(由模板生成)，
+ * 执行时不再检查类型，也没有虚函数调用和中间Value的构造。
+ *
+ * 字段有三种读取方式：
+ * - TUPLE：按照绑定的位置(FieldExpr::cell_index)从tuple中读取，用于一般的算子
+ * - RECORD：按照字段在记录中的偏移直接读取，用于表扫描上的过滤条件
+ * - CHUNK：按照绑定的列(FieldExpr::pos)从chunk中读取，每条指令一次处理一批数据
+ *
+ * 支持整数、浮点数、布尔和字符串类型的字段和常量，比较运算、AND/OR、算术运算以及到布尔类型的转换，
+ * 计算结果与表达式树一致。预编译语句的参数(ParamExpr)当做常量编译，每次计算前重新读取参数的值。按行计算时AND/OR会短路。
+ * 相同的子表达式(见 Expression::equal)只计算一次，后面直接使用第一次计算结果所在的寄存器。
+ * 不支持的表达式编译失败，调用方继续使用表达式树计算。
+ */
+class ExprProgram
+{
+public:
+  enum class FieldSource
+  {
+    TUPLE,
+    RECORD,
+    CHUNK,
+  };
+
+  /**
+   * @brief 寄存器，按照编译时确定的类型使用其中一个成员，布尔值保存在i中
+   */
+  union Reg
+  {
+    int32_t i;
+    float   f;
+    struct
+    {
+      const char *ptr;
+      int32_t     len;
+    } s;
+  };
+
+  struct Instr;
+  struct Context;
+  using Handler = void (*)(const Instr &instr, Context &ctx);
+
+  struct Instr
+  {
+    Handler handler = nullptr;
+    int     dst     = -1;
+    int     left    = -1;  ///< 操作数所在的寄存器，小于0表示第(-left-1)个常量
+    int     right   = -1;
+    int     arg     = 0;   ///< 字段的位置/偏移、跳转的目标等
+    int     arg_len = 0;   ///< 字段的长度
+  };
+
+public:
+  ExprProgram() = default;
+  ~ExprProgram() = default;
+
+  ExprProgram(const ExprProgram &) = delete;
+  ExprProgram &operator=(const ExprProgram &) = delete;
+
+  /**
+   * @brief 编译表达式，失败时返回 UNIMPLENMENT，程序保持为空
+   */
+  RC compile(Expression &expr, FieldSource source);
+
+  /**
+   * @brief 编译表达式，不支持时返回空
+   */
+  static std::unique_ptr<ExprProgram> try_compile(Expression &expr, FieldSource source);
+
+  bool compiled() const { return !instrs_.empty(); }
+  void clear();
+
+  AttrType result_type() const { return result_type_; }
+  int      instr_num() const { return static_cast<int>(instrs_.size()); }
+
+  /**
+   * @brief 在一行数据上计算，字段来源是TUPLE
+   */
+  RC eval(const Tuple &tuple, Value &value) const;
+
+  /**
+   * @brief 在一条记录上计算，字段来源是RECORD
+   */
+  RC eval(const char *record, Value &value) const;
+
+  /**
+   * @brief 在chunk的每个物理行上计算谓词，字段来源是CHUNK，结果类型需要是布尔
+   * @param[out] select 每一行一个字节，非0表示满足条件
+   */
+  RC eval(Chunk &chunk, std::vector<uint8_t> &select) const;
+
+private:
+  /**
+   * @param[out] reg 结果所在的寄存器，常量表达式的结果直接使用常量
+   */
+  RC   compile_expr(Expression &expr, int &reg, AttrType &type);
+  RC   compile_node(Expression &expr, int &reg, AttrType &type);
+  RC   compile_field(Expression &expr, int &reg, AttrType &type);
+  RC   compile_comparison(Expression &expr, int &reg);
+  RC   compile_conjunction(Expression &expr, int &reg);
+  RC   compile_arithmetic(Expression &expr, int &reg, AttrType &type);
+  RC   compile_convert(int &reg, AttrType from, AttrType to);
+  int  add_constant(const Value &value);
+  void load_params() const;
+  int  new_register() { return register_num_++; }
+  void emit(Handler handler, int dst, int left, int right, int arg = 0, int arg_len = 0);
+
+  /**
+   * @brief 参数所在的常量，计算前从参数中读取
+   */
+  struct ParamConstant
+  {
+    int          index;  ///< 在constants_中的位置
+    const Value *param;
+  };
+
+  struct CompiledExpr
+  {
+    const Expression *expr;
+    int               reg;
+    AttrType          type;
+  };
+
+  void run(Context &ctx) const;
+  void result_value(const Context &ctx, Value &value) const;
+
+private:
+  FieldSource         source_      = FieldSource::TUPLE;
+  AttrType            result_type_ = UNDEFINED;
+  int                 result_reg_  = -1;
+  int                 register_num_ = 0;
+  std::vector<Instr>  instrs_;
+  mutable std::vector<Reg>   constants_;  ///< 参数所在的常量在计算前更新
+  std::vector<ParamConstant> param_constants_;
+  std::deque<Value>   constant_values_;  ///< 字符串常量的存储，deque追加时不会移动已有的元素
+
+  /// 编译时使用，已经编译的子表达式及其结果所在的寄存器。只包含一定会执行的指令计算的结果
+  std::vector<CompiledExpr> compiled_exprs_;
+
+  // 执行时使用的寄存器，按行计算时避免每次分配内存
+  mutable std::vector<Reg>   regs_;
+  mutable std::vector<Value> boxes_;
+};
@@ -12,22 +12,133 @@ See the Mulan PSL v2 for more details. */
 // Created by Wangyunlai on 2022/07/05.
 //
 
+#include <string.h>
+
 #include "sql/expr/expression.h"
 #include "sql/expr/tuple.h"
+#include "sql/expr/aggregator.h"
+#include "sql/expr/select_kernel.h"
+#include "storage/common/chunk.h"
 
 using namespace std;
 
+static bool expr_equal(const unique_ptr<Expression> &left, const unique_ptr<Expression> &right)
+{
+  if (!left || !right) {
+    return !left && !right;
+  }
+  return left->equal(*right);
+}
+
+RC Expression::eval(Chunk &chunk, vector<uint8_t> &select)
+{
+  Column column;
+  RC rc = get_column(chunk, column);
+  if (rc != RC::SUCCESS) {
+    return rc;
+  }
+
+  const int rows = chunk.rows();
+  select.resize(rows);
+  for (int i = 0; i < rows; i++) {
+    select[i] = column.get_value(i).get_boolean() ? 1 : 0;
+  }
+  return rc;
+}
+
 RC FieldExpr::get_value(const Tuple &tuple, Value &value) const
 {
+  if (cell_index_ >= 0) {
+    return tuple.cell_at(cell_index_, value);
+  }
   return tuple.find_cell(TupleCellSpec(table_name(), field_name()), value);
 }
 
+RC FieldExpr::get_column(Chunk &chunk, Column &column)
+{
+  int index = chunk.column_index(pos_);
+  if (index < 0) {
+    LOG_WARN("field is not bound to a chunk column. field=%s.%s, pos=%d", table_name(), field_name(), pos_);
+    return RC::INTERNAL;
+  }
+  column.reference(chunk.column(index));
+  return RC::SUCCESS;
+}
+
+bool FieldExpr::equal(const Expression &other) const
+{
+  if (other.type() != ExprType::FIELD) {
+    return false;
+  }
+  const auto &other_field = static_cast<const FieldExpr &>(other);
+  return field_.table() == other_field.field_.table() && 0 == strcmp(field_name(), other_field.field_name());
+}
+
+unique_ptr<Expression> FieldExpr::copy() const
+{
+  auto expr = make_unique<FieldExpr>(field_);
+  expr->set_name(name());
+  expr->pos_        = pos_;
+  expr->cell_index_ = cell_index_;
+  return expr;
+}
+
 RC ValueExpr::get_value(const Tuple &tuple, Value &value) const
 {
   value = value_;
   return RC::SUCCESS;
 }
 
+RC ValueExpr::get_column(Chunk &chunk, Column &column)
+{
+  column.init(value_, chunk.rows());
+  return RC::SUCCESS;
+}
+
+bool ValueExpr::equal(const Expression &other) const
+{
+  if (other.type() != ExprType::VALUE) {
+    return false;
+  }
+  // 按照二进制比较，避免把浮点数比较时认为相等的两个不同常量合并
+  const Value &other_value = static_cast<const ValueExpr &>(other).value_;
+  return value_.attr_type() == other_value.attr_type() && value_.length() == other_value.length() &&
+         0 == memcmp(value_.data(), other_value.data(), value_.length());
+}
+
+unique_ptr<Expression> ValueExpr::copy() const
+{
+  auto expr = make_unique<ValueExpr>(value_);
+  expr->set_name(name());
+  return expr;
+}
+
+/////////////////////////////////////////////////////////////////////////////////
+RC ParamExpr::get_value(const Tuple &tuple, Value &value) const
+{
+  value = *param_;
+  return RC::SUCCESS;
+}
+
+RC ParamExpr::get_column(Chunk &chunk, Column &column)
+{
+  column.init(*param_, chunk.rows());
+  return RC::SUCCESS;
+}
+
+bool ParamExpr::equal(const Expression &other) const
+{
+  return other.type() == ExprType::PARAM && static_cast<const ParamExpr &>(other).param_ == param_;
+}
+
+unique_ptr<Expression> ParamExpr::copy() const
+{
+  // 复制出来的表达式引用同一个参数，并行执行时每个线程都能看到绑定的值
+  auto expr = make_unique<ParamExpr>(param_);
+  expr->set_name(name());
+  return expr;
+}
+
 /////////////////////////////////////////////////////////////////////////////////
 CastExpr::CastExpr(unique_ptr<Expression> child, AttrType cast_type)
     : child_(std::move(child)), cast_type_(cast_type)
@@ -77,6 +188,46 @@ RC CastExpr::try_get_value(Value &value) const
   return cast(value, value);
 }
 
+bool CastExpr::equal(const Expression &other) const
+{
+  if (other.type() != ExprType::CAST) {
+    return false;
+  }
+  const auto &other_cast = static_cast<const CastExpr &>(other);
+  return cast_type_ == other_cast.cast_type_ && expr_equal(child_, other_cast.child_);
+}
+
+unique_ptr<Expression> CastExpr::copy() const
+{
+  auto expr = make_unique<CastExpr>(child_->copy(), cast_type_);
+  expr->set_name(name());
+  return expr;
+}
+
+RC CastExpr::get_column(Chunk &chunk, Column &column)
+{
+  Column child_column;
+  RC rc = child_->get_column(chunk, child_column);
+  if (rc != RC::SUCCESS) {
+    return rc;
+  }
+
+  const int rows = child_column.count();
+  column.init(cast_type_, cast_type_ == CHARS ? child_column.attr_len() : static_cast<int>(sizeof(int)), rows);
+  Value value;
+  for (int i = 0; i < rows; i++) {
+    rc = cast(child_column.get_value(i), value);
+    if (rc != RC::SUCCESS) {
+      return rc;
+    }
+    rc = column.append_value(value);
+    if (rc != RC::SUCCESS) {
+      return rc;
+    }
+  }
+  return rc;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 ComparisonExpr::ComparisonExpr(CompOp comp, unique_ptr<Expression> left, unique_ptr<Expression> right)
@@ -119,6 +270,17 @@ RC ComparisonExpr::compare_value(const Value &left, const Value &right, bool &re
   return rc;
 }
 
+CompOp ComparisonExpr::swap_comp(CompOp comp)
+{
+  switch (comp) {
+    case LESS_THAN: return GREAT_THAN;
+    case LESS_EQUAL: return GREAT_EQUAL;
+    case GREAT_THAN: return LESS_THAN;
+    case GREAT_EQUAL: return LESS_EQUAL;
+    default: return comp;
+  }
+}
+
 RC ComparisonExpr::try_get_value(Value &cell) const
 {
   if (left_->type() == ExprType::VALUE && right_->type() == ExprType::VALUE) {
@@ -164,6 +326,164 @@ RC ComparisonExpr::get_value(const Tuple &tuple, Value &value) const
   return rc;
 }
 
+bool ComparisonExpr::equal(const Expression &other) const
+{
+  if (other.type() != ExprType::COMPARISON) {
+    return false;
+  }
+  const auto &other_cmp = static_cast<const ComparisonExpr &>(other);
+  if (comp_ == other_cmp.comp_ && expr_equal(left_, other_cmp.left_) && expr_equal(right_, other_cmp.right_)) {
+    return true;
+  }
+  // a < b 与 b > a 相同
+  return comp_ == swap_comp(other_cmp.comp_) && expr_equal(left_, other_cmp.right_) &&
+         expr_equal(right_, other_cmp.left_);
+}
+
+unique_ptr<Expression> ComparisonExpr::copy() const
+{
+  auto expr = make_unique<ComparisonExpr>(comp_, left_->copy(), right_->copy());
+  expr->set_name(name());
+  return expr;
+}
+
+namespace {
+
+template <typename T, typename Cmp>
+void compare_loop(const T *left, int left_step, const T *right, int right_step, int rows, uint8_t *result, Cmp cmp)
+{
+  for (int i = 0; i < rows; i++) {
+    result[i] = cmp(left[i * left_step], right[i * right_step]) ? 1 : 0;
+  }
+}
+
+template <typename T>
+RC compare_numeric(CompOp comp, const T *left, int left_step, const T *right, int right_step, int rows, uint8_t *result)
+{
+  switch (comp) {
+    case EQUAL_TO: compare_loop(left, left_step, right, right_step, rows, result, [](T l, T r) { return l == r; }); break;
+    case NOT_EQUAL: compare_loop(left, left_step, right, right_step, rows, result, [](T l, T r) { return l != r; }); break;
+    case LESS_THAN: compare_loop(left, left_step, right, right_step, rows, result, [](T l, T r) { return l < r; }); break;
+    case LESS_EQUAL: compare_loop(left, left_step, right, right_step, rows, result, [](T l, T r) { return l <= r; }); break;
+    case GREAT_THAN: compare_loop(left, left_step, right, right_step, rows, result, [](T l, T r) { return l > r; }); break;
+    case GREAT_EQUAL: compare_loop(left, left_step, right, right_step, rows, result, [](T l, T r) { return l >= r; }); break;
+    default: {
+      LOG_WARN("unsupported comparison. %d", comp);
+      return RC::INTERNAL;
+    }
+  }
+  return RC::SUCCESS;
+}
+
+/**
+ * @brief 浮点数比较，与common::compare_float一样考虑EPSILON
+ */
+RC compare_float_column(
+    CompOp comp, const float *left, int left_step, const float *right, int right_step, int rows, uint8_t *result)
+{
+  constexpr float eps = EPSILON;
+  switch (comp) {
+    case EQUAL_TO: compare_loop(left, left_step, right, right_step, rows, result, [](float l, float r) { return l - r <= eps && l - r >= -eps; }); break;
+    case NOT_EQUAL: compare_loop(left, left_step, right, right_step, rows, result, [](float l, float r) { return l - r > eps || l - r < -eps; }); break;
+    case LESS_THAN: compare_loop(left, left_step, right, right_step, rows, result, [](float l, float r) { return l - r < -eps; }); break;
+    case LESS_EQUAL: compare_loop(left, left_step, right, right_step, rows, result, [](float l, float r) { return l - r <= eps; }); break;
+    case GREAT_THAN: compare_loop(left, left_step, right, right_step, rows, result, [](float l, float r) { return l - r > eps; }); break;
+    case GREAT_EQUAL: compare_loop(left, left_step, right, right_step, rows, result, [](float l, float r) { return l - r >= -eps; }); break;
+    default: {
+      LOG_WARN("unsupported comparison. %d", comp);
+      return RC::INTERNAL;
+    }
+  }
+  return RC::SUCCESS;
+}
+
+}  // namespace
+
+RC ComparisonExpr::compare_column(const Column &left, const Column &right, int rows, vector<uint8_t> &result) const
+{
+  result.resize(rows);
+
+  const int left_step  = left.column_type() == Column::Type::CONSTANT_COLUMN ? 0 : 1;
+  const int right_step = right.column_type() == Column::Type::CONSTANT_COLUMN ? 0 : 1;
+
+  // 列与常量比较是最常见的过滤条件，使用SIMD实现
+  if (comp_ != NO_OP && left.attr_type() == right.attr_type() &&
+      (left.attr_type() == INTS || left.attr_type() == FLOATS) &&
+      left_step + right_step == 1) {
+    const Column &column   = left_step == 1 ? left : right;
+    const Column &constant = left_step == 1 ? right : left;
+    const CompOp  comp     = left_step == 1 ? comp_ : select_kernel::flip_comp_op(comp_);
+
+    vector<uint8_t> bitmap((rows + 7) / 8);
+    if (column.attr_type() == INTS) {
+      select_kernel::select_int32(
+          comp, (const int32_t *)column.data(), rows, *(const int32_t *)constant.data(), bitmap.data());
+    } else {
+      select_kernel::select_float(comp, (const float *)column.data(), rows, *(const float *)constant.data(), bitmap.data());
+    }
+    for (int i = 0; i < rows; i++) {
+      result[i] = (bitmap[i / 8] >> (i % 8)) & 1;
+    }
+    return RC::SUCCESS;
+  }
+
+  if (left.attr_type() == INTS && right.attr_type() == INTS) {
+    return compare_numeric(comp_, (const int *)left.data(), left_step, (const int *)right.data(), right_step, rows, result.data());
+  }
+  if (left.attr_type() == FLOATS && right.attr_type() == FLOATS) {
+    return compare_float_column(
+        comp_, (const float *)left.data(), left_step, (const float *)right.data(), right_step, rows, result.data());
+  }
+
+  RC rc = RC::SUCCESS;
+  bool bool_value = false;
+  for (int i = 0; i < rows; i++) {
+    rc = compare_value(left.get_value(i), right.get_value(i), bool_value);
+    if (rc != RC::SUCCESS) {
+      return rc;
+    }
+    result[i] = bool_value ? 1 : 0;
+  }
+  return rc;
+}
+
+RC ComparisonExpr::eval(Chunk &chunk, vector<uint8_t> &select)
+{
+  Column left_column;
+  Column right_column;
+
+  RC rc = left_->get_column(chunk, left_column);
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to get column of left expression. rc=%s", strrc(rc));
+    return rc;
+  }
+  rc = right_->get_column(chunk, right_column);
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to get column of right expression. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  return compare_column(left_column, right_column, chunk.rows(), select);
+}
+
+RC ComparisonExpr::get_column(Chunk &chunk, Column &column)
+{
+  vector<uint8_t> select;
+  RC rc = eval(chunk, select);
+  if (rc != RC::SUCCESS) {
+    return rc;
+  }
+
+  const int rows = static_cast<int>(select.size());
+  column.init(BOOLEANS, sizeof(int), rows);
+  int *data = (int *)column.data();
+  for (int i = 0; i < rows; i++) {
+    data[i] = select[i];
+  }
+  column.set_count(rows);
+  return rc;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 ConjunctionExpr::ConjunctionExpr(Type type, vector<unique_ptr<Expression>> &children)
     : conjunction_type_(type), children_(std::move(children))
@@ -196,6 +516,81 @@ RC ConjunctionExpr::get_value(const Tuple &tuple, Value &value) const
   return rc;
 }
 
+bool ConjunctionExpr::equal(const Expression &other) const
+{
+  if (other.type() != ExprType::CONJUNCTION) {
+    return false;
+  }
+  const auto &other_conjunction = static_cast<const ConjunctionExpr &>(other);
+  if (conjunction_type_ != other_conjunction.conjunction_type_ ||
+      children_.size() != other_conjunction.children_.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < children_.size(); i++) {
+    if (!expr_equal(children_[i], other_conjunction.children_[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+unique_ptr<Expression> ConjunctionExpr::copy() const
+{
+  vector<unique_ptr<Expression>> children;
+  for (const unique_ptr<Expression> &child : children_) {
+    children.emplace_back(child->copy());
+  }
+  auto expr = make_unique<ConjunctionExpr>(conjunction_type_, children);
+  expr->set_name(name());
+  return expr;
+}
+
+RC ConjunctionExpr::eval(Chunk &chunk, vector<uint8_t> &select)
+{
+  const int rows = chunk.rows();
+  const bool is_and = (conjunction_type_ == Type::AND);
+  select.assign(rows, is_and ? 1 : 0);
+
+  RC rc = RC::SUCCESS;
+  vector<uint8_t> child_select;
+  for (unique_ptr<Expression> &expr : children_) {
+    rc = expr->eval(chunk, child_select);
+    if (rc != RC::SUCCESS) {
+      LOG_WARN("failed to eval child expression. rc=%s", strrc(rc));
+      return rc;
+    }
+
+    if (is_and) {
+      for (int i = 0; i < rows; i++) {
+        select[i] &= child_select[i];
+      }
+    } else {
+      for (int i = 0; i < rows; i++) {
+        select[i] |= child_select[i];
+      }
+    }
+  }
+  return rc;
+}
+
+RC ConjunctionExpr::get_column(Chunk &chunk, Column &column)
+{
+  vector<uint8_t> select;
+  RC rc = eval(chunk, select);
+  if (rc != RC::SUCCESS) {
+    return rc;
+  }
+
+  const int rows = static_cast<int>(select.size());
+  column.init(BOOLEANS, sizeof(int), rows);
+  int *data = (int *)column.data();
+  for (int i = 0; i < rows; i++) {
+    data[i] = select[i];
+  }
+  column.set_count(rows);
+  return rc;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 ArithmeticExpr::ArithmeticExpr(ArithmeticExpr::Type type, Expression *left, Expression *right)
@@ -297,14 +692,33 @@ RC ArithmeticExpr::get_value(const Tuple &tuple, Value &value) const
     LOG_WARN("failed to get value of left expression. rc=%s", strrc(rc));
     return rc;
   }
-  rc = right_->get_value(tuple, right_value);
-  if (rc != RC::SUCCESS) {
-    LOG_WARN("failed to get value of right expression. rc=%s", strrc(rc));
-    return rc;
+  if (right_) {
+    rc = right_->get_value(tuple, right_value);
+    if (rc != RC::SUCCESS) {
+      LOG_WARN("failed to get value of right expression. rc=%s", strrc(rc));
+      return rc;
+    }
   }
   return calc_value(left_value, right_value, value);
 }
 
+bool ArithmeticExpr::equal(const Expression &other) const
+{
+  if (other.type() != ExprType::ARITHMETIC) {
+    return false;
+  }
+  const auto &other_arithmetic = static_cast<const ArithmeticExpr &>(other);
+  return arithmetic_type_ == other_arithmetic.arithmetic_type_ && expr_equal(left_, other_arithmetic.left_) &&
+         expr_equal(right_, other_arithmetic.right_);
+}
+
+unique_ptr<Expression> ArithmeticExpr::copy() const
+{
+  auto expr = make_unique<ArithmeticExpr>(arithmetic_type_, left_->copy(), right_ ? right_->copy() : nullptr);
+  expr->set_name(name());
+  return expr;
+}
+
 RC ArithmeticExpr::try_get_value(Value &value) const
 {
   RC rc = RC::SUCCESS;
@@ -327,4 +741,178 @@ RC ArithmeticExpr::try_get_value(Value &value) const
   }
 
   return calc_value(left_value, right_value, value);
-}
\ No newline at end of file
+}
+
+RC ArithmeticExpr::get_column(Chunk &chunk, Column &column)
+{
+  Column left_column;
+  Column right_column;
+
+  RC rc = left_->get_column(chunk, left_column);
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to get column of left expression. rc=%s", strrc(rc));
+    return rc;
+  }
+  if (right_) {
+    rc = right_->get_column(chunk, right_column);
+    if (rc != RC::SUCCESS) {
+      LOG_WARN("failed to get column of right expression. rc=%s", strrc(rc));
+      return rc;
+    }
+  }
+
+  const int rows = chunk.rows();
+  const AttrType target_type = value_type();
+  column.init(target_type, sizeof(int), rows);
+
+  // 整数的加减乘是最常见的情况，直接在原始数据上计算
+  if (target_type == INTS && left_column.attr_type() == INTS && right_column.attr_type() == INTS &&
+      arithmetic_type_ != Type::NEGATIVE) {
+    const int *left  = (const int *)left_column.data();
+    const int *right = (const int *)right_column.data();
+    const int left_step  = left_column.column_type() == Column::Type::CONSTANT_COLUMN ? 0 : 1;
+    const int right_step = right_column.column_type() == Column::Type::CONSTANT_COLUMN ? 0 : 1;
+    int *result = (int *)column.data();
+    switch (arithmetic_type_) {
+      case Type::ADD: {
+        for (int i = 0; i < rows; i++) {
+          result[i] = left[i * left_step] + right[i * right_step];
+        }
+      } break;
+      case Type::SUB: {
+        for (int i = 0; i < rows; i++) {
+          result[i] = left[i * left_step] - right[i * right_step];
+        }
+      } break;
+      case Type::MUL: {
+        for (int i = 0; i < rows; i++) {
+          result[i] = left[i * left_step] * right[i * right_step];
+        }
+      } break;
+      default: {
+        LOG_WARN("unsupported arithmetic type. %d", arithmetic_type_);
+        return RC::INTERNAL;
+      }
+    }
+    column.set_count(rows);
+    return rc;
+  }
+
+  Value left_value;
+  Value right_value;
+  Value value;
+  for (int i = 0; i < rows; i++) {
+    left_value = left_column.get_value(i);
+    if (right_) {
+      right_value = right_column.get_value(i);
+    }
+    rc = calc_value(left_value, right_value, value);
+    if (rc != RC::SUCCESS) {
+      return rc;
+    }
+    rc = column.append_value(value);
+    if (rc != RC::SUCCESS) {
+      return rc;
+    }
+  }
+  return rc;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+AggregateExpr::AggregateExpr(Type type, unique_ptr<Expression> child)
+    : aggregate_type_(type), child_(std::move(child))
+{}
+
+AggregateExpr::~AggregateExpr()
+{}
+
+AttrType AggregateExpr::value_type() const
+{
+  switch (aggregate_type_) {
+    case Type::AGG_COUNT: return INTS;
+    case Type::AGG_AVG: return FLOATS;
+    default: return child_ ? child_->value_type() : INTS;
+  }
+}
+
+RC AggregateExpr::get_value(const Tuple &tuple, Value &value) const
+{
+  return tuple.find_cell(TupleCellSpec(name().c_str()), value);
+}
+
+bool AggregateExpr::equal(const Expression &other) const
+{
+  if (other.type() != ExprType::AGGREGATION) {
+    return false;
+  }
+  const auto &other_aggregate = static_cast<const AggregateExpr &>(other);
+  return aggregate_type_ == other_aggregate.aggregate_type_ && expr_equal(child_, other_aggregate.child_);
+}
+
+unique_ptr<Expression> AggregateExpr::copy() const
+{
+  auto expr = make_unique<AggregateExpr>(aggregate_type_, child_ ? child_->copy() : nullptr);
+  expr->set_name(name());
+  return expr;
+}
+
+unique_ptr<Aggregator> AggregateExpr::create_aggregator() const
+{
+  switch (aggregate_type_) {
+    case Type::AGG_COUNT: return make_unique<CountAggregator>();
+    case Type::AGG_SUM: return make_unique<SumAggregator>();
+    case Type::AGG_AVG: return make_unique<AvgAggregator>();
+    case Type::AGG_MAX: return make_unique<MinMaxAggregator>(true /*is_max*/);
+    case Type::AGG_MIN: return make_unique<MinMaxAggregator>(false /*is_max*/);
+  }
+  return nullptr;
+}
+
+Aggregator *AggregateExpr::create_aggregator(void *buf) const
+{
+  switch (aggregate_type_) {
+    case Type::AGG_COUNT: return new (buf) CountAggregator();
+    case Type::AGG_SUM: return new (buf) SumAggregator();
+    case Type::AGG_AVG: return new (buf) AvgAggregator();
+    case Type::AGG_MAX: return new (buf) MinMaxAggregator(true /*is_max*/);
+    case Type::AGG_MIN: return new (buf) MinMaxAggregator(false /*is_max*/);
+  }
+  return nullptr;
+}
+
+size_t AggregateExpr::aggregator_size() const
+{
+  switch (aggregate_type_) {
+    case Type::AGG_COUNT: return sizeof(CountAggregator);
+    case Type::AGG_SUM: return sizeof(SumAggregator);
+    case Type::AGG_AVG: return sizeof(AvgAggregator);
+    case Type::AGG_MAX:
+    case Type::AGG_MIN: return sizeof(MinMaxAggregator);
+  }
+  return 0;
+}
+
+const char *AggregateExpr::type_to_string(Type type)
+{
+  switch (type) {
+    case Type::AGG_COUNT: return "count";
+    case Type::AGG_SUM: return "sum";
+    case Type::AGG_AVG: return "avg";
+    case Type::AGG_MAX: return "max";
+    case Type::AGG_MIN: return "min";
+  }
+  return "unknown";
+}
+
+RC AggregateExpr::type_from_string(const char *type_str, Type &type)
+{
+  static const Type types[] = {Type::AGG_COUNT, Type::AGG_SUM, Type::AGG_AVG, Type::AGG_MAX, Type::AGG_MIN};
+  for (Type t : types) {
+    if (0 == strcasecmp(type_str, type_to_string(t))) {
+      type = t;
+      return RC::SUCCESS;
+    }
+  }
+  return RC::INVALID_ARGUMENT;
+}
@@ -15,14 +15,19 @@ See the Mulan PSL v2 for more details. */
 #pragma once
 
 #include <string.h>
+#include <stdint.h>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "storage/field/field.h"
 #include "sql/parser/value.h"
 #include "common/log/log.h"
 
 class Tuple;
+class Chunk;
+class Column;
+class Aggregator;
 
 /**
  * @defgroup Expression
@@ -43,6 +48,8 @@ enum class ExprType
   COMPARISON,   ///< 需要做比较的表达式
   CONJUNCTION,  ///< 多个表达式使用同一种关系(AND或OR)来联结
   ARITHMETIC,   ///< 算术运算
+  AGGREGATION,  ///< 聚合函数，比如COUNT、SUM
+  PARAM,        ///< 预编译语句的参数
 };
 
 /**
@@ -76,6 +83,19 @@ public:
     return RC::UNIMPLENMENT;
   }
 
+  /**
+   * @brief 向量化计算，对chunk中的每一行计算表达式的值，结果放在column中
+   * @details column 不需要预先初始化，由表达式根据结果类型初始化
+   */
+  virtual RC get_column(Chunk &chunk, Column &column) { return RC::UNIMPLENMENT; }
+
+  /**
+   * @brief 向量化计算谓词，对chunk中的每个物理行计算一个布尔值
+   * @param[out] select 每一行一个字节，非0表示满足条件
+   * @details 默认实现是调用get_column后再逐行转换为布尔值，比较和联结表达式有更快的实现
+   */
+  virtual RC eval(Chunk &chunk, std::vector<uint8_t> &select);
+
   /**
    * @brief 表达式的类型
    * 可以根据表达式类型来转换为具体的子类
@@ -94,6 +114,18 @@ public:
   virtual std::string name() const { return name_; }
   virtual void set_name(std::string name) { name_ = name; }
 
+  /**
+   * @brief 判断两个表达式是否在任何一行上都计算出相同的值，不考虑表达式的名字
+   * @details 用于消除重复的子表达式。默认只有同一个对象才认为相同
+   */
+  virtual bool equal(const Expression &other) const { return this == &other; }
+
+  /**
+   * @brief 复制表达式，包括子表达式和名字
+   * @details 并行执行时每个线程使用各自的表达式，互不干扰
+   */
+  virtual std::unique_ptr<Expression> copy() const = 0;
+
 private:
   std::string  name_;
 };
@@ -125,9 +157,27 @@ public:
   const char *field_name() const { return field_.field_name(); }
 
   RC get_value(const Tuple &tuple, Value &value) const override;
+  RC get_column(Chunk &chunk, Column &column) override;
+  bool equal(const Expression &other) const override;
+  std::unique_ptr<Expression> copy() const override;
+
+  /**
+   * @brief 字段在chunk中的列ID，生成向量化执行计划时绑定
+   */
+  int pos() const { return pos_; }
+  void set_pos(int pos) { pos_ = pos; }
+
+  /**
+   * @brief 字段在输入tuple中的位置，生成按行执行的计划时绑定
+   * @details 绑定之后get_value直接按位置取值，没有绑定(-1)时按照表名和字段名查找
+   */
+  int cell_index() const { return cell_index_; }
+  void set_cell_index(int index) { cell_index_ = index; }
 
 private:
   Field field_;
+  int   pos_        = -1;
+  int   cell_index_ = -1;
 };
 
 /**
@@ -145,6 +195,9 @@ public:
 
   RC get_value(const Tuple &tuple, Value &value) const override;
   RC try_get_value(Value &value) const override { value = value_; return RC::SUCCESS; }
+  RC get_column(Chunk &chunk, Column &column) override;
+  bool equal(const Expression &other) const override;
+  std::unique_ptr<Expression> copy() const override;
 
   ExprType type() const override { return ExprType::VALUE; }
 
@@ -158,6 +211,40 @@ private:
   Value value_;
 };
 
+/**
+ * @brief 预编译语句的参数(?)
+ * @ingroup Expression
+ * @details 与ValueExpr类似，但是值在每次执行前绑定，同一个执行计划可以使用不同的参数执行。
+ * 参数的值保存在缓存的执行计划中(见 CachedPlan)，这里只引用，所以不能当做常量处理，
+ * 没有实现try_get_value，常量折叠等优化规则不会改变参数所在的表达式。
+ */
+class ParamExpr : public Expression
+{
+public:
+  explicit ParamExpr(const Value *param) : param_(param)
+  {}
+
+  virtual ~ParamExpr() = default;
+
+  RC get_value(const Tuple &tuple, Value &value) const override;
+  RC get_column(Chunk &chunk, Column &column) override;
+  bool equal(const Expression &other) const override;
+  std::unique_ptr<Expression> copy() const override;
+
+  ExprType type() const override { return ExprType::PARAM; }
+
+  /**
+   * @brief 参数的类型在生成执行计划时确定，类型不同的参数使用不同的执行计划
+   */
+  AttrType value_type() const override { return param_->attr_type(); }
+
+  const Value &get_value() const { return *param_; }
+  const Value *param() const { return param_; }
+
+private:
+  const Value *param_ = nullptr;
+};
+
 /**
  * @brief 类型转换表达式
  * @ingroup Expression
@@ -175,6 +262,9 @@ public:
   RC get_value(const Tuple &tuple, Value &value) const override;
 
   RC try_get_value(Value &value) const override;
+  RC get_column(Chunk &chunk, Column &column) override;
+  bool equal(const Expression &other) const override;
+  std::unique_ptr<Expression> copy() const override;
 
   AttrType value_type() const override { return cast_type_; }
 
@@ -221,6 +311,22 @@ public:
    */
   RC compare_value(const Value &left, const Value &right, bool &value) const;
 
+  /**
+   * @brief 交换比较两边的表达式后对应的比较运算，比如 a < b 等价于 b > a
+   */
+  static CompOp swap_comp(CompOp comp);
+
+  RC get_column(Chunk &chunk, Column &column) override;
+  RC eval(Chunk &chunk, std::vector<uint8_t> &select) override;
+  bool equal(const Expression &other) const override;
+  std::unique_ptr<Expression> copy() const override;
+
+  /**
+   * @brief 逐行比较两列数据
+   * @details 数值类型有专门的实现，其它类型退化为逐个值比较
+   */
+  RC compare_column(const Column &left, const Column &right, int rows, std::vector<uint8_t> &result) const;
+
 private:
   CompOp comp_;
   std::unique_ptr<Expression> left_;
@@ -250,6 +356,10 @@ public:
   AttrType value_type() const override { return BOOLEANS; }
 
   RC get_value(const Tuple &tuple, Value &value) const override;
+  RC get_column(Chunk &chunk, Column &column) override;
+  RC eval(Chunk &chunk, std::vector<uint8_t> &select) override;
+  bool equal(const Expression &other) const override;
+  std::unique_ptr<Expression> copy() const override;
 
   Type conjunction_type() const { return conjunction_type_; }
 
@@ -286,6 +396,9 @@ public:
 
   RC get_value(const Tuple &tuple, Value &value) const override;
   RC try_get_value(Value &value) const override;
+  RC get_column(Chunk &chunk, Column &column) override;
+  bool equal(const Expression &other) const override;
+  std::unique_ptr<Expression> copy() const override;
 
   Type arithmetic_type() const { return arithmetic_type_; }
 
@@ -299,4 +412,65 @@ private:
   Type arithmetic_type_;
   std::unique_ptr<Expression> left_;
   std::unique_ptr<Expression> right_;
-};
\ No newline at end of file
+};
+
+/**
+ * @brief 聚合函数表达式
+ * @ingroup Expression
+ * @details 聚合表达式本身不做计算，由聚合算子使用create_aggregator创建的聚合器计算。
+ * 在聚合算子之上，聚合的结果按照表达式的名字从tuple中查找。
+ */
+class AggregateExpr : public Expression
+{
+public:
+  enum class Type
+  {
+    AGG_COUNT,
+    AGG_SUM,
+    AGG_AVG,
+    AGG_MAX,
+    AGG_MIN,
+  };
+
+public:
+  /**
+   * @param child 聚合的参数，COUNT(*)时为空
+   */
+  AggregateExpr(Type type, std::unique_ptr<Expression> child);
+  virtual ~AggregateExpr();
+
+  ExprType type() const override { return ExprType::AGGREGATION; }
+
+  AttrType value_type() const override;
+
+  RC get_value(const Tuple &tuple, Value &value) const override;
+  bool equal(const Expression &other) const override;
+  std::unique_ptr<Expression> copy() const override;
+
+  Type aggregate_type() const { return aggregate_type_; }
+
+  std::unique_ptr<Expression> &child() { return child_; }
+  const std::unique_ptr<Expression> &child() const { return child_; }
+
+  std::unique_ptr<Aggregator> create_aggregator() const;
+
+  /**
+   * @brief 在调用方提供的内存上构造聚合器
+   * @details 用于把大量聚合器放在Arena中，内存大小至少是aggregator_size()，
+   * 调用方负责调用析构函数
+   */
+  Aggregator *create_aggregator(void *buf) const;
+  size_t      aggregator_size() const;
+
+  /**
+   * @brief 两阶段聚合时，中间状态由几个值组成
+   */
+  int partial_value_num() const { return aggregate_type_ == Type::AGG_AVG ? 2 : 1; }
+
+  static const char *type_to_string(Type type);
+  static RC type_from_string(const char *type_str, Type &type);
+
+private:
+  Type                        aggregate_type_;
+  std::unique_ptr<Expression> child_;
+};
@@ -0,0 +1,448 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#include "sql/expr/select_kernel.h"
+#include "common/defs.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define SELECT_KERNEL_X86 1
+#include <immintrin.h>
+#endif
+
+namespace select_kernel {
+
+/*
+ * 所有比较都归结为两个掩码：gt(data > value) 和 lt(data < value)，每8行一个字节。
+ * 再根据比较符组合：
+ *   =  : ~gt & ~lt     <> : gt | lt
+ *   >  : gt            <  : lt
+ *   >= : ~lt           <= : ~gt
+ * 组合方式在循环外确定，循环内没有分支。
+ * 浮点数的gt/lt是 (data - value) > EPSILON 和 (data - value) < -EPSILON。
+ */
+
+namespace {
+
+struct OpMask
+{
+  uint8_t gt;  ///< 结果中包含gt的位
+  uint8_t lt;  ///< 结果中包含lt的位
+  uint8_t eq;  ///< 结果中包含 ~(gt|lt) 的位
+};
+
+OpMask op_mask(CompOp op)
+{
+  switch (op) {
+    case EQUAL_TO: return {0x00, 0x00, 0xFF};
+    case NOT_EQUAL: return {0xFF, 0xFF, 0x00};
+    case GREAT_THAN: return {0xFF, 0x00, 0x00};
+    case LESS_THAN: return {0x00, 0xFF, 0x00};
+    case GREAT_EQUAL: return {0xFF, 0x00, 0xFF};
+    case LESS_EQUAL: return {0x00, 0xFF, 0xFF};
+    default: return {0x00, 0x00, 0x00};
+  }
+}
+
+inline uint8_t combine(const OpMask &mask, uint8_t gt, uint8_t lt)
+{
+  const uint8_t eq = static_cast<uint8_t>(~(gt | lt));
+  return static_cast<uint8_t>((gt & mask.gt) | (lt & mask.lt) | (eq & mask.eq));
+}
+
+constexpr float kEpsilon = EPSILON;
+
+/**
+ * @brief 处理不足8行的尾部，或者标量实现
+ */
+inline void scalar_block_int32(const int32_t *data, int count, int32_t value, uint8_t &gt, uint8_t &lt)
+{
+  gt = lt = 0;
+  for (int i = 0; i < count; i++) {
+    gt |= static_cast<uint8_t>((data[i] > value) << i);
+    lt |= static_cast<uint8_t>((data[i] < value) << i);
+  }
+}
+
+inline void scalar_block_float(const float *data, int count, float value, uint8_t &gt, uint8_t &lt)
+{
+  gt = lt = 0;
+  for (int i = 0; i < count; i++) {
+    const float d = data[i] - value;
+    gt |= static_cast<uint8_t>((d > kEpsilon) << i);
+    lt |= static_cast<uint8_t>((d < -kEpsilon) << i);
+  }
+}
+
+inline uint8_t tail_mask(int count) { return static_cast<uint8_t>((1u << count) - 1); }
+
+////////////////////////////////////////////////////////////////////////////////
+// 标量实现
+
+int select_int32_scalar(const OpMask &mask, const int32_t *data, int n, int32_t value, uint8_t *bitmap)
+{
+  int matched = 0;
+  uint8_t gt, lt;
+  for (int i = 0; i < n; i += 8) {
+    const int count = (n - i) < 8 ? (n - i) : 8;
+    scalar_block_int32(data + i, count, value, gt, lt);
+    bitmap[i / 8] = combine(mask, gt, lt) & tail_mask(count);
+    matched += __builtin_popcount(bitmap[i / 8]);
+  }
+  return matched;
+}
+
+int select_float_scalar(const OpMask &mask, const float *data, int n, float value, uint8_t *bitmap)
+{
+  int matched = 0;
+  uint8_t gt, lt;
+  for (int i = 0; i < n; i += 8) {
+    const int count = (n - i) < 8 ? (n - i) : 8;
+    scalar_block_float(data + i, count, value, gt, lt);
+    bitmap[i / 8] = combine(mask, gt, lt) & tail_mask(count);
+    matched += __builtin_popcount(bitmap[i / 8]);
+  }
+  return matched;
+}
+
+int between_int32_scalar(const int32_t *data, int n, int32_t low, int32_t high, uint8_t *bitmap)
+{
+  int matched = 0;
+  uint8_t gt_low, lt_low, gt_high, lt_high;
+  for (int i = 0; i < n; i += 8) {
+    const int count = (n - i) < 8 ? (n - i) : 8;
+    scalar_block_int32(data + i, count, low, gt_low, lt_low);
+    scalar_block_int32(data + i, count, high, gt_high, lt_high);
+    bitmap[i / 8] = static_cast<uint8_t>(~lt_low & ~gt_high) & tail_mask(count);
+    matched += __builtin_popcount(bitmap[i / 8]);
+  }
+  return matched;
+}
+
+int between_float_scalar(const float *data, int n, float low, float high, uint8_t *bitmap)
+{
+  int matched = 0;
+  uint8_t gt_low, lt_low, gt_high, lt_high;
+  for (int i = 0; i < n; i += 8) {
+    const int count = (n - i) < 8 ? (n - i) : 8;
+    scalar_block_float(data + i, count, low, gt_low, lt_low);
+    scalar_block_float(data + i, count, high, gt_high, lt_high);
+    bitmap[i / 8] = static_cast<uint8_t>(~lt_low & ~gt_high) & tail_mask(count);
+    matched += __builtin_popcount(bitmap[i / 8]);
+  }
+  return matched;
+}
+
+#ifdef SELECT_KERNEL_X86
+////////////////////////////////////////////////////////////////////////////////
+// SSE4.2 实现，每次处理4个值，两次组成一个字节
+
+__attribute__((target("sse4.2"))) inline void sse_block_int32(
+    const int32_t *data, __m128i v, uint8_t &gt, uint8_t &lt)
+{
+  __m128i x0 = _mm_loadu_si128((const __m128i *)data);
+  __m128i x1 = _mm_loadu_si128((const __m128i *)(data + 4));
+  gt = static_cast<uint8_t>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(x0, v))) |
+                            (_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(x1, v))) << 4));
+  lt = static_cast<uint8_t>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(x0, v))) |
+                            (_mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(x1, v))) << 4));
+}
+
+__attribute__((target("sse4.2"))) inline void sse_block_float(
+    const float *data, __m128 v, __m128 eps, __m128 neg_eps, uint8_t &gt, uint8_t &lt)
+{
+  __m128 d0 = _mm_sub_ps(_mm_loadu_ps(data), v);
+  __m128 d1 = _mm_sub_ps(_mm_loadu_ps(data + 4), v);
+  gt = static_cast<uint8_t>(_mm_movemask_ps(_mm_cmpgt_ps(d0, eps)) | (_mm_movemask_ps(_mm_cmpgt_ps(d1, eps)) << 4));
+  lt = static_cast<uint8_t>(
+      _mm_movemask_ps(_mm_cmplt_ps(d0, neg_eps)) | (_mm_movemask_ps(_mm_cmplt_ps(d1, neg_eps)) << 4));
+}
+
+__attribute__((target("sse4.2,popcnt"))) int select_int32_sse42(
+    const OpMask &mask, const int32_t *data, int n, int32_t value, uint8_t *bitmap)
+{
+  const __m128i v = _mm_set1_epi32(value);
+  const int full = n / 8 * 8;
+  int matched = 0;
+  uint8_t gt, lt;
+  for (int i = 0; i < full; i += 8) {
+    sse_block_int32(data + i, v, gt, lt);
+    bitmap[i / 8] = combine(mask, gt, lt);
+    matched += __builtin_popcount(bitmap[i / 8]);
+  }
+  if (full < n) {
+    matched += select_int32_scalar(mask, data + full, n - full, value, bitmap + full / 8);
+  }
+  return matched;
+}
+
+__attribute__((target("sse4.2,popcnt"))) int select_float_sse42(
+    const OpMask &mask, const float *data, int n, float value, uint8_t *bitmap)
+{
+  const __m128 v = _mm_set1_ps(value);
+  const __m128 eps = _mm_set1_ps(kEpsilon);
+  const __m128 neg_eps = _mm_set1_ps(-kEpsilon);
+  const int full = n / 8 * 8;
+  int matched = 0;
+  uint8_t gt, lt;
+  for (int i = 0; i < full; i += 8) {
+    sse_block_float(data + i, v, eps, neg_eps, gt, lt);
+    bitmap[i / 8] = combine(mask, gt, lt);
+    matched += __builtin_popcount(bitmap[i / 8]);
+  }
+  if (full < n) {
+    matched += select_float_scalar(mask, data + full, n - full, value, bitmap + full / 8);
+  }
+  return matched;
+}
+
+__attribute__((target("sse4.2,popcnt"))) int between_int32_sse42(
+    const int32_t *data, int n, int32_t low, int32_t high, uint8_t *bitmap)
+{
+  const __m128i vlow = _mm_set1_epi32(low);
+  const __m128i vhigh = _mm_set1_epi32(high);
+  const int full = n / 8 * 8;
+  int matched = 0;
+  uint8_t gt_low, lt_low, gt_high, lt_high;
+  for (int i = 0; i < full; i += 8) {
+    sse_block_int32(data + i, vlow, gt_low, lt_low);
+    sse_block_int32(data + i, vhigh, gt_high, lt_high);
+    bitmap[i / 8] = static_cast<uint8_t>(~lt_low & ~gt_high);
+    matched += __builtin_popcount(bitmap[i / 8]);
+  }
+  if (full < n) {
+    matched += between_int32_scalar(data + full, n - full, low, high, bitmap + full / 8);
+  }
+  return matched;
+}
+
+__attribute__((target("sse4.2,popcnt"))) int between_float_sse42(
+    const float *data, int n, float low, float high, uint8_t *bitmap)
+{
+  const __m128 vlow = _mm_set1_ps(low);
+  const __m128 vhigh = _mm_set1_ps(high);
+  const __m128 eps = _mm_set1_ps(kEpsilon);
+  const __m128 neg_eps = _mm_set1_ps(-kEpsilon);
+  const int full = n / 8 * 8;
+  int matched = 0;
+  uint8_t gt_low, lt_low, gt_high, lt_high;
+  for (int i = 0; i < full; i += 8) {
+    sse_block_float(data + i, vlow, eps, neg_eps, gt_low, lt_low);
+    sse_block_float(data + i, vhigh, eps, neg_eps, gt_high, lt_high);
+    bitmap[i / 8] = static_cast<uint8_t>(~lt_low & ~gt_high);
+    matched += __builtin_popcount(bitmap[i / 8]);
+  }
+  if (full < n) {
+    matched += between_float_scalar(data + full, n - full, low, high, bitmap + full / 8);
+  }
+  return matched;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// AVX2 实现，每次处理8个值，正好是一个字节
+
+__attribute__((target("avx2"))) inline void avx2_block_int32(
+    const int32_t *data, __m256i v, uint8_t &gt, uint8_t &lt)
+{
+  __m256i x = _mm256_loadu_si256((const __m256i *)data);
+  gt = static_cast<uint8_t>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(x, v))));
+  lt = static_cast<uint8_t>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(v, x))));
+}
+
+__attribute__((target("avx2"))) inline void avx2_block_float(
+    const float *data, __m256 v, __m256 eps, __m256 neg_eps, uint8_t &gt, uint8_t &lt)
+{
+  __m256 d = _mm256_sub_ps(_mm256_loadu_ps(data), v);
+  gt = static_cast<uint8_t>(_mm256_movemask_ps(_mm256_cmp_ps(d, eps, _CMP_GT_OQ)));
+  lt = static_cast<uint8_t>(_mm256_movemask_ps(_mm256_cmp_ps(d, neg_eps, _CMP_LT_OQ)));
+}
+
+__attribute__((target("avx2,popcnt"))) int select_int32_avx2(
+    const OpMask &mask, const int32_t *data, int n, int32_t value, uint8_t *bitmap)
+{
+  const __m256i v = _mm256_set1_epi32(value);
+  const int full = n / 8 * 8;
+  int matched = 0;
+  uint8_t gt, lt;
+  for (int i = 0; i < full; i += 8) {
+    avx2_block_int32(data + i, v, gt, lt);
+    bitmap[i / 8] = combine(mask, gt, lt);
+    matched += __builtin_popcount(bitmap[i / 8]);
+  }
+  if (full < n) {
+    matched += select_int32_scalar(mask, data + full, n - full, value, bitmap + full / 8);
+  }
+  return matched;
+}
+
+__attribute__((target("avx2,popcnt"))) int select_float_avx2(
+    const OpMask &mask, const float *data, int n, float value, uint8_t *bitmap)
+{
+  const __m256 v = _mm256_set1_ps(value);
+  const __m256 eps = _mm256_set1_ps(kEpsilon);
+  const __m256 neg_eps = _mm256_set1_ps(-kEpsilon);
+  const int full = n / 8 * 8;
+  int matched = 0;
+  uint8_t gt, lt;
+  for (int i = 0; i < full; i += 8) {
+    avx2_block_float(data + i, v, eps, neg_eps, gt, lt);
+    bitmap[i / 8] = combine(mask, gt, lt);
+    matched += __builtin_popcount(bitmap[i / 8]);
+  }
+  if (full < n) {
+    matched += select_float_scalar(mask, data + full, n - full, value, bitmap + full / 8);
+  }
+  return matched;
+}
+
+__attribute__((target("avx2,popcnt"))) int between_int32_avx2(
+    const int32_t *data, int n, int32_t low, int32_t high, uint8_t *bitmap)
+{
+  const __m256i vlow = _mm256_set1_epi32(low);
+  const __m256i vhigh = _mm256_set1_epi32(high);
+  const int full = n / 8 * 8;
+  int matched = 0;
+  uint8_t gt_low, lt_low, gt_high, lt_high;
+  for (int i = 0; i < full; i += 8) {
+    avx2_block_int32(data + i, vlow, gt_low, lt_low);
+    avx2_block_int32(data + i, vhigh, gt_high, lt_high);
+    bitmap[i / 8] = static_cast<uint8_t>(~lt_low & ~gt_high);
+    matched += __builtin_popcount(bitmap[i / 8]);
+  }
+  if (full < n) {
+    matched += between_int32_scalar(data + full, n - full, low, high, bitmap + full / 8);
+  }
+  return matched;
+}
+
+__attribute__((target("avx2,popcnt"))) int between_float_avx2(
+    const float *data, int n, float low, float high, uint8_t *bitmap)
+{
+  const __m256 vlow = _mm256_set1_ps(low);
+  const __m256 vhigh = _mm256_set1_ps(high);
+  const __m256 eps = _mm256_set1_ps(kEpsilon);
+  const __m256 neg_eps = _mm256_set1_ps(-kEpsilon);
+  const int full = n / 8 * 8;
+  int matched = 0;
+  uint8_t gt_low, lt_low, gt_high, lt_high;
+  for (int i = 0; i < full; i += 8) {
+    avx2_block_float(data + i, vlow, eps, neg_eps, gt_low, lt_low);
+    avx2_block_float(data + i, vhigh, eps, neg_eps, gt_high, lt_high);
+    bitmap[i / 8] = static_cast<uint8_t>(~lt_low & ~gt_high);
+    matched += __builtin_popcount(bitmap[i / 8]);
+  }
+  if (full < n) {
+    matched += between_float_scalar(data + full, n - full, low, high, bitmap + full / 8);
+  }
+  return matched;
+}
+#endif  // SELECT_KERNEL_X86
+
+SimdLevel detect_simd_level()
+{
+#ifdef SELECT_KERNEL_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt")) {
+    return SimdLevel::AVX2;
+  }
+  if (__builtin_cpu_supports("sse4.2") && __builtin_cpu_supports("popcnt")) {
+    return SimdLevel::SSE42;
+  }
+#endif
+  return SimdLevel::SCALAR;
+}
+
+SimdLevel &current_level()
+{
+  static SimdLevel level = detect_simd_level();
+  return level;
+}
+
+}  // namespace
+
+SimdLevel simd_level() { return current_level(); }
+
+SimdLevel set_simd_level(SimdLevel level)
+{
+  const SimdLevel supported = detect_simd_level();
+  current_level() = static_cast<int>(level) <= static_cast<int>(supported) ? level : supported;
+  return current_level();
+}
+
+const char *simd_level_name(SimdLevel level)
+{
+  switch (level) {
+    case SimdLevel::AVX2: return "avx2";
+    case SimdLevel::SSE42: return "sse4.2";
+    default: return "scalar";
+  }
+}
+
+CompOp flip_comp_op(CompOp op)
+{
+  switch (op) {
+    case LESS_THAN: return GREAT_THAN;
+    case LESS_EQUAL: return GREAT_EQUAL;
+    case GREAT_THAN: return LESS_THAN;
+    case GREAT_EQUAL: return LESS_EQUAL;
+    default: return op;
+  }
+}
+
+int select_int32(CompOp op, const int32_t *data, int n, int32_t value, uint8_t *bitmap)
+{
+  const OpMask mask = op_mask(op);
+  switch (current_level()) {
+#ifdef SELECT_KERNEL_X86
+    case SimdLevel::AVX2: return select_int32_avx2(mask, data, n, value, bitmap);
+    case SimdLevel::SSE42: return select_int32_sse42(mask, data, n, value, bitmap);
+#endif
+    default: return select_int32_scalar(mask, data, n, value, bitmap);
+  }
+}
+
+int select_float(CompOp op, const float *data, int n, float value, uint8_t *bitmap)
+{
+  const OpMask mask = op_mask(op);
+  switch (current_level()) {
+#ifdef SELECT_KERNEL_X86
+    case SimdLevel::AVX2: return select_float_avx2(mask, data, n, value, bitmap);
+    case SimdLevel::SSE42: return select_float_sse42(mask, data, n, value, bitmap);
+#endif
+    default: return select_float_scalar(mask, data, n, value, bitmap);
+  }
+}
+
+int select_int32_between(const int32_t *data, int n, int32_t low, int32_t high, uint8_t *bitmap)
+{
+  switch (current_level()) {
+#ifdef SELECT_KERNEL_X86
+    case SimdLevel::AVX2: return between_int32_avx2(data, n, low, high, bitmap);
+    case SimdLevel::SSE42: return between_int32_sse42(data, n, low, high, bitmap);
+#endif
+    default: return between_int32_scalar(data, n, low, high, bitmap);
+  }
+}
+
+int select_float_between(const float *data, int n, float low, float high, uint8_t *bitmap)
+{
+  switch (current_level()) {
+#ifdef SELECT_KERNEL_X86
+    case SimdLevel::AVX2: return between_float_avx2(data, n, low, high, bitmap);
+    case SimdLevel::SSE42: return between_float_sse42(data, n, low, high, bitmap);
+#endif
+    default: return between_float_scalar(data, n, low, high, bitmap);
+  }
+}
+
+}  // namespace select_kernel
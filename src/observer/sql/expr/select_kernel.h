@@ -0,0 +1,74 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#pragma once
+
+#include <stdint.h>
+
+#include "sql/parser/parse_defs.h"
+
+/**
+ * @brief 数值列与常量比较的选择算子(selection kernel)
+ * @ingroup Expression
+ * @details 对int32/float数组与一个常量(或一个区间)做比较，结果写入位图：
+ * 第i行满足条件时，bitmap[i / 8] 的第 (i % 8) 位为1，与common::Bitmap的格式相同。
+ * bitmap至少需要 (n + 7) / 8 个字节，最后一个字节中多余的位是0。
+ *
+ * 每个函数都有AVX2、SSE4.2和标量三种实现，运行时根据CPU支持的指令集选择，
+ * 非x86平台只有标量实现。浮点数比较与common::compare_float一致，差值在EPSILON内视为相等。
+ */
+namespace select_kernel {
+
+enum class SimdLevel
+{
+  SCALAR,
+  SSE42,
+  AVX2,
+};
+
+/**
+ * @brief 当前使用的指令集
+ * @details 第一次调用时检测CPU特性，选择支持的最高级别
+ */
+SimdLevel simd_level();
+
+/**
+ * @brief 指定使用的指令集，通常在测试或者性能对比时使用
+ * @details 如果CPU不支持指定的级别，就使用支持的最高级别。返回实际使用的级别
+ */
+SimdLevel set_simd_level(SimdLevel level);
+
+const char *simd_level_name(SimdLevel level);
+
+/**
+ * @brief data[i] op value
+ * @param op 只支持 = <> < <= > >=
+ * @return 满足条件的行数
+ */
+int select_int32(CompOp op, const int32_t *data, int n, int32_t value, uint8_t *bitmap);
+int select_float(CompOp op, const float *data, int n, float value, uint8_t *bitmap);
+
+/**
+ * @brief low <= data[i] <= high
+ * @return 满足条件的行数
+ */
+int select_int32_between(const int32_t *data, int n, int32_t low, int32_t high, uint8_t *bitmap);
+int select_float_between(const float *data, int n, float low, float high, uint8_t *bitmap);
+
+/**
+ * @brief 交换比较的左右两边时对应的比较符，比如 value < data 等价于 data > value
+ */
+CompOp flip_comp_op(CompOp op);
+
+}  // namespace select_kernel
@@ -24,6 +24,7 @@ See the Mulan PSL v2 for more details. */
 #include "sql/parser/value.h"
 #include "sql/expr/expression.h"
 #include "storage/record/record.h"
+#include "storage/common/chunk.h"
 
 class Table;
 
@@ -71,11 +72,34 @@ public:
   {
     return cells_[i];
   }
+  const std::vector<TupleCellSpec> &cells() const
+  {
+    return cells_;
+  }
 
 private:
   std::vector<TupleCellSpec> cells_;
 };
 
+/**
+ * @brief 在一组cell描述中查找指定的cell
+ * @details 描述中有字段名时按照表名和字段名匹配，否则按照别名匹配
+ * @return cell的位置，找不到返回-1
+ */
+inline int find_spec(const std::vector<TupleCellSpec> &specs, const TupleCellSpec &spec)
+{
+  for (size_t i = 0; i < specs.size(); i++) {
+    const TupleCellSpec &s = specs[i];
+    const bool field_match = spec.field_name()[0] != 0 && 0 == strcmp(spec.table_name(), s.table_name()) &&
+                             0 == strcmp(spec.field_name(), s.field_name());
+    const bool alias_match = spec.field_name()[0] == 0 && 0 == strcmp(spec.alias(), s.alias());
+    if (field_match || alias_match) {
+      return static_cast<int>(i);
+    }
+  }
+  return -1;
+}
+
 /**
  * @brief 元组的抽象描述
  * @ingroup Tuple
@@ -108,6 +132,15 @@ public:
    */
   virtual RC find_cell(const TupleCellSpec &spec, Value &cell) const = 0;
 
+  /**
+   * @brief 获取指定位置的cell的描述
+   * @details 物化中间结果时(比如hash join的build端)需要同时保存cell的描述，
+   * 以便物化后的tuple依然可以通过find_cell访问
+   * @param index 位置
+   * @param[out] spec 返回的cell描述
+   */
+  virtual RC spec_at(int index, TupleCellSpec &spec) const = 0;
+
   virtual std::string to_string() const
   {
     std::string str;
@@ -159,6 +192,38 @@ public:
     }
   }
 
+  /**
+   * @brief 只输出记录中的部分字段
+   */
+  void set_schema(const Table *table, const std::vector<Field> &fields)
+  {
+    table_ = table;
+    this->speces_.reserve(fields.size());
+    for (const Field &field : fields) {
+      speces_.push_back(new FieldExpr(field));
+    }
+  }
+
+  /**
+   * @brief 表中记录对应的tuple的schema，与使用表的所有字段set_schema之后cell的顺序一致
+   */
+  static void table_schema(const Table *table, TupleSchema &schema)
+  {
+    for (const FieldMeta &field : *table->table_meta().field_metas()) {
+      schema.append_cell(table->name(), field.name());
+    }
+  }
+
+  /**
+   * @brief 使用部分字段set_schema之后的schema
+   */
+  static void table_schema(const Table *table, const std::vector<Field> &fields, TupleSchema &schema)
+  {
+    for (const Field &field : fields) {
+      schema.append_cell(table->name(), field.field_name());
+    }
+  }
+
   int cell_num() const override
   {
     return speces_.size();
@@ -174,7 +239,8 @@ public:
     FieldExpr *field_expr = speces_[index];
     const FieldMeta *field_meta = field_expr->field().meta();
     cell.set_type(field_meta->type());
-    cell.set_data(this->record_->data() + field_meta->offset(), field_meta->len());
+    // 记录在当前行有效期间不会变化，字符串不需要复制
+    cell.borrow_data(this->record_->data() + field_meta->offset(), field_meta->len());
     return RC::SUCCESS;
   }
 
@@ -196,6 +262,18 @@ public:
     return RC::NOTFOUND;
   }
 
+  RC spec_at(int index, TupleCellSpec &spec) const override
+  {
+    if (index < 0 || index >= static_cast<int>(speces_.size())) {
+      LOG_WARN("invalid argument. index=%d", index);
+      return RC::INVALID_ARGUMENT;
+    }
+
+    const FieldExpr *field_expr = speces_[index];
+    spec = TupleCellSpec(field_expr->table_name(), field_expr->field_name());
+    return RC::SUCCESS;
+  }
+
 #if 0
   RC cell_spec_at(int index, const TupleCellSpec *&spec) const override
   {
@@ -208,6 +286,11 @@ public:
   }
 #endif
 
+  const Field &field_at(int index) const
+  {
+    return speces_[index]->field();
+  }
+
   Record &record()
   {
     return *record_;
@@ -252,6 +335,19 @@ public:
   {
     speces_.push_back(spec);
   }
+
+  /**
+   * @brief 根据输入tuple的schema，确定每个投影的cell在输入tuple中的位置
+   * @details 绑定之后按位置访问输入tuple，找不到的cell仍然按照描述查找
+   */
+  void bind_cells(const TupleSchema &input_schema)
+  {
+    cell_indexes_.clear();
+    for (const TupleCellSpec *spec : speces_) {
+      cell_indexes_.push_back(find_spec(input_schema.cells(), *spec));
+    }
+  }
+
   int cell_num() const override
   {
     return speces_.size();
@@ -266,6 +362,10 @@ public:
       return RC::INTERNAL;
     }
 
+    if (index < static_cast<int>(cell_indexes_.size()) && cell_indexes_[index] >= 0) {
+      return tuple_->cell_at(cell_indexes_[index], cell);
+    }
+
     const TupleCellSpec *spec = speces_[index];
     return tuple_->find_cell(*spec, cell);
   }
@@ -275,6 +375,15 @@ public:
     return tuple_->find_cell(spec, cell);
   }
 
+  RC spec_at(int index, TupleCellSpec &spec) const override
+  {
+    if (index < 0 || index >= static_cast<int>(speces_.size())) {
+      return RC::INTERNAL;
+    }
+    spec = *speces_[index];
+    return RC::SUCCESS;
+  }
+
 #if 0
   RC cell_spec_at(int index, const TupleCellSpec *&spec) const override
   {
@@ -287,6 +396,7 @@ public:
 #endif
 private:
   std::vector<TupleCellSpec *> speces_;
+  std::vector<int> cell_indexes_;  ///< 每个cell在输入tuple中的位置，-1表示没有绑定
   Tuple *tuple_ = nullptr;
 };
 
@@ -327,6 +437,14 @@ public:
     return RC::NOTFOUND;
   }
 
+  RC spec_at(int index, TupleCellSpec &spec) const override
+  {
+    if (index < 0 || index >= static_cast<int>(expressions_.size())) {
+      return RC::INTERNAL;
+    }
+    spec = TupleCellSpec(expressions_[index]->name().c_str());
+    return RC::SUCCESS;
+  }
 
 private:
   const std::vector<std::unique_ptr<Expression>> &expressions_;
@@ -346,6 +464,22 @@ public:
   {
     cells_ = cells;
   }
+  void set_cells(const Value *cells, int cell_num)
+  {
+    cells_.assign(cells, cells + cell_num);
+  }
+
+  /**
+   * @brief 设置每个cell的描述，设置之后才可以使用find_cell
+   */
+  void set_specs(const std::vector<TupleCellSpec> &specs)
+  {
+    specs_ = specs;
+  }
+  const std::vector<TupleCellSpec> &specs() const
+  {
+    return specs_;
+  }
 
   virtual int cell_num() const override
   {
@@ -364,11 +498,90 @@ public:
 
   virtual RC find_cell(const TupleCellSpec &spec, Value &cell) const override
   {
-    return RC::INTERNAL;
+    const int index = find_spec(specs_, spec);
+    if (index < 0) {
+      return RC::NOTFOUND;
+    }
+    return cell_at(index, cell);
+  }
+
+  virtual RC spec_at(int index, TupleCellSpec &spec) const override
+  {
+    if (index < 0 || index >= static_cast<int>(specs_.size())) {
+      return RC::NOTFOUND;
+    }
+    spec = specs_[index];
+    return RC::SUCCESS;
   }
 
 private:
   std::vector<Value> cells_;
+  std::vector<TupleCellSpec> specs_;
+};
+
+/**
+ * @brief chunk中的一行
+ * @ingroup Tuple
+ * @details 向量化执行的结果转换为按行输出时使用。specs与chunk中的列一一对应
+ */
+class ChunkTuple : public Tuple
+{
+public:
+  ChunkTuple() = default;
+  virtual ~ChunkTuple() = default;
+
+  void set_schema(const std::vector<TupleCellSpec> &specs)
+  {
+    specs_ = specs;
+  }
+  const std::vector<TupleCellSpec> &specs() const
+  {
+    return specs_;
+  }
+
+  void set_row(const Chunk *chunk, int row)
+  {
+    chunk_ = chunk;
+    row_ = row;
+  }
+
+  int cell_num() const override
+  {
+    return chunk_->column_num();
+  }
+
+  RC cell_at(int index, Value &cell) const override
+  {
+    if (index < 0 || index >= chunk_->column_num()) {
+      return RC::NOTFOUND;
+    }
+
+    cell = chunk_->get_value(index, row_);
+    return RC::SUCCESS;
+  }
+
+  RC find_cell(const TupleCellSpec &spec, Value &cell) const override
+  {
+    const int index = find_spec(specs_, spec);
+    if (index < 0) {
+      return RC::NOTFOUND;
+    }
+    return cell_at(index, cell);
+  }
+
+  RC spec_at(int index, TupleCellSpec &spec) const override
+  {
+    if (index < 0 || index >= static_cast<int>(specs_.size())) {
+      return RC::NOTFOUND;
+    }
+    spec = specs_[index];
+    return RC::SUCCESS;
+  }
+
+private:
+  const Chunk *chunk_ = nullptr;
+  int row_ = 0;
+  std::vector<TupleCellSpec> specs_;
 };
 
 /**
@@ -399,7 +612,7 @@ public:
   RC cell_at(int index, Value &value) const override
   {
     const int left_cell_num = left_->cell_num();
-    if (index > 0 && index < left_cell_num) {
+    if (index >= 0 && index < left_cell_num) {
       return left_->cell_at(index, value);
     }
 
@@ -420,6 +633,20 @@ public:
     return right_->find_cell(spec, value);
   }
 
+  RC spec_at(int index, TupleCellSpec &spec) const override
+  {
+    const int left_cell_num = left_->cell_num();
+    if (index >= 0 && index < left_cell_num) {
+      return left_->spec_at(index, spec);
+    }
+
+    if (index >= left_cell_num && index < left_cell_num + right_->cell_num()) {
+      return right_->spec_at(index - left_cell_num, spec);
+    }
+
+    return RC::NOTFOUND;
+  }
+
 private:
   Tuple *left_ = nullptr;
   Tuple *right_ = nullptr;
@@ -0,0 +1,155 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#include <new>
+
+#include "sql/operator/aggregate_hash_table.h"
+#include "sql/operator/join_hash_table.h"
+#include "sql/expr/aggregator.h"
+#include "sql/expr/expression.h"
+
+AggregateHashTable::~AggregateHashTable()
+{
+  clear();
+}
+
+void AggregateHashTable::init(int key_num, const std::vector<const AggregateExpr *> &aggregates)
+{
+  clear();
+  key_num_    = key_num;
+  aggregates_ = aggregates;
+  arena_.set_source(common::QueryArena::current());
+  rehash(16);
+}
+
+void AggregateHashTable::clear()
+{
+  // key和聚合器在arena中构造，释放内存之前需要先析构，比如MIN/MAX中保存的字符串
+  for (Aggregator **aggregators : groups_) {
+    for (size_t i = 0; i < aggregates_.size(); i++) {
+      aggregators[i]->~Aggregator();
+    }
+  }
+  for (Value *keys : keys_) {
+    for (int i = 0; i < key_num_; i++) {
+      keys[i].~Value();
+    }
+  }
+  groups_.clear();
+  keys_.clear();
+  hashes_.clear();
+  slots_.clear();
+  mask_ = 0;
+  arena_.reset();
+}
+
+uint64_t AggregateHashTable::hash_keys(const Value *keys) const
+{
+  return JoinHashTable::hash_keys(keys, key_num_);
+}
+
+Aggregator **AggregateHashTable::find(const Value *keys, uint64_t hash) const
+{
+  const uint32_t hash_tag = static_cast<uint32_t>(hash >> 32);
+  for (uint64_t pos = hash & mask_;; pos = (pos + 1) & mask_) {
+    const Slot &slot = slots_[pos];
+    if (slot.group < 0) {
+      return nullptr;
+    }
+
+    if (slot.hash_tag == hash_tag && keys_equal(group_keys(slot.group), keys)) {
+      return groups_[slot.group];
+    }
+  }
+}
+
+Aggregator **AggregateHashTable::find_or_create(const Value *keys, uint64_t hash)
+{
+  Aggregator **found = find(keys, hash);
+  if (found != nullptr) {
+    return found;
+  }
+
+  // 负载因子不超过0.5
+  if ((groups_.size() + 1) * 2 > slots_.size()) {
+    rehash(slots_.size() * 2);
+  }
+
+  Aggregator **aggregators = create_group(keys, hash);
+  const int32_t group = static_cast<int32_t>(groups_.size() - 1);
+  for (uint64_t pos = hash & mask_;; pos = (pos + 1) & mask_) {
+    Slot &slot = slots_[pos];
+    if (slot.group < 0) {
+      slot.hash_tag = static_cast<uint32_t>(hash >> 32);
+      slot.group    = group;
+      break;
+    }
+  }
+  return aggregators;
+}
+
+Aggregator **AggregateHashTable::create_group(const Value *keys, uint64_t hash)
+{
+  // 复制之后的key不再引用记录中的数据
+  auto group_keys = static_cast<Value *>(arena_.alloc(sizeof(Value) * key_num_));
+  for (int i = 0; i < key_num_; i++) {
+    new (&group_keys[i]) Value();
+    group_keys[i].set_value(keys[i], arena_);
+  }
+  keys_.push_back(group_keys);
+  hashes_.push_back(hash);
+
+  auto aggregators = static_cast<Aggregator **>(arena_.alloc(sizeof(Aggregator *) * aggregates_.size()));
+  for (size_t i = 0; i < aggregates_.size(); i++) {
+    const AggregateExpr *aggregate = aggregates_[i];
+    aggregators[i] = aggregate->create_aggregator(arena_.alloc(aggregate->aggregator_size()));
+  }
+  groups_.push_back(aggregators);
+  return aggregators;
+}
+
+void AggregateHashTable::rehash(size_t capacity)
+{
+  slots_.assign(capacity, Slot{0, -1});
+  mask_ = capacity - 1;
+
+  for (int32_t group = 0; group < groups(); group++) {
+    const uint64_t hash = hashes_[group];
+    for (uint64_t pos = hash & mask_;; pos = (pos + 1) & mask_) {
+      Slot &slot = slots_[pos];
+      if (slot.group < 0) {
+        slot.hash_tag = static_cast<uint32_t>(hash >> 32);
+        slot.group    = group;
+        break;
+      }
+    }
+  }
+}
+
+bool AggregateHashTable::keys_equal(const Value *left, const Value *right) const
+{
+  for (int i = 0; i < key_num_; i++) {
+    if (left[i].compare(right[i]) != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+int64_t AggregateHashTable::memory_size() const
+{
+  return static_cast<int64_t>(arena_.used_size() + keys_.capacity() * sizeof(Value *) +
+                              hashes_.capacity() * sizeof(uint64_t) + groups_.capacity() * sizeof(Aggregator **) +
+                              slots_.capacity() * sizeof(Slot));
+}
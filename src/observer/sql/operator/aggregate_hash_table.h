@@ -0,0 +1,101 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+
+#include "common/mm/arena.h"
+#include "sql/parser/value.h"
+
+class AggregateExpr;
+class Aggregator;
+
+/**
+ * @brief 分组聚合使用的hash表
+ * @ingroup PhysicalOperator
+ * @details 每个分组保存分组的key和每个聚合函数的聚合器。
+ * 分组的key(包括较长的字符串)和聚合器对象都在Arena中分配，每个分组只需要几次顺序分配，
+ * 不会产生大量的小块内存。
+ * Arena的块从当前查询的QueryArena中获取，clear时还回去，算子在close时需要clear。
+ * 分组按照创建的顺序编号。
+ * 索引部分与JoinHashTable一样使用开放寻址的槽位数组，分组增加时扩容并重新插入。
+ */
+class AggregateHashTable
+{
+public:
+  AggregateHashTable() = default;
+  ~AggregateHashTable();
+
+  /**
+   * @param key_num 分组key的个数
+   * @param aggregates 每个分组需要的聚合函数
+   */
+  void init(int key_num, const std::vector<const AggregateExpr *> &aggregates);
+
+  /**
+   * @brief 计算分组key的hash值
+   */
+  uint64_t hash_keys(const Value *keys) const;
+
+  /**
+   * @brief 查找key对应的分组，不存在时创建新的分组
+   * @param hash 使用hash_keys计算的hash值
+   * @return 分组的聚合器数组，与init中的聚合函数一一对应
+   */
+  Aggregator **find_or_create(const Value *keys, uint64_t hash);
+  Aggregator **find_or_create(const Value *keys) { return find_or_create(keys, hash_keys(keys)); }
+
+  /**
+   * @brief 查找key对应的分组
+   * @return 分组不存在时返回nullptr
+   */
+  Aggregator **find(const Value *keys, uint64_t hash) const;
+
+  void clear();
+
+  int groups() const { return static_cast<int>(groups_.size()); }
+
+  const Value *group_keys(int group) const { return keys_[group]; }
+  Aggregator **group_aggregators(int group) const { return groups_[group]; }
+
+  /**
+   * @brief 估算当前占用的内存
+   * @details key和聚合器按照arena中实际分配出去的字节数统计，不包含块中没有使用的部分
+   */
+  int64_t memory_size() const;
+
+private:
+  struct Slot
+  {
+    uint32_t hash_tag;  ///< hash值的高32位
+    int32_t  group;     ///< 分组编号，-1表示空槽位
+  };
+
+  Aggregator **create_group(const Value *keys, uint64_t hash);
+  void         rehash(size_t capacity);
+  bool         keys_equal(const Value *left, const Value *right) const;
+
+private:
+  int                                key_num_ = 0;
+  std::vector<const AggregateExpr *> aggregates_;
+
+  std::vector<Value *>       keys_;    ///< 每个分组的key，在arena_中分配
+  std::vector<uint64_t>      hashes_;  ///< 每个分组key的hash值，扩容时使用
+  std::vector<Aggregator **> groups_;  ///< 每个分组的聚合器数组，在arena_中分配
+  std::vector<Slot>          slots_;
+  uint64_t                   mask_ = 0;
+  common::Arena              arena_;
+};
@@ -0,0 +1,54 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "sql/operator/logical_operator.h"
+
+/**
+ * @brief 聚合算子，包括分组聚合
+ * @ingroup LogicalOperator
+ * @details 输出的每一行依次是分组的字段和每个聚合函数的结果，没有分组时只输出一行。
+ * 对应的物理算子有HashAggregate和StreamAggregate。
+ */
+class AggregateLogicalOperator : public LogicalOperator
+{
+public:
+  AggregateLogicalOperator(std::vector<std::unique_ptr<Expression>> &&group_by_expressions,
+      std::vector<std::unique_ptr<Expression>> &&aggregate_expressions)
+      : group_by_expressions_(std::move(group_by_expressions)), aggregate_expressions_(std::move(aggregate_expressions))
+  {}
+  virtual ~AggregateLogicalOperator() = default;
+
+  LogicalOperatorType type() const override
+  {
+    return LogicalOperatorType::AGGREGATION;
+  }
+
+  std::vector<std::unique_ptr<Expression>> &group_by_expressions()
+  {
+    return group_by_expressions_;
+  }
+  std::vector<std::unique_ptr<Expression>> &aggregate_expressions()
+  {
+    return aggregate_expressions_;
+  }
+
+private:
+  std::vector<std::unique_ptr<Expression>> group_by_expressions_;
+  std::vector<std::unique_ptr<Expression>> aggregate_expressions_;  ///< 都是AggregateExpr
+};
@@ -0,0 +1,134 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#include "sql/operator/aggregate_physical_operator.h"
+#include "common/log/log.h"
+
+using namespace std;
+
+AggregatePhysicalOperator::AggregatePhysicalOperator(
+    vector<unique_ptr<Expression>> &&group_by_exprs, vector<unique_ptr<Expression>> &&aggregate_exprs, AggregateMode mode)
+    : group_by_exprs_(std::move(group_by_exprs)), aggregate_exprs_(std::move(aggregate_exprs)), mode_(mode)
+{
+  vector<TupleCellSpec> specs;
+  for (const unique_ptr<Expression> &expr : group_by_exprs_) {
+    if (expr->type() == ExprType::FIELD) {
+      const Field &field = static_cast<FieldExpr *>(expr.get())->field();
+      specs.emplace_back(field.table_name(), field.field_name(), field.field_name());
+    } else {
+      specs.emplace_back(expr->name().c_str());
+    }
+  }
+
+  for (const AggregateExpr *aggregate_expr : aggregates()) {
+    ASSERT(aggregate_expr->type() == ExprType::AGGREGATION, "expected an aggregate expression. got %d", aggregate_expr->type());
+    const int value_num = mode_ == AggregateMode::PARTIAL ? aggregate_expr->partial_value_num() : 1;
+    for (int i = 0; i < value_num; i++) {
+      specs.emplace_back(aggregate_expr->name().c_str());
+    }
+  }
+  tuple_.set_specs(specs);
+}
+
+string AggregatePhysicalOperator::param() const
+{
+  switch (mode_) {
+    case AggregateMode::PARTIAL: return "mode=partial";
+    case AggregateMode::FINAL: return "mode=final";
+    default: return "";
+  }
+}
+
+vector<const AggregateExpr *> AggregatePhysicalOperator::aggregates() const
+{
+  vector<const AggregateExpr *> result;
+  for (const unique_ptr<Expression> &expr : aggregate_exprs_) {
+    result.push_back(static_cast<const AggregateExpr *>(expr.get()));
+  }
+  return result;
+}
+
+RC AggregatePhysicalOperator::get_group_keys(const Tuple &tuple, vector<Value> &keys) const
+{
+  keys.resize(group_by_exprs_.size());
+  for (size_t i = 0; i < group_by_exprs_.size(); i++) {
+    RC rc = mode_ == AggregateMode::FINAL ? tuple.cell_at(static_cast<int>(i), keys[i])
+                                          : group_by_exprs_[i]->get_value(tuple, keys[i]);
+    if (OB_FAIL(rc)) {
+      LOG_WARN("failed to get group key. rc=%s", strrc(rc));
+      return rc;
+    }
+  }
+  return RC::SUCCESS;
+}
+
+RC AggregatePhysicalOperator::accumulate(const Tuple &tuple, Aggregator *const *aggregators)
+{
+  RC rc = RC::SUCCESS;
+  if (mode_ == AggregateMode::FINAL) {
+    // 中间状态紧跟在分组key后面
+    int index = key_num();
+    for (size_t i = 0; i < aggregate_exprs_.size() && OB_SUCC(rc); i++) {
+      const int value_num = static_cast<const AggregateExpr *>(aggregate_exprs_[i].get())->partial_value_num();
+      values_.resize(value_num);
+      for (int j = 0; j < value_num && OB_SUCC(rc); j++) {
+        rc = tuple.cell_at(index++, values_[j]);
+      }
+      if (OB_SUCC(rc)) {
+        rc = aggregators[i]->merge(values_.data());
+      }
+    }
+    return rc;
+  }
+
+  values_.resize(1);
+  for (size_t i = 0; i < aggregate_exprs_.size() && OB_SUCC(rc); i++) {
+    const unique_ptr<Expression> &child = static_cast<const AggregateExpr *>(aggregate_exprs_[i].get())->child();
+    if (child) {
+      rc = child->get_value(tuple, values_[0]);
+    } else {
+      values_[0] = Value(1);  // COUNT(*)
+    }
+    if (OB_SUCC(rc)) {
+      rc = aggregators[i]->accumulate(values_[0]);
+    }
+  }
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to accumulate. rc=%s", strrc(rc));
+  }
+  return rc;
+}
+
+RC AggregatePhysicalOperator::set_output(const Value *keys, Aggregator *const *aggregators)
+{
+  values_.assign(keys, keys + key_num());
+  RC rc = RC::SUCCESS;
+  for (size_t i = 0; i < aggregate_exprs_.size() && OB_SUCC(rc); i++) {
+    if (mode_ == AggregateMode::PARTIAL) {
+      const size_t offset = values_.size();
+      values_.resize(offset + static_cast<const AggregateExpr *>(aggregate_exprs_[i].get())->partial_value_num());
+      rc = aggregators[i]->partial_evaluate(&values_[offset]);
+    } else {
+      values_.emplace_back();
+      rc = aggregators[i]->evaluate(values_.back());
+    }
+  }
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to evaluate aggregate result. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  tuple_.set_cells(values_);
+  return RC::SUCCESS;
+}
@@ -0,0 +1,99 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "sql/operator/physical_operator.h"
+#include "sql/expr/expression.h"
+#include "sql/expr/aggregator.h"
+#include "sql/expr/tuple.h"
+
+/**
+ * @brief 聚合的执行阶段
+ * @ingroup PhysicalOperator
+ * @details 两阶段聚合时，多个PARTIAL算子各自处理一部分数据，输出每个分组的中间状态，
+ * 再由一个FINAL算子合并相同分组的中间状态，得到最终结果。
+ */
+enum class AggregateMode
+{
+  COMPLETE,  ///< 一次完成聚合，输出聚合结果
+  PARTIAL,   ///< 第一阶段，输出中间状态
+  FINAL,     ///< 第二阶段，输入是PARTIAL算子的输出，合并中间状态后输出聚合结果
+};
+
+/**
+ * @brief 按行执行的聚合算子的基类
+ * @ingroup PhysicalOperator
+ * @details 输出的每一行依次是分组的key和每个聚合函数的结果，聚合函数的结果可以按照名字查找。
+ * PARTIAL模式下每个聚合函数输出 AggregateExpr::partial_value_num 个值。
+ * FINAL模式下子算子输出的格式与PARTIAL一致，按照位置读取key和中间状态，
+ * 不再计算分组表达式和聚合函数的参数。
+ */
+class AggregatePhysicalOperator : public PhysicalOperator
+{
+public:
+  /**
+   * @param group_by_exprs 分组表达式，为空时所有数据是一个分组
+   * @param aggregate_exprs 聚合函数，都是AggregateExpr
+   */
+  AggregatePhysicalOperator(std::vector<std::unique_ptr<Expression>> &&group_by_exprs,
+      std::vector<std::unique_ptr<Expression>> &&aggregate_exprs, AggregateMode mode);
+  virtual ~AggregatePhysicalOperator() = default;
+
+  std::string param() const override;
+
+  AggregateMode mode() const { return mode_; }
+
+  Tuple *current_tuple() override { return &tuple_; }
+
+  RC tuple_schema(TupleSchema &schema) const override
+  {
+    for (const TupleCellSpec &spec : tuple_.specs()) {
+      schema.append_cell(spec);
+    }
+    return RC::SUCCESS;
+  }
+
+protected:
+  int key_num() const { return static_cast<int>(group_by_exprs_.size()); }
+
+  std::vector<const AggregateExpr *> aggregates() const;
+
+  /**
+   * @brief 获取子算子输出的一行所属的分组
+   */
+  RC get_group_keys(const Tuple &tuple, std::vector<Value> &keys) const;
+
+  /**
+   * @brief 把子算子输出的一行累加到分组的聚合器中
+   */
+  RC accumulate(const Tuple &tuple, Aggregator *const *aggregators);
+
+  /**
+   * @brief 把一个分组的结果设置为当前输出的行
+   */
+  RC set_output(const Value *keys, Aggregator *const *aggregators);
+
+protected:
+  std::vector<std::unique_ptr<Expression>> group_by_exprs_;
+  std::vector<std::unique_ptr<Expression>> aggregate_exprs_;
+  AggregateMode                            mode_ = AggregateMode::COMPLETE;
+
+private:
+  std::vector<Value> values_;  ///< 计算聚合函数参数或者输出时使用的临时空间
+  ValueListTuple     tuple_;
+};
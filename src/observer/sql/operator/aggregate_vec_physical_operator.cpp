@@ -0,0 +1,107 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#include "common/log/log.h"
+#include "sql/operator/aggregate_vec_physical_operator.h"
+
+using namespace std;
+
+AggregateVecPhysicalOperator::AggregateVecPhysicalOperator(vector<unique_ptr<Expression>> &&expressions)
+    : aggregate_expressions_(std::move(expressions))
+{}
+
+RC AggregateVecPhysicalOperator::open(Trx *trx)
+{
+  if (children_.size() != 1) {
+    LOG_WARN("aggregate vec operator must has one child");
+    return RC::INTERNAL;
+  }
+
+  aggregators_.clear();
+  for (unique_ptr<Expression> &expr : aggregate_expressions_) {
+    ASSERT(expr->type() == ExprType::AGGREGATION, "expected an aggregate expression. got %d", expr->type());
+    aggregators_.push_back(static_cast<AggregateExpr *>(expr.get())->create_aggregator());
+  }
+  outputed_ = false;
+  return children_[0]->open(trx);
+}
+
+RC AggregateVecPhysicalOperator::aggregate(Chunk &chunk)
+{
+  RC rc = RC::SUCCESS;
+  Column column;
+  for (size_t i = 0; i < aggregate_expressions_.size(); i++) {
+    auto *aggregate_expr = static_cast<AggregateExpr *>(aggregate_expressions_[i].get());
+    if (aggregate_expr->child()) {
+      rc = aggregate_expr->child()->get_column(chunk, column);
+      if (OB_FAIL(rc)) {
+        LOG_WARN("failed to get column of aggregate argument. rc=%s", strrc(rc));
+        return rc;
+      }
+    } else {
+      // COUNT(*)
+      column.init(Value(1), chunk.rows());
+    }
+
+    rc = aggregators_[i]->accumulate(chunk, column);
+    if (OB_FAIL(rc)) {
+      LOG_WARN("failed to accumulate. rc=%s", strrc(rc));
+      return rc;
+    }
+  }
+  return rc;
+}
+
+RC AggregateVecPhysicalOperator::next(Chunk &chunk)
+{
+  if (outputed_) {
+    return RC::RECORD_EOF;
+  }
+
+  RC rc = RC::SUCCESS;
+  while (OB_SUCC(rc = children_[0]->next(child_chunk_))) {
+    rc = aggregate(child_chunk_);
+    if (OB_FAIL(rc)) {
+      return rc;
+    }
+  }
+
+  if (rc != RC::RECORD_EOF) {
+    LOG_WARN("failed to get next chunk from child. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  chunk.reset();
+  for (size_t i = 0; i < aggregators_.size(); i++) {
+    Value value;
+    rc = aggregators_[i]->evaluate(value);
+    if (OB_FAIL(rc)) {
+      return rc;
+    }
+
+    const int attr_len = value.attr_type() == CHARS ? max(value.length(), 1) : static_cast<int>(sizeof(int));
+    auto column = make_unique<Column>(value.attr_type(), attr_len, 1);
+    column->append_value(value);
+    chunk.add_column(std::move(column), static_cast<int>(i));
+  }
+
+  outputed_ = true;
+  return RC::SUCCESS;
+}
+
+RC AggregateVecPhysicalOperator::close()
+{
+  children_[0]->close();
+  return RC::SUCCESS;
+}
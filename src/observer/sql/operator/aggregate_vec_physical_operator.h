@@ -0,0 +1,56 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#pragma once
+
+#include <memory>
+#include "sql/operator/physical_operator.h"
+#include "sql/expr/expression.h"
+#include "sql/expr/aggregator.h"
+#include "storage/common/chunk.h"
+
+/**
+ * @brief 向量化的聚合物理算子(不带分组)
+ * @ingroup PhysicalOperator
+ * @details 消费子算子所有的chunk，每个聚合函数按列累加，最终输出只有一行的chunk，
+ * 第i个聚合函数的结果是ID为i的列。
+ */
+class AggregateVecPhysicalOperator : public PhysicalOperator
+{
+public:
+  AggregateVecPhysicalOperator(std::vector<std::unique_ptr<Expression>> &&expressions);
+
+  virtual ~AggregateVecPhysicalOperator() = default;
+
+  PhysicalOperatorType type() const override
+  {
+    return PhysicalOperatorType::AGGREGATE_VEC;
+  }
+
+  RC open(Trx *trx) override;
+  RC next() override { return RC::UNIMPLENMENT; }
+  RC next(Chunk &chunk) override;
+  RC close() override;
+
+  Tuple *current_tuple() override { return nullptr; }
+
+private:
+  RC aggregate(Chunk &chunk);
+
+private:
+  std::vector<std::unique_ptr<Expression>> aggregate_expressions_;  ///< 都是AggregateExpr
+  std::vector<std::unique_ptr<Aggregator>> aggregators_;
+  Chunk                                    child_chunk_;
+  bool                                     outputed_ = false;
+};
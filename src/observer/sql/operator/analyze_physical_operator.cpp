@@ -0,0 +1,99 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+//
+// Created by agent on 2026/10/18.
+//
+
+#include <unordered_set>
+
+#include "sql/operator/analyze_physical_operator.h"
+#include "sql/operator/exchange_physical_operator.h"
+#include "storage/buffer/disk_buffer_pool.h"
+#include "storage/common/chunk.h"
+#include "common/time/cycle_timer.h"
+
+using namespace std;
+
+AnalyzePhysicalOperator::Snapshot AnalyzePhysicalOperator::snapshot()
+{
+  const BufferPoolAccessStats &buffer_stats = BufferPoolAccessStats::current();
+  return Snapshot{common::CycleTimer::now(), buffer_stats.hits, buffer_stats.misses};
+}
+
+void AnalyzePhysicalOperator::record(const Snapshot &start)
+{
+  const Snapshot end = snapshot();
+  stats_.cycles += end.cycles - start.cycles;
+  stats_.buffer_hits += end.buffer_hits - start.buffer_hits;
+  stats_.buffer_misses += end.buffer_misses - start.buffer_misses;
+}
+
+RC AnalyzePhysicalOperator::open(Trx *trx)
+{
+  const Snapshot start = snapshot();
+  RC rc = children_[0]->open(trx);
+  record(start);
+  stats_.loops++;
+  return rc;
+}
+
+RC AnalyzePhysicalOperator::next()
+{
+  const Snapshot start = snapshot();
+  RC rc = children_[0]->next();
+  record(start);
+  if (OB_SUCC(rc)) {
+    stats_.rows++;
+  }
+  return rc;
+}
+
+RC AnalyzePhysicalOperator::next(Chunk &chunk)
+{
+  const Snapshot start = snapshot();
+  RC rc = children_[0]->next(chunk);
+  record(start);
+  if (OB_SUCC(rc)) {
+    stats_.rows += chunk.rows();
+  }
+  return rc;
+}
+
+RC AnalyzePhysicalOperator::close()
+{
+  const Snapshot start = snapshot();
+  RC rc = children_[0]->close();
+  record(start);
+  return rc;
+}
+
+static void instrument_tree(unique_ptr<PhysicalOperator> &oper, unordered_set<Exchange *> &exchanges)
+{
+  if (oper->type() == PhysicalOperatorType::EXCHANGE) {
+    // 同一个Exchange可能有多个接收者，生产者只需要包装一次
+    Exchange *exchange = static_cast<ExchangePhysicalOperator *>(oper.get())->exchange();
+    if (exchanges.insert(exchange).second) {
+      for (unique_ptr<PhysicalOperator> &producer : exchange->producers()) {
+        instrument_tree(producer, exchanges);
+      }
+    }
+  }
+
+  for (unique_ptr<PhysicalOperator> &child : oper->children()) {
+    instrument_tree(child, exchanges);
+  }
+  oper = make_unique<AnalyzePhysicalOperator>(std::move(oper));
+}
+
+void AnalyzePhysicalOperator::instrument(unique_ptr<PhysicalOperator> &oper)
+{
+  unordered_set<Exchange *> exchanges;
+  instrument_tree(oper, exchanges);
+}
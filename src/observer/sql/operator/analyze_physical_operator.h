@@ -0,0 +1,92 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+//
+// Created by agent on 2026/10/18.
+//
+
+#pragma once
+
+#include <stdint.h>
+
+#include "sql/operator/physical_operator.h"
+
+/**
+ * @brief 算子执行过程中的统计
+ * @ingroup PhysicalOperator
+ * @details 时间和访问的页面数都包含子算子的部分
+ */
+struct OperatorStats
+{
+  int64_t  rows          = 0;  ///< 输出的行数
+  int64_t  loops         = 0;  ///< open的次数
+  uint64_t cycles        = 0;  ///< 执行的时间，见 common::CycleTimer
+  uint64_t buffer_hits   = 0;  ///< 访问的页面已经在buffer pool中
+  uint64_t buffer_misses = 0;  ///< 访问的页面需要从磁盘读取
+
+  void merge(const OperatorStats &other)
+  {
+    rows += other.rows;
+    loops += other.loops;
+    cycles += other.cycles;
+    buffer_hits += other.buffer_hits;
+    buffer_misses += other.buffer_misses;
+  }
+};
+
+/**
+ * @brief 统计子算子执行情况的算子，EXPLAIN ANALYZE 时使用
+ * @ingroup PhysicalOperator
+ * @details 执行之前包装在执行计划的每个算子外面，唯一的子算子就是被统计的算子，
+ * 除了记录open/next/close的耗时、输出的行数和访问的页面数之外，不做任何事情。
+ * 每个实例只在一个线程中执行，统计时不需要同步。
+ */
+class AnalyzePhysicalOperator : public PhysicalOperator
+{
+public:
+  explicit AnalyzePhysicalOperator(std::unique_ptr<PhysicalOperator> oper) { add_child(std::move(oper)); }
+  virtual ~AnalyzePhysicalOperator() = default;
+
+  PhysicalOperatorType type() const override { return PhysicalOperatorType::ANALYZE; }
+
+  RC open(Trx *trx) override;
+  RC next() override;
+  RC next(Chunk &chunk) override;
+  RC close() override;
+  Tuple *current_tuple() override { return children_[0]->current_tuple(); }
+
+  RC      tuple_schema(TupleSchema &schema) const override { return children_[0]->tuple_schema(schema); }
+  int64_t peak_memory() const override { return children_[0]->peak_memory(); }
+
+  /**
+   * @brief 被统计的算子
+   */
+  PhysicalOperator *target() const { return children_[0].get(); }
+
+  const OperatorStats &stats() const { return stats_; }
+
+  /**
+   * @brief 在执行计划的每个算子外面包装一个AnalyzePhysicalOperator，包括并行执行的计划片段
+   */
+  static void instrument(std::unique_ptr<PhysicalOperator> &oper);
+
+private:
+  struct Snapshot
+  {
+    uint64_t cycles;
+    uint64_t buffer_hits;
+    uint64_t buffer_misses;
+  };
+
+  static Snapshot snapshot();
+  void            record(const Snapshot &start);
+
+private:
+  OperatorStats stats_;
+};
@@ -0,0 +1,378 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#include <algorithm>
+
+#include "sql/operator/exchange_physical_operator.h"
+#include "sql/operator/exchange_worker_pool.h"
+#include "sql/operator/join_hash_table.h"
+#include "common/log/log.h"
+#include "common/mm/arena.h"
+#include "common/mm/memory_tracker.h"
+
+using namespace std;
+
+Exchange::Exchange(
+    ExchangeMode mode, ExchangeWorkerPool *pool, vector<unique_ptr<PhysicalOperator>> producers, int receiver_num)
+    : mode_(mode), pool_(pool), producers_(std::move(producers))
+{
+  ASSERT(receiver_num > 0 && (mode != ExchangeMode::GATHER || receiver_num == 1),
+         "invalid receiver num. mode=%d, receiver num=%d", static_cast<int>(mode), receiver_num);
+  for (int i = 0; i < receiver_num; i++) {
+    queues_.emplace_back(new Queue(QUEUE_CAPACITY));
+  }
+  receiver_closed_ = make_unique<atomic<bool>[]>(receiver_num);
+}
+
+Exchange::~Exchange()
+{
+  // 生产者的任务可能还在访问算子，需要在销毁算子之前结束
+  if (!group_.empty()) {
+    stop();
+  }
+}
+
+string Exchange::param() const
+{
+  string result;
+  switch (mode_) {
+    case ExchangeMode::GATHER: {
+      result = "GATHER";
+    } break;
+    case ExchangeMode::REPARTITION: {
+      result = "REPARTITION BY ";
+      const vector<unique_ptr<Expression>> &keys = partition_keys_.front();
+      for (size_t i = 0; i < keys.size(); i++) {
+        result += (i == 0 ? "" : ", ") + keys[i]->name();
+      }
+    } break;
+    case ExchangeMode::BROADCAST: {
+      result = "BROADCAST";
+    } break;
+  }
+  return result + ", dop=" + to_string(producer_num());
+}
+
+RC Exchange::tuple_schema(TupleSchema &schema) const { return producers_.front()->tuple_schema(schema); }
+
+void Exchange::collect(vector<Exchange *> &exchanges)
+{
+  if (find(exchanges.begin(), exchanges.end(), this) != exchanges.end()) {
+    return;
+  }
+  exchanges.push_back(this);
+
+  // 同一个Exchange的多个接收者分布在不同的片段中，只需要收集一次
+  vector<PhysicalOperator *> opers;
+  for (unique_ptr<PhysicalOperator> &producer : producers_) {
+    opers.push_back(producer.get());
+  }
+  while (!opers.empty()) {
+    PhysicalOperator *oper = opers.back();
+    opers.pop_back();
+    if (oper->type() == PhysicalOperatorType::EXCHANGE) {
+      static_cast<ExchangePhysicalOperator *>(oper)->exchange()->collect(exchanges);
+    }
+    for (unique_ptr<PhysicalOperator> &child : oper->children()) {
+      opers.push_back(child.get());
+    }
+  }
+}
+
+void Exchange::reset(Trx *trx)
+{
+  trx_ = trx;
+  for (int i = 0; i < receiver_num(); i++) {
+    shared_ptr<const ExchangeBatch> batch;
+    while (queues_[i]->try_pop(batch)) {
+    }
+    receiver_closed_[i].store(false);
+  }
+  running_producers_.store(producer_num());
+  cancelled_.store(false);
+  error_.store(static_cast<int>(RC::SUCCESS));
+}
+
+RC Exchange::start(Trx *trx)
+{
+  ASSERT(mode_ == ExchangeMode::GATHER, "only gather exchange can be started");
+  if (!group_.empty()) {
+    stop();
+  }
+
+  collect(group_);
+
+  // 生产者在工作线程中执行，算子使用的内存也要记录到当前查询中
+  common::MemoryTracker   *memory_tracker = common::MemoryTracker::current();
+  common::QueryArena      *query_arena    = common::QueryArena::current();
+  vector<function<void()>> tasks;
+  for (Exchange *exchange : group_) {
+    exchange->reset(trx);
+    for (int i = 0; i < exchange->producer_num(); i++) {
+      tasks.emplace_back([this, exchange, i, memory_tracker, query_arena]() {
+        common::MemoryTracker *old_tracker = common::MemoryTracker::current();
+        common::QueryArena    *old_arena   = common::QueryArena::current();
+        common::MemoryTracker::set_current(memory_tracker);
+        common::QueryArena::set_current(query_arena);
+        exchange->run_producer(i);
+        common::QueryArena::set_current(old_arena);
+        common::MemoryTracker::set_current(old_tracker);
+        task_done();
+      });
+    }
+  }
+
+  running_tasks_ = static_cast<int>(tasks.size());
+  RC rc = pool_->execute(std::move(tasks));
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to start exchange tasks. rc=%s", strrc(rc));
+    running_tasks_ = 0;
+    group_.clear();
+    return rc;
+  }
+  LOG_TRACE("exchange started. exchange num=%d, task num=%d", static_cast<int>(group_.size()), running_tasks_);
+  return RC::SUCCESS;
+}
+
+void Exchange::stop()
+{
+  for (Exchange *exchange : group_) {
+    exchange->cancelled_.store(true);
+  }
+
+  unique_lock<mutex> lock(task_mutex_);
+  task_cond_.wait(lock, [this]() { return running_tasks_ == 0; });
+  group_.clear();
+}
+
+void Exchange::task_done()
+{
+  lock_guard<mutex> guard(task_mutex_);
+  if (--running_tasks_ == 0) {
+    task_cond_.notify_all();
+  }
+}
+
+void Exchange::cancel(RC rc)
+{
+  int expected = static_cast<int>(RC::SUCCESS);
+  error_.compare_exchange_strong(expected, static_cast<int>(rc));
+  cancelled_.store(true);
+}
+
+RC Exchange::route(int index, const Tuple &tuple, vector<Value> &keys, int &receiver) const
+{
+  if (mode_ != ExchangeMode::REPARTITION) {
+    receiver = 0;
+    return RC::SUCCESS;
+  }
+
+  const vector<unique_ptr<Expression>> &key_exprs = partition_keys_[index];
+  keys.resize(key_exprs.size());
+  for (size_t i = 0; i < key_exprs.size(); i++) {
+    RC rc = key_exprs[i]->get_value(tuple, keys[i]);
+    if (OB_FAIL(rc)) {
+      LOG_WARN("failed to get partition key. rc=%s", strrc(rc));
+      return rc;
+    }
+  }
+
+  // 接收者用低位定位hash表的槽位，这里使用高位，避免同一个接收者的数据集中在部分槽位上
+  const uint64_t hash = JoinHashTable::hash_keys(keys.data(), static_cast<int>(keys.size()));
+  receiver            = static_cast<int>((hash >> 32) % static_cast<uint64_t>(receiver_num()));
+  return RC::SUCCESS;
+}
+
+void Exchange::push(int receiver, shared_ptr<const ExchangeBatch> batch)
+{
+  ExchangeBackoff backoff;
+  while (!queues_[receiver]->try_push(batch)) {
+    if (cancelled_.load(memory_order_relaxed) || receiver_closed_[receiver].load(memory_order_relaxed)) {
+      return;
+    }
+    backoff.wait();
+  }
+}
+
+RC Exchange::flush(int receiver, shared_ptr<ExchangeBatch> &batch)
+{
+  if (!batch || batch->rows == 0) {
+    return RC::SUCCESS;
+  }
+
+  if (mode_ == ExchangeMode::BROADCAST) {
+    // 所有接收者共享同一批数据
+    for (int i = 0; i < receiver_num(); i++) {
+      push(i, batch);
+    }
+  } else {
+    push(receiver, batch);
+  }
+  batch.reset();
+  return cancelled_.load() ? RC::RECORD_EOF : RC::SUCCESS;
+}
+
+void Exchange::run_producer(int index)
+{
+  PhysicalOperator &producer = *producers_[index];
+
+  RC rc = producer.open(trx_);
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to open exchange producer. index=%d, rc=%s", index, strrc(rc));
+  }
+
+  vector<shared_ptr<ExchangeBatch>> batches(mode_ == ExchangeMode::REPARTITION ? receiver_num() : 1);
+  vector<Value>                     keys;
+  Value                             cell;
+  while (OB_SUCC(rc) && !cancelled_.load(memory_order_relaxed)) {
+    rc = producer.next();
+    if (OB_FAIL(rc)) {
+      break;
+    }
+
+    Tuple *tuple    = producer.current_tuple();
+    int    receiver = 0;
+    rc              = route(index, *tuple, keys, receiver);
+    if (OB_FAIL(rc)) {
+      break;
+    }
+
+    shared_ptr<ExchangeBatch> &batch = batches[mode_ == ExchangeMode::REPARTITION ? receiver : 0];
+    if (!batch) {
+      batch = make_shared<ExchangeBatch>();
+      batch->values.reserve(static_cast<size_t>(BATCH_ROWS) * tuple->cell_num());
+    }
+    for (int i = 0; i < tuple->cell_num(); i++) {
+      rc = tuple->cell_at(i, cell);
+      if (OB_FAIL(rc)) {
+        break;
+      }
+      batch->values.push_back(cell);
+    }
+    batch->rows++;
+    if (OB_SUCC(rc) && batch->rows >= BATCH_ROWS) {
+      rc = flush(receiver, batch);
+    }
+  }
+
+  if (rc == RC::RECORD_EOF) {
+    rc = RC::SUCCESS;
+    for (size_t i = 0; i < batches.size() && OB_SUCC(rc); i++) {
+      rc = flush(static_cast<int>(i), batches[i]);
+    }
+    rc = rc == RC::RECORD_EOF ? RC::SUCCESS : rc;
+  }
+  producer.close();
+
+  if (OB_FAIL(rc)) {
+    LOG_WARN("exchange producer failed. index=%d, rc=%s", index, strrc(rc));
+    cancel(rc);
+  }
+
+  // 最后一个结束的生产者通知所有的接收者
+  if (running_producers_.fetch_sub(1) == 1) {
+    for (int i = 0; i < receiver_num(); i++) {
+      push(i, nullptr);
+    }
+  }
+}
+
+RC Exchange::pop(int receiver, shared_ptr<const ExchangeBatch> &batch)
+{
+  ExchangeBackoff backoff;
+  while (true) {
+    if (queues_[receiver]->try_pop(batch)) {
+      if (batch) {
+        return RC::SUCCESS;
+      }
+      break;
+    }
+    if (cancelled_.load(memory_order_relaxed)) {
+      break;
+    }
+    backoff.wait();
+  }
+
+  const RC rc = static_cast<RC>(error_.load());
+  if (OB_FAIL(rc)) {
+    return rc;
+  }
+  return RC::RECORD_EOF;
+}
+
+void Exchange::close_receiver(int receiver) { receiver_closed_[receiver].store(true); }
+
+////////////////////////////////////////////////////////////////////////////////
+ExchangePhysicalOperator::ExchangePhysicalOperator(shared_ptr<Exchange> exchange, int receiver)
+    : exchange_(std::move(exchange)), receiver_(receiver)
+{
+  TupleSchema schema;
+  if (OB_SUCC(exchange_->tuple_schema(schema))) {
+    tuple_.set_specs(schema.cells());
+  }
+}
+
+ExchangePhysicalOperator::~ExchangePhysicalOperator() = default;
+
+string ExchangePhysicalOperator::param() const { return exchange_->param(); }
+
+RC ExchangePhysicalOperator::open(Trx *trx)
+{
+  batch_.reset();
+  row_ = 0;
+  eof_ = false;
+  if (exchange_->mode() != ExchangeMode::GATHER) {
+    // 嵌套的Exchange由最上层的GATHER启动
+    return RC::SUCCESS;
+  }
+
+  RC rc = exchange_->start(trx);
+  started_ = OB_SUCC(rc);
+  return rc;
+}
+
+RC ExchangePhysicalOperator::next()
+{
+  if (eof_) {
+    return RC::RECORD_EOF;
+  }
+  if (batch_ && ++row_ < batch_->rows) {
+    tuple_.set_cells(&batch_->values[static_cast<size_t>(row_) * cell_num_], cell_num_);
+    return RC::SUCCESS;
+  }
+
+  RC rc = exchange_->pop(receiver_, batch_);
+  if (OB_FAIL(rc)) {
+    batch_.reset();
+    eof_ = true;
+    return rc;
+  }
+
+  row_      = 0;
+  cell_num_ = static_cast<int>(batch_->values.size()) / batch_->rows;
+  tuple_.set_cells(batch_->values.data(), cell_num_);
+  return RC::SUCCESS;
+}
+
+RC ExchangePhysicalOperator::close()
+{
+  batch_.reset();
+  exchange_->close_receiver(receiver_);
+  if (started_) {
+    exchange_->stop();
+    started_ = false;
+  }
+  return RC::SUCCESS;
+}
@@ -0,0 +1,196 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "sql/expr/expression.h"
+#include "sql/operator/exchange_queue.h"
+#include "sql/operator/physical_operator.h"
+
+class ExchangeWorkerPool;
+
+/**
+ * @brief 数据在Exchange的生产者和接收者之间的分发方式
+ * @ingroup PhysicalOperator
+ */
+enum class ExchangeMode
+{
+  GATHER,       ///< 所有生产者的数据发给唯一的接收者
+  REPARTITION,  ///< 按照key的hash值发给其中一个接收者，key相同的行由同一个接收者处理
+  BROADCAST,    ///< 每一行都发给所有的接收者
+};
+
+/**
+ * @brief 在线程之间传递的一批数据，按行连续存放
+ */
+struct ExchangeBatch
+{
+  std::vector<Value> values;
+  int                rows = 0;
+};
+
+/**
+ * @brief 并行执行的一个数据交换点，由多个生产者和多个接收者共享
+ * @ingroup PhysicalOperator
+ * @details 每个生产者是一个计划片段，在 ExchangeWorkerPool 的线程中执行，输出的行按照分发方式
+ * 攒成批放到接收者各自的 ExchangeQueue 中。接收者是 ExchangePhysicalOperator，位于上层的计划片段中，
+ * 从自己的队列中读取数据。
+ *
+ * 计划中最上层的Exchange是GATHER，它的接收者在SQL线程中执行。GATHER在open时找到片段中嵌套的
+ * 所有Exchange，把它们的生产者作为一组任务一起提交给线程池，close时取消并等待所有的任务结束。
+ * 嵌套的Exchange自己不会启动。
+ */
+class Exchange
+{
+public:
+  /**
+   * @param producers 生产者，每个生产者输出的格式相同
+   * @param receiver_num 接收者的个数，GATHER只有一个接收者
+   */
+  Exchange(ExchangeMode mode, ExchangeWorkerPool *pool, std::vector<std::unique_ptr<PhysicalOperator>> producers,
+      int receiver_num);
+  ~Exchange();
+
+  /**
+   * @brief REPARTITION时使用的key，每个生产者一组，绑定在生产者的输出上
+   */
+  void set_partition_keys(std::vector<std::vector<std::unique_ptr<Expression>>> keys)
+  {
+    partition_keys_ = std::move(keys);
+  }
+
+  ExchangeMode mode() const { return mode_; }
+  int          producer_num() const { return static_cast<int>(producers_.size()); }
+  int          receiver_num() const { return static_cast<int>(queues_.size()); }
+  PhysicalOperator *producer(int index) const { return producers_[index].get(); }
+
+  /**
+   * @brief 执行之前替换生产者，比如 EXPLAIN ANALYZE 时包装统计算子
+   */
+  std::vector<std::unique_ptr<PhysicalOperator>> &producers() { return producers_; }
+
+  std::string param() const;
+
+  RC tuple_schema(TupleSchema &schema) const;
+
+  /**
+   * @brief 启动这个Exchange以及片段中嵌套的所有Exchange的生产者，只在GATHER上调用
+   */
+  RC start(Trx *trx);
+
+  /**
+   * @brief 取消所有还在执行的生产者并等待结束，只在GATHER上调用
+   */
+  void stop();
+
+  /**
+   * @brief 接收者读取下一批数据
+   * @return 所有生产者都结束之后返回RECORD_EOF，生产者出错时返回错误
+   */
+  RC pop(int receiver, std::shared_ptr<const ExchangeBatch> &batch);
+
+  /**
+   * @brief 接收者不再读取数据，之后发给它的数据直接丢弃
+   */
+  void close_receiver(int receiver);
+
+  /**
+   * @brief 生产者每攒够这么多行发送一次
+   */
+  static constexpr int BATCH_ROWS = 256;
+
+  /**
+   * @brief 每个接收者的队列中最多缓存的批数
+   */
+  static constexpr int QUEUE_CAPACITY = 16;
+
+private:
+  void collect(std::vector<Exchange *> &exchanges);
+  void reset(Trx *trx);
+  void run_producer(int index);
+  RC   route(int index, const Tuple &tuple, std::vector<Value> &keys, int &receiver) const;
+  void push(int receiver, std::shared_ptr<const ExchangeBatch> batch);
+  RC   flush(int receiver, std::shared_ptr<ExchangeBatch> &batch);
+  void cancel(RC rc);
+  void task_done();
+
+private:
+  using Queue = ExchangeQueue<std::shared_ptr<const ExchangeBatch>>;
+
+  ExchangeMode                                          mode_;
+  ExchangeWorkerPool                                   *pool_ = nullptr;
+  std::vector<std::unique_ptr<PhysicalOperator>>        producers_;
+  std::vector<std::vector<std::unique_ptr<Expression>>> partition_keys_;
+  std::vector<std::unique_ptr<Queue>>                   queues_;
+  std::unique_ptr<std::atomic<bool>[]>                  receiver_closed_;
+
+  Trx              *trx_ = nullptr;
+  std::atomic<int>  running_producers_{0};
+  std::atomic<bool> cancelled_{false};
+  std::atomic<int>  error_{static_cast<int>(RC::SUCCESS)};  ///< 第一个出错的生产者返回的错误
+
+  // 以下只在GATHER上使用，记录一起启动的所有任务
+  std::vector<Exchange *> group_;
+  std::mutex              task_mutex_;
+  std::condition_variable task_cond_;
+  int                     running_tasks_ = 0;
+};
+
+/**
+ * @brief Exchange的接收端，从Exchange中读取发给自己的数据
+ * @ingroup PhysicalOperator
+ * @details 没有子算子，生产者由Exchange持有。explain时显示第一个生产者的计划片段。
+ */
+class ExchangePhysicalOperator : public PhysicalOperator
+{
+public:
+  ExchangePhysicalOperator(std::shared_ptr<Exchange> exchange, int receiver);
+  virtual ~ExchangePhysicalOperator();
+
+  PhysicalOperatorType type() const override { return PhysicalOperatorType::EXCHANGE; }
+
+  std::string param() const override;
+
+  RC open(Trx *trx) override;
+  RC next() override;
+  RC close() override;
+
+  Tuple *current_tuple() override { return &tuple_; }
+
+  RC tuple_schema(TupleSchema &schema) const override { return exchange_->tuple_schema(schema); }
+
+  /**
+   * @brief 生产者的计划片段，用于explain
+   */
+  PhysicalOperator *fragment() const { return exchange_->producer(0); }
+
+  Exchange *exchange() const { return exchange_.get(); }
+
+private:
+  std::shared_ptr<Exchange>            exchange_;
+  int                                  receiver_ = 0;
+  bool                                 started_  = false;
+  bool                                 eof_      = false;
+  std::shared_ptr<const ExchangeBatch> batch_;
+  int                                  row_ = 0;
+  int                                  cell_num_ = 0;
+  ValueListTuple                       tuple_;
+};
@@ -0,0 +1,148 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#pragma once
+
+#include <stddef.h>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+
+/**
+ * @brief 有界的多生产者多消费者无锁队列
+ * @ingroup PhysicalOperator
+ * @details 用于Exchange算子在线程之间传递数据。实现是一个环形数组，每个槽位有一个序号：
+ * 序号等于写入位置时可以写入，等于写入位置+1时可以读取。生产者和消费者分别通过CAS
+ * 推进写入和读取的位置，互不阻塞。队列满或者空时try_push/try_pop直接返回false，
+ * 由调用方决定等待的方式，见 ExchangeBackoff。
+ */
+template <typename T>
+class ExchangeQueue
+{
+public:
+  /**
+   * @param capacity 队列的容量，向上取整到2的幂
+   */
+  explicit ExchangeQueue(size_t capacity)
+  {
+    capacity_ = 2;
+    while (capacity_ < capacity) {
+      capacity_ <<= 1;
+    }
+    mask_  = capacity_ - 1;
+    slots_ = std::make_unique<Slot[]>(capacity_);
+    for (size_t i = 0; i < capacity_; i++) {
+      slots_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  ExchangeQueue(const ExchangeQueue &)            = delete;
+  ExchangeQueue &operator=(const ExchangeQueue &) = delete;
+
+  size_t capacity() const { return capacity_; }
+
+  /**
+   * @brief 写入一个元素，成功时item被移走，队列满时返回false
+   */
+  bool try_push(T &item)
+  {
+    size_t pos = push_pos_.load(std::memory_order_relaxed);
+    while (true) {
+      Slot        &slot     = slots_[pos & mask_];
+      const size_t sequence = slot.sequence.load(std::memory_order_acquire);
+      const auto   diff     = static_cast<ptrdiff_t>(sequence) - static_cast<ptrdiff_t>(pos);
+      if (diff == 0) {
+        if (push_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          slot.item = std::move(item);
+          slot.sequence.store(pos + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = push_pos_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  /**
+   * @brief 读取一个元素，队列空时返回false
+   */
+  bool try_pop(T &item)
+  {
+    size_t pos = pop_pos_.load(std::memory_order_relaxed);
+    while (true) {
+      Slot        &slot     = slots_[pos & mask_];
+      const size_t sequence = slot.sequence.load(std::memory_order_acquire);
+      const auto   diff     = static_cast<ptrdiff_t>(sequence) - static_cast<ptrdiff_t>(pos + 1);
+      if (diff == 0) {
+        if (pop_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          item = std::move(slot.item);
+          slot.item = T();
+          slot.sequence.store(pos + mask_ + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = pop_pos_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+private:
+  struct Slot
+  {
+    std::atomic<size_t> sequence{0};
+    T                   item;
+  };
+
+  std::unique_ptr<Slot[]> slots_;
+  size_t                  capacity_ = 0;
+  size_t                  mask_     = 0;
+
+  // 读写位置放在不同的cache line上，避免生产者和消费者相互干扰
+  alignas(64) std::atomic<size_t> push_pos_{0};
+  alignas(64) std::atomic<size_t> pop_pos_{0};
+};
+
+/**
+ * @brief 等待无锁队列时的退避策略
+ * @details 先空转，再让出CPU，最后短暂休眠，避免长时间等待时占用CPU
+ */
+class ExchangeBackoff
+{
+public:
+  void wait()
+  {
+    if (++count_ <= SPIN_COUNT) {
+      return;
+    }
+    if (count_ <= SPIN_COUNT + YIELD_COUNT) {
+      std::this_thread::yield();
+      return;
+    }
+    std::this_thread::sleep_for(std::chrono::microseconds(50));
+  }
+
+  void reset() { count_ = 0; }
+
+private:
+  static constexpr int SPIN_COUNT  = 64;
+  static constexpr int YIELD_COUNT = 64;
+
+  int count_ = 0;
+};
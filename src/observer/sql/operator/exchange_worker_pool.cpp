@@ -0,0 +1,97 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#include "sql/operator/exchange_worker_pool.h"
+#include "common/log/log.h"
+
+using namespace std;
+
+ExchangeWorkerPool::~ExchangeWorkerPool() { cleanup(); }
+
+RC ExchangeWorkerPool::init(int thread_num)
+{
+  if (thread_num <= 0 || !threads_.empty()) {
+    return RC::INVALID_ARGUMENT;
+  }
+
+  stopped_ = false;
+  for (int i = 0; i < thread_num; i++) {
+    threads_.emplace_back([this]() { run(); });
+  }
+  LOG_INFO("exchange worker pool started. thread num=%d", thread_num);
+  return RC::SUCCESS;
+}
+
+void ExchangeWorkerPool::cleanup()
+{
+  {
+    lock_guard<mutex> guard(mutex_);
+    stopped_ = true;
+  }
+  task_cond_.notify_all();
+  idle_cond_.notify_all();
+
+  for (thread &t : threads_) {
+    t.join();
+  }
+  threads_.clear();
+}
+
+RC ExchangeWorkerPool::execute(vector<function<void()>> tasks)
+{
+  const int task_num = static_cast<int>(tasks.size());
+  if (task_num > thread_num()) {
+    LOG_WARN("too many tasks. task num=%d, thread num=%d", task_num, thread_num());
+    return RC::INVALID_ARGUMENT;
+  }
+
+  unique_lock<mutex> lock(mutex_);
+  idle_cond_.wait(lock, [this, task_num]() { return stopped_ || busy_num_ + task_num <= thread_num(); });
+  if (stopped_) {
+    return RC::INTERNAL;
+  }
+
+  busy_num_ += task_num;
+  for (function<void()> &task : tasks) {
+    tasks_.emplace_back(std::move(task));
+  }
+  lock.unlock();
+  task_cond_.notify_all();
+  return RC::SUCCESS;
+}
+
+void ExchangeWorkerPool::run()
+{
+  while (true) {
+    function<void()> task;
+    {
+      unique_lock<mutex> lock(mutex_);
+      task_cond_.wait(lock, [this]() { return stopped_ || !tasks_.empty(); });
+      if (tasks_.empty()) {
+        return;
+      }
+      task = std::move(tasks_.front());
+      tasks_.pop_front();
+    }
+
+    task();
+
+    {
+      lock_guard<mutex> guard(mutex_);
+      busy_num_--;
+    }
+    idle_cond_.notify_all();
+  }
+}
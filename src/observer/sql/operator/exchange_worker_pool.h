@@ -0,0 +1,63 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "common/rc.h"
+
+/**
+ * @brief 并行查询使用的线程池
+ * @ingroup PhysicalOperator
+ * @details 与处理请求的SQL线程分开，并行查询占满这里的线程时也不影响其它请求的处理。
+ * 一个查询的所有任务通过一次execute提交，只有空闲线程足够同时运行所有任务时才开始执行，
+ * 否则等待其它查询的任务结束。任务之间通过队列相互等待，同时运行可以保证不会死锁，
+ * 同时也限制了并行查询的并发数。
+ */
+class ExchangeWorkerPool
+{
+public:
+  ExchangeWorkerPool() = default;
+  ~ExchangeWorkerPool();
+
+  RC   init(int thread_num);
+  void cleanup();
+
+  int thread_num() const { return static_cast<int>(threads_.size()); }
+
+  /**
+   * @brief 提交一组任务，等到有足够的空闲线程时同时开始执行，不等待任务结束
+   * @details 任务的个数不能超过线程数
+   */
+  RC execute(std::vector<std::function<void()>> tasks);
+
+private:
+  void run();
+
+private:
+  std::vector<std::thread>          threads_;
+  std::mutex                        mutex_;
+  std::condition_variable           task_cond_;  ///< 有新的任务
+  std::condition_variable           idle_cond_;  ///< 有任务结束，空闲线程增加
+  std::deque<std::function<void()>> tasks_;
+  int                               busy_num_ = 0;  ///< 已经提交还没有结束的任务数
+  bool                              stopped_  = false;
+};
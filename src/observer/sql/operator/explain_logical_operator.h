@@ -23,7 +23,7 @@ See the Mulan PSL v2 for more details. */
 class ExplainLogicalOperator : public LogicalOperator 
 {
 public:
-  ExplainLogicalOperator() = default;
+  explicit ExplainLogicalOperator(bool analyze = false) : analyze_(analyze) {}
   virtual ~ExplainLogicalOperator() = default;
 
   LogicalOperatorType type() const override
@@ -31,5 +31,11 @@ public:
     return LogicalOperatorType::EXPLAIN;
   }
 
+  bool analyze() const
+  {
+    return analyze_;
+  }
+
 private:
+  bool analyze_ = false;  ///< 执行之后输出每个算子的统计
 };
@@ -13,31 +13,103 @@ See the Mulan PSL v2 for more details. */
 //
 
 #include <sstream>
+#include <unordered_set>
+
 #include "sql/operator/explain_physical_operator.h"
+#include "sql/operator/analyze_physical_operator.h"
+#include "sql/operator/exchange_physical_operator.h"
 #include "common/log/log.h"
+#include "common/mm/memory_tracker.h"
+#include "common/time/cycle_timer.h"
 
 using namespace std;
 
-RC ExplainPhysicalOperator::open(Trx *)
+static string format_time(uint64_t cycles)
+{
+  char buf[32];
+  snprintf(buf, sizeof(buf), "%.3fms", common::CycleTimer::to_nanos(cycles) / 1000000.0);
+  return buf;
+}
+
+static string format_bytes(int64_t bytes)
+{
+  char buf[32];
+  if (bytes >= 1024 * 1024) {
+    snprintf(buf, sizeof(buf), "%.1fMB", bytes / (1024.0 * 1024.0));
+  } else if (bytes >= 1024) {
+    snprintf(buf, sizeof(buf), "%.1fKB", bytes / 1024.0);
+  } else {
+    snprintf(buf, sizeof(buf), "%ldB", static_cast<long>(bytes));
+  }
+  return buf;
+}
+
+RC ExplainPhysicalOperator::open(Trx *trx)
 {
   ASSERT(children_.size() == 1, "explain must has 1 child");
+  trx_ = trx;
+  physical_plan_.clear();
+  if (analyze_ && children_[0]->type() != PhysicalOperatorType::ANALYZE) {
+    AnalyzePhysicalOperator::instrument(children_[0]);
+  }
   return RC::SUCCESS;
 }
 
 RC ExplainPhysicalOperator::close()
 {
+  if (executed_) {
+    executed_ = false;
+    return RC::SUCCESS;
+  }
+
   for (std::unique_ptr<PhysicalOperator> &child_oper : children_) {
     child_oper->close();
   }
   return RC::SUCCESS;
 }
 
+/**
+ * @brief 执行子算子，丢弃输出的数据，只保留每个算子的统计
+ */
+RC ExplainPhysicalOperator::execute()
+{
+  PhysicalOperator *child = children_[0].get();
+  const uint64_t start = common::CycleTimer::now();
+  rows_ = 0;
+  RC rc = child->open(trx_);
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to open child operator. rc=%s", strrc(rc));
+    child->close();
+    return rc;
+  }
+
+  while (OB_SUCC(rc = child->next())) {
+    rows_++;
+  }
+
+  RC close_rc = child->close();
+  executed_ = true;
+  cycles_   = common::CycleTimer::now() - start;
+  if (rc != RC::RECORD_EOF) {
+    LOG_WARN("failed to execute child operator. rc=%s", strrc(rc));
+    return rc;
+  }
+  return close_rc;
+}
+
 RC ExplainPhysicalOperator::next()
 {
   if (!physical_plan_.empty()) {
     return RC::RECORD_EOF;
   }
 
+  if (analyze_) {
+    RC rc = execute();
+    if (OB_FAIL(rc)) {
+      return rc;
+    }
+  }
+
   stringstream ss;
   ss << "OPERATOR(NAME)\n";
 
@@ -46,10 +118,19 @@ RC ExplainPhysicalOperator::next()
   ends.push_back(true);
   const auto children_size = static_cast<int>(children_.size());
   for (int i = 0; i < children_size - 1; i++) {
-    to_string(ss, children_[i].get(), level, false /*last_child*/, ends);
+    to_string(ss, {children_[i].get()}, level, false /*last_child*/, ends);
   }
   if (children_size > 0) {
-    to_string(ss, children_[children_size - 1].get(), level, true /*last_child*/, ends);
+    to_string(ss, {children_[children_size - 1].get()}, level, true /*last_child*/, ends);
+  }
+
+  if (analyze_) {
+    ss << "Execution: rows=" << rows_ << ", time=" << format_time(cycles_);
+    common::MemoryTracker *memory_tracker = common::MemoryTracker::current();
+    if (memory_tracker != nullptr && memory_tracker->peak() > 0) {
+      ss << ", peak memory=" << format_bytes(memory_tracker->peak());
+    }
+    ss << '\n';
   }
 
   physical_plan_ = ss.str();
@@ -67,16 +148,30 @@ Tuple *ExplainPhysicalOperator::current_tuple()
   return &tuple_;
 }
 
+/**
+ * @brief 合并统计，没有统计的算子(不是 EXPLAIN ANALYZE)返回空的统计
+ */
+static OperatorStats merged_stats(const vector<PhysicalOperator *> &opers)
+{
+  OperatorStats stats;
+  for (PhysicalOperator *oper : opers) {
+    if (oper->type() == PhysicalOperatorType::ANALYZE) {
+      stats.merge(static_cast<AnalyzePhysicalOperator *>(oper)->stats());
+    }
+  }
+  return stats;
+}
+
 /**
  * 递归打印某个算子
  * @param os 结果输出到这里
- * @param oper 将要打印的算子
+ * @param opers 将要打印的算子。并行执行时是所有计划片段中对应位置的算子，统计合并在一起输出
  * @param level 当前算子在第几层
  * @param last_child 当前算子是否是当前兄弟节点中最后一个节点
  * @param ends 表示当前某个层级上的算子，是否已经没有其它的节点，以判断使用什么打印符号
  */
 void ExplainPhysicalOperator::to_string(
-    std::ostream &os, PhysicalOperator *oper, int level, bool last_child, std::vector<bool> &ends)
+    std::ostream &os, const vector<PhysicalOperator *> &opers, int level, bool last_child, std::vector<bool> &ends)
 {
   for (int i = 0; i < level - 1; i++) {
     if (ends[i]) {
@@ -94,11 +189,69 @@ void ExplainPhysicalOperator::to_string(
     }
   }
 
+  // ANALYZE 时每个算子都包装在统计算子中
+  vector<PhysicalOperator *> targets;
+  int64_t peak_memory = 0;
+  for (PhysicalOperator *oper : opers) {
+    if (oper->type() == PhysicalOperatorType::ANALYZE) {
+      targets.push_back(static_cast<AnalyzePhysicalOperator *>(oper)->target());
+    } else {
+      targets.push_back(oper);
+    }
+    peak_memory += oper->peak_memory();
+  }
+
+  PhysicalOperator *oper = targets.front();
   os << oper->name();
   std::string param = oper->param();
   if (!param.empty()) {
     os << "(" << param << ")";
   }
+
+  vector<vector<PhysicalOperator *>> children;
+  if (oper->type() == PhysicalOperatorType::EXCHANGE) {
+    // 所有生产者的计划片段相同，只显示一份
+    unordered_set<Exchange *> exchanges;
+    vector<PhysicalOperator *> producers;
+    for (PhysicalOperator *target : targets) {
+      Exchange *exchange = static_cast<ExchangePhysicalOperator *>(target)->exchange();
+      if (exchanges.insert(exchange).second) {
+        for (int i = 0; i < exchange->producer_num(); i++) {
+          producers.push_back(exchange->producer(i));
+        }
+      }
+    }
+    children.push_back(std::move(producers));
+  } else {
+    for (size_t i = 0; i < oper->children().size(); i++) {
+      vector<PhysicalOperator *> group;
+      for (PhysicalOperator *target : targets) {
+        group.push_back(target->children()[i].get());
+      }
+      children.push_back(std::move(group));
+    }
+  }
+
+  if (analyze_) {
+    // 生产者在其它线程中执行，时间不包含在EXCHANGE中
+    const OperatorStats stats       = merged_stats(opers);
+    uint64_t            self_cycles = stats.cycles;
+    if (oper->type() != PhysicalOperatorType::EXCHANGE) {
+      for (const vector<PhysicalOperator *> &group : children) {
+        self_cycles -= min(self_cycles, merged_stats(group).cycles);
+      }
+    }
+    os << " [rows=" << stats.rows << ", loops=" << stats.loops << ", time=" << format_time(stats.cycles)
+       << ", self=" << format_time(self_cycles) << ", hits=" << stats.buffer_hits
+       << ", misses=" << stats.buffer_misses;
+    if (peak_memory > 0) {
+      os << ", memory=" << format_bytes(peak_memory);
+    }
+    if (opers.size() > 1) {
+      os << ", workers=" << opers.size();
+    }
+    os << "]";
+  }
   os << '\n';
 
   if (static_cast<int>(ends.size()) < level + 2) {
@@ -106,12 +259,11 @@ void ExplainPhysicalOperator::to_string(
   }
   ends[level + 1] = false;
 
-  vector<std::unique_ptr<PhysicalOperator>> &children = oper->children();
   const auto size = static_cast<int>(children.size());
   for (auto i = 0; i < size - 1; i++) {
-    to_string(os, children[i].get(), level + 1, false /*last_child*/, ends);
+    to_string(os, children[i], level + 1, false /*last_child*/, ends);
   }
   if (size > 0) {
-    to_string(os, children[size - 1].get(), level + 1, true /*last_child*/, ends);
+    to_string(os, children[size - 1], level + 1, true /*last_child*/, ends);
   }
 }
@@ -19,11 +19,13 @@ See the Mulan PSL v2 for more details. */
 /**
  * @brief Explain物理算子
  * @ingroup PhysicalOperator
+ * @details EXPLAIN ANALYZE 时先执行子算子并丢弃结果，在执行计划中输出每个算子的实际行数、
+ * 执行次数、耗时(包含与不包含子算子)、访问的页面数和内存峰值。
  */
 class ExplainPhysicalOperator : public PhysicalOperator
 {
 public:
-  ExplainPhysicalOperator() = default;
+  explicit ExplainPhysicalOperator(bool analyze = false) : analyze_(analyze) {}
   virtual ~ExplainPhysicalOperator() = default;
 
   PhysicalOperatorType type() const override
@@ -36,10 +38,19 @@ public:
   RC close() override;
   Tuple *current_tuple() override;
 
+  bool analyze() const { return analyze_; }
+
 private:
-  void to_string(std::ostream &os, PhysicalOperator *oper, int level, bool last_child, std::vector<bool> &ends);
+  RC   execute();
+  void to_string(std::ostream &os, const std::vector<PhysicalOperator *> &opers, int level, bool last_child,
+      std::vector<bool> &ends);
 
 private:
-  std::string physical_plan_;
+  bool           analyze_ = false;
+  bool           executed_ = false;  ///< ANALYZE 时子算子已经执行并关闭
+  Trx           *trx_ = nullptr;
+  int64_t        rows_ = 0;          ///< ANALYZE 时子算子输出的行数
+  uint64_t       cycles_ = 0;        ///< ANALYZE 时执行的时间
+  std::string    physical_plan_;
   ValueListTuple tuple_;
 };
@@ -0,0 +1,246 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#include "sql/operator/hash_aggregate_physical_operator.h"
+#include "common/global_context.h"
+#include "common/log/log.h"
+#include "sql/operator/hash_partition.h"
+
+using namespace std;
+
+RC HashAggregatePhysicalOperator::open(Trx *trx)
+{
+  if (children_.size() != 1) {
+    LOG_WARN("hash aggregate operator should have 1 child");
+    return RC::INTERNAL;
+  }
+
+  PhysicalOperator *child = children_[0].get();
+  RC rc = child->open(trx);
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to open child operator. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  hash_table_.init(key_num(), aggregates());
+  current_group_ = -1;
+  spilled_       = false;
+  pending_partitions_.clear();
+  memory_.reset(common::MemoryTracker::current());
+
+  vector<Value>     keys;
+  vector<Partition> partitions;
+  while (OB_SUCC(rc = child->next())) {
+    Tuple *tuple = child->current_tuple();
+    rc = get_group_keys(*tuple, keys);
+    if (OB_SUCC(rc)) {
+      rc = add_row(*tuple, keys, hash_table_.hash_keys(keys.data()), 0, partitions);
+    }
+    if (OB_FAIL(rc)) {
+      return rc;
+    }
+  }
+
+  if (rc != RC::RECORD_EOF) {
+    LOG_WARN("failed to get next tuple from child. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  // 没有分组时，即使没有数据也要输出一行，比如count(*)是0
+  if (key_num() == 0 && hash_table_.groups() == 0) {
+    hash_table_.find_or_create(nullptr);
+  }
+
+  LOG_TRACE("hash aggregate got %d groups, memory size=%ld, spilled=%d",
+            hash_table_.groups(), hash_table_.memory_size(), spilled_);
+  return finish_partitions(partitions);
+}
+
+/**
+ * @brief 把子算子输出的一行累加到分组中
+ * @details 已经开始分区时只累加到hash表中已有的分组，其它分组的行写到分区文件中
+ * @param level 分区时使用第几次分区的hash位
+ */
+RC HashAggregatePhysicalOperator::add_row(
+    const Tuple &tuple, const vector<Value> &keys, uint64_t hash, int level, vector<Partition> &partitions)
+{
+  RC rc = RC::SUCCESS;
+  if (!partitions.empty()) {
+    Aggregator **aggregators = hash_table_.find(keys.data(), hash);
+    if (aggregators != nullptr) {
+      return accumulate(tuple, aggregators);
+    }
+
+    rc = HashPartition::get_cells(tuple, spill_cells_);
+    if (OB_SUCC(rc)) {
+      TempFile &file = *partitions[HashPartition::partition_of(hash, level)].file;
+      rc = HashPartition::write_row(
+          file, hash, keys.data(), key_num(), spill_cells_.data(), static_cast<int>(spill_cells_.size()));
+    }
+    if (OB_FAIL(rc)) {
+      LOG_WARN("failed to write hash aggregate spill file. rc=%s", strrc(rc));
+    }
+    return rc;
+  }
+
+  rc = accumulate(tuple, hash_table_.find_or_create(keys.data(), hash));
+  if (OB_FAIL(rc)) {
+    return rc;
+  }
+
+  bool spill = false;
+  rc = check_memory(level, spill);
+  if (OB_FAIL(rc) || !spill) {
+    return rc;
+  }
+
+  LOG_INFO("hash aggregate exceeds memory limit, spill to temp files. level=%d, groups=%d, memory=%ld, limit=%ld",
+           level, hash_table_.groups(), hash_table_.memory_size(), memory_limit_);
+  if (level == 0) {
+    // 从临时文件中读取的行与子算子输出的行格式相同
+    vector<TupleCellSpec> specs;
+    rc = HashPartition::get_specs(tuple, specs);
+    if (OB_FAIL(rc)) {
+      return rc;
+    }
+    spill_tuple_.set_specs(specs);
+  }
+  spilled_ = true;
+  return create_partitions(level, partitions);
+}
+
+/**
+ * @brief 检查hash表使用的内存
+ * @param[out] spill 超过了内存限制并且可以分区
+ * @return 超过查询的内存限制并且不能再分区时返回RC::NOMEM
+ */
+RC HashAggregatePhysicalOperator::check_memory(int level, bool &spill)
+{
+  const int64_t memory_size        = hash_table_.memory_size();
+  const bool    within_query_limit = memory_.update(memory_size);
+  spill = false;
+  if (within_query_limit && memory_size <= memory_limit_) {
+    return RC::SUCCESS;
+  }
+
+  // 没有分组key时只有一个分组，分区没有意义
+  if (key_num() > 0 && level < HashPartition::MAX_LEVEL && GCTX.temp_file_manager_ != nullptr) {
+    spill = true;
+    return RC::SUCCESS;
+  }
+
+  if (!within_query_limit) {
+    LOG_WARN("hash aggregate exceeds query memory limit. groups=%d, memory size=%ld",
+             hash_table_.groups(), memory_size);
+    return RC::NOMEM;
+  }
+  return RC::SUCCESS;
+}
+
+RC HashAggregatePhysicalOperator::create_partitions(int level, vector<Partition> &partitions)
+{
+  TempFileManager *temp_file_manager = GCTX.temp_file_manager_;
+  partitions.resize(HashPartition::NUM);
+  for (Partition &partition : partitions) {
+    partition.level = level;
+    RC rc = temp_file_manager->create_file(partition.file);
+    if (OB_FAIL(rc)) {
+      LOG_WARN("failed to create temp file for hash aggregate. rc=%s", strrc(rc));
+      return rc;
+    }
+  }
+  return RC::SUCCESS;
+}
+
+/**
+ * @brief 分区写完后，将有数据的分区加入到待处理列表中
+ */
+RC HashAggregatePhysicalOperator::finish_partitions(vector<Partition> &partitions)
+{
+  for (Partition &partition : partitions) {
+    if (partition.file->size() == 0) {
+      continue;
+    }
+
+    RC rc = partition.file->rewind();
+    if (OB_FAIL(rc)) {
+      LOG_WARN("failed to rewind hash aggregate spill file. rc=%s", strrc(rc));
+      return rc;
+    }
+    pending_partitions_.emplace_back(std::move(partition));
+  }
+  partitions.clear();
+  return RC::SUCCESS;
+}
+
+/**
+ * @brief 读取下一个分区中的行重新聚合
+ * @details 这个分区依然超过内存限制时，其中的一部分行会再次分区，在这个分区的分组输出之后处理
+ */
+RC HashAggregatePhysicalOperator::load_next_partition()
+{
+  Partition partition = std::move(pending_partitions_.back());
+  pending_partitions_.pop_back();
+
+  hash_table_.init(key_num(), aggregates());
+  memory_.update(hash_table_.memory_size());
+  current_group_ = -1;
+
+  RC                rc   = RC::SUCCESS;
+  uint64_t          hash = 0;
+  vector<Value>     keys;
+  vector<Value>     cells;
+  vector<Partition> sub_partitions;
+  while (OB_SUCC(rc = HashPartition::read_row(*partition.file, key_num(), hash, keys, cells))) {
+    spill_tuple_.set_cells(cells);
+    rc = add_row(spill_tuple_, keys, hash, partition.level + 1, sub_partitions);
+    if (OB_FAIL(rc)) {
+      return rc;
+    }
+  }
+  if (rc != RC::RECORD_EOF) {
+    return rc;
+  }
+
+  LOG_TRACE("hash aggregate load partition. level=%d, groups=%d", partition.level, hash_table_.groups());
+  return finish_partitions(sub_partitions);
+}
+
+RC HashAggregatePhysicalOperator::next()
+{
+  while (current_group_ + 1 >= hash_table_.groups()) {
+    if (pending_partitions_.empty()) {
+      return RC::RECORD_EOF;
+    }
+
+    RC rc = load_next_partition();
+    if (OB_FAIL(rc)) {
+      return rc;
+    }
+  }
+
+  current_group_++;
+  return set_output(hash_table_.group_keys(current_group_), hash_table_.group_aggregators(current_group_));
+}
+
+RC HashAggregatePhysicalOperator::close()
+{
+  hash_table_.clear();
+  memory_.reset(nullptr);
+  pending_partitions_.clear();
+  if (!children_.empty()) {
+    children_[0]->close();
+  }
+  return RC::SUCCESS;
+}
@@ -0,0 +1,97 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#pragma once
+
+#include "common/mm/memory_tracker.h"
+#include "sql/operator/aggregate_physical_operator.h"
+#include "sql/operator/aggregate_hash_table.h"
+#include "storage/common/temp_file.h"
+
+/**
+ * @brief hash分组聚合算子
+ * @ingroup PhysicalOperator
+ * @details open时读取子算子所有的数据，按照分组key在hash表中找到分组并累加，
+ * 之后按照分组创建的顺序逐个输出。对输入的顺序没有要求。
+ *
+ * hash表超过算子的内存限制或者查询的内存限制时，不再创建新的分组：已经在hash表中的分组继续在内存中累加，
+ * 其它分组的输入行根据key的hash值分区写到临时文件中，key相同的行一定在同一个分区。
+ * 内存中的分组输出完之后，再逐个分区读取出来聚合，某个分区依然放不下时用同样的方式再次分区。
+ * 不能再分区时，超过算子的限制会继续使用内存，超过查询的限制返回RC::NOMEM。
+ */
+class HashAggregatePhysicalOperator : public AggregatePhysicalOperator
+{
+public:
+  HashAggregatePhysicalOperator(std::vector<std::unique_ptr<Expression>> &&group_by_exprs,
+      std::vector<std::unique_ptr<Expression>> &&aggregate_exprs, AggregateMode mode = AggregateMode::COMPLETE)
+      : AggregatePhysicalOperator(std::move(group_by_exprs), std::move(aggregate_exprs), mode)
+  {}
+  virtual ~HashAggregatePhysicalOperator() = default;
+
+  PhysicalOperatorType type() const override
+  {
+    return PhysicalOperatorType::HASH_AGGREGATE;
+  }
+
+  /**
+   * @brief 设置hash表可以使用的内存(字节)，超过后将新分组的数据分区写到临时文件
+   */
+  void set_memory_limit(int64_t memory_limit)
+  {
+    memory_limit_ = memory_limit;
+  }
+
+  /**
+   * @brief 是否因为内存不足使用了临时文件，测试使用
+   */
+  bool spilled() const
+  {
+    return spilled_;
+  }
+
+  RC open(Trx *trx) override;
+  RC next() override;
+  RC close() override;
+
+  int64_t peak_memory() const override { return memory_.peak(); }
+
+private:
+  /**
+   * @brief 写到临时文件中的一个分区，保存子算子输出的行
+   */
+  struct Partition
+  {
+    std::unique_ptr<TempFile> file;
+    int                       level = 0;  ///< 第几次分区，决定使用hash值的哪几位
+  };
+
+private:
+  RC add_row(const Tuple &tuple, const std::vector<Value> &keys, uint64_t hash, int level,
+      std::vector<Partition> &partitions);
+  RC check_memory(int level, bool &spill);
+  RC create_partitions(int level, std::vector<Partition> &partitions);
+  RC finish_partitions(std::vector<Partition> &partitions);
+  RC load_next_partition();
+
+private:
+  AggregateHashTable        hash_table_;
+  common::MemoryReservation memory_;  ///< hash表记录到查询的MemoryTracker中
+  int64_t                   memory_limit_  = INT64_MAX;
+  int                       current_group_ = -1;
+
+  bool                   spilled_ = false;
+  std::vector<Partition> pending_partitions_;  ///< 还没有处理的分区
+  ValueListTuple         spill_tuple_;         ///< 从临时文件中读取的子算子的行
+  std::vector<Value>     spill_cells_;
+};
@@ -0,0 +1,508 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#include "sql/operator/hash_join_physical_operator.h"
+#include "sql/operator/hash_partition.h"
+#include "common/global_context.h"
+#include "common/log/log.h"
+
+using namespace std;
+
+HashJoinPhysicalOperator::HashJoinPhysicalOperator(
+    vector<unique_ptr<Expression>> &&left_keys, vector<unique_ptr<Expression>> &&right_keys, bool build_left)
+    : left_keys_(std::move(left_keys)), right_keys_(std::move(right_keys)), build_left_(build_left)
+{
+  ASSERT(left_keys_.size() == right_keys_.size(), "join key number mismatch");
+}
+
+string HashJoinPhysicalOperator::param() const
+{
+  return build_left_ ? "build=left" : "build=right";
+}
+
+RC HashJoinPhysicalOperator::open(Trx *trx)
+{
+  if (children_.size() != 2) {
+    LOG_WARN("hash join operator should have 2 children");
+    return RC::INTERNAL;
+  }
+
+  build_oper_ = children_[build_left_ ? 0 : 1].get();
+  probe_oper_ = children_[build_left_ ? 1 : 0].get();
+  match_row_  = -1;
+  spilled_    = false;
+  memory_.reset(common::MemoryTracker::current());
+
+  // 谓词在创建算子之后才绑定到joined_tuple_上，所以在这里编译
+  if (predicate_ && !program_) {
+    program_ = ExprProgram::try_compile(*predicate_, ExprProgram::FieldSource::TUPLE);
+  }
+
+  RC rc = build(trx);
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to build hash table. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  if (build_left_) {
+    joined_tuple_.set_left(&build_tuple_);
+  } else {
+    joined_tuple_.set_right(&build_tuple_);
+  }
+
+  if (spilled_) {
+    // probe端已经全部写到了分区文件中
+    return rc;
+  }
+
+  rc = probe_oper_->open(trx);
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to open probe side operator. rc=%s", strrc(rc));
+    return rc;
+  }
+  probe_opened_ = true;
+  return rc;
+}
+
+RC HashJoinPhysicalOperator::build(Trx *trx)
+{
+  RC rc = build_oper_->open(trx);
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to open build side operator. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  if (runtime_filter_) {
+    runtime_filter_->reset();
+  }
+
+  const vector<unique_ptr<Expression>> &key_exprs = build_left_ ? left_keys_ : right_keys_;
+  vector<Value> keys;
+  vector<Value> cells;
+  vector<Partition> partitions;
+  bool first = true;
+  while (OB_SUCC(rc = build_oper_->next())) {
+    Tuple *tuple = build_oper_->current_tuple();
+    rc = eval_keys(key_exprs, *tuple, keys);
+    if (OB_SUCC(rc)) {
+      // 字段的值都复制到hash表中，probe时不再访问build端的记录
+      rc = HashPartition::get_cells(*tuple, cells);
+    }
+    if (OB_FAIL(rc)) {
+      break;
+    }
+
+    if (first) {
+      // build端所有行的cell描述都是一样的，只需要记录一次
+      vector<TupleCellSpec> specs;
+      rc = HashPartition::get_specs(*tuple, specs);
+      if (OB_FAIL(rc)) {
+        break;
+      }
+      build_tuple_.set_specs(specs);
+      hash_table_.init(static_cast<int>(keys.size()), static_cast<int>(cells.size()));
+      first = false;
+    }
+
+    if (!spilled_) {
+      hash_table_.append_row(keys, cells);
+      if (exceed_memory_limit()) {
+        LOG_INFO("hash join exceeds memory limit, spill to temp files. rows=%d, memory=%ld, limit=%ld",
+                 hash_table_.rows(), hash_table_.memory_size(), memory_limit_);
+        add_runtime_filter_keys();
+        rc = create_partitions(0, partitions);
+        if (OB_SUCC(rc)) {
+          rc = spill_hash_table(partitions);
+        }
+        if (OB_FAIL(rc)) {
+          break;
+        }
+        spilled_ = true;
+      }
+    } else {
+      const uint64_t hash = JoinHashTable::hash_keys(keys.data(), static_cast<int>(keys.size()));
+      if (runtime_filter_) {
+        runtime_filter_->add(keys.data(), static_cast<int>(keys.size()), hash);
+      }
+      TempFile &file = *partitions[HashPartition::partition_of(hash, 0)].build_file;
+      rc = HashPartition::write_row(
+          file, hash, keys.data(), static_cast<int>(keys.size()), cells.data(), static_cast<int>(cells.size()));
+      if (OB_FAIL(rc)) {
+        break;
+      }
+    }
+  }
+
+  RC close_rc = build_oper_->close();
+  if (rc != RC::RECORD_EOF) {
+    return rc;
+  }
+  if (OB_FAIL(close_rc)) {
+    LOG_WARN("failed to close build side operator. rc=%s", strrc(close_rc));
+    return close_rc;
+  }
+
+  if (!spilled_) {
+    hash_table_.build();
+    add_runtime_filter_keys();
+    if (runtime_filter_) {
+      runtime_filter_->build();
+    }
+    LOG_TRACE("hash join build done. rows=%d", hash_table_.rows());
+    return RC::SUCCESS;
+  }
+
+  // 分区之前生成，probe端写到分区文件之前就可以过滤
+  if (runtime_filter_) {
+    runtime_filter_->build();
+  }
+  rc = partition_probe_side(trx, partitions);
+  if (OB_FAIL(rc)) {
+    return rc;
+  }
+  return finish_partitions(partitions);
+}
+
+/**
+ * @brief 把hash表中的key添加到运行时过滤条件中，直接使用hash表中保存的hash值
+ */
+void HashJoinPhysicalOperator::add_runtime_filter_keys()
+{
+  if (!runtime_filter_) {
+    return;
+  }
+  for (int row = 0; row < hash_table_.rows(); row++) {
+    runtime_filter_->add(hash_table_.row_keys(row), hash_table_.key_num(), hash_table_.row_hash(row));
+  }
+}
+
+RC HashJoinPhysicalOperator::partition_probe_side(Trx *trx, vector<Partition> &partitions)
+{
+  RC rc = probe_oper_->open(trx);
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to open probe side operator. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  const vector<unique_ptr<Expression>> &key_exprs = build_left_ ? right_keys_ : left_keys_;
+  vector<Value> keys;
+  vector<Value> cells;
+  bool first = true;
+  while (OB_SUCC(rc = probe_oper_->next())) {
+    Tuple *tuple = probe_oper_->current_tuple();
+    rc = eval_keys(key_exprs, *tuple, keys);
+    if (OB_SUCC(rc)) {
+      rc = HashPartition::get_cells(*tuple, cells);
+    }
+    if (OB_FAIL(rc)) {
+      break;
+    }
+
+    if (first) {
+      vector<TupleCellSpec> specs;
+      rc = HashPartition::get_specs(*tuple, specs);
+      if (OB_FAIL(rc)) {
+        break;
+      }
+      probe_tuple_.set_specs(specs);
+      first = false;
+    }
+
+    const uint64_t hash = JoinHashTable::hash_keys(keys.data(), static_cast<int>(keys.size()));
+    TempFile &file = *partitions[HashPartition::partition_of(hash, 0)].probe_file;
+    rc = HashPartition::write_row(
+        file, hash, keys.data(), static_cast<int>(keys.size()), cells.data(), static_cast<int>(cells.size()));
+    if (OB_FAIL(rc)) {
+      break;
+    }
+  }
+
+  RC close_rc = probe_oper_->close();
+  if (rc != RC::RECORD_EOF) {
+    return rc;
+  }
+  if (OB_FAIL(close_rc)) {
+    LOG_WARN("failed to close probe side operator. rc=%s", strrc(close_rc));
+  }
+  return close_rc;
+}
+
+RC HashJoinPhysicalOperator::create_partitions(int level, vector<Partition> &partitions)
+{
+  TempFileManager *temp_file_manager = GCTX.temp_file_manager_;
+  partitions.resize(HashPartition::NUM);
+  for (Partition &partition : partitions) {
+    partition.level = level;
+    RC rc = temp_file_manager->create_file(partition.build_file);
+    if (OB_SUCC(rc)) {
+      rc = temp_file_manager->create_file(partition.probe_file);
+    }
+    if (OB_FAIL(rc)) {
+      LOG_WARN("failed to create temp file for hash join. rc=%s", strrc(rc));
+      return rc;
+    }
+  }
+  return RC::SUCCESS;
+}
+
+RC HashJoinPhysicalOperator::spill_hash_table(vector<Partition> &partitions)
+{
+  const int level = partitions.front().level;
+  for (int row = 0; row < hash_table_.rows(); row++) {
+    const uint64_t hash = hash_table_.row_hash(row);
+    TempFile &file = *partitions[HashPartition::partition_of(hash, level)].build_file;
+    RC rc = HashPartition::write_row(file, hash, hash_table_.row_keys(row), hash_table_.key_num(),
+        hash_table_.row_cells(row), hash_table_.cell_num());
+    if (OB_FAIL(rc)) {
+      LOG_WARN("failed to write hash join spill file. rc=%s", strrc(rc));
+      return rc;
+    }
+  }
+
+  hash_table_.init(hash_table_.key_num(), hash_table_.cell_num());
+  return RC::SUCCESS;
+}
+
+/**
+ * @brief 分区写完后，将需要处理的分区加入到待处理列表中
+ * @details 任意一侧没有数据的分区不会有连接结果，直接丢弃
+ */
+RC HashJoinPhysicalOperator::finish_partitions(vector<Partition> &partitions)
+{
+  for (Partition &partition : partitions) {
+    if (partition.build_file->size() == 0 || partition.probe_file->size() == 0) {
+      continue;
+    }
+
+    RC rc = partition.build_file->rewind();
+    if (OB_SUCC(rc)) {
+      rc = partition.probe_file->rewind();
+    }
+    if (OB_FAIL(rc)) {
+      LOG_WARN("failed to rewind hash join spill file. rc=%s", strrc(rc));
+      return rc;
+    }
+    pending_partitions_.emplace_back(std::move(partition));
+  }
+  partitions.clear();
+  return RC::SUCCESS;
+}
+
+/**
+ * @brief 加载下一个分区的build端数据到hash表中
+ * @details 如果这个分区依然超过内存限制，就把它再次分区，直到达到最大分区次数。
+ * 达到最大次数说明有大量key相同的行，这时只能全部放在内存中
+ */
+RC HashJoinPhysicalOperator::load_next_partition()
+{
+  RC rc = RC::SUCCESS;
+  const int key_num = hash_table_.key_num();
+  uint64_t hash = 0;
+  vector<Value> keys;
+  vector<Value> cells;
+  while (!pending_partitions_.empty()) {
+    Partition partition = std::move(pending_partitions_.back());
+    pending_partitions_.pop_back();
+
+    hash_table_.init(key_num, hash_table_.cell_num());
+    vector<Partition> sub_partitions;
+    const bool can_repartition = partition.level + 1 < HashPartition::MAX_LEVEL;
+    bool repartition = false;
+    while (OB_SUCC(rc = HashPartition::read_row(*partition.build_file, key_num, hash, keys, cells))) {
+      if (!repartition) {
+        hash_table_.append_row(keys, cells);
+        if (can_repartition && exceed_memory_limit()) {
+          rc = create_partitions(partition.level + 1, sub_partitions);
+          if (OB_SUCC(rc)) {
+            rc = spill_hash_table(sub_partitions);
+          }
+          repartition = true;
+        }
+      } else {
+        TempFile &file = *sub_partitions[HashPartition::partition_of(hash, partition.level + 1)].build_file;
+        rc = HashPartition::write_row(file, hash, keys.data(), key_num, cells.data(), static_cast<int>(cells.size()));
+      }
+
+      if (OB_FAIL(rc)) {
+        return rc;
+      }
+    }
+    if (rc != RC::RECORD_EOF) {
+      return rc;
+    }
+
+    if (!repartition) {
+      hash_table_.build();
+      probe_file_ = std::move(partition.probe_file);
+      LOG_TRACE("hash join load partition. level=%d, rows=%d", partition.level, hash_table_.rows());
+      return RC::SUCCESS;
+    }
+
+    LOG_INFO("hash join partition exceeds memory limit, partition again. level=%d", partition.level + 1);
+    while (OB_SUCC(rc = HashPartition::read_row(*partition.probe_file, key_num, hash, keys, cells))) {
+      TempFile &file = *sub_partitions[HashPartition::partition_of(hash, partition.level + 1)].probe_file;
+      rc = HashPartition::write_row(file, hash, keys.data(), key_num, cells.data(), static_cast<int>(cells.size()));
+      if (OB_FAIL(rc)) {
+        return rc;
+      }
+    }
+    if (rc != RC::RECORD_EOF) {
+      return rc;
+    }
+
+    rc = finish_partitions(sub_partitions);
+    if (OB_FAIL(rc)) {
+      return rc;
+    }
+  }
+  return RC::RECORD_EOF;
+}
+
+bool HashJoinPhysicalOperator::exceed_memory_limit()
+{
+  // 查询使用的内存超过限制时也写到临时文件中
+  const bool within_query_limit = memory_.update(hash_table_.memory_size());
+  return (hash_table_.memory_size() > memory_limit_ || !within_query_limit) && GCTX.temp_file_manager_ != nullptr;
+}
+
+RC HashJoinPhysicalOperator::next_probe_row()
+{
+  RC rc = RC::SUCCESS;
+  Tuple *probe_tuple = nullptr;
+  if (!spilled_) {
+    rc = probe_oper_->next();
+    if (OB_FAIL(rc)) {
+      return rc;
+    }
+
+    probe_tuple = probe_oper_->current_tuple();
+    rc = eval_keys(build_left_ ? right_keys_ : left_keys_, *probe_tuple, probe_keys_);
+    if (OB_FAIL(rc)) {
+      return rc;
+    }
+  } else {
+    while (true) {
+      if (probe_file_) {
+        uint64_t hash = 0;
+        rc = HashPartition::read_row(*probe_file_, hash_table_.key_num(), hash, probe_keys_, probe_cells_);
+        if (OB_SUCC(rc)) {
+          break;
+        }
+        if (rc != RC::RECORD_EOF) {
+          return rc;
+        }
+        probe_file_.reset();
+      }
+
+      rc = load_next_partition();
+      if (OB_FAIL(rc)) {
+        return rc;
+      }
+    }
+
+    probe_tuple_.set_cells(probe_cells_);
+    probe_tuple = &probe_tuple_;
+  }
+
+  if (build_left_) {
+    joined_tuple_.set_right(probe_tuple);
+  } else {
+    joined_tuple_.set_left(probe_tuple);
+  }
+  return rc;
+}
+
+RC HashJoinPhysicalOperator::next()
+{
+  RC rc = RC::SUCCESS;
+  if (!spilled_ && hash_table_.rows() == 0) {
+    return RC::RECORD_EOF;
+  }
+
+  while (true) {
+    while (match_row_ >= 0) {
+      const int row = match_row_;
+      match_row_    = hash_table_.next_match(row);
+      build_tuple_.set_cells(hash_table_.row_cells(row), hash_table_.cell_num());
+
+      bool result = true;
+      rc = filter(result);
+      if (OB_FAIL(rc)) {
+        return rc;
+      }
+      if (result) {
+        return rc;
+      }
+    }
+
+    rc = next_probe_row();
+    if (OB_FAIL(rc)) {
+      return rc;
+    }
+    match_row_ = hash_table_.find(probe_keys_);
+  }
+  return rc;
+}
+
+RC HashJoinPhysicalOperator::close()
+{
+  RC rc = RC::SUCCESS;
+  if (probe_opened_) {
+    rc = probe_oper_->close();
+    if (OB_FAIL(rc)) {
+      LOG_WARN("failed to close probe side operator. rc=%s", strrc(rc));
+    }
+    probe_opened_ = false;
+  }
+  hash_table_.clear();
+  memory_.reset(nullptr);
+  pending_partitions_.clear();
+  probe_file_.reset();
+  return rc;
+}
+
+Tuple *HashJoinPhysicalOperator::current_tuple()
+{
+  return &joined_tuple_;
+}
+
+RC HashJoinPhysicalOperator::eval_keys(
+    const vector<unique_ptr<Expression>> &key_exprs, const Tuple &tuple, vector<Value> &keys)
+{
+  keys.resize(key_exprs.size());
+  for (size_t i = 0; i < key_exprs.size(); i++) {
+    RC rc = key_exprs[i]->get_value(tuple, keys[i]);
+    if (OB_FAIL(rc)) {
+      LOG_WARN("failed to evaluate join key. rc=%s", strrc(rc));
+      return rc;
+    }
+  }
+  return RC::SUCCESS;
+}
+
+RC HashJoinPhysicalOperator::filter(bool &result)
+{
+  result = true;
+  if (!predicate_) {
+    return RC::SUCCESS;
+  }
+
+  Value value;
+  RC rc = program_ ? program_->eval(joined_tuple_, value) : predicate_->get_value(joined_tuple_, value);
+  if (OB_FAIL(rc)) {
+    return rc;
+  }
+  result = value.get_boolean();
+  return rc;
+}
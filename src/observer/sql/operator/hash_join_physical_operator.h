@@ -0,0 +1,165 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#pragma once
+
+#include "common/mm/memory_tracker.h"
+#include "sql/operator/physical_operator.h"
+#include "sql/expr/expr_program.h"
+#include "sql/operator/join_hash_table.h"
+#include "sql/operator/runtime_filter.h"
+#include "storage/common/temp_file.h"
+
+/**
+ * @brief 等值连接的hash join算子
+ * @ingroup PhysicalOperator
+ * @details 把较小的一侧(build端)全部读取出来建立hash表，然后逐行读取另一侧(probe端)，
+ * 在hash表中查找key相等的行。每个输入只需要扫描一次。
+ * 无论哪一侧作为build端，输出的tuple都保持左表在前、右表在后。
+ * 除了等值条件以外的连接条件，在关联之后再过滤。
+ *
+ * build端需要的字段(见 ProjectionPushdown)都复制到hash表中，probe时不再根据RID访问表中的记录，
+ * 记录在build之后被删除或者槽位被复用，都不影响连接的结果。
+ *
+ * 如果hash表超过了内存限制，就按照grace hash join的方式执行：
+ * 根据key的hash值把两侧的数据都分成若干个分区写到临时文件中，key相同的行一定在同一个分区，
+ * 然后逐个分区做连接。某个分区依然放不下时，使用hash值的其它位再次分区。
+ *
+ * build端读取完成后可以生成 RuntimeFilter，下推到probe端的扫描算子上提前过滤。
+ * probe端在build完成之后才打开，所以扫描开始时过滤条件已经生成。
+ */
+class HashJoinPhysicalOperator : public PhysicalOperator
+{
+public:
+  /**
+   * @param left_keys 左孩子上计算的连接key
+   * @param right_keys 右孩子上计算的连接key，与left_keys一一对应
+   * @param build_left 是否使用左孩子建立hash表
+   */
+  HashJoinPhysicalOperator(std::vector<std::unique_ptr<Expression>> &&left_keys,
+      std::vector<std::unique_ptr<Expression>> &&right_keys, bool build_left);
+  virtual ~HashJoinPhysicalOperator() = default;
+
+  PhysicalOperatorType type() const override
+  {
+    return PhysicalOperatorType::HASH_JOIN;
+  }
+
+  std::string param() const override;
+
+  /**
+   * @brief 设置等值条件之外的连接条件
+   */
+  void set_predicate(std::unique_ptr<Expression> predicate)
+  {
+    predicate_ = std::move(predicate);
+  }
+
+  /**
+   * @brief 设置hash表可以使用的内存(字节)，超过后将数据分区写到临时文件
+   */
+  void set_memory_limit(int64_t memory_limit)
+  {
+    memory_limit_ = memory_limit;
+  }
+
+  bool build_left() const { return build_left_; }
+
+  /**
+   * @brief probe端上计算的连接key
+   */
+  const std::vector<std::unique_ptr<Expression>> &probe_keys() const { return build_left_ ? right_keys_ : left_keys_; }
+
+  /**
+   * @brief 创建运行时过滤条件，之后每次build都会重新生成
+   * @details 只有在probe端找到了可以下推的扫描算子时才需要创建
+   */
+  std::shared_ptr<RuntimeFilter> create_runtime_filter()
+  {
+    if (!runtime_filter_) {
+      runtime_filter_ = std::make_shared<RuntimeFilter>();
+    }
+    return runtime_filter_;
+  }
+
+  /**
+   * @brief 是否因为内存不足使用了临时文件，测试使用
+   */
+  bool spilled() const
+  {
+    return spilled_;
+  }
+
+  RC open(Trx *trx) override;
+  RC next() override;
+  RC close() override;
+  Tuple *current_tuple() override;
+
+  int64_t peak_memory() const override { return memory_.peak(); }
+
+  RC tuple_schema(TupleSchema &schema) const override { return children_tuple_schema(schema); }
+
+private:
+  /**
+   * @brief 分区落盘时的一个分区，两侧的数据分别保存在一个临时文件中
+   */
+  struct Partition
+  {
+    std::unique_ptr<TempFile> build_file;
+    std::unique_ptr<TempFile> probe_file;
+    int                       level = 0;  ///< 第几次分区，决定使用hash值的哪几位
+  };
+
+private:
+  RC build(Trx *trx);
+  void add_runtime_filter_keys();
+  RC partition_probe_side(Trx *trx, std::vector<Partition> &partitions);
+  RC load_next_partition();
+  RC next_probe_row();
+
+  RC create_partitions(int level, std::vector<Partition> &partitions);
+  RC spill_hash_table(std::vector<Partition> &partitions);
+  RC finish_partitions(std::vector<Partition> &partitions);
+  bool exceed_memory_limit();
+
+  RC eval_keys(const std::vector<std::unique_ptr<Expression>> &key_exprs, const Tuple &tuple,
+      std::vector<Value> &keys);
+  RC filter(bool &result);
+
+private:
+  std::vector<std::unique_ptr<Expression>> left_keys_;
+  std::vector<std::unique_ptr<Expression>> right_keys_;
+  std::unique_ptr<Expression>              predicate_;
+  std::unique_ptr<ExprProgram>             program_;  ///< 编译后的predicate_，open时编译
+  bool                                     build_left_ = false;
+  int64_t                                  memory_limit_ = INT64_MAX;
+
+  PhysicalOperator *build_oper_ = nullptr;
+  PhysicalOperator *probe_oper_ = nullptr;
+  bool              probe_opened_ = false;
+
+  JoinHashTable                  hash_table_;
+  common::MemoryReservation      memory_;  ///< hash表记录到查询的MemoryTracker中
+  std::shared_ptr<RuntimeFilter> runtime_filter_;
+  ValueListTuple     build_tuple_;  ///< 当前匹配的build端的行
+  JoinedTuple        joined_tuple_;
+  std::vector<Value> probe_keys_;
+  int                match_row_ = -1;  ///< 下一个要输出的build端的行
+
+  bool                      spilled_ = false;
+  std::vector<Partition>    pending_partitions_;  ///< 还没有处理的分区
+  std::unique_ptr<TempFile> probe_file_;          ///< 当前分区probe端的数据
+  ValueListTuple            probe_tuple_;         ///< 从临时文件中读取的probe端的行
+  std::vector<Value>        probe_cells_;
+};
@@ -0,0 +1,94 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#include "sql/operator/hash_partition.h"
+#include "common/log/log.h"
+
+using namespace std;
+
+RC HashPartition::write_row(
+    TempFile &file, uint64_t hash, const Value *keys, int key_num, const Value *cells, int cell_num)
+{
+  RC rc = file.write(reinterpret_cast<const char *>(&hash), sizeof(hash));
+  for (int i = 0; i < key_num && OB_SUCC(rc); i++) {
+    rc = file.write_value(keys[i]);
+  }
+
+  const int32_t n = cell_num;
+  if (OB_SUCC(rc)) {
+    rc = file.write(reinterpret_cast<const char *>(&n), sizeof(n));
+  }
+  for (int i = 0; i < cell_num && OB_SUCC(rc); i++) {
+    rc = file.write_value(cells[i]);
+  }
+  return rc;
+}
+
+RC HashPartition::read_row(TempFile &file, int key_num, uint64_t &hash, vector<Value> &keys, vector<Value> &cells)
+{
+  RC rc = file.read(reinterpret_cast<char *>(&hash), sizeof(hash));
+  if (OB_FAIL(rc)) {
+    return rc;
+  }
+
+  keys.resize(key_num);
+  for (int i = 0; i < key_num && OB_SUCC(rc); i++) {
+    rc = file.read_value(keys[i]);
+  }
+
+  int32_t cell_num = 0;
+  if (OB_SUCC(rc)) {
+    rc = file.read(reinterpret_cast<char *>(&cell_num), sizeof(cell_num));
+  }
+  if (OB_SUCC(rc)) {
+    cells.resize(cell_num);
+  }
+  for (int i = 0; i < cell_num && OB_SUCC(rc); i++) {
+    rc = file.read_value(cells[i]);
+  }
+
+  if (rc == RC::RECORD_EOF) {
+    LOG_WARN("hash partition file is truncated. file=%s", file.path().c_str());
+    rc = RC::IOERR_READ;
+  }
+  return rc;
+}
+
+RC HashPartition::get_specs(const Tuple &tuple, vector<TupleCellSpec> &specs)
+{
+  const int cell_num = tuple.cell_num();
+  specs.assign(cell_num, TupleCellSpec(""));
+  for (int i = 0; i < cell_num; i++) {
+    RC rc = tuple.spec_at(i, specs[i]);
+    if (OB_FAIL(rc)) {
+      LOG_WARN("failed to get cell spec. index=%d, rc=%s", i, strrc(rc));
+      return rc;
+    }
+  }
+  return RC::SUCCESS;
+}
+
+RC HashPartition::get_cells(const Tuple &tuple, vector<Value> &cells)
+{
+  const int cell_num = tuple.cell_num();
+  cells.resize(cell_num);
+  for (int i = 0; i < cell_num; i++) {
+    RC rc = tuple.cell_at(i, cells[i]);
+    if (OB_FAIL(rc)) {
+      LOG_WARN("failed to get cell. index=%d, rc=%s", i, strrc(rc));
+      return rc;
+    }
+  }
+  return RC::SUCCESS;
+}
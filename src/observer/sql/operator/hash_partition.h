@@ -0,0 +1,61 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+
+#include "common/rc.h"
+#include "sql/expr/tuple.h"
+#include "sql/parser/value.h"
+#include "storage/common/temp_file.h"
+
+/**
+ * @brief hash算子超过内存限制时，按照key的hash值把数据分区写到临时文件
+ * @ingroup PhysicalOperator
+ * @details hash join和hash聚合共用。key相同的行一定在同一个分区，某个分区依然放不下时，
+ * 使用hash值的其它位再次分区，最多分区 MAX_LEVEL 次。
+ * 行在临时文件中的格式：hash值(8字节) key值 cell个数(4字节) cell值
+ */
+class HashPartition
+{
+public:
+  static constexpr int BITS      = 4;
+  static constexpr int NUM       = 1 << BITS;
+  static constexpr int MAX_LEVEL = 4;
+
+  /**
+   * @brief 根据hash值计算分区
+   * @details 低位用于hash表的槽位，高32位用于槽位中的快速比较，
+   * 分区使用中间的位，每一次分区使用不同的位
+   */
+  static int partition_of(uint64_t hash, int level)
+  {
+    return static_cast<int>((hash >> (40 + level * BITS)) & (NUM - 1));
+  }
+
+  static RC write_row(TempFile &file, uint64_t hash, const Value *keys, int key_num, const Value *cells, int cell_num);
+
+  /**
+   * @return 读取到文件末尾时返回RECORD_EOF
+   */
+  static RC read_row(TempFile &file, int key_num, uint64_t &hash, std::vector<Value> &keys, std::vector<Value> &cells);
+
+  /**
+   * @brief 获取tuple中每个cell的描述，从临时文件中读取的行使用相同的描述
+   */
+  static RC get_specs(const Tuple &tuple, std::vector<TupleCellSpec> &specs);
+  static RC get_cells(const Tuple &tuple, std::vector<Value> &cells);
+};
@@ -0,0 +1,234 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#include "sql/operator/index_nested_loop_join_physical_operator.h"
+#include "storage/index/index.h"
+#include "storage/table/table.h"
+#include "storage/trx/trx.h"
+
+using namespace std;
+
+IndexNestedLoopJoinPhysicalOperator::IndexNestedLoopJoinPhysicalOperator(
+    Table *table, Index *index, bool readonly, unique_ptr<Expression> outer_key, bool inner_left)
+    : table_(table), index_(index), readonly_(readonly), outer_key_(std::move(outer_key)), inner_left_(inner_left)
+{
+  for (const FieldMeta &field_meta : *table_->table_meta().field_metas()) {
+    inner_fields_.emplace_back(table_, &field_meta);
+  }
+}
+
+IndexNestedLoopJoinPhysicalOperator::~IndexNestedLoopJoinPhysicalOperator()
+{
+  if (index_scanner_ != nullptr) {
+    index_scanner_->destroy();
+    index_scanner_ = nullptr;
+  }
+}
+
+string IndexNestedLoopJoinPhysicalOperator::param() const
+{
+  return string(index_->index_meta().name()) + " ON " + table_->name();
+}
+
+void IndexNestedLoopJoinPhysicalOperator::set_inner_predicates(vector<unique_ptr<Expression>> &&exprs)
+{
+  inner_predicates_ = std::move(exprs);
+  inner_programs_.clear();
+  for (unique_ptr<Expression> &expr : inner_predicates_) {
+    inner_programs_.push_back(ExprProgram::try_compile(*expr, ExprProgram::FieldSource::RECORD));
+  }
+}
+
+RC IndexNestedLoopJoinPhysicalOperator::open(Trx *trx)
+{
+  if (children_.size() != 1) {
+    LOG_WARN("index nested loop join operator should have 1 child");
+    return RC::INTERNAL;
+  }
+
+  record_handler_ = table_->record_handler();
+  if (nullptr == record_handler_) {
+    LOG_WARN("invalid record handler");
+    return RC::INTERNAL;
+  }
+
+  outer_oper_ = children_[0].get();
+  RC rc = outer_oper_->open(trx);
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to open outer oper. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  trx_     = trx;
+  opened_  = true;
+  probing_ = false;
+  if (inner_table_tuple_.cell_num() == 0) {
+    // 重复打开时不能再次设置，否则cell的个数会变化
+    inner_table_tuple_.set_schema(table_, table_->table_meta().field_metas());
+    inner_tuple_.set_schema(table_, inner_fields_);
+  }
+  if (inner_left_) {
+    joined_tuple_.set_left(&inner_tuple_);
+  } else {
+    joined_tuple_.set_right(&inner_tuple_);
+  }
+  return rc;
+}
+
+/**
+ * @brief 在索引上查找key相等的数据。第一次查找时创建扫描器，之后复用
+ */
+RC IndexNestedLoopJoinPhysicalOperator::probe(const Value &key)
+{
+  if (index_scanner_ == nullptr) {
+    index_scanner_ = index_->create_scanner(key.data(), key.length(), true, key.data(), key.length(), true);
+    if (index_scanner_ == nullptr) {
+      LOG_WARN("failed to create index scanner");
+      return RC::INTERNAL;
+    }
+    return RC::SUCCESS;
+  }
+
+  RC rc = index_scanner_->reopen(key.data(), key.length(), true, key.data(), key.length(), true);
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to reopen index scanner. rc=%s", strrc(rc));
+  }
+  return rc;
+}
+
+RC IndexNestedLoopJoinPhysicalOperator::next()
+{
+  RC rc = RC::SUCCESS;
+  RID rid;
+  Value key;
+  while (true) {
+    record_page_handler_.cleanup();
+    if (probing_) {
+      rc = index_scanner_->next_entry(&rid);
+      if (rc == RC::RECORD_EOF) {
+        probing_ = false;
+        continue;
+      }
+      if (OB_FAIL(rc)) {
+        return rc;
+      }
+
+      rc = record_handler_->get_record(record_page_handler_, &rid, readonly_, &current_record_);
+      if (OB_FAIL(rc)) {
+        return rc;
+      }
+
+      inner_table_tuple_.set_record(&current_record_);
+      bool filter_result = false;
+      rc = filter(filter_result);
+      if (OB_FAIL(rc)) {
+        return rc;
+      }
+      if (!filter_result) {
+        continue;
+      }
+
+      rc = trx_->visit_record(table_, current_record_, readonly_);
+      if (rc == RC::RECORD_INVISIBLE) {
+        continue;
+      }
+      return rc;
+    }
+
+    rc = outer_oper_->next();
+    if (OB_FAIL(rc)) {
+      return rc;
+    }
+
+    Tuple *outer_tuple = outer_oper_->current_tuple();
+    if (inner_left_) {
+      joined_tuple_.set_right(outer_tuple);
+    } else {
+      joined_tuple_.set_left(outer_tuple);
+    }
+
+    rc = outer_key_->get_value(*outer_tuple, key);
+    if (OB_FAIL(rc)) {
+      LOG_WARN("failed to evaluate join key. rc=%s", strrc(rc));
+      return rc;
+    }
+
+    rc = probe(key);
+    if (OB_FAIL(rc)) {
+      return rc;
+    }
+    probing_ = true;
+  }
+  return rc;
+}
+
+RC IndexNestedLoopJoinPhysicalOperator::close()
+{
+  RC rc = RC::SUCCESS;
+  record_page_handler_.cleanup();
+  if (index_scanner_ != nullptr) {
+    index_scanner_->destroy();
+    index_scanner_ = nullptr;
+  }
+
+  if (opened_) {
+    rc = outer_oper_->close();
+    opened_ = false;
+  }
+  return rc;
+}
+
+Tuple *IndexNestedLoopJoinPhysicalOperator::current_tuple()
+{
+  inner_tuple_.set_record(&current_record_);
+  return &joined_tuple_;
+}
+
+RC IndexNestedLoopJoinPhysicalOperator::tuple_schema(TupleSchema &schema) const
+{
+  if (inner_left_) {
+    RowTuple::table_schema(table_, inner_fields_, schema);
+    return children_tuple_schema(schema);
+  }
+
+  RC rc = children_tuple_schema(schema);
+  if (OB_SUCC(rc)) {
+    RowTuple::table_schema(table_, inner_fields_, schema);
+  }
+  return rc;
+}
+
+RC IndexNestedLoopJoinPhysicalOperator::filter(bool &result)
+{
+  RC rc = RC::SUCCESS;
+  Value value;
+  for (size_t i = 0; i < inner_predicates_.size(); i++) {
+    if (inner_programs_[i]) {
+      rc = inner_programs_[i]->eval(current_record_.data(), value);
+    } else {
+      rc = inner_predicates_[i]->get_value(inner_table_tuple_, value);
+    }
+    if (OB_FAIL(rc)) {
+      return rc;
+    }
+
+    if (!value.get_boolean()) {
+      result = false;
+      return rc;
+    }
+  }
+
+  result = true;
+  return rc;
+}
@@ -0,0 +1,98 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#pragma once
+
+#include "sql/operator/physical_operator.h"
+#include "sql/expr/expr_program.h"
+#include "storage/record/record_manager.h"
+
+class Index;
+class IndexScanner;
+
+/**
+ * @brief 使用内表索引的nested loop join
+ * @ingroup PhysicalOperator
+ * @details 只有一个孩子，是外表。对外表的每一行计算连接key，在内表连接字段的索引上查找key相等的行。
+ * 适合外表数据量很小的情况，这时内表不需要全表扫描。
+ * 所有外表的行复用同一个索引扫描器。
+ * 内表上的过滤条件在查找到数据之后执行，其它的连接条件由上层算子过滤。
+ * 内表只输出 inner_fields 中的字段。
+ * 无论内表是左表还是右表，输出的tuple都保持左表在前、右表在后。
+ */
+class IndexNestedLoopJoinPhysicalOperator : public PhysicalOperator
+{
+public:
+  /**
+   * @param table 内表
+   * @param index 内表连接字段上的索引
+   * @param outer_key 在外表上计算的连接key
+   * @param inner_left 内表是否是连接的左表
+   */
+  IndexNestedLoopJoinPhysicalOperator(
+      Table *table, Index *index, bool readonly, std::unique_ptr<Expression> outer_key, bool inner_left);
+  virtual ~IndexNestedLoopJoinPhysicalOperator();
+
+  PhysicalOperatorType type() const override
+  {
+    return PhysicalOperatorType::INDEX_NESTED_LOOP_JOIN;
+  }
+
+  std::string param() const override;
+
+  /**
+   * @brief 设置内表上的过滤条件
+   */
+  void set_inner_predicates(std::vector<std::unique_ptr<Expression>> &&exprs);
+
+  /**
+   * @brief 设置内表需要输出的字段，默认输出所有字段
+   */
+  void set_inner_fields(const std::vector<Field> &fields) { inner_fields_ = fields; }
+
+  RC open(Trx *trx) override;
+  RC next() override;
+  RC close() override;
+  Tuple *current_tuple() override;
+
+  RC tuple_schema(TupleSchema &schema) const override;
+
+private:
+  RC probe(const Value &key);
+  RC filter(bool &result);
+
+private:
+  Trx   *trx_      = nullptr;
+  Table *table_    = nullptr;
+  Index *index_    = nullptr;
+  bool   readonly_ = false;
+
+  std::unique_ptr<Expression>              outer_key_;
+  std::vector<std::unique_ptr<Expression>> inner_predicates_;
+  std::vector<std::unique_ptr<ExprProgram>> inner_programs_;  ///< 与inner_predicates_一一对应，不能编译的为空
+  bool                                     inner_left_ = false;
+
+  PhysicalOperator *outer_oper_ = nullptr;
+  bool              opened_     = false;
+  bool              probing_    = false;  ///< 当前外表的行是否还有没有遍历完的内表数据
+
+  IndexScanner      *index_scanner_  = nullptr;
+  RecordFileHandler *record_handler_ = nullptr;
+  RecordPageHandler  record_page_handler_;
+  Record             current_record_;
+  std::vector<Field> inner_fields_;
+  RowTuple           inner_table_tuple_;  ///< 内表所有的字段，用来计算内表上的过滤条件
+  RowTuple           inner_tuple_;        ///< 内表输出的字段
+  JoinedTuple        joined_tuple_;
+};
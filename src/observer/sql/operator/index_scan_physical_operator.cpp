@@ -32,6 +32,11 @@ IndexScanPhysicalOperator::IndexScanPhysicalOperator(
   if (right_value) {
     right_value_ = *right_value;
   }
+  if (table_ != nullptr) {
+    for (const FieldMeta &field_meta : *table_->table_meta().field_metas()) {
+      output_fields_.emplace_back(table_, &field_meta);
+    }
+  }
 }
 
 RC IndexScanPhysicalOperator::open(Trx *trx)
@@ -40,13 +45,18 @@ RC IndexScanPhysicalOperator::open(Trx *trx)
     return RC::INTERNAL;
   }
 
-  IndexScanner *index_scanner = index_->create_scanner(left_value_.data(),
+  empty_range_ = !range_terms_.empty() && !bind_range();
+
+  // 没有指定边界时从索引的一端开始扫描
+  const char *left_key  = left_value_.attr_type() == UNDEFINED ? nullptr : left_value_.data();
+  const char *right_key = right_value_.attr_type() == UNDEFINED ? nullptr : right_value_.data();
+  IndexScanner *index_scanner = empty_range_ ? nullptr : index_->create_scanner(left_key,
       left_value_.length(),
       left_inclusive_,
-      right_value_.data(),
+      right_key,
       right_value_.length(),
       right_inclusive_);
-  if (nullptr == index_scanner) {
+  if (nullptr == index_scanner && !empty_range_) {
     LOG_WARN("failed to create index scanner");
     return RC::INTERNAL;
   }
@@ -54,12 +64,18 @@ RC IndexScanPhysicalOperator::open(Trx *trx)
   record_handler_ = table_->record_handler();
   if (nullptr == record_handler_) {
     LOG_WARN("invalid record handler");
-    index_scanner->destroy();
+    if (index_scanner != nullptr) {
+      index_scanner->destroy();
+    }
     return RC::INTERNAL;
   }
   index_scanner_ = index_scanner;
+  runtime_filters_.reset();
 
-  tuple_.set_schema(table_, table_->table_meta().field_metas());
+  if (table_tuple_.cell_num() == 0) {
+    table_tuple_.set_schema(table_, table_->table_meta().field_metas());
+    tuple_.set_schema(table_, output_fields_);
+  }
 
   trx_ = trx;
   return RC::SUCCESS;
@@ -70,17 +86,21 @@ RC IndexScanPhysicalOperator::next()
   RID rid;
   RC rc = RC::SUCCESS;
 
-  record_page_handler_.cleanup();
+  if (empty_range_) {
+    return RC::RECORD_EOF;
+  }
 
   bool filter_result = false;
   while (RC::SUCCESS == (rc = index_scanner_->next_entry(&rid))) {
+    // 被过滤掉的行也占用了页面，读取下一行之前需要先释放
+    record_page_handler_.cleanup();
     rc = record_handler_->get_record(record_page_handler_, &rid, readonly_, &current_record_);
     if (rc != RC::SUCCESS) {
       return rc;
     }
 
-    tuple_.set_record(&current_record_);
-    rc = filter(tuple_, filter_result);
+    table_tuple_.set_record(&current_record_);
+    rc = filter(table_tuple_, filter_result);
     if (rc != RC::SUCCESS) {
       return rc;
     }
@@ -102,8 +122,12 @@ RC IndexScanPhysicalOperator::next()
 
 RC IndexScanPhysicalOperator::close()
 {
-  index_scanner_->destroy();
-  index_scanner_ = nullptr;
+  // explain 不会打开算子，但是会关闭
+  if (index_scanner_ != nullptr) {
+    index_scanner_->destroy();
+    index_scanner_ = nullptr;
+  }
+  record_page_handler_.cleanup();
   return RC::SUCCESS;
 }
 
@@ -113,17 +137,100 @@ Tuple *IndexScanPhysicalOperator::current_tuple()
   return &tuple_;
 }
 
+bool IndexScanPhysicalOperator::cast_to_index_type(const Value &value, AttrType field_type, Value &result)
+{
+  if (value.attr_type() == field_type) {
+    result = value;
+    return true;
+  }
+
+  if (field_type == FLOATS && value.attr_type() == INTS) {
+    result.set_float(static_cast<float>(value.get_int()));
+    return true;
+  }
+
+  if (field_type == INTS && value.attr_type() == FLOATS) {
+    const float f = value.get_float();
+    // 超出int的范围或者有小数部分时不能精确转换
+    if (!(f >= -2147483648.0f && f < 2147483648.0f) || f != static_cast<float>(static_cast<int>(f))) {
+      return false;
+    }
+    result.set_int(static_cast<int>(f));
+    return true;
+  }
+  return false;
+}
+
+bool IndexScanPhysicalOperator::bind_range()
+{
+  // 与生成执行计划时计算范围的方法相同：同一个字段上的多个条件取交集。
+  // 无法转换成索引字段类型的条件不缩小范围，由谓词过滤
+  const FieldMeta *field_meta = table_->table_meta().field(index_->index_meta().field());
+  left_value_      = Value();
+  right_value_     = Value();
+  left_inclusive_  = false;
+  right_inclusive_ = false;
+
+  auto intersect_low = [this](const Value &value, bool inclusive) {
+    const int result = left_value_.attr_type() != UNDEFINED ? value.compare(left_value_) : 1;
+    if (result > 0 || (result == 0 && !inclusive)) {
+      left_value_     = value;
+      left_inclusive_ = inclusive;
+    }
+  };
+  auto intersect_high = [this](const Value &value, bool inclusive) {
+    const int result = right_value_.attr_type() != UNDEFINED ? value.compare(right_value_) : -1;
+    if (result < 0 || (result == 0 && !inclusive)) {
+      right_value_     = value;
+      right_inclusive_ = inclusive;
+    }
+  };
+
+  for (const IndexRangeTerm &term : range_terms_) {
+    Value value;
+    if (!cast_to_index_type(*term.value, field_meta->type(), value)) {
+      continue;
+    }
+
+    switch (term.comp) {
+      case EQUAL_TO: {
+        intersect_low(value, true);
+        intersect_high(value, true);
+      } break;
+      case GREAT_EQUAL: intersect_low(value, true); break;
+      case GREAT_THAN: intersect_low(value, false); break;
+      case LESS_EQUAL: intersect_high(value, true); break;
+      case LESS_THAN: intersect_high(value, false); break;
+      default: break;
+    }
+  }
+
+  if (left_value_.attr_type() == UNDEFINED || right_value_.attr_type() == UNDEFINED) {
+    return true;
+  }
+  const int result = left_value_.compare(right_value_);
+  return result < 0 || (result == 0 && left_inclusive_ && right_inclusive_);
+}
+
 void IndexScanPhysicalOperator::set_predicates(std::vector<std::unique_ptr<Expression>> &&exprs)
 {
   predicates_ = std::move(exprs);
+  programs_.clear();
+  for (std::unique_ptr<Expression> &expr : predicates_) {
+    programs_.push_back(ExprProgram::try_compile(*expr, ExprProgram::FieldSource::RECORD));
+  }
 }
 
 RC IndexScanPhysicalOperator::filter(RowTuple &tuple, bool &result)
 {
   RC rc = RC::SUCCESS;
   Value value;
-  for (std::unique_ptr<Expression> &expr : predicates_) {
-    rc = expr->get_value(tuple, value);
+  for (size_t i = 0; i < predicates_.size(); i++) {
+    if (programs_[i]) {
+      rc = programs_[i]->eval(current_record_.data(), value);
+    } else {
+      rc = predicates_[i]->get_value(tuple, value);
+    }
     if (rc != RC::SUCCESS) {
       return rc;
     }
@@ -135,11 +242,28 @@ RC IndexScanPhysicalOperator::filter(RowTuple &tuple, bool &result)
     }
   }
 
-  result = true;
+  result = runtime_filters_.empty() || runtime_filters_.check(current_record_.data());
   return rc;
 }
 
 std::string IndexScanPhysicalOperator::param() const
 {
-  return std::string(index_->index_meta().name()) + " ON " + table_->name();
+  std::string result = std::string(index_->index_meta().name()) + " ON " + table_->name();
+  const bool has_left  = left_value_.attr_type() != UNDEFINED;
+  const bool has_right = right_value_.attr_type() != UNDEFINED;
+  if (!has_left && !has_right) {
+    // 按照索引顺序扫描全部数据
+  } else if (has_left && has_right && left_inclusive_ && right_inclusive_ && left_value_.compare(right_value_) == 0) {
+    // 等值查询输出 =1
+    result += ", =" + left_value_.to_string();
+  } else {
+    // 扫描范围，比如 [1, 10)
+    result += has_left ? (left_inclusive_ ? ", [" : ", (") + left_value_.to_string() : ", (-inf";
+    result += has_right ? ", " + right_value_.to_string() + (right_inclusive_ ? "]" : ")") : ", +inf)";
+  }
+
+  if (!runtime_filters_.empty()) {
+    result += ", runtime_filters=" + std::to_string(runtime_filters_.size());
+  }
+  return result;
 }
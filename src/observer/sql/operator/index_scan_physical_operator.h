@@ -15,16 +15,32 @@ See the Mulan PSL v2 for more details. */
 #pragma once
 
 #include "sql/operator/physical_operator.h"
+#include "sql/expr/expr_program.h"
+#include "sql/operator/runtime_filter.h"
 #include "sql/expr/tuple.h"
 #include "storage/record/record_manager.h"
 
+/**
+ * @brief 确定索引扫描范围的一个条件：索引字段 comp value
+ * @details value 指向条件中的常量或者预编译语句的参数，由条件所在的表达式持有
+ */
+struct IndexRangeTerm
+{
+  CompOp       comp  = NO_OP;
+  const Value *value = nullptr;
+};
+
 /**
  * @brief 索引扫描物理算子
  * @ingroup PhysicalOperator
+ * @details 与表扫描一样，过滤条件在记录上计算，只输出 output_fields 中的字段
  */
 class IndexScanPhysicalOperator : public PhysicalOperator
 {
 public:
+  /**
+   * @details left_value/right_value 为空时表示这一侧没有边界，都为空时按照索引顺序扫描全部数据
+   */
   IndexScanPhysicalOperator(Table *table, Index *index, bool readonly, 
       const Value *left_value, bool left_inclusive,
       const Value *right_value, bool right_inclusive);
@@ -44,8 +60,53 @@ public:
 
   Tuple *current_tuple() override;
 
+  RC tuple_schema(TupleSchema &schema) const override
+  {
+    RowTuple::table_schema(table_, output_fields_, schema);
+    return RC::SUCCESS;
+  }
+
+  /**
+   * @brief 谓词中的字段需要绑定到表中所有字段组成的tuple上
+   */
   void set_predicates(std::vector<std::unique_ptr<Expression>> &&exprs);
 
+  /**
+   * @brief 设置需要输出的字段，需要在open之前调用
+   */
+  void set_output_fields(const std::vector<Field> &fields) { output_fields_ = fields; }
+
+  /**
+   * @brief 添加hash join下推的运行时过滤条件，见 RuntimeFilter
+   * @param key_fields 本表中与build端的key一一对应的字段
+   */
+  void add_runtime_filter(std::shared_ptr<RuntimeFilter> filter, std::vector<const FieldMeta *> key_fields)
+  {
+    runtime_filters_.add(std::move(filter), std::move(key_fields));
+  }
+
+  /**
+   * @brief 设置确定扫描范围的条件，条件中包含预编译语句的参数时使用
+   * @details 每次open时按照参数当前的值重新计算扫描范围，同一个执行计划可以使用不同的参数执行。
+   * 条件中的值由谓词表达式持有，需要同时调用set_predicates
+   */
+  void set_range_terms(std::vector<IndexRangeTerm> terms) { range_terms_ = std::move(terms); }
+
+  Table *table() const { return table_; }
+
+  /**
+   * @brief 把比较的常量转换成索引字段的类型，索引按照字段类型的二进制数据比较
+   * @return 无法精确转换时返回false，这个条件不能用于确定索引的扫描范围
+   */
+  static bool cast_to_index_type(const Value &value, AttrType field_type, Value &result);
+
+private:
+  /**
+   * @brief 根据range_terms_重新计算扫描范围
+   * @return 范围内没有数据时返回false
+   */
+  bool bind_range();
+
 private:
   // 与TableScanPhysicalOperator代码相同，可以优化
   RC filter(RowTuple &tuple, bool &result);
@@ -60,12 +121,18 @@ private:
 
   RecordPageHandler record_page_handler_;
   Record current_record_;
-  RowTuple tuple_;
+  std::vector<Field> output_fields_;
+  RowTuple table_tuple_;  ///< 包含所有字段，用来计算过滤条件
+  RowTuple tuple_;        ///< 输出的字段
 
   Value left_value_;
   Value right_value_;
   bool left_inclusive_ = false;
   bool right_inclusive_ = false;
+  std::vector<IndexRangeTerm> range_terms_;
+  bool empty_range_ = false;  ///< 按照参数计算的范围为空，不需要扫描
 
   std::vector<std::unique_ptr<Expression>> predicates_;
+  std::vector<std::unique_ptr<ExprProgram>> programs_;  ///< 与predicates_一一对应，不能编译的为空
+  ScanRuntimeFilters runtime_filters_;
 };
@@ -0,0 +1,187 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#include <string.h>
+#include <new>
+#include <string_view>
+
+#include "sql/operator/join_hash_table.h"
+#include "common/log/log.h"
+
+/**
+ * @brief murmur3的64位finalizer，让低位也充分混合，便于直接取低位作为槽位号
+ */
+static inline uint64_t mix64(uint64_t h)
+{
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+  h *= 0xc4ceb9fe1a85ec53ULL;
+  h ^= h >> 33;
+  return h;
+}
+
+static uint64_t hash_value(const Value &value)
+{
+  switch (value.attr_type()) {
+    case INTS: {
+      return static_cast<uint32_t>(value.get_int());
+    }
+    case FLOATS: {
+      float f = value.get_float();
+      if (f == 0) {
+        f = 0;  // +0.0 与 -0.0 相等
+      }
+      uint32_t bits = 0;
+      memcpy(&bits, &f, sizeof(bits));
+      return bits;
+    }
+    case BOOLEANS: {
+      return value.get_boolean() ? 1 : 0;
+    }
+    case CHARS: {
+      // 与 common::compare_string 一致，第一个'\0'之后的内容不参与比较
+      return std::hash<std::string_view>()(std::string_view(value.data()));
+    }
+    default: {
+      return 0;
+    }
+  }
+}
+
+uint64_t JoinHashTable::hash_keys(const Value *keys, int key_num)
+{
+  uint64_t h = 0;
+  for (int i = 0; i < key_num; i++) {
+    h = (h * 0x9e3779b97f4a7c15ULL) ^ hash_value(keys[i]);
+  }
+  return mix64(h);
+}
+
+JoinHashTable::~JoinHashTable()
+{
+  clear();
+}
+
+void JoinHashTable::init(int key_num, int cell_num)
+{
+  clear();
+  key_num_  = key_num;
+  cell_num_ = cell_num;
+  arena_.set_source(common::QueryArena::current());
+}
+
+void JoinHashTable::clear()
+{
+  // 行在arena中构造，释放内存之前需要先析构
+  for (Value *row : rows_) {
+    for (int i = 0; i < key_num_ + cell_num_; i++) {
+      row[i].~Value();
+    }
+  }
+  rows_.clear();
+  arena_.reset();
+  hashes_.clear();
+  next_.clear();
+  slots_.clear();
+  mask_ = 0;
+  memory_size_ = 0;
+}
+
+void JoinHashTable::append_row(const std::vector<Value> &keys, const std::vector<Value> &cells)
+{
+  ASSERT(static_cast<int>(keys.size()) == key_num_ && static_cast<int>(cells.size()) == cell_num_,
+         "invalid row. key num=%d, cell num=%d", static_cast<int>(keys.size()), static_cast<int>(cells.size()));
+
+  const size_t arena_used = arena_.used_size();
+  auto         row        = static_cast<Value *>(arena_.alloc(sizeof(Value) * (key_num_ + cell_num_)));
+  for (int i = 0; i < key_num_; i++) {
+    new (&row[i]) Value();
+    row[i].set_value(keys[i], arena_);
+  }
+  for (int i = 0; i < cell_num_; i++) {
+    new (&row[key_num_ + i]) Value();
+    row[key_num_ + i].set_value(cells[i], arena_);
+  }
+  rows_.push_back(row);
+  hashes_.push_back(hash_keys(keys.data(), key_num_));
+  next_.push_back(-1);
+
+  // 每行在arena(行数据和字符串)、行指针、hash值、链表和槽位数组(负载因子0.5)上的开销
+  memory_size_ += static_cast<int64_t>(arena_.used_size() - arena_used) + sizeof(Value *) + sizeof(uint64_t) +
+                  sizeof(int32_t) + 2 * sizeof(Slot);
+}
+
+void JoinHashTable::build()
+{
+  // 槽位数是2的幂，并且负载因子不超过0.5
+  size_t capacity = 16;
+  while (capacity < next_.size() * 2) {
+    capacity <<= 1;
+  }
+  slots_.assign(capacity, Slot{0, -1});
+  mask_ = capacity - 1;
+
+  // 倒序插入到链表头，这样链表中的顺序与追加的顺序一致
+  for (int row = rows() - 1; row >= 0; row--) {
+    const uint64_t hash     = hashes_[row];
+    const uint32_t hash_tag = static_cast<uint32_t>(hash >> 32);
+    const Value   *keys     = rows_[row];
+    for (uint64_t pos = hash & mask_;; pos = (pos + 1) & mask_) {
+      Slot &slot = slots_[pos];
+      if (slot.head < 0) {
+        slot.hash_tag = hash_tag;
+        slot.head     = row;
+        break;
+      }
+
+      if (slot.hash_tag == hash_tag && keys_equal(rows_[slot.head], keys)) {
+        next_[row] = slot.head;
+        slot.head  = row;
+        break;
+      }
+    }
+  }
+}
+
+int JoinHashTable::find(const std::vector<Value> &keys) const
+{
+  if (slots_.empty()) {
+    return -1;
+  }
+
+  const uint64_t hash     = hash_keys(keys.data(), key_num_);
+  const uint32_t hash_tag = static_cast<uint32_t>(hash >> 32);
+  for (uint64_t pos = hash & mask_;; pos = (pos + 1) & mask_) {
+    const Slot &slot = slots_[pos];
+    if (slot.head < 0) {
+      return -1;
+    }
+
+    if (slot.hash_tag == hash_tag && keys_equal(rows_[slot.head], keys.data())) {
+      return slot.head;
+    }
+  }
+  return -1;
+}
+
+bool JoinHashTable::keys_equal(const Value *left, const Value *right) const
+{
+  for (int i = 0; i < key_num_; i++) {
+    if (left[i].compare(right[i]) != 0) {
+      return false;
+    }
+  }
+  return true;
+}
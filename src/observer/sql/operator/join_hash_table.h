@@ -0,0 +1,104 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+
+#include "common/mm/arena.h"
+#include "sql/parser/value.h"
+
+/**
+ * @brief hash join build端使用的hash表
+ * @ingroup PhysicalOperator
+ * @details 先通过append_row追加所有的行，然后调用build建立索引，之后只读。
+ * 每行的key和数据在Arena中连续存放(先key后数据)，较长的字符串也复制到Arena中，
+ * 追加一行只需要几次顺序分配，扩容时不需要移动已有的行。
+ * Arena的块从当前查询的QueryArena中获取，clear时还回去，算子在close时需要clear。
+ * 索引部分是开放寻址(线性探测)的槽位数组，每个槽位只有8个字节(hash的高32位和链表头)，
+ * 探测时基本都在同一个cache line中完成。key相同的行通过next_链接在一起，
+ * 顺序与追加的顺序相同。
+ *
+ * key的比较使用Value::compare，调用方需要保证参与比较的key类型一致，
+ * 否则相等的值可能得到不同的hash值。
+ */
+class JoinHashTable
+{
+public:
+  JoinHashTable() = default;
+  ~JoinHashTable();
+
+  /**
+   * @param key_num 每行key的个数
+   * @param cell_num 每行数据的个数
+   */
+  void init(int key_num, int cell_num);
+
+  void append_row(const std::vector<Value> &keys, const std::vector<Value> &cells);
+
+  /**
+   * @brief 所有数据追加完成后，建立hash索引
+   */
+  void build();
+
+  void clear();
+
+  int rows() const { return static_cast<int>(next_.size()); }
+  int key_num() const { return key_num_; }
+  int cell_num() const { return cell_num_; }
+
+  /**
+   * @brief 查找第一个key相同的行
+   * @return 行号，没有找到返回-1
+   */
+  int find(const std::vector<Value> &keys) const;
+
+  /**
+   * @brief 与指定行key相同的下一行，没有返回-1
+   */
+  int next_match(int row) const { return next_[row]; }
+
+  const Value *row_cells(int row) const { return rows_[row] + key_num_; }
+  const Value *row_keys(int row) const { return rows_[row]; }
+  uint64_t     row_hash(int row) const { return hashes_[row]; }
+
+  /**
+   * @brief 估算当前占用的内存，包括建立索引之后槽位数组的大小
+   */
+  int64_t memory_size() const { return memory_size_; }
+
+  static uint64_t hash_keys(const Value *keys, int key_num);
+
+private:
+  struct Slot
+  {
+    uint32_t hash_tag;  ///< hash值的高32位，用来在比较key之前快速排除
+    int32_t  head;      ///< key相同的行组成的链表的第一行，-1表示空槽位
+  };
+
+  bool keys_equal(const Value *left, const Value *right) const;
+
+private:
+  int key_num_  = 0;
+  int cell_num_ = 0;
+
+  std::vector<Value *>   rows_;    ///< 每行的key和数据，在arena_中分配
+  std::vector<uint64_t> hashes_;  ///< 每行key的hash值
+  std::vector<int32_t>  next_;    ///< key相同的下一行
+  std::vector<Slot>     slots_;
+  uint64_t              mask_ = 0;
+  int64_t               memory_size_ = 0;
+  common::Arena         arena_;
+};
@@ -27,59 +27,169 @@ RC NestedLoopJoinPhysicalOperator::open(Trx *trx)
   RC rc = RC::SUCCESS;
   left_ = children_[0].get();
   right_ = children_[1].get();
-  right_closed_ = true;
   round_done_ = true;
+  left_done_ = false;
+
+  rc = materialize_right(trx);
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to materialize right oper. rc=%s", strrc(rc));
+    return rc;
+  }
 
   rc = left_->open(trx);
-  trx_ = trx;
+  if (rc == RC::SUCCESS) {
+    left_opened_ = true;
+  }
   return rc;
 }
 
+RC NestedLoopJoinPhysicalOperator::materialize_right(Trx *trx)
+{
+  right_rows_.init(memory_limit_, common::MemoryTracker::current());
+  RC rc = right_->open(trx);
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to open right oper. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  while (RC::SUCCESS == (rc = right_->next())) {
+    rc = right_rows_.append(*right_->current_tuple());
+    if (rc != RC::SUCCESS) {
+      break;
+    }
+  }
+
+  RC close_rc = right_->close();
+  if (rc != RC::RECORD_EOF) {
+    return rc;
+  }
+  if (close_rc != RC::SUCCESS) {
+    LOG_WARN("failed to close right oper. rc=%s", strrc(close_rc));
+    return close_rc;
+  }
+
+  LOG_TRACE("nlj materialized right oper. rows=%ld, spilled=%d", right_rows_.rows(), right_rows_.spilled());
+  joined_tuple_.set_right(right_rows_.current_tuple());
+  return RC::SUCCESS;
+}
+
 RC NestedLoopJoinPhysicalOperator::next()
 {
-  bool left_need_step = (left_tuple_ == nullptr);
+  if (right_rows_.rows() == 0) {
+    return RC::RECORD_EOF;
+  }
+
+  if (right_rows_.spilled()) {
+    return block_next();
+  }
+
   RC rc = RC::SUCCESS;
-  if (round_done_) {
-    left_need_step = true;
-  } else {
-    rc = right_next();
-    if (rc != RC::SUCCESS) {
-      if (rc == RC::RECORD_EOF) {
-        left_need_step = true;
-      } else {
-        return rc;
+  while (true) {
+    if (!round_done_) {
+      rc = right_next();
+      if (rc != RC::RECORD_EOF) {
+        return rc;  // got one tuple from right
       }
-    } else {
-      return rc;  // got one tuple from right
     }
-  }
 
-  if (left_need_step) {
     rc = left_next();
     if (rc != RC::SUCCESS) {
       return rc;
     }
+
+    rc = right_rows_.rewind();
+    if (rc != RC::SUCCESS) {
+      return rc;
+    }
+    round_done_ = false;
   }
+  return rc;
+}
+
+RC NestedLoopJoinPhysicalOperator::block_next()
+{
+  RC rc = RC::SUCCESS;
+  while (true) {
+    // 内表的当前行与这一批左表数据逐个关联
+    if (!round_done_) {
+      rc = left_block_.next();
+      if (rc != RC::RECORD_EOF) {
+        return rc;
+      }
+      round_done_ = true;
+    }
+
+    if (left_block_.rows() > 0) {
+      rc = right_next();
+      if (rc == RC::SUCCESS) {
+        rc = left_block_.rewind();
+        if (rc != RC::SUCCESS) {
+          return rc;
+        }
+        round_done_ = false;
+        continue;
+      }
+      if (rc != RC::RECORD_EOF) {
+        return rc;
+      }
+    }
 
-  rc = right_next();
+    // 内表已经遍历完一遍，读取下一批左表数据
+    if (left_done_) {
+      return RC::RECORD_EOF;
+    }
+
+    rc = load_left_block();
+    if (rc != RC::SUCCESS) {
+      return rc;
+    }
+    rc = right_rows_.rewind();
+    if (rc != RC::SUCCESS) {
+      return rc;
+    }
+  }
   return rc;
 }
 
-RC NestedLoopJoinPhysicalOperator::close()
+RC NestedLoopJoinPhysicalOperator::load_left_block()
 {
-  RC rc = left_->close();
-  if (rc != RC::SUCCESS) {
-    LOG_WARN("failed to close left oper. rc=%s", strrc(rc));
+  RC rc = RC::SUCCESS;
+  left_block_.init(INT64_MAX);
+  while (left_block_.memory_size() <= memory_limit_) {
+    rc = left_->next();
+    if (rc == RC::RECORD_EOF) {
+      left_done_ = true;
+      break;
+    }
+    if (rc != RC::SUCCESS) {
+      return rc;
+    }
+
+    rc = left_block_.append(*left_->current_tuple());
+    if (rc != RC::SUCCESS) {
+      return rc;
+    }
   }
 
-  if (!right_closed_) {
-    rc = right_->close();
+  LOG_TRACE("nlj load left block. rows=%ld", left_block_.rows());
+  joined_tuple_.set_left(left_block_.current_tuple());
+  return RC::SUCCESS;
+}
+
+RC NestedLoopJoinPhysicalOperator::close()
+{
+  RC rc = RC::SUCCESS;
+  if (left_opened_) {
+    rc = left_->close();
     if (rc != RC::SUCCESS) {
-      LOG_WARN("failed to close right oper. rc=%s", strrc(rc));
-    } else {
-      right_closed_ = true;
+      LOG_WARN("failed to close left oper. rc=%s", strrc(rc));
     }
+    left_opened_ = false;
   }
+
+  right_rows_.clear();
+  left_block_.clear();
+  left_tuple_ = nullptr;
   return rc;
 }
 
@@ -103,34 +213,9 @@ RC NestedLoopJoinPhysicalOperator::left_next()
 
 RC NestedLoopJoinPhysicalOperator::right_next()
 {
-  RC rc = RC::SUCCESS;
-  if (round_done_) {
-    if (!right_closed_) {
-      rc = right_->close();
-      right_closed_ = true;
-      if (rc != RC::SUCCESS) {
-        return rc;
-      }
-    }
-
-    rc = right_->open(trx_);
-    if (rc != RC::SUCCESS) {
-      return rc;
-    }
-    right_closed_ = false;
-
-    round_done_ = false;
+  RC rc = right_rows_.next();
+  if (rc == RC::RECORD_EOF) {
+    round_done_ = true;
   }
-
-  rc = right_->next();
-  if (rc != RC::SUCCESS) {
-    if (rc == RC::RECORD_EOF) {
-      round_done_ = true;
-    }
-    return rc;
-  }
-
-  right_tuple_ = right_->current_tuple();
-  joined_tuple_.set_right(right_tuple_);
   return rc;
 }
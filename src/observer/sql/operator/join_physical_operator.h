@@ -16,10 +16,16 @@ See the Mulan PSL v2 for more details. */
 
 #include "sql/parser/parse.h"
 #include "sql/operator/physical_operator.h"
+#include "sql/operator/row_buffer.h"
 
 /**
  * @brief 最简单的两表（称为左表、右表）join算子
- * @details 依次遍历左表的每一行，然后关联右表的每一行
+ * @details 依次遍历左表的每一行，然后关联右表的每一行。
+ * 右表(内表)在打开时只读取一次，物化保存下来，之后每一轮都从物化的数据中遍历，
+ * 不需要每次重新打开右表，重新访问buffer pool和做可见性判断。
+ * 内表超过内存限制时会写到临时文件中，这时按照block nested loop的方式执行：
+ * 每次读取一批左表的数据放在内存中，内表的每一行与这一批数据逐个关联，
+ * 这样内表的临时文件只需要按照批次读取多遍。这种情况下输出的顺序与左表的顺序不同。
  * @ingroup PhysicalOperator
  */
 class NestedLoopJoinPhysicalOperator : public PhysicalOperator
@@ -33,24 +39,43 @@ public:
     return PhysicalOperatorType::NESTED_LOOP_JOIN;
   }
 
+  /**
+   * @brief 设置物化内表和缓存左表数据可以使用的内存(字节)
+   */
+  void set_memory_limit(int64_t memory_limit)
+  {
+    memory_limit_ = memory_limit;
+  }
+
   RC open(Trx *trx) override;
   RC next() override;
   RC close() override;
   Tuple *current_tuple() override;
 
+  int64_t peak_memory() const override { return right_rows_.peak_memory(); }
+
+  RC tuple_schema(TupleSchema &schema) const override { return children_tuple_schema(schema); }
+
 private:
+  RC materialize_right(Trx *trx);
   RC left_next();   //! 左表遍历下一条数据
-  RC right_next();  //! 右表遍历下一条数据，如果上一轮结束了就重新开始新的一轮
+  RC right_next();  //! 内表遍历下一条数据，如果上一轮结束了就返回RECORD_EOF
+
+  RC block_next();       //! 内表在临时文件中时，按批次关联
+  RC load_left_block();  //! 读取下一批左表的数据
 
 private:
-  Trx *trx_ = nullptr;
+  int64_t memory_limit_ = INT64_MAX;
 
   //! 左表右表的真实对象是在PhysicalOperator::children_中，这里是为了写的时候更简单
   PhysicalOperator *left_ = nullptr;
   PhysicalOperator *right_ = nullptr;
-  Tuple *left_tuple_ = nullptr;
-  Tuple *right_tuple_ = nullptr;
+  bool        left_opened_ = false;
+  Tuple      *left_tuple_ = nullptr;
+  RowBuffer   right_rows_;  //! 物化的内表
   JoinedTuple joined_tuple_;  //! 当前关联的左右两个tuple
-  bool round_done_ = true;    //! 右表遍历的一轮是否结束
-  bool right_closed_ = true;  //! 右表算子是否已经关闭
+  bool        round_done_ = true;  //! 内表遍历的一轮是否结束
+
+  RowBuffer left_block_;  //! 按批次关联时当前一批左表的数据
+  bool      left_done_ = false;
 };
@@ -0,0 +1,52 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#pragma once
+
+#include <stdint.h>
+
+#include "sql/operator/logical_operator.h"
+
+/**
+ * @brief limit算子，跳过前offset行，最多输出limit行
+ * @ingroup LogicalOperator
+ * @details 子算子是排序时，物理计划可以合并成Top-N算子，或者直接按照索引的顺序读取。
+ */
+class LimitLogicalOperator : public LogicalOperator
+{
+public:
+  /**
+   * @param limit 小于0时表示不限制输出的行数
+   */
+  LimitLogicalOperator(int64_t limit, int64_t offset) : limit_(limit), offset_(offset) {}
+  virtual ~LimitLogicalOperator() = default;
+
+  LogicalOperatorType type() const override
+  {
+    return LogicalOperatorType::LIMIT;
+  }
+
+  int64_t limit() const
+  {
+    return limit_;
+  }
+  int64_t offset() const
+  {
+    return offset_;
+  }
+
+private:
+  int64_t limit_  = -1;
+  int64_t offset_ = 0;
+};
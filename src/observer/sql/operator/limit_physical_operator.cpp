@@ -0,0 +1,71 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#include "sql/operator/limit_physical_operator.h"
+#include "common/log/log.h"
+
+using namespace std;
+
+string LimitPhysicalOperator::param() const
+{
+  string result = "limit=" + to_string(limit_);
+  if (offset_ > 0) {
+    result += ", offset=" + to_string(offset_);
+  }
+  return result;
+}
+
+RC LimitPhysicalOperator::open(Trx *trx)
+{
+  if (children_.size() != 1) {
+    LOG_WARN("limit operator should have 1 child");
+    return RC::INTERNAL;
+  }
+
+  skipped_ = 0;
+  emitted_ = 0;
+  return children_[0]->open(trx);
+}
+
+RC LimitPhysicalOperator::next()
+{
+  if (limit_ >= 0 && emitted_ >= limit_) {
+    return RC::RECORD_EOF;
+  }
+
+  PhysicalOperator *child = children_[0].get();
+  RC rc = RC::SUCCESS;
+  for (; skipped_ < offset_; skipped_++) {
+    rc = child->next();
+    if (OB_FAIL(rc)) {
+      return rc;
+    }
+  }
+
+  rc = child->next();
+  if (OB_SUCC(rc)) {
+    emitted_++;
+  }
+  return rc;
+}
+
+RC LimitPhysicalOperator::close()
+{
+  return children_[0]->close();
+}
+
+Tuple *LimitPhysicalOperator::current_tuple()
+{
+  return children_[0]->current_tuple();
+}
@@ -0,0 +1,54 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#pragma once
+
+#include <stdint.h>
+
+#include "sql/operator/physical_operator.h"
+
+/**
+ * @brief limit算子，跳过前offset行，最多输出limit行
+ * @ingroup PhysicalOperator
+ * @details 输出足够的行之后不再从子算子读取数据，子算子之后的数据都不会被计算。
+ */
+class LimitPhysicalOperator : public PhysicalOperator
+{
+public:
+  /**
+   * @param limit 小于0时表示不限制输出的行数
+   */
+  LimitPhysicalOperator(int64_t limit, int64_t offset) : limit_(limit), offset_(offset) {}
+  virtual ~LimitPhysicalOperator() = default;
+
+  PhysicalOperatorType type() const override
+  {
+    return PhysicalOperatorType::LIMIT;
+  }
+
+  std::string param() const override;
+
+  RC open(Trx *trx) override;
+  RC next() override;
+  RC close() override;
+  Tuple *current_tuple() override;
+
+  RC tuple_schema(TupleSchema &schema) const override { return children_tuple_schema(schema); }
+
+private:
+  int64_t limit_   = -1;
+  int64_t offset_  = 0;
+  int64_t skipped_ = 0;  ///< 已经跳过的行数
+  int64_t emitted_ = 0;  ///< 已经输出的行数
+};
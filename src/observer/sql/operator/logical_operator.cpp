@@ -21,3 +21,10 @@ void LogicalOperator::add_child(std::unique_ptr<LogicalOperator> oper)
 {
   children_.emplace_back(std::move(oper));
 }
+
+void LogicalOperator::collect_tables(std::set<const Table *> &tables) const
+{
+  for (const std::unique_ptr<LogicalOperator> &child : children_) {
+    child->collect_tables(tables);
+  }
+}
@@ -15,6 +15,7 @@ See the Mulan PSL v2 for more details. */
 #pragma once
 
 #include <memory>
+#include <set>
 #include <vector>
 
 #include "sql/expr/expression.h"
@@ -37,6 +38,9 @@ enum class LogicalOperatorType
   PREDICATE,  ///< 过滤，就是谓词
   PROJECTION, ///< 投影，就是select
   JOIN,       ///< 连接
+  AGGREGATION, ///< 聚合，包括分组聚合
+  SORT,       ///< 排序
+  LIMIT,      ///< 限制输出的行数
   INSERT,     ///< 插入
   DELETE,     ///< 删除，删除可能会有子查询
   EXPLAIN,    ///< 查看执行计划
@@ -64,6 +68,11 @@ public:
     return expressions_;
   }
 
+  /**
+   * @brief 收集当前算子及其所有孩子访问的表
+   */
+  virtual void collect_tables(std::set<const Table *> &tables) const;
+
 protected:
   std::vector<std::unique_ptr<LogicalOperator>> children_;  ///< 子算子
 
@@ -0,0 +1,229 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#include "sql/operator/merge_join_physical_operator.h"
+#include "common/log/log.h"
+
+using namespace std;
+
+MergeJoinPhysicalOperator::MergeJoinPhysicalOperator(unique_ptr<Expression> left_key, unique_ptr<Expression> right_key)
+    : left_key_expr_(std::move(left_key)), right_key_expr_(std::move(right_key))
+{}
+
+RC MergeJoinPhysicalOperator::open(Trx *trx)
+{
+  if (children_.size() != 2) {
+    LOG_WARN("merge join operator should have 2 children");
+    return RC::INTERNAL;
+  }
+
+  left_  = children_[0].get();
+  right_ = children_[1].get();
+
+  // 谓词在创建算子之后才绑定到joined_tuple_上，所以在这里编译
+  if (predicate_ && !program_) {
+    program_ = ExprProgram::try_compile(*predicate_, ExprProgram::FieldSource::TUPLE);
+  }
+
+  RC rc = left_->open(trx);
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to open left child. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  rc = right_->open(trx);
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to open right child. rc=%s", strrc(rc));
+    left_->close();
+    return rc;
+  }
+  opened_ = true;
+
+  group_cells_.clear();
+  group_rows_ = 0;
+  group_pos_  = 0;
+  joined_tuple_.set_right(&group_tuple_);
+
+  right_eof_ = false;
+  rc = right_next();
+  if (rc == RC::RECORD_EOF) {
+    right_eof_ = true;
+    rc = RC::SUCCESS;
+  }
+  return rc;
+}
+
+RC MergeJoinPhysicalOperator::left_next()
+{
+  RC rc = left_->next();
+  if (OB_FAIL(rc)) {
+    return rc;
+  }
+
+  Tuple *tuple = left_->current_tuple();
+  joined_tuple_.set_left(tuple);
+  return left_key_expr_->get_value(*tuple, left_key_);
+}
+
+RC MergeJoinPhysicalOperator::right_next()
+{
+  RC rc = right_->next();
+  if (OB_FAIL(rc)) {
+    return rc;
+  }
+  return right_key_expr_->get_value(*right_->current_tuple(), right_key_);
+}
+
+RC MergeJoinPhysicalOperator::fetch_right_group()
+{
+  RC rc = RC::SUCCESS;
+  group_key_ = right_key_;
+  group_cells_.clear();
+  group_rows_ = 0;
+  group_pos_  = 0;
+
+  bool first = true;
+  while (!right_eof_ && right_key_.compare(group_key_) == 0) {
+    Tuple *tuple = right_->current_tuple();
+    const int cell_num = tuple->cell_num();
+    if (first) {
+      vector<TupleCellSpec> specs(cell_num, TupleCellSpec(""));
+      for (int i = 0; i < cell_num && OB_SUCC(rc); i++) {
+        rc = tuple->spec_at(i, specs[i]);
+      }
+      if (OB_FAIL(rc)) {
+        LOG_WARN("failed to get cell spec of right child. rc=%s", strrc(rc));
+        return rc;
+      }
+      group_tuple_.set_specs(specs);
+      first = false;
+    }
+
+    const size_t offset = group_cells_.size();
+    group_cells_.resize(offset + cell_num);
+    for (int i = 0; i < cell_num; i++) {
+      rc = tuple->cell_at(i, group_cells_[offset + i]);
+      if (OB_FAIL(rc)) {
+        LOG_WARN("failed to get cell of right child. rc=%s", strrc(rc));
+        return rc;
+      }
+      group_cells_[offset + i].make_owned();
+    }
+    group_rows_++;
+
+    rc = right_next();
+    if (rc == RC::RECORD_EOF) {
+      right_eof_ = true;
+    } else if (OB_FAIL(rc)) {
+      return rc;
+    }
+  }
+  return RC::SUCCESS;
+}
+
+RC MergeJoinPhysicalOperator::next()
+{
+  RC rc = RC::SUCCESS;
+  while (true) {
+    // 当前左侧的行与缓存的右侧行逐个关联
+    while (group_pos_ < group_rows_) {
+      const int cell_num = static_cast<int>(group_cells_.size()) / group_rows_;
+      group_tuple_.set_cells(&group_cells_[static_cast<size_t>(group_pos_) * cell_num], cell_num);
+      group_pos_++;
+
+      bool result = true;
+      rc = filter(result);
+      if (OB_FAIL(rc)) {
+        return rc;
+      }
+      if (result) {
+        return rc;
+      }
+    }
+
+    rc = left_next();
+    if (OB_FAIL(rc)) {
+      return rc;
+    }
+
+    // 左侧key相同的多行都与同一组右侧行关联
+    if (group_rows_ > 0 && left_key_.compare(group_key_) == 0) {
+      group_pos_ = 0;
+      continue;
+    }
+
+    group_cells_.clear();
+    group_rows_ = 0;
+    group_pos_  = 0;
+    while (!right_eof_ && right_key_.compare(left_key_) < 0) {
+      rc = right_next();
+      if (rc == RC::RECORD_EOF) {
+        right_eof_ = true;
+      } else if (OB_FAIL(rc)) {
+        return rc;
+      }
+    }
+
+    if (right_eof_) {
+      // 左侧剩余的key都更大，不会再有关联的行
+      return RC::RECORD_EOF;
+    }
+
+    if (right_key_.compare(left_key_) == 0) {
+      rc = fetch_right_group();
+      if (OB_FAIL(rc)) {
+        return rc;
+      }
+    }
+  }
+  return rc;
+}
+
+RC MergeJoinPhysicalOperator::close()
+{
+  RC rc = RC::SUCCESS;
+  if (opened_) {
+    rc = left_->close();
+    RC rc2 = right_->close();
+    if (OB_SUCC(rc)) {
+      rc = rc2;
+    }
+    opened_ = false;
+  }
+  group_cells_.clear();
+  group_rows_ = 0;
+  group_pos_  = 0;
+  return rc;
+}
+
+Tuple *MergeJoinPhysicalOperator::current_tuple()
+{
+  return &joined_tuple_;
+}
+
+RC MergeJoinPhysicalOperator::filter(bool &result)
+{
+  result = true;
+  if (!predicate_) {
+    return RC::SUCCESS;
+  }
+
+  Value value;
+  RC rc = program_ ? program_->eval(joined_tuple_, value) : predicate_->get_value(joined_tuple_, value);
+  if (OB_FAIL(rc)) {
+    return rc;
+  }
+  result = value.get_boolean();
+  return rc;
+}
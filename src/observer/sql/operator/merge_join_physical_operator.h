@@ -0,0 +1,90 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#pragma once
+
+#include "sql/operator/physical_operator.h"
+#include "sql/expr/expr_program.h"
+
+/**
+ * @brief 等值连接的merge join算子
+ * @ingroup PhysicalOperator
+ * @details 要求两个孩子输出的数据都已经按照连接key升序排列，比如都是连接字段上的索引扫描。
+ * 两侧同时向前推进，只需要缓存右侧key相同的一组行，用于和左侧key相同的多行关联。
+ * 输出的顺序与左侧的顺序相同。
+ * 除了等值条件以外的连接条件，在关联之后再过滤。
+ */
+class MergeJoinPhysicalOperator : public PhysicalOperator
+{
+public:
+  /**
+   * @param left_key 左孩子上计算的连接key，左孩子按照它有序
+   * @param right_key 右孩子上计算的连接key，右孩子按照它有序
+   */
+  MergeJoinPhysicalOperator(std::unique_ptr<Expression> left_key, std::unique_ptr<Expression> right_key);
+  virtual ~MergeJoinPhysicalOperator() = default;
+
+  PhysicalOperatorType type() const override
+  {
+    return PhysicalOperatorType::MERGE_JOIN;
+  }
+
+  /**
+   * @brief 设置等值条件之外的连接条件
+   */
+  void set_predicate(std::unique_ptr<Expression> predicate)
+  {
+    predicate_ = std::move(predicate);
+  }
+
+  RC open(Trx *trx) override;
+  RC next() override;
+  RC close() override;
+  Tuple *current_tuple() override;
+
+  RC tuple_schema(TupleSchema &schema) const override { return children_tuple_schema(schema); }
+
+private:
+  RC left_next();
+  RC right_next();
+
+  /**
+   * @brief 从右侧读取所有与当前右侧key相同的行，缓存起来
+   */
+  RC fetch_right_group();
+
+  RC filter(bool &result);
+
+private:
+  std::unique_ptr<Expression> left_key_expr_;
+  std::unique_ptr<Expression> right_key_expr_;
+  std::unique_ptr<Expression> predicate_;
+  std::unique_ptr<ExprProgram> program_;  ///< 编译后的predicate_，open时编译
+
+  PhysicalOperator *left_ = nullptr;
+  PhysicalOperator *right_ = nullptr;
+  bool              opened_ = false;
+
+  Value left_key_;
+  Value right_key_;
+  bool  right_eof_ = false;  ///< 右侧是否已经读完，没有读完时right_key_是右侧当前行的key
+
+  Value              group_key_;    ///< 缓存的右侧一组行的key
+  std::vector<Value> group_cells_;  ///< 缓存的右侧的行，按行连续存放
+  int                group_rows_ = 0;
+  int                group_pos_  = 0;  ///< 当前左侧行下一个要关联的缓存行
+
+  ValueListTuple group_tuple_;
+  JoinedTuple    joined_tuple_;
+};
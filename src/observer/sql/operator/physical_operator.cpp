@@ -23,6 +23,22 @@ std::string physical_operator_type_name(PhysicalOperatorType type)
       return "INDEX_SCAN";
     case PhysicalOperatorType::NESTED_LOOP_JOIN:
       return "NESTED_LOOP_JOIN";
+    case PhysicalOperatorType::HASH_JOIN:
+      return "HASH_JOIN";
+    case PhysicalOperatorType::MERGE_JOIN:
+      return "MERGE_JOIN";
+    case PhysicalOperatorType::INDEX_NESTED_LOOP_JOIN:
+      return "INDEX_NESTED_LOOP_JOIN";
+    case PhysicalOperatorType::HASH_AGGREGATE:
+      return "HASH_AGGREGATE";
+    case PhysicalOperatorType::STREAM_AGGREGATE:
+      return "STREAM_AGGREGATE";
+    case PhysicalOperatorType::SORT:
+      return "SORT";
+    case PhysicalOperatorType::TOP_N:
+      return "TOP_N";
+    case PhysicalOperatorType::LIMIT:
+      return "LIMIT";
     case PhysicalOperatorType::EXPLAIN:
       return "EXPLAIN";
     case PhysicalOperatorType::PREDICATE:
@@ -35,6 +51,24 @@ std::string physical_operator_type_name(PhysicalOperatorType type)
       return "PROJECT";
     case PhysicalOperatorType::STRING_LIST:
       return "STRING_LIST";
+    case PhysicalOperatorType::TABLE_SCAN_VEC:
+      return "TABLE_SCAN_VEC";
+    case PhysicalOperatorType::PREDICATE_VEC:
+      return "PREDICATE_VEC";
+    case PhysicalOperatorType::PROJECT_VEC:
+      return "PROJECT_VEC";
+    case PhysicalOperatorType::AGGREGATE_VEC:
+      return "AGGREGATE_VEC";
+    case PhysicalOperatorType::ROW_TO_VEC:
+      return "ROW_TO_VEC";
+    case PhysicalOperatorType::VEC_TO_ROW:
+      return "VEC_TO_ROW";
+    case PhysicalOperatorType::EXCHANGE:
+      return "EXCHANGE";
+    case PhysicalOperatorType::ANALYZE:
+      return "ANALYZE";
+    case PhysicalOperatorType::QUERY_RESULT:
+      return "QUERY_RESULT";
     default:
       return "UNKNOWN";
   }
@@ -52,3 +86,19 @@ std::string PhysicalOperator::param() const
 {
   return "";
 }
+
+RC PhysicalOperator::tuple_schema(TupleSchema &schema) const
+{
+  return RC::UNIMPLENMENT;
+}
+
+RC PhysicalOperator::children_tuple_schema(TupleSchema &schema) const
+{
+  for (const std::unique_ptr<PhysicalOperator> &child : children_) {
+    RC rc = child->tuple_schema(schema);
+    if (OB_FAIL(rc)) {
+      return rc;
+    }
+  }
+  return RC::SUCCESS;
+}
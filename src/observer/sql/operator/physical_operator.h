@@ -24,6 +24,7 @@ See the Mulan PSL v2 for more details. */
 class Record;
 class TupleCellSpec;
 class Trx;
+class Chunk;
 
 /**
  * @brief 物理算子
@@ -40,6 +41,14 @@ enum class PhysicalOperatorType
   TABLE_SCAN,
   INDEX_SCAN,
   NESTED_LOOP_JOIN,
+  HASH_JOIN,
+  MERGE_JOIN,
+  INDEX_NESTED_LOOP_JOIN,
+  HASH_AGGREGATE,
+  STREAM_AGGREGATE,
+  SORT,
+  TOP_N,
+  LIMIT,
   EXPLAIN,
   PREDICATE,
   PROJECT,
@@ -47,6 +56,15 @@ enum class PhysicalOperatorType
   STRING_LIST,
   DELETE,
   INSERT,
+  TABLE_SCAN_VEC,
+  PREDICATE_VEC,
+  PROJECT_VEC,
+  AGGREGATE_VEC,
+  ROW_TO_VEC,
+  VEC_TO_ROW,
+  EXCHANGE,
+  ANALYZE,
+  QUERY_RESULT,
 };
 
 /**
@@ -74,6 +92,27 @@ public:
 
   virtual Tuple *current_tuple() = 0;
 
+  /**
+   * @brief 向量化执行接口，每次返回一批数据
+   * @details 向量化的算子实现这个接口，而不是next()/current_tuple()。
+   * 两种接口的算子之间通过RowToVec和VecToRow算子转换。
+   * 没有数据时返回RECORD_EOF。
+   */
+  virtual RC next(Chunk &chunk) { return RC::UNIMPLENMENT; }
+
+  /**
+   * @brief 输出的tuple中每个cell的描述，顺序与current_tuple返回的tuple中cell的顺序一致
+   * @details 生成物理计划时，根据子算子的schema把字段表达式绑定到cell的位置上，
+   * 执行时按位置取值，不需要每行都按照表名和字段名查找。
+   * 执行之前无法确定输出格式的算子返回UNIMPLENMENT，这时仍然按照名字查找。
+   */
+  virtual RC tuple_schema(TupleSchema &schema) const;
+
+  /**
+   * @brief 执行期间算子占用内存的峰值，EXPLAIN ANALYZE 时输出
+   */
+  virtual int64_t peak_memory() const { return 0; }
+
   void add_child(std::unique_ptr<PhysicalOperator> oper)
   {
     children_.emplace_back(std::move(oper));
@@ -84,6 +123,12 @@ public:
     return children_;
   }
 
+protected:
+  /**
+   * @brief 按顺序拼接所有子算子的schema，适用于直接输出子算子tuple或者连接子算子tuple的算子
+   */
+  RC children_tuple_schema(TupleSchema &schema) const;
+
 protected:
   std::vector<std::unique_ptr<PhysicalOperator>> children_;
 };
@@ -21,10 +21,14 @@ See the Mulan PSL v2 for more details. */
 PredicatePhysicalOperator::PredicatePhysicalOperator(std::unique_ptr<Expression> expr) : expression_(std::move(expr))
 {
   ASSERT(expression_->value_type() == BOOLEANS, "predicate's expression should be BOOLEAN type");
+  program_ = ExprProgram::try_compile(*expression_, ExprProgram::FieldSource::TUPLE);
 }
 
 RC PredicatePhysicalOperator::open(Trx *trx)
 {
+  if (children_.empty()) {
+    return RC::SUCCESS;
+  }
   if (children_.size() != 1) {
     LOG_WARN("predicate operator must has one child");
     return RC::INTERNAL;
@@ -35,6 +39,10 @@ RC PredicatePhysicalOperator::open(Trx *trx)
 
 RC PredicatePhysicalOperator::next()
 {
+  if (children_.empty()) {
+    return RC::RECORD_EOF;
+  }
+
   RC rc = RC::SUCCESS;
   PhysicalOperator *oper = children_.front().get();
 
@@ -47,7 +55,11 @@ RC PredicatePhysicalOperator::next()
     }
 
     Value value;
-    rc = expression_->get_value(*tuple, value);
+    if (program_) {
+      rc = program_->eval(*tuple, value);
+    } else {
+      rc = expression_->get_value(*tuple, value);
+    }
     if (rc != RC::SUCCESS) {
       return rc;
     }
@@ -61,11 +73,13 @@ RC PredicatePhysicalOperator::next()
 
 RC PredicatePhysicalOperator::close()
 {
-  children_[0]->close();
+  if (!children_.empty()) {
+    children_[0]->close();
+  }
   return RC::SUCCESS;
 }
 
 Tuple *PredicatePhysicalOperator::current_tuple()
 {
-  return children_[0]->current_tuple();
+  return children_.empty() ? nullptr : children_[0]->current_tuple();
 }
@@ -17,12 +17,15 @@ See the Mulan PSL v2 for more details. */
 #include <memory>
 #include "sql/operator/physical_operator.h"
 #include "sql/expr/expression.h"
+#include "sql/expr/expr_program.h"
 
 class FilterStmt;
 
 /**
  * @brief 过滤/谓词物理算子
  * @ingroup PhysicalOperator
+ * @details 表达式中的字段已经绑定到子算子输出的位置时，编译成 ExprProgram 计算。
+ * 没有子算子时表示条件恒为false的空结果集
  */
 class PredicatePhysicalOperator : public PhysicalOperator
 {
@@ -42,6 +45,9 @@ public:
 
   Tuple *current_tuple() override;
 
+  RC tuple_schema(TupleSchema &schema) const override { return children_tuple_schema(schema); }
+
 private:
-  std::unique_ptr<Expression> expression_;
+  std::unique_ptr<Expression>  expression_;
+  std::unique_ptr<ExprProgram> program_;
 };
@@ -0,0 +1,58 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#include "common/log/log.h"
+#include "sql/operator/predicate_vec_physical_operator.h"
+
+PredicateVecPhysicalOperator::PredicateVecPhysicalOperator(std::unique_ptr<Expression> expr)
+    : expression_(std::move(expr))
+{
+  ASSERT(expression_->value_type() == BOOLEANS, "predicate's expression should be BOOLEAN type");
+}
+
+RC PredicateVecPhysicalOperator::open(Trx *trx)
+{
+  if (children_.size() != 1) {
+    LOG_WARN("predicate operator must has one child");
+    return RC::INTERNAL;
+  }
+
+  return children_[0]->open(trx);
+}
+
+RC PredicateVecPhysicalOperator::next(Chunk &chunk)
+{
+  RC rc = RC::SUCCESS;
+  PhysicalOperator *oper = children_.front().get();
+
+  while (RC::SUCCESS == (rc = oper->next(chunk))) {
+    rc = expression_->eval(chunk, select_);
+    if (rc != RC::SUCCESS) {
+      LOG_WARN("failed to eval predicate. rc=%s", strrc(rc));
+      return rc;
+    }
+
+    chunk.select(select_);
+    if (chunk.active_rows() > 0) {
+      return rc;
+    }
+  }
+  return rc;
+}
+
+RC PredicateVecPhysicalOperator::close()
+{
+  children_[0]->close();
+  return RC::SUCCESS;
+}
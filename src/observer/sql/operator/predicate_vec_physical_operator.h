@@ -0,0 +1,49 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#pragma once
+
+#include <memory>
+#include "sql/operator/physical_operator.h"
+#include "sql/expr/expression.h"
+#include "storage/common/chunk.h"
+
+/**
+ * @brief 向量化的过滤物理算子
+ * @ingroup PhysicalOperator
+ * @details 不搬移数据，只更新chunk的选择向量。跳过所有行都被过滤掉的chunk。
+ */
+class PredicateVecPhysicalOperator : public PhysicalOperator
+{
+public:
+  PredicateVecPhysicalOperator(std::unique_ptr<Expression> expr);
+
+  virtual ~PredicateVecPhysicalOperator() = default;
+
+  PhysicalOperatorType type() const override
+  {
+    return PhysicalOperatorType::PREDICATE_VEC;
+  }
+
+  RC open(Trx *trx) override;
+  RC next() override { return RC::UNIMPLENMENT; }
+  RC next(Chunk &chunk) override;
+  RC close() override;
+
+  Tuple *current_tuple() override { return nullptr; }
+
+private:
+  std::unique_ptr<Expression> expression_;
+  std::vector<uint8_t>        select_;
+};
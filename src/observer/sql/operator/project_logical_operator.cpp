@@ -16,3 +16,8 @@ See the Mulan PSL v2 for more details. */
 
 ProjectLogicalOperator::ProjectLogicalOperator(const std::vector<Field> &fields) : fields_(fields)
 {}
+
+ProjectLogicalOperator::ProjectLogicalOperator(std::vector<std::unique_ptr<Expression>> &&expressions)
+{
+  expressions_ = std::move(expressions);
+}
@@ -30,6 +30,11 @@ class ProjectLogicalOperator : public LogicalOperator
 {
 public:
   ProjectLogicalOperator(const std::vector<Field> &fields);
+
+  /**
+   * @brief 按照表达式投影，表达式只能是字段或者子算子输出的聚合函数
+   */
+  ProjectLogicalOperator(std::vector<std::unique_ptr<Expression>> &&expressions);
   virtual ~ProjectLogicalOperator() = default;
 
   LogicalOperatorType type() const override
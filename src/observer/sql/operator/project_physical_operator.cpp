@@ -61,3 +61,18 @@ void ProjectPhysicalOperator::add_projection(const Table *table, const FieldMeta
   TupleCellSpec *spec = new TupleCellSpec(table->name(), field_meta->name(), field_meta->name());
   tuple_.add_cell_spec(spec);
 }
+
+void ProjectPhysicalOperator::add_projection(const char *alias)
+{
+  tuple_.add_cell_spec(new TupleCellSpec(alias));
+}
+
+RC ProjectPhysicalOperator::tuple_schema(TupleSchema &schema) const
+{
+  for (int i = 0; i < tuple_.cell_num(); i++) {
+    TupleCellSpec spec("");
+    tuple_.spec_at(i, spec);
+    schema.append_cell(spec);
+  }
+  return RC::SUCCESS;
+}
@@ -34,6 +34,11 @@ public:
   }
   void add_projection(const Table *table, const FieldMeta *field);
 
+  /**
+   * @brief 按照名字投影子算子输出的列，比如聚合函数的结果
+   */
+  void add_projection(const char *alias);
+
   PhysicalOperatorType type() const override
   {
     return PhysicalOperatorType::PROJECT;
@@ -50,6 +55,13 @@ public:
 
   Tuple *current_tuple() override;
 
+  RC tuple_schema(TupleSchema &schema) const override;
+
+  /**
+   * @brief 把投影的cell绑定到子算子输出的tuple中的位置上
+   */
+  void bind_cells(const TupleSchema &child_schema) { tuple_.bind_cells(child_schema); }
+
 private:
   ProjectTuple tuple_;
 };
@@ -0,0 +1,68 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#include "common/log/log.h"
+#include "sql/operator/project_vec_physical_operator.h"
+
+using namespace std;
+
+ProjectVecPhysicalOperator::ProjectVecPhysicalOperator(vector<unique_ptr<Expression>> &&expressions)
+    : expressions_(std::move(expressions))
+{}
+
+RC ProjectVecPhysicalOperator::open(Trx *trx)
+{
+  if (children_.size() != 1) {
+    LOG_WARN("project vec operator must has one child");
+    return RC::INTERNAL;
+  }
+
+  return children_[0]->open(trx);
+}
+
+RC ProjectVecPhysicalOperator::next(Chunk &chunk)
+{
+  RC rc = children_[0]->next(child_chunk_);
+  if (rc != RC::SUCCESS) {
+    return rc;
+  }
+
+  if (chunk.column_num() != static_cast<int>(expressions_.size())) {
+    chunk.reset();
+    for (size_t i = 0; i < expressions_.size(); i++) {
+      chunk.add_column(make_unique<Column>(), static_cast<int>(i));
+    }
+  }
+
+  for (size_t i = 0; i < expressions_.size(); i++) {
+    rc = expressions_[i]->get_column(child_chunk_, chunk.column(i));
+    if (rc != RC::SUCCESS) {
+      LOG_WARN("failed to get column of expression %s. rc=%s", expressions_[i]->name().c_str(), strrc(rc));
+      return rc;
+    }
+  }
+
+  if (child_chunk_.has_selection()) {
+    chunk.set_selection(vector<int>(child_chunk_.selection()));
+  } else {
+    chunk.clear_selection();
+  }
+  return rc;
+}
+
+RC ProjectVecPhysicalOperator::close()
+{
+  children_[0]->close();
+  return RC::SUCCESS;
+}
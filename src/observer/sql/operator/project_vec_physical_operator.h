@@ -0,0 +1,52 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#pragma once
+
+#include <memory>
+#include "sql/operator/physical_operator.h"
+#include "sql/expr/expression.h"
+#include "storage/common/chunk.h"
+
+/**
+ * @brief 向量化的投影物理算子
+ * @ingroup PhysicalOperator
+ * @details 对子算子输出的每个chunk计算所有投影表达式，第i个表达式的结果是输出chunk中ID为i的列。
+ * 字段表达式只是引用子算子的列，不会拷贝数据。选择向量原样传递给上层。
+ */
+class ProjectVecPhysicalOperator : public PhysicalOperator
+{
+public:
+  ProjectVecPhysicalOperator(std::vector<std::unique_ptr<Expression>> &&expressions);
+
+  virtual ~ProjectVecPhysicalOperator() = default;
+
+  PhysicalOperatorType type() const override
+  {
+    return PhysicalOperatorType::PROJECT_VEC;
+  }
+
+  RC open(Trx *trx) override;
+  RC next() override { return RC::UNIMPLENMENT; }
+  RC next(Chunk &chunk) override;
+  RC close() override;
+
+  Tuple *current_tuple() override { return nullptr; }
+
+  std::vector<std::unique_ptr<Expression>> &expressions() { return expressions_; }
+
+private:
+  std::vector<std::unique_ptr<Expression>> expressions_;
+  Chunk                                    child_chunk_;
+};
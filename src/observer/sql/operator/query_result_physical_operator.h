@@ -0,0 +1,66 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#pragma once
+
+#include <memory>
+
+#include "sql/operator/physical_operator.h"
+#include "sql/query_cache/query_cache.h"
+
+/**
+ * @brief 返回查询缓存中的结果
+ * @ingroup PhysicalOperator
+ * @details 命中查询缓存时代替整个执行计划。结果可能同时被多个会话使用，这里只读取不修改
+ */
+class QueryResultPhysicalOperator : public PhysicalOperator
+{
+public:
+  explicit QueryResultPhysicalOperator(std::shared_ptr<const QueryResult> result) : result_(std::move(result)) {}
+
+  virtual ~QueryResultPhysicalOperator() = default;
+
+  PhysicalOperatorType type() const override { return PhysicalOperatorType::QUERY_RESULT; }
+
+  RC open(Trx *) override
+  {
+    index_ = -1;
+    return RC::SUCCESS;
+  }
+
+  RC next() override
+  {
+    const int row_num = static_cast<int>(result_->rows().size());
+    if (index_ < row_num) {
+      index_++;
+    }
+    if (index_ >= row_num) {
+      return RC::RECORD_EOF;
+    }
+
+    const std::vector<Value> &row = result_->rows()[index_];
+    tuple_.set_cells(row.data(), static_cast<int>(row.size()));
+    return RC::SUCCESS;
+  }
+
+  RC close() override { return RC::SUCCESS; }
+
+  Tuple *current_tuple() override { return &tuple_; }
+
+private:
+  std::shared_ptr<const QueryResult> result_;
+  int                                index_ = -1;
+  ValueListTuple                     tuple_;
+};
@@ -0,0 +1,173 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#include <new>
+
+#include "sql/operator/row_buffer.h"
+#include "common/global_context.h"
+#include "common/log/log.h"
+
+using namespace std;
+
+RowBuffer::~RowBuffer()
+{
+  clear_rows();
+}
+
+void RowBuffer::init(int64_t memory_limit, common::MemoryTracker *memory_tracker)
+{
+  clear();
+  memory_limit_ = memory_limit;
+  memory_.reset(memory_tracker);
+  arena_.set_source(common::QueryArena::current());
+}
+
+void RowBuffer::clear_rows()
+{
+  // 行在arena中构造，释放内存之前需要先析构
+  for (Value *cells : row_cells_) {
+    for (int i = 0; i < cell_num_; i++) {
+      cells[i].~Value();
+    }
+  }
+  vector<Value *>().swap(row_cells_);
+  arena_.reset();
+}
+
+void RowBuffer::clear()
+{
+  clear_rows();
+  file_.reset();
+  memory_size_ = 0;
+  memory_.update(0);
+  rows_        = 0;
+  cell_num_    = 0;
+  pos_         = 0;
+}
+
+RC RowBuffer::append(const Tuple &tuple)
+{
+  RC rc = RC::SUCCESS;
+  const int cell_num = tuple.cell_num();
+  if (rows_ == 0) {
+    vector<TupleCellSpec> specs(cell_num, TupleCellSpec(""));
+    for (int i = 0; i < cell_num && OB_SUCC(rc); i++) {
+      rc = tuple.spec_at(i, specs[i]);
+    }
+    if (OB_FAIL(rc)) {
+      LOG_WARN("failed to get cell spec. rc=%s", strrc(rc));
+      return rc;
+    }
+    tuple_.set_specs(specs);
+    cell_num_ = cell_num;
+  }
+
+  const size_t arena_used = arena_.used_size();
+  Value       *cells      = nullptr;
+  if (!file_) {
+    cells = static_cast<Value *>(arena_.alloc(sizeof(Value) * cell_num));
+    for (int i = 0; i < cell_num; i++) {
+      new (&cells[i]) Value();
+    }
+    row_cells_.push_back(cells);
+  }
+
+  Value cell;
+  for (int i = 0; i < cell_num; i++) {
+    rc = tuple.cell_at(i, cell);
+    if (OB_FAIL(rc)) {
+      LOG_WARN("failed to get cell. index=%d, rc=%s", i, strrc(rc));
+      return rc;
+    }
+
+    if (file_) {
+      rc = file_->write_value(cell);
+      if (OB_FAIL(rc)) {
+        return rc;
+      }
+    } else {
+      cells[i].set_value(cell, arena_);
+    }
+  }
+  rows_++;
+
+  if (!file_) {
+    memory_size_ += static_cast<int64_t>(arena_.used_size() - arena_used + sizeof(Value *));
+    const bool within_query_limit = memory_.update(memory_size_);
+    if ((memory_size_ > memory_limit_ || !within_query_limit) && GCTX.temp_file_manager_ != nullptr) {
+      rc = spill();
+    }
+  }
+  return rc;
+}
+
+RC RowBuffer::spill()
+{
+  LOG_INFO("row buffer exceeds memory limit, spill to temp file. rows=%ld, memory=%ld, limit=%ld",
+           rows_, memory_size_, memory_limit_);
+  RC rc = GCTX.temp_file_manager_->create_file(file_);
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to create temp file. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  for (const Value *cells : row_cells_) {
+    for (int i = 0; i < cell_num_; i++) {
+      rc = file_->write_value(cells[i]);
+      if (OB_FAIL(rc)) {
+        return rc;
+      }
+    }
+  }
+
+  clear_rows();
+  memory_size_ = 0;
+  memory_.update(0);
+  return rc;
+}
+
+RC RowBuffer::rewind()
+{
+  pos_ = 0;
+  if (file_) {
+    return file_->rewind();
+  }
+  return RC::SUCCESS;
+}
+
+RC RowBuffer::next()
+{
+  if (!file_) {
+    if (pos_ >= rows_) {
+      return RC::RECORD_EOF;
+    }
+    tuple_.set_cells(row_cells_[pos_], cell_num_);
+    pos_++;
+    return RC::SUCCESS;
+  }
+
+  current_cells_.resize(cell_num_);
+  for (int i = 0; i < cell_num_; i++) {
+    RC rc = file_->read_value(current_cells_[i]);
+    if (rc == RC::RECORD_EOF && i > 0) {
+      LOG_WARN("row buffer temp file is truncated. file=%s", file_->path().c_str());
+      return RC::IOERR_READ;
+    }
+    if (OB_FAIL(rc)) {
+      return rc;
+    }
+  }
+  tuple_.set_cells(current_cells_);
+  return RC::SUCCESS;
+}
@@ -0,0 +1,91 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#pragma once
+
+#include <stdint.h>
+#include <memory>
+#include <vector>
+
+#include "common/mm/arena.h"
+#include "common/mm/memory_tracker.h"
+#include "sql/expr/tuple.h"
+#include "storage/common/temp_file.h"
+
+/**
+ * @brief 物化保存的一组行
+ * @ingroup PhysicalOperator
+ * @details 算子需要多次遍历同一份数据时使用，比如nested loop join的内表。
+ * 先通过append追加所有的行，然后rewind，再通过next逐行遍历，可以多次rewind。
+ * 数据先保存在内存中，超过内存限制或者查询的内存超过限制后全部写到临时文件中。
+ * 内存中的行(包括较长的字符串)在Arena中分配，Arena的块从当前查询的QueryArena中获取，
+ * 写到临时文件或者clear时还回去，使用的算子在close时需要clear。
+ * 所有行的cell描述都相同，只在追加第一行时记录。
+ */
+class RowBuffer
+{
+public:
+  RowBuffer() = default;
+  ~RowBuffer();
+
+  /**
+   * @param memory_tracker 记录使用的内存，为空时不记录
+   */
+  void init(int64_t memory_limit, common::MemoryTracker *memory_tracker = nullptr);
+
+  RC append(const Tuple &tuple);
+
+  /**
+   * @brief 从第一行开始遍历。第一次调用之后不能再追加数据
+   */
+  RC rewind();
+
+  /**
+   * @brief 遍历下一行，通过current_tuple获取
+   * @return 没有更多的数据时返回RECORD_EOF
+   */
+  RC next();
+
+  Tuple *current_tuple() { return &tuple_; }
+
+  void clear();
+
+  int64_t rows() const { return rows_; }
+  bool    spilled() const { return file_ != nullptr; }
+
+  /**
+   * @brief 内存中数据占用的内存
+   */
+  int64_t memory_size() const { return memory_size_; }
+  int64_t peak_memory() const { return memory_.peak(); }
+
+private:
+  RC   spill();
+  void clear_rows();
+
+private:
+  int64_t memory_limit_ = INT64_MAX;
+  int64_t memory_size_  = 0;
+  common::MemoryReservation memory_;
+  int64_t rows_         = 0;
+  int     cell_num_     = 0;
+
+  std::vector<Value *>       row_cells_;  ///< 内存中每行的数据，在arena_中分配
+  common::Arena             arena_;
+  std::unique_ptr<TempFile> file_;       ///< 超过内存限制后，数据都保存在临时文件中
+  int64_t                   pos_ = 0;    ///< 下一个要访问的内存中的行
+
+  std::vector<Value> current_cells_;  ///< 从临时文件中读取的当前行
+  ValueListTuple     tuple_;
+};
@@ -0,0 +1,91 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#include "common/log/log.h"
+#include "sql/operator/row_to_vec_physical_operator.h"
+
+using namespace std;
+
+RowToVecPhysicalOperator::RowToVecPhysicalOperator(const vector<Field> &fields) : fields_(fields)
+{
+  specs_.reserve(fields_.size());
+  for (const Field &field : fields_) {
+    specs_.emplace_back(field.table_name(), field.field_name());
+  }
+}
+
+RC RowToVecPhysicalOperator::open(Trx *trx)
+{
+  if (children_.size() != 1) {
+    LOG_WARN("row to vec operator must has one child");
+    return RC::INTERNAL;
+  }
+
+  child_eof_ = false;
+  return children_[0]->open(trx);
+}
+
+RC RowToVecPhysicalOperator::next(Chunk &chunk)
+{
+  if (child_eof_) {
+    return RC::RECORD_EOF;
+  }
+
+  if (chunk.column_num() != static_cast<int>(fields_.size())) {
+    chunk.reset();
+    for (size_t i = 0; i < fields_.size(); i++) {
+      chunk.add_column(make_unique<Column>(*fields_[i].meta(), Chunk::MAX_ROWS), static_cast<int>(i));
+    }
+  } else {
+    chunk.reset_data();
+  }
+
+  RC rc = RC::SUCCESS;
+  PhysicalOperator *child = children_[0].get();
+  Value value;
+  int rows = 0;
+  while (rows < Chunk::MAX_ROWS) {
+    rc = child->next();
+    if (rc == RC::RECORD_EOF) {
+      child_eof_ = true;
+      break;
+    }
+    if (OB_FAIL(rc)) {
+      LOG_WARN("failed to get next tuple from child. rc=%s", strrc(rc));
+      return rc;
+    }
+
+    Tuple *tuple = child->current_tuple();
+    for (size_t i = 0; i < specs_.size(); i++) {
+      rc = tuple->find_cell(specs_[i], value);
+      if (OB_FAIL(rc)) {
+        LOG_WARN("failed to find cell %s. rc=%s", specs_[i].alias(), strrc(rc));
+        return rc;
+      }
+      rc = chunk.column(i).append_value(value);
+      if (OB_FAIL(rc)) {
+        return rc;
+      }
+    }
+    rows++;
+  }
+
+  return rows == 0 ? RC::RECORD_EOF : RC::SUCCESS;
+}
+
+RC RowToVecPhysicalOperator::close()
+{
+  children_[0]->close();
+  return RC::SUCCESS;
+}
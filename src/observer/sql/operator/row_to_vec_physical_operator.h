@@ -0,0 +1,49 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#pragma once
+
+#include "sql/operator/physical_operator.h"
+#include "storage/common/chunk.h"
+
+/**
+ * @brief 将按行输出的算子转换为向量化接口
+ * @ingroup PhysicalOperator
+ * @details 从子算子中读取最多MAX_ROWS行，按照fields从tuple中查找每个字段，
+ * 第i个字段是输出chunk中ID为i的列。用于向量化算子之下还没有向量化实现的算子，比如连接。
+ */
+class RowToVecPhysicalOperator : public PhysicalOperator
+{
+public:
+  RowToVecPhysicalOperator(const std::vector<Field> &fields);
+
+  virtual ~RowToVecPhysicalOperator() = default;
+
+  PhysicalOperatorType type() const override
+  {
+    return PhysicalOperatorType::ROW_TO_VEC;
+  }
+
+  RC open(Trx *trx) override;
+  RC next() override { return RC::UNIMPLENMENT; }
+  RC next(Chunk &chunk) override;
+  RC close() override;
+
+  Tuple *current_tuple() override { return nullptr; }
+
+private:
+  std::vector<Field>         fields_;
+  std::vector<TupleCellSpec> specs_;
+  bool                       child_eof_ = false;
+};
@@ -0,0 +1,168 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#include <algorithm>
+
+#include "sql/operator/runtime_filter.h"
+#include "sql/operator/join_hash_table.h"
+#include "storage/field/field_meta.h"
+
+using namespace std;
+
+/**
+ * @brief 每个32位字使用不同的乘数，从hash值的低32位得到字中的一位
+ */
+static constexpr uint32_t BLOOM_SALTS[8] = {
+    0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU, 0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+RuntimeFilter::Block RuntimeFilter::block_mask(uint64_t hash)
+{
+  Block mask;
+  const uint32_t low = static_cast<uint32_t>(hash);
+  for (int i = 0; i < 8; i++) {
+    mask.words[i] = 1U << ((low * BLOOM_SALTS[i]) >> 27);
+  }
+  return mask;
+}
+
+void RuntimeFilter::reset()
+{
+  ready_     = false;
+  use_bloom_ = true;
+  use_range_ = true;
+  min_key_   = 0;
+  max_key_   = 0;
+  rows_      = 0;
+  hashes_.clear();
+  blocks_.clear();
+}
+
+void RuntimeFilter::add(const Value *keys, int key_num, uint64_t hash)
+{
+  if (use_range_) {
+    if (key_num != 1 || keys[0].attr_type() != INTS) {
+      use_range_ = false;
+    } else {
+      const int key = keys[0].get_int();
+      min_key_      = rows_ == 0 ? key : std::min(min_key_, key);
+      max_key_      = rows_ == 0 ? key : std::max(max_key_, key);
+    }
+  }
+
+  rows_++;
+  if (use_bloom_) {
+    if (rows_ > MAX_BLOOM_KEYS) {
+      use_bloom_ = false;
+      vector<uint64_t>().swap(hashes_);
+    } else {
+      hashes_.push_back(hash);
+    }
+  }
+}
+
+void RuntimeFilter::build()
+{
+  if (use_bloom_) {
+    const size_t block_num = std::max<size_t>(1, (hashes_.size() * BITS_PER_KEY + 255) / 256);
+    blocks_.assign(block_num, Block{});
+    for (uint64_t hash : hashes_) {
+      Block       &block = blocks_[block_index(hash)];
+      const Block  mask  = block_mask(hash);
+      for (int i = 0; i < 8; i++) {
+        block.words[i] |= mask.words[i];
+      }
+    }
+  }
+  vector<uint64_t>().swap(hashes_);
+  ready_ = true;
+}
+
+bool RuntimeFilter::may_contain(const Value *keys, int key_num) const
+{
+  if (!ready_) {
+    return true;
+  }
+  if (rows_ == 0) {
+    return false;
+  }
+
+  if (use_range_) {
+    const int key = keys[0].get_int();
+    if (key < min_key_ || key > max_key_) {
+      return false;
+    }
+  }
+
+  if (!use_bloom_) {
+    return true;
+  }
+
+  const uint64_t hash  = JoinHashTable::hash_keys(keys, key_num);
+  const Block   &block = blocks_[block_index(hash)];
+  const Block    mask  = block_mask(hash);
+  for (int i = 0; i < 8; i++) {
+    if ((block.words[i] & mask.words[i]) == 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void ScanRuntimeFilters::add(shared_ptr<RuntimeFilter> filter, vector<const FieldMeta *> key_fields)
+{
+  Entry entry;
+  entry.filter     = std::move(filter);
+  entry.key_fields = std::move(key_fields);
+  entries_.emplace_back(std::move(entry));
+}
+
+void ScanRuntimeFilters::reset()
+{
+  for (Entry &entry : entries_) {
+    entry.checked  = 0;
+    entry.passed   = 0;
+    entry.disabled = false;
+  }
+}
+
+bool ScanRuntimeFilters::check(const char *record_data)
+{
+  for (Entry &entry : entries_) {
+    if (entry.disabled || !entry.filter->ready()) {
+      continue;
+    }
+
+    const int key_num = static_cast<int>(entry.key_fields.size());
+    keys_.resize(key_num);
+    for (int i = 0; i < key_num; i++) {
+      const FieldMeta *field_meta = entry.key_fields[i];
+      keys_[i].set_type(field_meta->type());
+      keys_[i].set_data(const_cast<char *>(record_data) + field_meta->offset(), field_meta->len());
+    }
+
+    const bool pass = entry.filter->may_contain(keys_.data(), key_num);
+    entry.checked++;
+    if (pass) {
+      entry.passed++;
+    }
+    if (entry.checked == SAMPLE_ROWS && entry.passed > entry.checked * MAX_PASS_RATIO) {
+      entry.disabled = true;
+    }
+    if (!pass) {
+      return false;
+    }
+  }
+  return true;
+}
@@ -0,0 +1,153 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#pragma once
+
+#include <stdint.h>
+#include <memory>
+#include <vector>
+
+#include "sql/parser/value.h"
+
+class FieldMeta;
+
+/**
+ * @brief hash join根据build端的key生成的运行时过滤条件
+ * @ingroup PhysicalOperator
+ * @details build端的数据全部读取之后生成，下推到probe端的扫描算子上，
+ * 在记录转换成tuple、参与连接之前就丢弃key不可能匹配的行。
+ *
+ * 使用分块的bloom filter：每个key只访问一个32字节的块，在块的8个32位字中各设置一位，
+ * 检查一个key只访问一个cache line。只有一个整数key时，还记录key的最小值和最大值。
+ * bloom filter有误判，只能用来丢弃一定不匹配的行。
+ * key的hash值与 JoinHashTable::hash_keys 相同，build端可以直接使用hash表中保存的hash值。
+ */
+class RuntimeFilter
+{
+public:
+  RuntimeFilter() = default;
+  ~RuntimeFilter() = default;
+
+  /**
+   * @brief 清空之前的数据，开始收集build端的key
+   */
+  void reset();
+
+  /**
+   * @brief 添加build端一行的key
+   * @param hash JoinHashTable::hash_keys 计算的hash值
+   */
+  void add(const Value *keys, int key_num, uint64_t hash);
+
+  /**
+   * @brief build端的key都添加之后，生成bloom filter，之后可以用来过滤
+   */
+  void build();
+
+  bool ready() const { return ready_; }
+
+  /**
+   * @brief key是否可能在build端出现，没有生成时总是返回true
+   */
+  bool may_contain(const Value *keys, int key_num) const;
+
+  int64_t memory_size() const { return static_cast<int64_t>(blocks_.size() * sizeof(Block)); }
+
+  /**
+   * @brief build端超过这么多行时不再使用bloom filter，只使用最小值和最大值过滤
+   */
+  static constexpr int64_t MAX_BLOOM_KEYS = 4 * 1024 * 1024;
+
+  /**
+   * @brief bloom filter中每个key平均占用的位数，分块之后误判率大约1%
+   */
+  static constexpr int BITS_PER_KEY = 12;
+
+private:
+  struct alignas(32) Block
+  {
+    uint32_t words[8];
+  };
+
+  static Block block_mask(uint64_t hash);
+
+  /**
+   * @brief 使用hash值的高32位选择块，低32位决定块中的哪几位
+   */
+  size_t block_index(uint64_t hash) const
+  {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(hash >> 32)) * blocks_.size()) >> 32;
+  }
+
+private:
+  bool                  ready_      = false;
+  bool                  use_bloom_  = true;
+  bool                  use_range_  = true;  ///< 只有一个整数key时记录范围
+  int                   min_key_    = 0;
+  int                   max_key_    = 0;
+  int64_t               rows_       = 0;
+  std::vector<uint64_t> hashes_;  ///< build之前收集的hash值，生成bloom filter后释放
+  std::vector<Block>    blocks_;
+};
+
+/**
+ * @brief 扫描算子上的运行时过滤条件，直接读取记录中的key字段检查
+ * @ingroup PhysicalOperator
+ * @details 一个扫描可能是多个hash join的probe端，比如星型连接中的事实表，每个连接一个过滤条件。
+ * 开始扫描后先检查一部分行，如果大部分行都能通过，就不再检查这个过滤条件，避免额外的开销。
+ */
+class ScanRuntimeFilters
+{
+public:
+  /**
+   * @param key_fields 与build端的key一一对应的字段
+   */
+  void add(std::shared_ptr<RuntimeFilter> filter, std::vector<const FieldMeta *> key_fields);
+
+  bool empty() const { return entries_.empty(); }
+  int  size() const { return static_cast<int>(entries_.size()); }
+
+  /**
+   * @brief 每次打开扫描时重置统计，build端可能已经重新生成
+   */
+  void reset();
+
+  /**
+   * @brief 记录是否可能通过所有的过滤条件
+   */
+  bool check(const char *record_data);
+
+  /**
+   * @brief 检查了这么多行之后评估过滤效果
+   */
+  static constexpr int64_t SAMPLE_ROWS = 1024;
+
+  /**
+   * @brief 通过的比例超过这个值时停止检查
+   */
+  static constexpr double MAX_PASS_RATIO = 0.9;
+
+private:
+  struct Entry
+  {
+    std::shared_ptr<RuntimeFilter> filter;
+    std::vector<const FieldMeta *> key_fields;
+    int64_t                        checked  = 0;
+    int64_t                        passed   = 0;
+    bool                           disabled = false;
+  };
+
+  std::vector<Entry> entries_;
+  std::vector<Value> keys_;
+};
@@ -0,0 +1,53 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "sql/operator/logical_operator.h"
+
+/**
+ * @brief 排序算子，对应order by
+ * @ingroup LogicalOperator
+ * @details 按照排序表达式的顺序依次比较，ascending中对应的值表示是否升序。
+ * 输出的行与子算子相同。
+ */
+class SortLogicalOperator : public LogicalOperator
+{
+public:
+  SortLogicalOperator(std::vector<std::unique_ptr<Expression>> &&sort_expressions, std::vector<bool> ascending)
+      : sort_expressions_(std::move(sort_expressions)), ascending_(std::move(ascending))
+  {}
+  virtual ~SortLogicalOperator() = default;
+
+  LogicalOperatorType type() const override
+  {
+    return LogicalOperatorType::SORT;
+  }
+
+  std::vector<std::unique_ptr<Expression>> &sort_expressions()
+  {
+    return sort_expressions_;
+  }
+  const std::vector<bool> &ascending() const
+  {
+    return ascending_;
+  }
+
+private:
+  std::vector<std::unique_ptr<Expression>> sort_expressions_;
+  std::vector<bool>                        ascending_;
+};
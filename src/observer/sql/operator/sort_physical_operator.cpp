@@ -0,0 +1,572 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#include <string.h>
+#include <algorithm>
+#include <new>
+#include <numeric>
+#include <string_view>
+
+#include "sql/operator/sort_physical_operator.h"
+#include "common/global_context.h"
+#include "common/log/log.h"
+
+using namespace std;
+
+/**
+ * @brief 定长编码的类型，编码后的长度(不包括空值标记)
+ * @return 不是定长编码时返回-1
+ */
+static int fixed_encode_length(AttrType type)
+{
+  switch (type) {
+    case INTS:
+    case FLOATS: return 4;
+    case BOOLEANS: return 1;
+    default: return -1;
+  }
+}
+
+static void append_big_endian(uint32_t value, string &key)
+{
+  key.push_back(static_cast<char>(value >> 24));
+  key.push_back(static_cast<char>(value >> 16));
+  key.push_back(static_cast<char>(value >> 8));
+  key.push_back(static_cast<char>(value));
+}
+
+void SortPhysicalOperator::encode_key(const Value &value, AttrType type, bool ascending, string &key)
+{
+  const size_t start = key.size();
+  if (type != INTS && type != FLOATS && type != BOOLEANS && type != CHARS) {
+    type = value.attr_type();
+  }
+
+  if (value.attr_type() == UNDEFINED) {
+    key.push_back(0);
+    // 空值也保持定长，这样同一列的key长度都相同
+    const int length = fixed_encode_length(type);
+    if (length > 0) {
+      key.append(length, 0);
+    }
+  } else {
+    key.push_back(1);
+    switch (type) {
+      case INTS: {
+        append_big_endian(static_cast<uint32_t>(value.get_int()) ^ 0x80000000U, key);
+      } break;
+      case FLOATS: {
+        float f = value.get_float();
+        if (f == 0) {
+          f = 0;  // +0.0 与 -0.0 相等
+        }
+        uint32_t bits = 0;
+        memcpy(&bits, &f, sizeof(bits));
+        bits = (bits & 0x80000000U) ? ~bits : (bits ^ 0x80000000U);
+        append_big_endian(bits, key);
+      } break;
+      case BOOLEANS: {
+        key.push_back(value.get_boolean() ? 1 : 0);
+      } break;
+      default: {
+        // 与 common::compare_string 一致，第一个'\0'之后的内容不参与比较
+        if (value.attr_type() == CHARS) {
+          key.append(value.data());
+        } else {
+          key.append(value.to_string());
+        }
+        key.push_back(0);
+      } break;
+    }
+  }
+
+  if (!ascending) {
+    for (size_t i = start; i < key.size(); i++) {
+      key[i] = ~key[i];
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void SortPhysicalOperator::LoserTree::init(vector<Run> *runs)
+{
+  runs_ = runs;
+  const int run_num = static_cast<int>(runs_->size());
+  // -1 表示比所有run都小的哨兵，从后往前依次加入每个run之后，所有的哨兵都会被替换掉
+  tree_.assign(std::max(run_num, 1), -1);
+  for (int i = run_num - 1; i >= 0; i--) {
+    adjust(i);
+  }
+}
+
+void SortPhysicalOperator::LoserTree::adjust(int run)
+{
+  const int run_num = static_cast<int>(runs_->size());
+  int       winner  = run;
+  for (int node = (run + run_num) / 2; node > 0; node /= 2) {
+    if (winner >= 0 && (tree_[node] < 0 || less(tree_[node], winner))) {
+      std::swap(tree_[node], winner);
+    }
+  }
+  tree_[0] = winner;
+}
+
+bool SortPhysicalOperator::LoserTree::less(int left, int right) const
+{
+  const Run &left_run  = (*runs_)[left];
+  const Run &right_run = (*runs_)[right];
+  if (left_run.eof || right_run.eof) {
+    return !left_run.eof && right_run.eof;
+  }
+
+  // key相同时先输出前面的run，run是按照输入的顺序生成的，这样排序是稳定的
+  const int result = left_run.key.compare(right_run.key);
+  return result < 0 || (result == 0 && left < right);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+SortPhysicalOperator::SortPhysicalOperator(vector<unique_ptr<Expression>> &&sort_exprs, vector<bool> ascending)
+    : sort_exprs_(std::move(sort_exprs)), ascending_(std::move(ascending))
+{
+  ASSERT(sort_exprs_.size() == ascending_.size(), "sort expressions and orders should have the same size");
+
+  fixed_key_len_ = 0;
+  for (const unique_ptr<Expression> &expr : sort_exprs_) {
+    const AttrType type   = expr->value_type();
+    const int      length = fixed_encode_length(type);
+    key_types_.push_back(type);
+    if (length < 0 || fixed_key_len_ < 0) {
+      fixed_key_len_ = -1;
+    } else {
+      fixed_key_len_ += 1 + length;
+    }
+  }
+}
+
+SortPhysicalOperator::~SortPhysicalOperator()
+{
+  destroy_rows();
+}
+
+string SortPhysicalOperator::sort_keys_to_string(
+    const vector<unique_ptr<Expression>> &sort_exprs, const vector<bool> &ascending)
+{
+  string result;
+  for (size_t i = 0; i < sort_exprs.size(); i++) {
+    const Expression &expr = *sort_exprs[i];
+    if (!result.empty()) {
+      result += ", ";
+    }
+    if (expr.type() == ExprType::FIELD) {
+      const auto &field_expr = static_cast<const FieldExpr &>(expr);
+      result += string(field_expr.table_name()) + "." + field_expr.field_name();
+    } else {
+      result += expr.name();
+    }
+    if (!ascending[i]) {
+      result += " desc";
+    }
+  }
+  return result;
+}
+
+string SortPhysicalOperator::param() const
+{
+  return sort_keys_to_string(sort_exprs_, ascending_);
+}
+
+RC SortPhysicalOperator::open(Trx *trx)
+{
+  if (children_.size() != 1) {
+    LOG_WARN("sort operator should have 1 child");
+    return RC::INTERNAL;
+  }
+
+  memory_.reset(common::MemoryTracker::current());
+  clear_rows();
+  arena_.set_source(common::QueryArena::current());
+  run_files_.clear();
+  runs_.clear();
+  merging_      = false;
+  first_merge_  = true;
+  spilled_runs_ = 0;
+  cell_num_     = -1;
+
+  PhysicalOperator *child = children_[0].get();
+  RC rc = child->open(trx);
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to open child operator. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  while (OB_SUCC(rc = child->next())) {
+    rc = append_row(*child->current_tuple());
+    if (OB_FAIL(rc)) {
+      return rc;
+    }
+
+    // 查询使用的内存超过限制时也写到临时文件中
+    const bool within_query_limit = memory_.update(memory_size_);
+    if ((memory_size_ > memory_limit_ || !within_query_limit) && GCTX.temp_file_manager_ != nullptr) {
+      rc = spill_rows();
+      if (OB_FAIL(rc)) {
+        return rc;
+      }
+    }
+  }
+
+  if (rc != RC::RECORD_EOF) {
+    LOG_WARN("failed to read child operator. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  if (run_files_.empty()) {
+    sort_rows();
+    pos_ = -1;
+    return RC::SUCCESS;
+  }
+
+  if (!rows_.empty()) {
+    rc = spill_rows();
+    if (OB_FAIL(rc)) {
+      return rc;
+    }
+  }
+  LOG_INFO("sort spilled %d runs", spilled_runs_);
+  return prepare_merge();
+}
+
+RC SortPhysicalOperator::next()
+{
+  if (!merging_) {
+    if (++pos_ >= static_cast<int>(sorted_rows_.size())) {
+      return RC::RECORD_EOF;
+    }
+    const int row = sorted_rows_[pos_];
+    tuple_.set_cells(rows_[row].cells, cell_num_);
+    return RC::SUCCESS;
+  }
+
+  if (!first_merge_) {
+    const int winner = loser_tree_.winner();
+    RC rc = read_run(runs_[winner]);
+    if (OB_FAIL(rc)) {
+      return rc;
+    }
+    loser_tree_.adjust(winner);
+  }
+  first_merge_ = false;
+
+  const Run &run = runs_[loser_tree_.winner()];
+  if (run.eof) {
+    return RC::RECORD_EOF;
+  }
+  tuple_.set_cells(run.cells);
+  return RC::SUCCESS;
+}
+
+RC SortPhysicalOperator::close()
+{
+  clear_rows();
+  run_files_.clear();
+  runs_.clear();
+  merging_ = false;
+  if (!children_.empty()) {
+    children_[0]->close();
+  }
+  return RC::SUCCESS;
+}
+
+RC SortPhysicalOperator::append_row(const Tuple &tuple)
+{
+  RC rc = RC::SUCCESS;
+  if (cell_num_ < 0) {
+    cell_num_ = tuple.cell_num();
+    specs_.assign(cell_num_, TupleCellSpec(""));
+    for (int i = 0; i < cell_num_ && OB_SUCC(rc); i++) {
+      rc = tuple.spec_at(i, specs_[i]);
+    }
+    if (OB_FAIL(rc)) {
+      LOG_WARN("failed to get cell spec. rc=%s", strrc(rc));
+      return rc;
+    }
+    tuple_.set_specs(specs_);
+  }
+
+  Value value;
+  key_.clear();
+  for (size_t i = 0; i < sort_exprs_.size(); i++) {
+    rc = sort_exprs_[i]->get_value(tuple, value);
+    if (OB_FAIL(rc)) {
+      LOG_WARN("failed to get sort key. index=%d, rc=%s", static_cast<int>(i), strrc(rc));
+      return rc;
+    }
+    encode_key(value, key_types_[i], ascending_[i], key_);
+  }
+
+  // 一行的数据和key一起分配，key紧跟在数据之后
+  const size_t arena_used = arena_.used_size();
+  char        *data       = static_cast<char *>(arena_.alloc(sizeof(Value) * cell_num_ + key_.size()));
+  SortRow      row;
+  row.cells = reinterpret_cast<Value *>(data);
+  for (int i = 0; i < cell_num_; i++) {
+    new (&row.cells[i]) Value();
+  }
+  char *key = data + sizeof(Value) * cell_num_;
+  memcpy(key, key_.data(), key_.size());
+  row.key     = key;
+  row.key_len = static_cast<int>(key_.size());
+  rows_.push_back(row);
+
+  for (int i = 0; i < cell_num_ && OB_SUCC(rc); i++) {
+    rc = tuple.cell_at(i, value);
+    if (OB_FAIL(rc)) {
+      LOG_WARN("failed to get cell. index=%d, rc=%s", i, strrc(rc));
+    } else {
+      row.cells[i].set_value(value, arena_);
+    }
+  }
+  memory_size_ += static_cast<int64_t>(arena_.used_size() - arena_used + sizeof(SortRow) + sizeof(int));
+  return rc;
+}
+
+void SortPhysicalOperator::sort_rows()
+{
+  sorted_rows_.resize(rows_.size());
+  std::iota(sorted_rows_.begin(), sorted_rows_.end(), 0);
+
+  if (fixed_key_len_ > 0) {
+    radix_sort_rows();
+    return;
+  }
+
+  const vector<SortRow> &rows = rows_;
+  std::stable_sort(sorted_rows_.begin(), sorted_rows_.end(), [&rows](int left, int right) {
+    return string_view(rows[left].key, rows[left].key_len) < string_view(rows[right].key, rows[right].key_len);
+  });
+}
+
+/**
+ * LSD基数排序，从key的最后一个字节开始，每轮按照一个字节做计数排序。
+ * 每轮都是稳定的，所以最终按照整个key排序。所有行在某个字节上都相同时跳过这一轮，
+ * 比如空值标记和int的高位字节。
+ */
+void SortPhysicalOperator::radix_sort_rows()
+{
+  const int rows = static_cast<int>(sorted_rows_.size());
+
+  // 按行号访问每一行的key，避免每次比较都经过rows_
+  vector<const unsigned char *> keys(rows);
+  for (int row = 0; row < rows; row++) {
+    keys[row] = reinterpret_cast<const unsigned char *>(rows_[row].key);
+  }
+
+  vector<int> buffer(rows);
+  for (int byte = fixed_key_len_ - 1; byte >= 0; byte--) {
+    size_t counts[256 + 1] = {0};
+    for (int row = 0; row < rows; row++) {
+      counts[keys[row][byte] + 1]++;
+    }
+    if (std::find(std::begin(counts), std::end(counts), static_cast<size_t>(rows)) != std::end(counts)) {
+      continue;
+    }
+
+    for (int i = 1; i <= 256; i++) {
+      counts[i] += counts[i - 1];
+    }
+    for (int row : sorted_rows_) {
+      buffer[counts[keys[row][byte]]++] = row;
+    }
+    sorted_rows_.swap(buffer);
+  }
+}
+
+RC SortPhysicalOperator::spill_rows()
+{
+  sort_rows();
+
+  unique_ptr<TempFile> file;
+  RC rc = create_run_file(file);
+  if (OB_FAIL(rc)) {
+    return rc;
+  }
+
+  for (int row : sorted_rows_) {
+    const SortRow &sort_row = rows_[row];
+    rc = write_row(*file, sort_row.key, sort_row.key_len, sort_row.cells);
+    if (OB_FAIL(rc)) {
+      return rc;
+    }
+  }
+
+  LOG_TRACE("spill a sorted run. rows=%d, memory size=%ld, file size=%ld",
+            static_cast<int>(sorted_rows_.size()), memory_size_, file->size());
+  run_files_.push_back(std::move(file));
+  spilled_runs_++;
+  clear_rows();
+  return rc;
+}
+
+void SortPhysicalOperator::clear_rows()
+{
+  destroy_rows();
+  sorted_rows_.clear();
+  memory_size_ = 0;
+  memory_.update(0);
+  pos_         = -1;
+}
+
+void SortPhysicalOperator::destroy_rows()
+{
+  // 行在arena中构造，释放内存之前需要先析构
+  for (SortRow &row : rows_) {
+    for (int i = 0; i < cell_num_; i++) {
+      row.cells[i].~Value();
+    }
+  }
+  vector<SortRow>().swap(rows_);
+  arena_.reset();
+}
+
+RC SortPhysicalOperator::create_run_file(unique_ptr<TempFile> &file)
+{
+  TempFileManager *temp_file_manager = GCTX.temp_file_manager_;
+  if (temp_file_manager == nullptr) {
+    LOG_WARN("temp file manager is not initialized");
+    return RC::INTERNAL;
+  }
+
+  RC rc = temp_file_manager->create_file(file);
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to create temp file for sort. rc=%s", strrc(rc));
+  }
+  return rc;
+}
+
+/**
+ * 格式：key长度(4字节) key 每个cell
+ */
+RC SortPhysicalOperator::write_row(TempFile &file, const char *key, int key_len, const Value *cells)
+{
+  const int32_t len = key_len;
+  RC rc = file.write(reinterpret_cast<const char *>(&len), sizeof(len));
+  if (OB_SUCC(rc)) {
+    rc = file.write(key, key_len);
+  }
+  for (int i = 0; i < cell_num_ && OB_SUCC(rc); i++) {
+    rc = file.write_value(cells[i]);
+  }
+  return rc;
+}
+
+RC SortPhysicalOperator::read_run(Run &run)
+{
+  int32_t len = 0;
+  RC rc = run.file->read(reinterpret_cast<char *>(&len), sizeof(len));
+  if (rc == RC::RECORD_EOF) {
+    run.eof = true;
+    return RC::SUCCESS;
+  }
+  if (OB_FAIL(rc)) {
+    return rc;
+  }
+
+  run.key.resize(len);
+  rc = run.file->read(run.key.data(), len);
+  run.cells.resize(cell_num_);
+  for (int i = 0; i < cell_num_ && OB_SUCC(rc); i++) {
+    rc = run.file->read_value(run.cells[i]);
+  }
+  if (rc == RC::RECORD_EOF) {
+    LOG_WARN("sort run file is truncated. file=%s", run.file->path().c_str());
+    rc = RC::IOERR_READ;
+  }
+  return rc;
+}
+
+/**
+ * @brief 取出前run_num个run，并读取每个run的第一行
+ */
+RC SortPhysicalOperator::open_runs(int run_num, vector<Run> &runs)
+{
+  runs.clear();
+  runs.resize(run_num);
+  for (int i = 0; i < run_num; i++) {
+    Run &run = runs[i];
+    run.file = std::move(run_files_[i]);
+    RC rc = run.file->rewind();
+    if (OB_SUCC(rc)) {
+      rc = read_run(run);
+    }
+    if (OB_FAIL(rc)) {
+      return rc;
+    }
+  }
+  run_files_.erase(run_files_.begin(), run_files_.begin() + run_num);
+  return RC::SUCCESS;
+}
+
+RC SortPhysicalOperator::merge_runs(vector<Run> &runs, TempFile &output)
+{
+  LoserTree loser_tree;
+  loser_tree.init(&runs);
+  RC rc = RC::SUCCESS;
+  while (OB_SUCC(rc)) {
+    const int winner = loser_tree.winner();
+    Run &run = runs[winner];
+    if (run.eof) {
+      break;
+    }
+
+    rc = write_row(output, run.key.data(), static_cast<int>(run.key.size()), run.cells.data());
+    if (OB_SUCC(rc)) {
+      rc = read_run(run);
+    }
+    loser_tree.adjust(winner);
+  }
+  return rc;
+}
+
+RC SortPhysicalOperator::prepare_merge()
+{
+  RC rc = RC::SUCCESS;
+  // run太多时先归并前面的run，归并的结果放在最前面，run之间依然保持输入的顺序
+  while (static_cast<int>(run_files_.size()) > MAX_MERGE_WAYS) {
+    vector<Run> runs;
+    unique_ptr<TempFile> output;
+    rc = open_runs(MAX_MERGE_WAYS, runs);
+    if (OB_SUCC(rc)) {
+      rc = create_run_file(output);
+    }
+    if (OB_SUCC(rc)) {
+      rc = merge_runs(runs, *output);
+    }
+    if (OB_FAIL(rc)) {
+      LOG_WARN("failed to merge sorted runs. rc=%s", strrc(rc));
+      return rc;
+    }
+    run_files_.insert(run_files_.begin(), std::move(output));
+  }
+
+  rc = open_runs(static_cast<int>(run_files_.size()), runs_);
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to open sorted runs. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  loser_tree_.init(&runs_);
+  merging_     = true;
+  first_merge_ = true;
+  return rc;
+}
@@ -0,0 +1,198 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#pragma once
+
+#include <stdint.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/mm/arena.h"
+#include "common/mm/memory_tracker.h"
+#include "sql/operator/physical_operator.h"
+#include "sql/expr/expression.h"
+#include "sql/expr/tuple.h"
+#include "storage/common/temp_file.h"
+
+/**
+ * @brief 排序算子，外部归并排序
+ * @ingroup PhysicalOperator
+ * @details open时读取子算子的所有数据。每一行的排序key编码成可以直接用memcmp比较的字节串
+ * (见encode_key)，排序时只比较字节串，不再调用Value::compare。
+ * key是定长的(排序表达式都是int/float/bool)时使用基数排序，否则使用快速排序。
+ *
+ * 内存中每一行的数据(包括较长的字符串)和key在Arena中连续分配，Arena的块从当前查询的QueryArena中获取，
+ * 写到临时文件或者close时还回去。
+ * 内存中的数据超过内存限制后，排好序作为一个run写到临时文件中，最后使用败者树做多路归并。
+ * run的个数超过 MAX_MERGE_WAYS 时，先把前面的run归并成一个更大的run，直到可以一次归并完成。
+ */
+class SortPhysicalOperator : public PhysicalOperator
+{
+public:
+  /**
+   * @param sort_exprs 排序表达式，在子算子输出的行上计算
+   * @param ascending 每个排序表达式是否升序
+   */
+  SortPhysicalOperator(std::vector<std::unique_ptr<Expression>> &&sort_exprs, std::vector<bool> ascending);
+  virtual ~SortPhysicalOperator();
+
+  PhysicalOperatorType type() const override
+  {
+    return PhysicalOperatorType::SORT;
+  }
+
+  std::string param() const override;
+
+  /**
+   * @brief 设置内存中的数据可以使用的内存(字节)，超过后写到临时文件
+   */
+  void set_memory_limit(int64_t memory_limit)
+  {
+    memory_limit_ = memory_limit;
+  }
+
+  /**
+   * @brief 写到临时文件中的run的个数，测试使用
+   */
+  int spilled_runs() const
+  {
+    return spilled_runs_;
+  }
+
+  RC open(Trx *trx) override;
+  RC next() override;
+  RC close() override;
+  Tuple *current_tuple() override
+  {
+    return &tuple_;
+  }
+
+  int64_t peak_memory() const override { return memory_.peak(); }
+
+  RC tuple_schema(TupleSchema &schema) const override { return children_tuple_schema(schema); }
+
+  /**
+   * @brief 把一个值编码后追加到key的末尾
+   * @details 编码后的字节串按照memcmp比较的结果与值的大小顺序一致：
+   * 第一个字节区分空值(比所有值都小)，之后int翻转符号位后按大端存放，
+   * float负数翻转所有位、正数翻转符号位后按大端存放，字符串以'\0'结尾。
+   * 降序时把这个值编码出的所有字节取反。
+   * @param type 排序表达式的类型，值按照这个类型编码，保证同一列的编码方式相同
+   */
+  static void encode_key(const Value &value, AttrType type, bool ascending, std::string &key);
+
+  /**
+   * @brief 排序key的描述，用于explain，比如 t.id, t.score desc
+   */
+  static std::string sort_keys_to_string(
+      const std::vector<std::unique_ptr<Expression>> &sort_exprs, const std::vector<bool> &ascending);
+
+private:
+  /**
+   * @brief 内存中的一行，cells和key都在arena_中分配
+   */
+  struct SortRow
+  {
+    Value      *cells   = nullptr;
+    const char *key     = nullptr;
+    int         key_len = 0;
+  };
+
+  /**
+   * @brief 一个写到临时文件中的run，归并时顺序读取
+   */
+  struct Run
+  {
+    std::unique_ptr<TempFile> file;
+    std::string               key;    ///< 当前行的key
+    std::vector<Value>        cells;  ///< 当前行的数据
+    bool                      eof = false;
+  };
+
+  /**
+   * @brief 败者树，用于多路归并
+   * @details 叶子是每个run的当前行，内部节点保存比较中失败的run，根节点之上保存最终的胜者。
+   * 一个run前进之后，只需要沿着它到根的路径重新比较，每次输出的代价是log(k)次key比较。
+   */
+  class LoserTree
+  {
+  public:
+    void init(std::vector<Run> *runs);
+
+    /**
+     * @brief 当前key最小的run，所有的run都结束时返回的run是eof状态
+     */
+    int winner() const
+    {
+      return tree_[0];
+    }
+
+    /**
+     * @brief 指定的run前进一行之后调整败者树
+     */
+    void adjust(int run);
+
+  private:
+    bool less(int left, int right) const;
+
+  private:
+    std::vector<Run> *runs_ = nullptr;
+    std::vector<int>  tree_;
+  };
+
+private:
+  RC   append_row(const Tuple &tuple);
+  void sort_rows();
+  void radix_sort_rows();
+  RC   spill_rows();
+  void clear_rows();
+  void destroy_rows();
+
+  RC create_run_file(std::unique_ptr<TempFile> &file);
+  RC write_row(TempFile &file, const char *key, int key_len, const Value *cells);
+  RC read_run(Run &run);
+  RC open_runs(int run_num, std::vector<Run> &runs);
+  RC merge_runs(std::vector<Run> &runs, TempFile &output);
+  RC prepare_merge();
+
+private:
+  static constexpr int MAX_MERGE_WAYS = 64;
+
+  std::vector<std::unique_ptr<Expression>> sort_exprs_;
+  std::vector<bool>                        ascending_;
+  std::vector<AttrType>                    key_types_;
+  int                                      fixed_key_len_ = -1;  ///< key的长度都相同时是这个长度，否则是-1
+  int64_t                                  memory_limit_  = INT64_MAX;
+
+  int                        cell_num_ = 0;
+  std::vector<TupleCellSpec> specs_;
+
+  std::vector<SortRow>      rows_;         ///< 内存中的数据，按照输入的顺序
+  common::Arena             arena_;        ///< rows_中每一行的数据和key
+  std::vector<int>          sorted_rows_;  ///< 排序之后的行号
+  int64_t                   memory_size_ = 0;
+  common::MemoryReservation memory_;           ///< 记录到查询的MemoryTracker中
+  int                       pos_         = -1;  ///< 内存中当前输出的行在sorted_rows_中的位置
+
+  std::vector<std::unique_ptr<TempFile>> run_files_;  ///< 已经写完还没有归并的run
+  std::vector<Run>                       runs_;       ///< 最后一次归并的run
+  LoserTree                              loser_tree_;
+  bool                                   merging_      = false;
+  bool                                   first_merge_  = true;
+  int                                    spilled_runs_ = 0;
+
+  std::string    key_;  ///< 生成key时使用的缓冲
+  ValueListTuple tuple_;
+};
@@ -0,0 +1,121 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#include "sql/operator/stream_aggregate_physical_operator.h"
+#include "common/log/log.h"
+
+using namespace std;
+
+RC StreamAggregatePhysicalOperator::open(Trx *trx)
+{
+  if (children_.size() != 1) {
+    LOG_WARN("stream aggregate operator should have 1 child");
+    return RC::INTERNAL;
+  }
+
+  RC rc = children_[0]->open(trx);
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to open child operator. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  reset_aggregators();
+  group_keys_.clear();
+  has_group_ = false;
+  finished_  = false;
+  return RC::SUCCESS;
+}
+
+void StreamAggregatePhysicalOperator::reset_aggregators()
+{
+  aggregators_.clear();
+  aggregator_ptrs_.clear();
+  for (const AggregateExpr *aggregate_expr : aggregates()) {
+    aggregators_.emplace_back(aggregate_expr->create_aggregator());
+    aggregator_ptrs_.push_back(aggregators_.back().get());
+  }
+}
+
+bool StreamAggregatePhysicalOperator::same_group(const vector<Value> &keys) const
+{
+  for (size_t i = 0; i < keys.size(); i++) {
+    if (keys[i].compare(group_keys_[i]) != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+RC StreamAggregatePhysicalOperator::next()
+{
+  if (finished_) {
+    return RC::RECORD_EOF;
+  }
+
+  RC rc = RC::SUCCESS;
+  PhysicalOperator *child = children_[0].get();
+  while (OB_SUCC(rc = child->next())) {
+    Tuple *tuple = child->current_tuple();
+    rc = get_group_keys(*tuple, keys_);
+    if (OB_FAIL(rc)) {
+      return rc;
+    }
+
+    if (!has_group_) {
+      group_keys_ = keys_;
+      has_group_  = true;
+    } else if (!same_group(keys_)) {
+      // 新分组的第一行，先输出当前分组，再用这一行开始新的分组
+      rc = set_output(group_keys_.data(), aggregator_ptrs_.data());
+      if (OB_FAIL(rc)) {
+        return rc;
+      }
+
+      reset_aggregators();
+      group_keys_.swap(keys_);
+      // 读取下一行之后，key可能引用的记录就失效了
+      for (Value &key : group_keys_) {
+        key.make_owned();
+      }
+      return accumulate(*tuple, aggregator_ptrs_.data());
+    }
+
+    rc = accumulate(*tuple, aggregator_ptrs_.data());
+    if (OB_FAIL(rc)) {
+      return rc;
+    }
+  }
+
+  if (rc != RC::RECORD_EOF) {
+    LOG_WARN("failed to get next tuple from child. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  // 输出最后一个分组。没有分组时，即使没有数据也要输出一行
+  finished_ = true;
+  if (!has_group_ && key_num() > 0) {
+    return RC::RECORD_EOF;
+  }
+  return set_output(group_keys_.data(), aggregator_ptrs_.data());
+}
+
+RC StreamAggregatePhysicalOperator::close()
+{
+  aggregators_.clear();
+  aggregator_ptrs_.clear();
+  if (!children_.empty()) {
+    children_[0]->close();
+  }
+  return RC::SUCCESS;
+}
@@ -0,0 +1,55 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#pragma once
+
+#include "sql/operator/aggregate_physical_operator.h"
+
+/**
+ * @brief 流式聚合算子
+ * @ingroup PhysicalOperator
+ * @details 要求子算子的输出已经按照分组key排好序，key相同的行是连续的。
+ * 只保存当前分组的聚合器，遇到下一个分组的第一行时输出当前分组，不需要hash表。
+ * 没有分组时也使用这个算子。
+ */
+class StreamAggregatePhysicalOperator : public AggregatePhysicalOperator
+{
+public:
+  StreamAggregatePhysicalOperator(std::vector<std::unique_ptr<Expression>> &&group_by_exprs,
+      std::vector<std::unique_ptr<Expression>> &&aggregate_exprs, AggregateMode mode = AggregateMode::COMPLETE)
+      : AggregatePhysicalOperator(std::move(group_by_exprs), std::move(aggregate_exprs), mode)
+  {}
+  virtual ~StreamAggregatePhysicalOperator() = default;
+
+  PhysicalOperatorType type() const override
+  {
+    return PhysicalOperatorType::STREAM_AGGREGATE;
+  }
+
+  RC open(Trx *trx) override;
+  RC next() override;
+  RC close() override;
+
+private:
+  void reset_aggregators();
+  bool same_group(const std::vector<Value> &keys) const;
+
+private:
+  std::vector<std::unique_ptr<Aggregator>> aggregators_;  ///< 当前分组的聚合器
+  std::vector<Aggregator *>                aggregator_ptrs_;
+  std::vector<Value>                       group_keys_;  ///< 当前分组的key
+  std::vector<Value>                       keys_;
+  bool                                     has_group_ = false;
+  bool                                     finished_  = false;
+};
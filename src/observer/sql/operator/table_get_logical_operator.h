@@ -33,8 +33,15 @@ public:
   }
 
   Table *table() const  { return table_; }
+  void collect_tables(std::set<const Table *> &tables) const override { tables.insert(table_); }
   bool readonly() const { return readonly_; }
 
+  /**
+   * @brief 表扫描需要输出的字段
+   */
+  const std::vector<Field> &fields() const { return fields_; }
+  void set_fields(std::vector<Field> &&fields) { fields_ = std::move(fields); }
+
   void set_predicates(std::vector<std::unique_ptr<Expression>> &&exprs);
   std::vector<std::unique_ptr<Expression>> &predicates()
   {
@@ -18,11 +18,24 @@ See the Mulan PSL v2 for more details. */
 
 using namespace std;
 
+TableScanPhysicalOperator::TableScanPhysicalOperator(Table *table, bool readonly)
+    : table_(table), readonly_(readonly)
+{
+  for (const FieldMeta &field_meta : *table_->table_meta().field_metas()) {
+    output_fields_.emplace_back(table_, &field_meta);
+  }
+}
+
 RC TableScanPhysicalOperator::open(Trx *trx)
 {
+  record_scanner_.set_partition(partition_index_, partition_count_);
+  runtime_filters_.reset();
   RC rc = table_->get_record_scanner(record_scanner_, trx, readonly_);
   if (rc == RC::SUCCESS) {
-    tuple_.set_schema(table_, table_->table_meta().field_metas());
+    if (table_tuple_.cell_num() == 0) {
+      table_tuple_.set_schema(table_, table_->table_meta().field_metas());
+      tuple_.set_schema(table_, output_fields_);
+    }
   }
   trx_ = trx;
   return rc;
@@ -42,17 +55,17 @@ RC TableScanPhysicalOperator::next()
       return rc;
     }
 
-    tuple_.set_record(&current_record_);
-    rc = filter(tuple_, filter_result);
+    table_tuple_.set_record(&current_record_);
+    rc = filter(table_tuple_, filter_result);
     if (rc != RC::SUCCESS) {
       return rc;
     }
 
     if (filter_result) {
-      sql_debug("get a tuple: %s", tuple_.to_string().c_str());
+      sql_debug("get a tuple: %s", table_tuple_.to_string().c_str());
       break;
     } else {
-      sql_debug("a tuple is filtered: %s", tuple_.to_string().c_str());
+      sql_debug("a tuple is filtered: %s", table_tuple_.to_string().c_str());
       rc = RC::RECORD_EOF;
     }
   }
@@ -72,20 +85,35 @@ Tuple *TableScanPhysicalOperator::current_tuple()
 
 string TableScanPhysicalOperator::param() const
 {
-  return table_->name();
+  string result = table_->name();
+  if (partition_count_ > 1) {
+    result += ", partition=" + to_string(partition_index_) + "/" + to_string(partition_count_);
+  }
+  if (!runtime_filters_.empty()) {
+    result += ", runtime_filters=" + to_string(runtime_filters_.size());
+  }
+  return result;
 }
 
 void TableScanPhysicalOperator::set_predicates(vector<unique_ptr<Expression>> &&exprs)
 {
   predicates_ = std::move(exprs);
+  programs_.clear();
+  for (unique_ptr<Expression> &expr : predicates_) {
+    programs_.push_back(ExprProgram::try_compile(*expr, ExprProgram::FieldSource::RECORD));
+  }
 }
 
 RC TableScanPhysicalOperator::filter(RowTuple &tuple, bool &result)
 {
   RC rc = RC::SUCCESS;
   Value value;
-  for (unique_ptr<Expression> &expr : predicates_) {
-    rc = expr->get_value(tuple, value);
+  for (size_t i = 0; i < predicates_.size(); i++) {
+    if (programs_[i]) {
+      rc = programs_[i]->eval(current_record_.data(), value);
+    } else {
+      rc = predicates_[i]->get_value(tuple, value);
+    }
     if (rc != RC::SUCCESS) {
       return rc;
     }
@@ -97,6 +125,6 @@ RC TableScanPhysicalOperator::filter(RowTuple &tuple, bool &result)
     }
   }
 
-  result = true;
+  result = runtime_filters_.empty() || runtime_filters_.check(current_record_.data());
   return rc;
 }
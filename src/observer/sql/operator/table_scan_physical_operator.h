@@ -15,6 +15,8 @@ See the Mulan PSL v2 for more details. */
 #pragma once
 
 #include "sql/operator/physical_operator.h"
+#include "sql/expr/expr_program.h"
+#include "sql/operator/runtime_filter.h"
 #include "storage/record/record_manager.h"
 #include "common/rc.h"
 
@@ -23,13 +25,13 @@ class Table;
 /**
  * @brief 表扫描物理算子
  * @ingroup PhysicalOperator
+ * @details 过滤条件直接在记录上计算，通过过滤的行只输出 output_fields 中的字段。
+ * 默认输出表中所有的字段。能够编译的过滤条件编译成 ExprProgram，直接读取记录中的字段计算。
  */
 class TableScanPhysicalOperator : public PhysicalOperator
 {
 public:
-  TableScanPhysicalOperator(Table *table, bool readonly) 
-      : table_(table), readonly_(readonly)
-  {}
+  TableScanPhysicalOperator(Table *table, bool readonly);
 
   virtual ~TableScanPhysicalOperator() = default;
 
@@ -46,8 +48,42 @@ public:
 
   Tuple *current_tuple() override;
 
+  RC tuple_schema(TupleSchema &schema) const override
+  {
+    RowTuple::table_schema(table_, output_fields_, schema);
+    return RC::SUCCESS;
+  }
+
+  /**
+   * @brief 谓词中的字段需要绑定到表中所有字段组成的tuple上，见 RowTuple::table_schema
+   */
   void set_predicates(std::vector<std::unique_ptr<Expression>> &&exprs);
 
+  /**
+   * @brief 设置需要输出的字段，需要在open之前调用
+   */
+  void set_output_fields(const std::vector<Field> &fields) { output_fields_ = fields; }
+
+  /**
+   * @brief 添加hash join下推的运行时过滤条件，见 RuntimeFilter
+   * @param key_fields 本表中与build端的key一一对应的字段
+   */
+  void add_runtime_filter(std::shared_ptr<RuntimeFilter> filter, std::vector<const FieldMeta *> key_fields)
+  {
+    runtime_filters_.add(std::move(filter), std::move(key_fields));
+  }
+
+  Table *table() const { return table_; }
+
+  /**
+   * @brief 并行扫描时只扫描表的一部分，见 RecordFileScanner::set_partition
+   */
+  void set_partition(int index, int count)
+  {
+    partition_index_ = index;
+    partition_count_ = count;
+  }
+
 private:
   RC filter(RowTuple &tuple, bool &result);
 
@@ -57,6 +93,12 @@ private:
   bool                                     readonly_ = false;
   RecordFileScanner                        record_scanner_;
   Record                                   current_record_;
-  RowTuple                                 tuple_;
+  std::vector<Field>                       output_fields_;
+  RowTuple                                 table_tuple_;  ///< 包含所有字段，用来计算过滤条件
+  RowTuple                                 tuple_;        ///< 输出的字段
   std::vector<std::unique_ptr<Expression>> predicates_; // TODO chang predicate to table tuple filter
+  std::vector<std::unique_ptr<ExprProgram>> programs_;  ///< 与predicates_一一对应，不能编译的为空
+  ScanRuntimeFilters                       runtime_filters_;
+  int                                      partition_index_ = 0;
+  int                                      partition_count_ = 1;
 };
@@ -0,0 +1,129 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#include <algorithm>
+
+#include "sql/operator/table_scan_vec_physical_operator.h"
+#include "storage/table/table.h"
+#include "event/sql_debug.h"
+
+using namespace std;
+
+TableScanVecPhysicalOperator::TableScanVecPhysicalOperator(Table *table, bool readonly)
+    : table_(table), readonly_(readonly)
+{
+  const TableMeta &table_meta = table_->table_meta();
+  for (int i = table_meta.sys_field_num(); i < table_meta.field_num(); i++) {
+    output_fields_.emplace_back(table_, table_meta.field(i));
+  }
+}
+
+RC TableScanVecPhysicalOperator::open(Trx *trx)
+{
+  output_rows_ = 0;
+  return table_->get_record_scanner(record_scanner_, trx, readonly_);
+}
+
+RC TableScanVecPhysicalOperator::next(Chunk &chunk)
+{
+  if (limit_ >= 0 && output_rows_ >= limit_) {
+    return RC::RECORD_EOF;
+  }
+
+  RC rc = RC::SUCCESS;
+  while (OB_SUCC(rc = fill_chunk(chunk))) {
+    rc = filter(chunk);
+    if (OB_FAIL(rc)) {
+      return rc;
+    }
+
+    if (chunk.active_rows() > 0) {
+      output_rows_ += chunk.active_rows();
+      sql_debug("table scan vec: got %d rows from %s", chunk.active_rows(), table_->name());
+      break;
+    }
+  }
+  return rc;
+}
+
+RC TableScanVecPhysicalOperator::fill_chunk(Chunk &chunk)
+{
+  if (chunk.column_num() != static_cast<int>(output_fields_.size())) {
+    chunk.reset();
+    for (size_t i = 0; i < output_fields_.size(); i++) {
+      chunk.add_column(make_unique<Column>(*output_fields_[i].meta(), Chunk::MAX_ROWS), static_cast<int>(i));
+    }
+  } else {
+    chunk.reset_data();
+  }
+
+  int max_rows = Chunk::MAX_ROWS;
+  if (limit_ >= 0 && predicates_.empty()) {
+    max_rows = static_cast<int>(std::min<int64_t>(max_rows, limit_ - output_rows_));
+  }
+
+  RC rc = RC::SUCCESS;
+  int rows = 0;
+  const int column_num = chunk.column_num();
+  while (rows < max_rows && record_scanner_.has_next()) {
+    rc = record_scanner_.next(current_record_);
+    if (OB_FAIL(rc)) {
+      return rc;
+    }
+
+    const char *data = current_record_.data();
+    for (int i = 0; i < column_num; i++) {
+      const FieldMeta *field_meta = output_fields_[i].meta();
+      rc = chunk.column(i).append_one(data + field_meta->offset());
+      if (OB_FAIL(rc)) {
+        return rc;
+      }
+    }
+    rows++;
+  }
+
+  return rows == 0 ? RC::RECORD_EOF : RC::SUCCESS;
+}
+
+RC TableScanVecPhysicalOperator::filter(Chunk &chunk)
+{
+  RC rc = RC::SUCCESS;
+  for (unique_ptr<Expression> &expr : predicates_) {
+    rc = expr->eval(chunk, select_);
+    if (OB_FAIL(rc)) {
+      LOG_WARN("failed to eval predicate. rc=%s", strrc(rc));
+      return rc;
+    }
+    chunk.select(select_);
+  }
+  return rc;
+}
+
+RC TableScanVecPhysicalOperator::close()
+{
+  return record_scanner_.close_scan();
+}
+
+string TableScanVecPhysicalOperator::param() const
+{
+  if (limit_ >= 0) {
+    return string(table_->name()) + ", limit=" + to_string(limit_);
+  }
+  return table_->name();
+}
+
+void TableScanVecPhysicalOperator::set_predicates(vector<unique_ptr<Expression>> &&exprs)
+{
+  predicates_ = std::move(exprs);
+}
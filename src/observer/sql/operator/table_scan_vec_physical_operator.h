@@ -0,0 +1,86 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#pragma once
+
+#include "sql/operator/physical_operator.h"
+#include "storage/record/record_manager.h"
+#include "storage/common/chunk.h"
+#include "common/rc.h"
+
+class Table;
+
+/**
+ * @brief 向量化的表扫描物理算子
+ * @ingroup PhysicalOperator
+ * @details 每次从表中读取一批记录，按列拷贝到chunk中，然后使用下推的谓词计算选择向量。
+ * 默认输出表中所有的用户字段，列ID是字段在 output_fields 中的下标。
+ */
+class TableScanVecPhysicalOperator : public PhysicalOperator
+{
+public:
+  TableScanVecPhysicalOperator(Table *table, bool readonly);
+
+  virtual ~TableScanVecPhysicalOperator() = default;
+
+  std::string param() const override;
+
+  PhysicalOperatorType type() const override
+  {
+    return PhysicalOperatorType::TABLE_SCAN_VEC;
+  }
+
+  RC open(Trx *trx) override;
+  RC next() override { return RC::UNIMPLENMENT; }
+  RC next(Chunk &chunk) override;
+  RC close() override;
+
+  Tuple *current_tuple() override { return nullptr; }
+
+  /**
+   * @brief 谓词中的字段需要已经绑定到 output_fields 对应的列
+   */
+  void set_predicates(std::vector<std::unique_ptr<Expression>> &&exprs);
+
+  /**
+   * @brief 最多输出多少行，由上层的limit下推。输出足够的行之后不再读取记录，
+   * 没有谓词时每批也只读取需要的行数
+   */
+  void set_limit(int64_t limit) { limit_ = limit; }
+
+  /**
+   * @brief 输出的字段，与chunk中的列一一对应
+   */
+  const std::vector<Field> &output_fields() const { return output_fields_; }
+
+  /**
+   * @brief 只读取部分字段，需要包含谓词中的字段
+   */
+  void set_output_fields(std::vector<Field> &&fields) { output_fields_ = std::move(fields); }
+
+private:
+  RC fill_chunk(Chunk &chunk);
+  RC filter(Chunk &chunk);
+
+private:
+  Table *                                  table_    = nullptr;
+  bool                                     readonly_ = false;
+  RecordFileScanner                        record_scanner_;
+  Record                                   current_record_;
+  std::vector<Field>                       output_fields_;
+  std::vector<std::unique_ptr<Expression>> predicates_;
+  std::vector<uint8_t>                     select_;
+  int64_t                                  limit_       = -1;
+  int64_t                                  output_rows_ = 0;  ///< 已经输出的行数
+};
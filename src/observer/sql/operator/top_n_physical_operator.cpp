@@ -0,0 +1,148 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#include <algorithm>
+
+#include "sql/operator/top_n_physical_operator.h"
+#include "sql/operator/sort_physical_operator.h"
+#include "common/log/log.h"
+
+using namespace std;
+
+TopNPhysicalOperator::TopNPhysicalOperator(
+    vector<unique_ptr<Expression>> &&sort_exprs, vector<bool> ascending, int64_t limit)
+    : sort_exprs_(std::move(sort_exprs)), ascending_(std::move(ascending)), limit_(limit)
+{
+  ASSERT(sort_exprs_.size() == ascending_.size(), "sort expressions and orders should have the same size");
+  for (const unique_ptr<Expression> &expr : sort_exprs_) {
+    key_types_.push_back(expr->value_type());
+  }
+}
+
+string TopNPhysicalOperator::param() const
+{
+  return SortPhysicalOperator::sort_keys_to_string(sort_exprs_, ascending_) + ", limit=" + to_string(limit_);
+}
+
+bool TopNPhysicalOperator::row_less(const Row &left, const Row &right)
+{
+  const int result = left.key.compare(right.key);
+  return result < 0 || (result == 0 && left.seq < right.seq);
+}
+
+RC TopNPhysicalOperator::open(Trx *trx)
+{
+  if (children_.size() != 1) {
+    LOG_WARN("top-n operator should have 1 child");
+    return RC::INTERNAL;
+  }
+
+  heap_.clear();
+  seq_ = 0;
+  pos_ = -1;
+
+  PhysicalOperator *child = children_[0].get();
+  RC rc = child->open(trx);
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to open child operator. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  while (OB_SUCC(rc = child->next())) {
+    rc = add_row(*child->current_tuple());
+    if (OB_FAIL(rc)) {
+      return rc;
+    }
+  }
+
+  if (rc != RC::RECORD_EOF) {
+    LOG_WARN("failed to read child operator. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  sort_heap(heap_.begin(), heap_.end(), row_less);
+  return RC::SUCCESS;
+}
+
+RC TopNPhysicalOperator::add_row(const Tuple &tuple)
+{
+  RC rc = RC::SUCCESS;
+  if (seq_ == 0) {
+    vector<TupleCellSpec> specs(tuple.cell_num(), TupleCellSpec(""));
+    for (int i = 0; i < tuple.cell_num() && OB_SUCC(rc); i++) {
+      rc = tuple.spec_at(i, specs[i]);
+    }
+    if (OB_FAIL(rc)) {
+      LOG_WARN("failed to get cell spec. rc=%s", strrc(rc));
+      return rc;
+    }
+    tuple_.set_specs(specs);
+  }
+
+  const int64_t seq = seq_++;
+  if (limit_ <= 0) {
+    return rc;
+  }
+
+  key_.clear();
+  Value value;
+  for (size_t i = 0; i < sort_exprs_.size(); i++) {
+    rc = sort_exprs_[i]->get_value(tuple, value);
+    if (OB_FAIL(rc)) {
+      LOG_WARN("failed to get sort key. index=%d, rc=%s", static_cast<int>(i), strrc(rc));
+      return rc;
+    }
+    SortPhysicalOperator::encode_key(value, key_types_[i], ascending_[i], key_);
+  }
+
+  // 堆满时，key不小于堆顶的行不会出现在结果中。seq比堆中的都大，key相等时也不需要
+  if (static_cast<int64_t>(heap_.size()) >= limit_) {
+    if (key_.compare(heap_.front().key) >= 0) {
+      return rc;
+    }
+    pop_heap(heap_.begin(), heap_.end(), row_less);
+  } else {
+    heap_.emplace_back();
+  }
+
+  Row &row = heap_.back();
+  row.key.swap(key_);
+  row.seq = seq;
+  row.cells.resize(tuple.cell_num());
+  for (int i = 0; i < tuple.cell_num(); i++) {
+    rc = tuple.cell_at(i, row.cells[i]);
+    if (OB_FAIL(rc)) {
+      LOG_WARN("failed to get cell. index=%d, rc=%s", i, strrc(rc));
+      return rc;
+    }
+    row.cells[i].make_owned();
+  }
+  push_heap(heap_.begin(), heap_.end(), row_less);
+  return rc;
+}
+
+RC TopNPhysicalOperator::next()
+{
+  if (++pos_ >= static_cast<int>(heap_.size())) {
+    return RC::RECORD_EOF;
+  }
+  tuple_.set_cells(heap_[pos_].cells);
+  return RC::SUCCESS;
+}
+
+RC TopNPhysicalOperator::close()
+{
+  heap_.clear();
+  return children_[0]->close();
+}
@@ -0,0 +1,86 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#pragma once
+
+#include <stdint.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "sql/operator/physical_operator.h"
+#include "sql/expr/expression.h"
+#include "sql/expr/tuple.h"
+
+/**
+ * @brief Top-N算子，order by后面有limit时使用
+ * @ingroup PhysicalOperator
+ * @details 只保留排序后的前N行，N是limit与offset的和，跳过offset行由上层的limit算子完成。
+ * 使用一个大小为N的大顶堆，堆顶是已经保留的行中最大的一行，新的一行比堆顶小时替换堆顶。
+ * 先计算排序key与堆顶比较，被淘汰的行不需要复制数据。排序key的编码与SortPhysicalOperator相同。
+ * 内存中最多有N行数据，所以N比较大时应该使用排序算子。
+ */
+class TopNPhysicalOperator : public PhysicalOperator
+{
+public:
+  /**
+   * @param sort_exprs 排序表达式，在子算子输出的行上计算
+   * @param ascending 每个排序表达式是否升序
+   * @param limit 最多输出多少行
+   */
+  TopNPhysicalOperator(std::vector<std::unique_ptr<Expression>> &&sort_exprs, std::vector<bool> ascending,
+      int64_t limit);
+  virtual ~TopNPhysicalOperator() = default;
+
+  PhysicalOperatorType type() const override
+  {
+    return PhysicalOperatorType::TOP_N;
+  }
+
+  std::string param() const override;
+
+  RC open(Trx *trx) override;
+  RC next() override;
+  RC close() override;
+  Tuple *current_tuple() override
+  {
+    return &tuple_;
+  }
+
+  RC tuple_schema(TupleSchema &schema) const override { return children_tuple_schema(schema); }
+
+private:
+  struct Row
+  {
+    std::string        key;
+    int64_t            seq = 0;  ///< 输入的顺序，key相同时先输入的行在前面
+    std::vector<Value> cells;
+  };
+
+  static bool row_less(const Row &left, const Row &right);
+
+  RC add_row(const Tuple &tuple);
+
+private:
+  std::vector<std::unique_ptr<Expression>> sort_exprs_;
+  std::vector<bool>                        ascending_;
+  std::vector<AttrType>                    key_types_;
+  int64_t                                  limit_ = 0;
+
+  std::vector<Row> heap_;     ///< 没有读完时是大顶堆，读完之后按照从小到大排序
+  int64_t          seq_ = 0;
+  int              pos_ = -1;
+  std::string      key_;      ///< 当前行的key
+  ValueListTuple   tuple_;
+};
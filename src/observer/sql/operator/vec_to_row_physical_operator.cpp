@@ -0,0 +1,62 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#include "common/log/log.h"
+#include "sql/operator/vec_to_row_physical_operator.h"
+
+using namespace std;
+
+VecToRowPhysicalOperator::VecToRowPhysicalOperator(const vector<TupleCellSpec> &specs)
+{
+  tuple_.set_schema(specs);
+}
+
+RC VecToRowPhysicalOperator::open(Trx *trx)
+{
+  if (children_.size() != 1) {
+    LOG_WARN("vec to row operator must has one child");
+    return RC::INTERNAL;
+  }
+
+  chunk_.reset();
+  cursor_ = 0;
+  return children_[0]->open(trx);
+}
+
+RC VecToRowPhysicalOperator::next()
+{
+  RC rc = RC::SUCCESS;
+  while (cursor_ >= chunk_.active_rows()) {
+    rc = children_[0]->next(chunk_);
+    if (rc != RC::SUCCESS) {
+      return rc;
+    }
+    cursor_ = 0;
+  }
+
+  tuple_.set_row(&chunk_, chunk_.active_row(cursor_));
+  cursor_++;
+  return rc;
+}
+
+RC VecToRowPhysicalOperator::close()
+{
+  children_[0]->close();
+  return RC::SUCCESS;
+}
+
+Tuple *VecToRowPhysicalOperator::current_tuple()
+{
+  return &tuple_;
+}
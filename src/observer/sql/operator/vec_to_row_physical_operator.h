@@ -0,0 +1,59 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#pragma once
+
+#include "sql/operator/physical_operator.h"
+#include "storage/common/chunk.h"
+
+/**
+ * @brief 将向量化算子的输出转换为按行输出
+ * @ingroup PhysicalOperator
+ * @details 每次从子算子获取一个chunk，然后逐行输出选择向量中的行。
+ * 执行计划的根节点总是按行输出的，因此向量化执行计划的顶端总是这个算子。
+ */
+class VecToRowPhysicalOperator : public PhysicalOperator
+{
+public:
+  /**
+   * @param specs 子算子输出chunk中每一列的描述
+   */
+  VecToRowPhysicalOperator(const std::vector<TupleCellSpec> &specs);
+
+  virtual ~VecToRowPhysicalOperator() = default;
+
+  PhysicalOperatorType type() const override
+  {
+    return PhysicalOperatorType::VEC_TO_ROW;
+  }
+
+  RC open(Trx *trx) override;
+  RC next() override;
+  RC close() override;
+
+  Tuple *current_tuple() override;
+
+  RC tuple_schema(TupleSchema &schema) const override
+  {
+    for (const TupleCellSpec &spec : tuple_.specs()) {
+      schema.append_cell(spec);
+    }
+    return RC::SUCCESS;
+  }
+
+private:
+  Chunk      chunk_;
+  int        cursor_ = 0;  ///< 下一个要输出的行在选择向量中的位置
+  ChunkTuple tuple_;
+};
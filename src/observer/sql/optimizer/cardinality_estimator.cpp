@@ -0,0 +1,255 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#include <algorithm>
+
+#include "sql/optimizer/cardinality_estimator.h"
+#include "sql/expr/expression.h"
+#include "sql/operator/logical_operator.h"
+#include "sql/operator/table_get_logical_operator.h"
+#include "sql/operator/aggregate_logical_operator.h"
+#include "sql/operator/limit_logical_operator.h"
+#include "storage/buffer/page.h"
+#include "storage/table/table.h"
+#include "storage/table/table_stats.h"
+
+using namespace std;
+
+static thread_local TableStatsSnapshot *current_snapshot = nullptr;
+
+TableStatsSnapshot::TableStatsSnapshot() : previous_(current_snapshot)
+{
+  current_snapshot = this;
+}
+
+TableStatsSnapshot::~TableStatsSnapshot()
+{
+  current_snapshot = previous_;
+}
+
+TableStatsSnapshot *TableStatsSnapshot::current()
+{
+  return current_snapshot;
+}
+
+const shared_ptr<const TableStats> &TableStatsSnapshot::get(const Table *table)
+{
+  auto iter = stats_.find(table);
+  if (iter == stats_.end()) {
+    iter = stats_.emplace(table, table->table_stats()).first;
+  }
+  return iter->second;
+}
+
+shared_ptr<const TableStats> CardinalityEstimator::table_stats(const Table *table)
+{
+  TableStatsSnapshot *snapshot = TableStatsSnapshot::current();
+  return snapshot == nullptr ? table->table_stats() : snapshot->get(table);
+}
+
+double CardinalityEstimator::table_rows(const Table *table)
+{
+  shared_ptr<const TableStats> stats = table_stats(table);
+  const int32_t     pages = table->data_page_count();
+  if (stats != nullptr) {
+    // 收集统计信息之后表中的数据可能有变化，按照数据页面数的变化比例调整
+    if (stats->page_count() <= 0) {
+      return stats->row_count();
+    }
+    return static_cast<double>(stats->row_count()) * pages / stats->page_count();
+  }
+
+  // 第一个页面是文件头，其它页面按照装满记录估算
+  const int record_size = std::max(1, table->table_meta().record_size());
+  return static_cast<double>(std::max(0, pages - 1)) * (BP_PAGE_DATA_SIZE / record_size);
+}
+
+/**
+ * @brief 字段的统计信息
+ * @param stats 保存字段所在表的统计信息，使用返回的字段统计信息时需要一直持有
+ */
+static const ColumnStats *column_stats(const Field &field, shared_ptr<const TableStats> &stats)
+{
+  stats = CardinalityEstimator::table_stats(field.table());
+  return stats == nullptr ? nullptr : stats->column(field.field_name());
+}
+
+/**
+ * @brief 字段不同值的个数，没有统计信息时认为字段没有重复值
+ */
+static double field_ndv(const Field &field)
+{
+  shared_ptr<const TableStats> stats;
+  const ColumnStats *column = column_stats(field, stats);
+  if (column != nullptr) {
+    return std::max<double>(column->ndv(), 1);
+  }
+  return std::max(CardinalityEstimator::table_rows(field.table()), 1.0);
+}
+
+/**
+ * @brief 直方图中的值与常量可以比较，即类型相同或者都是数值类型
+ */
+static bool comparable(AttrType left, AttrType right)
+{
+  auto is_number = [](AttrType type) { return type == INTS || type == FLOATS; };
+  return left == right || (is_number(left) && is_number(right));
+}
+
+/**
+ * @brief 常量或参数的值，参数使用生成执行计划时绑定的值估算
+ */
+static const Value *constant_value(Expression *expr)
+{
+  switch (expr->type()) {
+    case ExprType::VALUE: return &static_cast<ValueExpr *>(expr)->get_value();
+    case ExprType::PARAM: return &static_cast<ParamExpr *>(expr)->get_value();
+    default: return nullptr;
+  }
+}
+
+static double comparison_selectivity(ComparisonExpr &expr)
+{
+  CompOp      comp  = expr.comp();
+  Expression *left  = expr.left().get();
+  Expression *right = expr.right().get();
+  if (constant_value(left) != nullptr && right->type() == ExprType::FIELD) {
+    std::swap(left, right);
+    comp = ComparisonExpr::swap_comp(comp);
+  }
+
+  if (left->type() == ExprType::FIELD && right->type() == ExprType::FIELD) {
+    const double equal_selectivity = 1.0 / std::max(field_ndv(static_cast<FieldExpr *>(left)->field()),
+                                                    field_ndv(static_cast<FieldExpr *>(right)->field()));
+    switch (comp) {
+      case EQUAL_TO: return equal_selectivity;
+      case NOT_EQUAL: return 1 - equal_selectivity;
+      default: return CardinalityEstimator::DEFAULT_RANGE_SELECTIVITY;
+    }
+  }
+
+  if (left->type() == ExprType::FIELD && constant_value(right) != nullptr) {
+    const Field       &field  = static_cast<FieldExpr *>(left)->field();
+    const Value       &value  = *constant_value(right);
+    shared_ptr<const TableStats> stats;
+    const ColumnStats *column = column_stats(field, stats);
+    if (column != nullptr && comparable(field.attr_type(), value.attr_type())) {
+      switch (comp) {
+        case EQUAL_TO: return column->equal_selectivity(value);
+        case NOT_EQUAL: return std::max(0.0, 1 - column->null_fraction() - column->equal_selectivity(value));
+        case LESS_THAN: return column->range_selectivity(nullptr, false, &value, false);
+        case LESS_EQUAL: return column->range_selectivity(nullptr, false, &value, true);
+        case GREAT_THAN: return column->range_selectivity(&value, false, nullptr, false);
+        case GREAT_EQUAL: return column->range_selectivity(&value, true, nullptr, false);
+        default: break;
+      }
+    }
+  }
+
+  if (left->type() == ExprType::VALUE && right->type() == ExprType::VALUE) {
+    Value result;
+    if (OB_SUCC(expr.try_get_value(result))) {
+      return result.get_boolean() ? 1 : 0;
+    }
+  }
+
+  switch (comp) {
+    case EQUAL_TO: return CardinalityEstimator::DEFAULT_EQUAL_SELECTIVITY;
+    case NOT_EQUAL: return 1 - CardinalityEstimator::DEFAULT_EQUAL_SELECTIVITY;
+    default: return CardinalityEstimator::DEFAULT_RANGE_SELECTIVITY;
+  }
+}
+
+double CardinalityEstimator::selectivity(Expression &expr)
+{
+  switch (expr.type()) {
+    case ExprType::COMPARISON: {
+      return comparison_selectivity(static_cast<ComparisonExpr &>(expr));
+    }
+
+    case ExprType::CONJUNCTION: {
+      auto  &conjunction_expr = static_cast<ConjunctionExpr &>(expr);
+      double result           = 1;
+      if (conjunction_expr.conjunction_type() == ConjunctionExpr::Type::AND) {
+        // 认为各个条件之间相互独立
+        for (unique_ptr<Expression> &child : conjunction_expr.children()) {
+          result *= selectivity(*child);
+        }
+        return result;
+      }
+
+      for (unique_ptr<Expression> &child : conjunction_expr.children()) {
+        result *= 1 - selectivity(*child);
+      }
+      return 1 - result;
+    }
+
+    case ExprType::VALUE: {
+      return static_cast<ValueExpr &>(expr).get_value().get_boolean() ? 1 : 0;
+    }
+
+    default: {
+      return DEFAULT_RANGE_SELECTIVITY;
+    }
+  }
+}
+
+double CardinalityEstimator::estimate_rows(LogicalOperator &oper)
+{
+  double rows = 1;
+  switch (oper.type()) {
+    case LogicalOperatorType::TABLE_GET: {
+      auto &table_get_oper = static_cast<TableGetLogicalOperator &>(oper);
+      rows                 = table_rows(table_get_oper.table());
+      for (unique_ptr<Expression> &predicate : table_get_oper.predicates()) {
+        rows *= selectivity(*predicate);
+      }
+    } break;
+
+    case LogicalOperatorType::PREDICATE:
+    case LogicalOperatorType::JOIN: {
+      // 连接的结果是笛卡尔积再按照连接条件过滤
+      for (unique_ptr<LogicalOperator> &child : oper.children()) {
+        rows *= estimate_rows(*child);
+      }
+      for (unique_ptr<Expression> &expr : oper.expressions()) {
+        rows *= selectivity(*expr);
+      }
+    } break;
+
+    case LogicalOperatorType::AGGREGATION: {
+      auto &aggregate_oper = static_cast<AggregateLogicalOperator &>(oper);
+      if (!aggregate_oper.group_by_expressions().empty() && !oper.children().empty()) {
+        rows = estimate_rows(*oper.children().front());
+      }
+    } break;
+
+    case LogicalOperatorType::LIMIT: {
+      auto &limit_oper = static_cast<LimitLogicalOperator &>(oper);
+      rows = oper.children().empty() ? 0 : estimate_rows(*oper.children().front());
+      if (limit_oper.limit() >= 0) {
+        rows = std::min(rows, static_cast<double>(limit_oper.limit()));
+      }
+    } break;
+
+    default: {
+      if (!oper.children().empty()) {
+        rows = estimate_rows(*oper.children().front());
+      }
+    } break;
+  }
+
+  // 至少按照一行估算，避免空表让不同的连接顺序代价都相同
+  return std::max(rows, 1.0);
+}
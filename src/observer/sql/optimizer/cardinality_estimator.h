@@ -0,0 +1,88 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+
+class Table;
+class TableStats;
+class Expression;
+class LogicalOperator;
+
+/**
+ * @brief 优化一个查询时使用的表统计信息
+ * @ingroup SQLStage
+ * @details 其它会话执行 ANALYZE TABLE 时会替换表的统计信息。优化开始时在栈上创建一个，
+ * 第一次用到某个表的统计信息时保存一份，之后整个优化过程都使用同一份，
+ * 既不会在使用中被释放，前后的估算也是一致的。
+ * 创建时设置为当前线程的快照，析构时恢复。
+ */
+class TableStatsSnapshot
+{
+public:
+  TableStatsSnapshot();
+  ~TableStatsSnapshot();
+
+  TableStatsSnapshot(const TableStatsSnapshot &) = delete;
+  TableStatsSnapshot &operator=(const TableStatsSnapshot &) = delete;
+
+  /**
+   * @brief 当前线程正在使用的快照，没有时返回空
+   */
+  static TableStatsSnapshot *current();
+
+  /**
+   * @brief 表的统计信息，第一次获取之后不再变化
+   */
+  const std::shared_ptr<const TableStats> &get(const Table *table);
+
+private:
+  TableStatsSnapshot *previous_ = nullptr;
+
+  std::unordered_map<const Table *, std::shared_ptr<const TableStats>> stats_;
+};
+
+/**
+ * @brief 估算逻辑算子输出的行数
+ * @ingroup SQLStage
+ * @details 表执行过 ANALYZE TABLE 时使用统计信息，否则按照数据页面数和记录长度估算表的行数，
+ * 过滤条件使用默认的选择率。等值连接按照外键连接估算，选择率是 1/max(NDV)，
+ * 没有统计信息时认为连接字段没有重复值。
+ */
+class CardinalityEstimator
+{
+public:
+  static constexpr double DEFAULT_EQUAL_SELECTIVITY = 0.005;
+  static constexpr double DEFAULT_RANGE_SELECTIVITY = 1.0 / 3;
+
+  /**
+   * @brief 估算表当前的行数
+   */
+  static double table_rows(const Table *table);
+
+  /**
+   * @brief 估算时使用的表统计信息
+   * @details 有当前快照时从快照中获取，否则直接从表中获取
+   */
+  static std::shared_ptr<const TableStats> table_stats(const Table *table);
+
+  /**
+   * @brief 估算一个过滤条件的选择率，即满足条件的数据占比
+   */
+  static double selectivity(Expression &expr);
+
+  static double estimate_rows(LogicalOperator &oper);
+};
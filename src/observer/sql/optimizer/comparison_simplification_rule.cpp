@@ -29,6 +29,30 @@ RC ComparisonSimplificationRule::rewrite(std::unique_ptr<Expression> &expr, bool
       expr.swap(new_expr);
       change_made = true;
       LOG_TRACE("comparison expression is simplified");
+      return rc;
+    }
+
+    std::unique_ptr<Expression> &left  = cmp_expr->left();
+    std::unique_ptr<Expression> &right = cmp_expr->right();
+    if (left->equal(*right)) {
+      // 两边是同一个表达式，结果只取决于比较运算本身。比如 a = a 恒为true，a < a 恒为false
+      const CompOp comp = cmp_expr->comp();
+      const bool   result = (comp == EQUAL_TO || comp == LESS_EQUAL || comp == GREAT_EQUAL);
+      expr.reset(new ValueExpr(Value(result)));
+      change_made = true;
+      LOG_TRACE("comparison of the same expression is simplified to %d", result);
+      return rc;
+    }
+
+    const bool left_constant  = left->type() == ExprType::VALUE || left->type() == ExprType::PARAM;
+    const bool right_constant = right->type() == ExprType::VALUE || right->type() == ExprType::PARAM;
+    if (left_constant && !right_constant) {
+      // 常量(包括预编译语句的参数)放在右边，比如 1 < a 改写成 a > 1，后续的规则只需要处理一种形式
+      std::unique_ptr<Expression> new_expr(
+          new ComparisonExpr(ComparisonExpr::swap_comp(cmp_expr->comp()), std::move(right), std::move(left)));
+      new_expr->set_name(expr->name());
+      expr = std::move(new_expr);
+      change_made = true;
     }
   }
   return rc;
@@ -24,6 +24,8 @@ class LogicalOperator;
  * @ingroup Rewriter
  * @details 如果有简单的比较运算，比如比较的两边都是常量，那我们就可以在运行执行计划之前就知道结果，
  * 进而直接将表达式改成结果，这样就可以减少运行时的计算量。
+ * 两边是相同表达式的比较也可以直接得到结果。
+ * 另外把 常量 op 表达式 规范成 表达式 op' 常量 的形式。
  */
 class ComparisonSimplificationRule : public ExpressionRewriteRule 
 {
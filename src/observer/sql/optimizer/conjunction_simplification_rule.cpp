@@ -16,7 +16,7 @@ See the Mulan PSL v2 for more details. */
 #include "sql/optimizer/conjunction_simplification_rule.h"
 #include "sql/expr/expression.h"
 
-RC try_to_get_bool_constant(std::unique_ptr<Expression> &expr, bool &constant_value)
+static RC try_to_get_bool_constant(std::unique_ptr<Expression> &expr, bool &constant_value)
 {
   if (expr->type() == ExprType::VALUE && expr->value_type() == BOOLEANS) {
     auto value_expr = static_cast<ValueExpr *>(expr.get());
@@ -25,57 +25,192 @@ RC try_to_get_bool_constant(std::unique_ptr<Expression> &expr, bool &constant_va
   }
   return RC::INTERNAL;
 }
+namespace {
+
+/**
+ * @brief AND联结的 字段 op 常量 条件确定的字段取值范围
+ */
+struct FieldRange
+{
+  const Expression *field = nullptr;
+  const Value      *lower = nullptr;
+  const Value      *upper = nullptr;
+  bool              lower_inclusive = false;
+  bool              upper_inclusive = false;
+  std::vector<const Value *> not_equal_values;
+
+  void set_lower(const Value &value, bool inclusive)
+  {
+    const int cmp = lower == nullptr ? 1 : value.compare(*lower);
+    if (cmp > 0 || (cmp == 0 && !inclusive)) {
+      lower           = &value;
+      lower_inclusive = inclusive;
+    }
+  }
+
+  void set_upper(const Value &value, bool inclusive)
+  {
+    const int cmp = upper == nullptr ? -1 : value.compare(*upper);
+    if (cmp < 0 || (cmp == 0 && !inclusive)) {
+      upper           = &value;
+      upper_inclusive = inclusive;
+    }
+  }
+
+  bool empty() const
+  {
+    if (lower == nullptr || upper == nullptr) {
+      return false;
+    }
+
+    const int cmp = lower->compare(*upper);
+    if (cmp > 0 || (cmp == 0 && (!lower_inclusive || !upper_inclusive))) {
+      return true;
+    }
+    if (cmp == 0) {
+      // 只有一个取值，并且这个值被 <> 排除了
+      for (const Value *value : not_equal_values) {
+        if (value->compare(*lower) == 0) {
+          return true;
+        }
+      }
+    }
+    return false;
+  }
+};
+
+/**
+ * @brief 判断AND联结的条件是否互相矛盾，比如 a > 5 AND a < 3
+ * @details 只处理整数和字符串类型的 字段 op 常量，这两种类型的比较是精确的。
+ * 浮点数比较时有误差范围，两个边界很接近时不能确定是否矛盾
+ */
+bool has_contradiction(std::vector<std::unique_ptr<Expression>> &children)
+{
+  std::vector<FieldRange> ranges;
+  for (std::unique_ptr<Expression> &child : children) {
+    if (child->type() != ExprType::COMPARISON) {
+      continue;
+    }
+
+    auto cmp_expr = static_cast<ComparisonExpr *>(child.get());
+    Expression *left  = cmp_expr->left().get();
+    Expression *right = cmp_expr->right().get();
+    if (left->type() != ExprType::FIELD || right->type() != ExprType::VALUE ||
+        left->value_type() != right->value_type() || (left->value_type() != INTS && left->value_type() != CHARS)) {
+      continue;
+    }
+
+    FieldRange *range = nullptr;
+    for (FieldRange &r : ranges) {
+      if (r.field->equal(*left)) {
+        range = &r;
+        break;
+      }
+    }
+    if (range == nullptr) {
+      ranges.emplace_back();
+      range        = &ranges.back();
+      range->field = left;
+    }
+
+    const Value &value = static_cast<ValueExpr *>(right)->get_value();
+    switch (cmp_expr->comp()) {
+      case EQUAL_TO: {
+        range->set_lower(value, true);
+        range->set_upper(value, true);
+      } break;
+      case NOT_EQUAL: range->not_equal_values.push_back(&value); break;
+      case LESS_THAN: range->set_upper(value, false); break;
+      case LESS_EQUAL: range->set_upper(value, true); break;
+      case GREAT_THAN: range->set_lower(value, false); break;
+      case GREAT_EQUAL: range->set_lower(value, true); break;
+      default: break;
+    }
+  }
+
+  for (const FieldRange &range : ranges) {
+    if (range.empty()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
 RC ConjunctionSimplificationRule::rewrite(std::unique_ptr<Expression> &expr, bool &change_made)
 {
   RC rc = RC::SUCCESS;
+  change_made = false;
   if (expr->type() != ExprType::CONJUNCTION) {
     return rc;
   }
 
-  change_made = false;
   auto conjunction_expr = static_cast<ConjunctionExpr *>(expr.get());
+  const bool is_and = conjunction_expr->conjunction_type() == ConjunctionExpr::Type::AND;
   std::vector<std::unique_ptr<Expression>> &child_exprs = conjunction_expr->children();
-  // 先看看有没有能够直接去掉的表达式。比如AND时恒为true的表达式可以删除
-  // 或者是否可以直接计算出当前表达式的值。比如AND时，如果有一个表达式为false，那么整个表达式就是false
-  for (auto iter = child_exprs.begin(); iter != child_exprs.end();) {
-    bool constant_value = false;
-    rc = try_to_get_bool_constant(*iter, constant_value);
-    if (rc != RC::SUCCESS) {
-      rc = RC::SUCCESS;
-      ++iter;
-      continue;
-    }
 
-    if (conjunction_expr->conjunction_type() == ConjunctionExpr::Type::AND) {
-      if (constant_value == true) {
-        child_exprs.erase(iter);
-      } else {
-        // always be false
-        std::unique_ptr<Expression> child_expr = std::move(child_exprs.front());
-        child_exprs.clear();
-        expr = std::move(child_expr);
-        return rc;
+  // 展开相同类型的联结，比如 a AND (b AND c) 就是 a AND b AND c
+  std::vector<std::unique_ptr<Expression>> flat_exprs;
+  for (std::unique_ptr<Expression> &child_expr : child_exprs) {
+    if (child_expr->type() == ExprType::CONJUNCTION &&
+        static_cast<ConjunctionExpr *>(child_expr.get())->conjunction_type() == conjunction_expr->conjunction_type()) {
+      for (std::unique_ptr<Expression> &grand_child : static_cast<ConjunctionExpr *>(child_expr.get())->children()) {
+        flat_exprs.emplace_back(std::move(grand_child));
       }
+      change_made = true;
     } else {
-      // conjunction_type == OR
-      if (constant_value == true) {
-        // always be true
-        std::unique_ptr<Expression> child_expr = std::move(child_exprs.front());
-        child_exprs.clear();
-        expr = std::move(child_expr);
-        return rc;
-      } else {
-        child_exprs.erase(iter);
+      flat_exprs.emplace_back(std::move(child_expr));
+    }
+  }
+
+  // 去掉能够直接去掉的表达式。比如AND时恒为true的表达式，以及重复的表达式
+  // 或者直接计算出当前表达式的值。比如AND时，如果有一个表达式为false，那么整个表达式就是false
+  std::vector<std::unique_ptr<Expression>> new_exprs;
+  for (std::unique_ptr<Expression> &child_expr : flat_exprs) {
+    bool constant_value = false;
+    if (try_to_get_bool_constant(child_expr, constant_value) == RC::SUCCESS) {
+      change_made = true;
+      if (constant_value == is_and) {
+        continue;
       }
+
+      LOG_TRACE("conjunction expression is always %d", constant_value);
+      expr.reset(new ValueExpr(Value(constant_value)));
+      return rc;
+    }
+
+    bool duplicated = false;
+    for (std::unique_ptr<Expression> &new_expr : new_exprs) {
+      if (new_expr->equal(*child_expr)) {
+        duplicated = true;
+        break;
+      }
+    }
+    if (duplicated) {
+      change_made = true;
+      continue;
     }
+    new_exprs.emplace_back(std::move(child_expr));
   }
-  if (child_exprs.size() == 1) {
-    LOG_TRACE("conjunction expression has only 1 child");
-    std::unique_ptr<Expression> child_expr = std::move(child_exprs.front());
-    child_exprs.clear();
-    expr = std::move(child_expr);
 
+  if (is_and && has_contradiction(new_exprs)) {
+    LOG_TRACE("conjunction expression has contradictory conditions");
+    expr.reset(new ValueExpr(Value(false)));
+    change_made = true;
+    return rc;
+  }
+
+  if (new_exprs.empty()) {
+    // 所有的条件都去掉了，AND时是true，OR时是false
+    expr.reset(new ValueExpr(Value(is_and)));
+    change_made = true;
+  } else if (new_exprs.size() == 1) {
+    LOG_TRACE("conjunction expression has only 1 child");
+    expr = std::move(new_exprs.front());
     change_made = true;
+  } else {
+    child_exprs.swap(new_exprs);
   }
 
   return rc;
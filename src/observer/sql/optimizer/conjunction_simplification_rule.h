@@ -21,7 +21,8 @@ class LogicalOperator;
 /**
  * @brief 简化多个表达式联结的运算
  * @ingroup Rewriter
- * @details 比如只有一个表达式，或者表达式可以直接出来
+ * @details 比如只有一个表达式，或者表达式可以直接出来。
+ * 另外会展开嵌套的相同类型的联结，去掉重复的条件，并识别互相矛盾的条件(比如 a > 5 AND a < 3)
  */
 class ConjunctionSimplificationRule : public ExpressionRewriteRule 
 {
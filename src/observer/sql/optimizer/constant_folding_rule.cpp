@@ -0,0 +1,42 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#include "sql/optimizer/constant_folding_rule.h"
+#include "common/log/log.h"
+#include "sql/expr/expression.h"
+
+using namespace std;
+
+RC ConstantFoldingRule::rewrite(unique_ptr<Expression> &expr, bool &change_made)
+{
+  change_made = false;
+  if (expr->type() != ExprType::ARITHMETIC && expr->type() != ExprType::CAST) {
+    return RC::SUCCESS;
+  }
+
+  // try_get_value 只有在所有的子表达式都是常量时才能成功
+  Value value;
+  RC rc = expr->try_get_value(value);
+  if (OB_FAIL(rc)) {
+    return RC::SUCCESS;
+  }
+
+  unique_ptr<Expression> value_expr(new ValueExpr(value));
+  value_expr->set_name(expr->name());
+  expr = std::move(value_expr);
+  change_made = true;
+  LOG_TRACE("constant expression is folded. value=%s", value.to_string().c_str());
+  return RC::SUCCESS;
+}
@@ -0,0 +1,34 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#pragma once
+
+#include "sql/optimizer/rewrite_rule.h"
+
+/**
+ * @brief 常量折叠
+ * @ingroup Rewriter
+ * @details 所有参数都是常量的算术运算和类型转换，在生成执行计划前直接计算出结果，替换成常量表达式。
+ * 常量表达式保留原来的名字，输出的列名不变。
+ * 比较运算的折叠见 ComparisonSimplificationRule。
+ */
+class ConstantFoldingRule : public ExpressionRewriteRule
+{
+public:
+  ConstantFoldingRule() = default;
+  virtual ~ConstantFoldingRule() = default;
+
+  RC rewrite(std::unique_ptr<Expression> &expr, bool &change_made) override;
+};
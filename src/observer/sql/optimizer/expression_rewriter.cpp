@@ -15,10 +15,12 @@ See the Mulan PSL v2 for more details. */
 #include "sql/optimizer/expression_rewriter.h"
 #include "sql/optimizer/comparison_simplification_rule.h"
 #include "sql/optimizer/conjunction_simplification_rule.h"
+#include "sql/optimizer/constant_folding_rule.h"
 #include "common/log/log.h"
 
 ExpressionRewriter::ExpressionRewriter()
 {
+  expr_rewrite_rules_.emplace_back(new ConstantFoldingRule);
   expr_rewrite_rules_.emplace_back(new ComparisonSimplificationRule);
   expr_rewrite_rules_.emplace_back(new ConjunctionSimplificationRule);
 }
@@ -80,7 +82,8 @@ RC ExpressionRewriter::rewrite_expression(std::unique_ptr<Expression> &expr, boo
 
   switch (expr->type()) {
     case ExprType::FIELD:
-    case ExprType::VALUE: {
+    case ExprType::VALUE:
+    case ExprType::PARAM: {
       // do nothing
     } break;
 
@@ -129,6 +132,25 @@ RC ExpressionRewriter::rewrite_expression(std::unique_ptr<Expression> &expr, boo
       }
     } break;
 
+    case ExprType::ARITHMETIC: {
+      auto arithmetic_expr = static_cast<ArithmeticExpr *>(expr.get());
+      for (std::unique_ptr<Expression> *child_expr : {&arithmetic_expr->left(), &arithmetic_expr->right()}) {
+        if (!*child_expr) {
+          continue;
+        }
+
+        bool sub_change_made = false;
+        rc = rewrite_expression(*child_expr, sub_change_made);
+        if (rc != RC::SUCCESS) {
+          return rc;
+        }
+
+        if (sub_change_made && !change_made) {
+          change_made = true;
+        }
+      }
+    } break;
+
     default: {
       // do nothing
     } break;
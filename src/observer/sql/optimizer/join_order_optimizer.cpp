@@ -0,0 +1,354 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#include <stdint.h>
+#include <limits>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+#include "sql/optimizer/join_order_optimizer.h"
+#include "sql/optimizer/cardinality_estimator.h"
+#include "sql/optimizer/predicate_pushdown_rewriter.h"
+#include "sql/operator/join_logical_operator.h"
+#include "sql/expr/expression.h"
+#include "common/log/log.h"
+
+using namespace std;
+
+namespace {
+
+/**
+ * @brief 一组输入的位图，第i位表示第i个输入
+ */
+using LeafSet = uint64_t;
+
+struct JoinCondition
+{
+  unique_ptr<Expression> expr;
+  LeafSet                leaves      = 0;  ///< 条件涉及的输入
+  double                 selectivity = 1;
+};
+
+/**
+ * @brief 展开之后的连接图，输入是连接树中不是连接的子树，边是连接条件
+ */
+class JoinGraph
+{
+public:
+  /**
+   * @brief 将连接树展开成输入和连接条件，原来的连接树被拆掉
+   */
+  void flatten(unique_ptr<LogicalOperator> &oper)
+  {
+    if (oper->type() != LogicalOperatorType::JOIN) {
+      leaves_.emplace_back(std::move(oper));
+      return;
+    }
+
+    for (unique_ptr<Expression> &expr : oper->expressions()) {
+      JoinCondition condition;
+      condition.expr = std::move(expr);
+      conditions_.emplace_back(std::move(condition));
+    }
+    for (unique_ptr<LogicalOperator> &child : oper->children()) {
+      flatten(child);
+    }
+  }
+
+  /**
+   * @brief 估算每个输入的行数和每个连接条件的选择率
+   * @details 调用方需要保证同一张表只出现在一个输入中
+   */
+  void init()
+  {
+    const LeafSet all_leaves = (LeafSet(1) << leaves_.size()) - 1;
+
+    vector<set<const Table *>> leaf_tables(leaves_.size());
+    for (size_t i = 0; i < leaves_.size(); i++) {
+      leaves_[i]->collect_tables(leaf_tables[i]);
+      leaf_rows_.push_back(CardinalityEstimator::estimate_rows(*leaves_[i]));
+    }
+
+    for (JoinCondition &condition : conditions_) {
+      set<const Table *> tables;
+      if (!PredicatePushdownRewriter::collect_expr_tables(condition.expr.get(), tables)) {
+        // 不知道依赖哪些表，只能在所有的输入都连接之后计算
+        condition.leaves = all_leaves;
+      }
+      for (const Table *table : tables) {
+        for (size_t i = 0; i < leaf_tables.size(); i++) {
+          if (leaf_tables[i].count(table) > 0) {
+            condition.leaves |= LeafSet(1) << i;
+          }
+        }
+      }
+      condition.selectivity = CardinalityEstimator::selectivity(*condition.expr);
+    }
+  }
+
+  int leaf_num() const { return static_cast<int>(leaves_.size()); }
+
+  /**
+   * @brief 使用动态规划枚举所有的连接树
+   * @details 按照子集从小到大的顺序，计算每个子集代价最小的划分方式。
+   * 一个子集的结果行数与划分方式无关，代价是自身的行数加上两个部分的代价。
+   */
+  void enumerate_dp()
+  {
+    const LeafSet all_leaves = (LeafSet(1) << leaves_.size()) - 1;
+
+    vector<double>  rows(all_leaves + 1, 0);
+    vector<double>  cost(all_leaves + 1, 0);
+    vector<LeafSet> split(all_leaves + 1, 0);
+    for (size_t i = 0; i < leaves_.size(); i++) {
+      rows[LeafSet(1) << i] = leaf_rows_[i];
+      cost[LeafSet(1) << i] = leaf_rows_[i];
+    }
+
+    for (LeafSet leaf_set = 1; leaf_set <= all_leaves; leaf_set++) {
+      if ((leaf_set & (leaf_set - 1)) == 0) {
+        continue;
+      }
+
+      // 只枚举包含最低位的一侧，避免对称的划分重复计算
+      const LeafSet lowest    = leaf_set & (~leaf_set + 1);
+      bool          connected = false;
+      rows[leaf_set] = rows[lowest] * rows[leaf_set ^ lowest] * join_selectivity(lowest, leaf_set ^ lowest, connected);
+
+      double best_cost      = numeric_limits<double>::max();
+      bool   best_connected = false;
+      for (LeafSet left = (leaf_set - 1) & leaf_set; left != 0; left = (left - 1) & leaf_set) {
+        if ((left & lowest) == 0) {
+          continue;
+        }
+
+        const LeafSet right = leaf_set ^ left;
+        join_selectivity(left, right, connected);
+        if (best_connected && !connected) {
+          continue;
+        }
+
+        const double total_cost = cost[left] + cost[right] + rows[leaf_set];
+        if ((connected && !best_connected) || total_cost < best_cost) {
+          best_cost       = total_cost;
+          best_connected  = connected;
+          split[leaf_set] = left;
+        }
+      }
+      cost[leaf_set] = best_cost;
+    }
+
+    record_dp_plan(all_leaves, rows, split);
+    LOG_TRACE("join order enumerated by dynamic programming. leaves=%d, rows=%.1f, cost=%.1f",
+              leaf_num(), rows[all_leaves], cost[all_leaves]);
+  }
+
+  /**
+   * @brief 贪心算法，每次合并结果行数最少的两个部分
+   */
+  void enumerate_greedy()
+  {
+    struct Part
+    {
+      LeafSet leaves;
+      double  rows;
+    };
+
+    vector<Part> parts;
+    for (size_t i = 0; i < leaves_.size(); i++) {
+      parts.push_back(Part{LeafSet(1) << i, leaf_rows_[i]});
+    }
+
+    while (parts.size() > 1) {
+      size_t best_left      = 0;
+      size_t best_right     = 1;
+      double best_rows      = numeric_limits<double>::max();
+      bool   best_connected = false;
+      for (size_t i = 0; i < parts.size(); i++) {
+        for (size_t j = i + 1; j < parts.size(); j++) {
+          bool         connected = false;
+          const double rows =
+              parts[i].rows * parts[j].rows * join_selectivity(parts[i].leaves, parts[j].leaves, connected);
+          if (best_connected && !connected) {
+            continue;
+          }
+          if ((connected && !best_connected) || rows < best_rows) {
+            best_left      = i;
+            best_right     = j;
+            best_rows      = rows;
+            best_connected = connected;
+          }
+        }
+      }
+
+      const LeafSet merged = parts[best_left].leaves | parts[best_right].leaves;
+      plans_[merged]       = Plan{parts[best_left].leaves, best_rows};
+      parts[best_left]     = Part{merged, best_rows};
+      parts.erase(parts.begin() + best_right);
+    }
+    LOG_TRACE("join order enumerated by greedy algorithm. leaves=%d, rows=%.1f", leaf_num(), parts.front().rows);
+  }
+
+  /**
+   * @brief 按照枚举的结果重建连接树
+   */
+  unique_ptr<LogicalOperator> build() { return build((LeafSet(1) << leaves_.size()) - 1); }
+
+private:
+  struct Plan
+  {
+    LeafSet left;  ///< 其中一侧包含的输入，另一侧是剩下的输入
+    double  rows;
+  };
+
+  /**
+   * @brief 两个不相交的部分连接时可以使用的连接条件的选择率
+   * @param[out] connected 是否有连接条件，没有时是笛卡尔积
+   */
+  double join_selectivity(LeafSet left, LeafSet right, bool &connected) const
+  {
+    const LeafSet leaf_set    = left | right;
+    double        selectivity = 1;
+    connected                 = false;
+    for (const JoinCondition &condition : conditions_) {
+      if ((condition.leaves & ~leaf_set) == 0 && (condition.leaves & left) != 0 && (condition.leaves & right) != 0) {
+        selectivity *= condition.selectivity;
+        connected = true;
+      }
+    }
+    return selectivity;
+  }
+
+  void record_dp_plan(LeafSet leaf_set, const vector<double> &rows, const vector<LeafSet> &split)
+  {
+    if ((leaf_set & (leaf_set - 1)) == 0) {
+      return;
+    }
+    plans_[leaf_set] = Plan{split[leaf_set], rows[leaf_set]};
+    record_dp_plan(split[leaf_set], rows, split);
+    record_dp_plan(leaf_set ^ split[leaf_set], rows, split);
+  }
+
+  double rows_of(LeafSet leaf_set) const
+  {
+    if ((leaf_set & (leaf_set - 1)) == 0) {
+      return leaf_rows_[__builtin_ctzll(leaf_set)];
+    }
+    return plans_.at(leaf_set).rows;
+  }
+
+  unique_ptr<LogicalOperator> build(LeafSet leaf_set)
+  {
+    if ((leaf_set & (leaf_set - 1)) == 0) {
+      return std::move(leaves_[__builtin_ctzll(leaf_set)]);
+    }
+
+    LeafSet left  = plans_.at(leaf_set).left;
+    LeafSet right = leaf_set ^ left;
+    if (rows_of(left) < rows_of(right)) {
+      std::swap(left, right);
+    }
+
+    unique_ptr<LogicalOperator> join_oper(new JoinLogicalOperator);
+    join_oper->add_child(build(left));
+    join_oper->add_child(build(right));
+
+    // 子树先构建，已经取走了只涉及一侧的条件，剩下的条件放在当前连接上
+    for (JoinCondition &condition : conditions_) {
+      if (condition.expr && (condition.leaves & ~leaf_set) == 0) {
+        join_oper->expressions().emplace_back(std::move(condition.expr));
+      }
+    }
+    return join_oper;
+  }
+
+private:
+  vector<unique_ptr<LogicalOperator>> leaves_;
+  vector<double>                      leaf_rows_;
+  vector<JoinCondition>               conditions_;
+  unordered_map<LeafSet, Plan>        plans_;
+};
+
+/**
+ * @brief 连接树中不是连接的子树个数，同一张表出现在多个子树中时返回-1
+ */
+int count_join_leaves(LogicalOperator &oper, set<const Table *> &tables)
+{
+  if (oper.type() != LogicalOperatorType::JOIN) {
+    set<const Table *> leaf_tables;
+    oper.collect_tables(leaf_tables);
+    for (const Table *table : leaf_tables) {
+      if (!tables.insert(table).second) {
+        return -1;
+      }
+    }
+    return 1;
+  }
+
+  int count = 0;
+  for (unique_ptr<LogicalOperator> &child : oper.children()) {
+    const int child_count = count_join_leaves(*child, tables);
+    if (child_count < 0) {
+      return -1;
+    }
+    count += child_count;
+  }
+  return count;
+}
+
+}  // namespace
+
+RC JoinOrderOptimizer::optimize(unique_ptr<LogicalOperator> &oper)
+{
+  if (oper->type() == LogicalOperatorType::JOIN) {
+    return reorder(oper);
+  }
+
+  for (unique_ptr<LogicalOperator> &child : oper->children()) {
+    RC rc = optimize(child);
+    if (OB_FAIL(rc)) {
+      return rc;
+    }
+  }
+  return RC::SUCCESS;
+}
+
+RC JoinOrderOptimizer::reorder(unique_ptr<LogicalOperator> &join_oper)
+{
+  // 两个输入的连接没有顺序可以调整，由物理计划选择build端。
+  // 同一张表出现多次时无法通过表区分连接条件涉及的输入，保持原来的顺序
+  set<const Table *> tables;
+  const int leaf_num = count_join_leaves(*join_oper, tables);
+  if (leaf_num < 3 || leaf_num >= 64) {
+    for (unique_ptr<LogicalOperator> &child : join_oper->children()) {
+      RC rc = optimize(child);
+      if (OB_FAIL(rc)) {
+        return rc;
+      }
+    }
+    return RC::SUCCESS;
+  }
+
+  JoinGraph graph;
+  graph.flatten(join_oper);
+  graph.init();
+  if (graph.leaf_num() <= DP_MAX_LEAVES) {
+    graph.enumerate_dp();
+  } else {
+    graph.enumerate_greedy();
+  }
+  join_oper = graph.build();
+  return RC::SUCCESS;
+}
@@ -0,0 +1,47 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#pragma once
+
+#include <memory>
+
+#include "common/rc.h"
+
+class LogicalOperator;
+
+/**
+ * @brief 根据估算的代价调整连接的顺序
+ * @ingroup SQLStage
+ * @details 逻辑计划按照FROM中表的顺序生成左深树。这里把相邻的连接算子展开成一组输入和一组连接条件，
+ * 重新枚举连接顺序。参与连接的输入不多时，使用动态规划在所有的子集上找到代价最小的连接树(可以是bushy树)，
+ * 输入较多时使用贪心算法，每次合并结果最小的两个输入。
+ * 代价是所有中间结果的行数之和，行数由 CardinalityEstimator 估算。
+ * 优先选择有连接条件的组合，只有无法避免时才使用笛卡尔积。
+ * 重建连接树时，每个连接条件放到包含它所有表的最低的连接上，较大的一侧作为左孩子。
+ * hash join的build端由物理计划根据两侧估算的行数决定。
+ */
+class JoinOrderOptimizer
+{
+public:
+  /**
+   * @brief 使用动态规划的最大输入个数，动态规划的复杂度是 O(3^n)
+   */
+  static constexpr int DP_MAX_LEAVES = 10;
+
+public:
+  RC optimize(std::unique_ptr<LogicalOperator> &oper);
+
+private:
+  RC reorder(std::unique_ptr<LogicalOperator> &join_oper);
+};
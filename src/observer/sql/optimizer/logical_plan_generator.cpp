@@ -12,6 +12,8 @@ See the Mulan PSL v2 for more details. */
 // Created by Wangyunlai on 2023/08/16.
 //
 
+#include <algorithm>
+
 #include "sql/optimizer/logical_plan_generator.h"
 
 #include "sql/operator/logical_operator.h"
@@ -24,6 +26,9 @@ See the Mulan PSL v2 for more details. */
 #include "sql/operator/join_logical_operator.h"
 #include "sql/operator/project_logical_operator.h"
 #include "sql/operator/explain_logical_operator.h"
+#include "sql/operator/aggregate_logical_operator.h"
+#include "sql/operator/sort_logical_operator.h"
+#include "sql/operator/limit_logical_operator.h"
 
 #include "sql/stmt/stmt.h"
 #include "sql/stmt/calc_stmt.h"
@@ -76,6 +81,107 @@ RC LogicalPlanGenerator::create_plan(CalcStmt *calc_stmt, std::unique_ptr<Logica
   return RC::SUCCESS;
 }
 
+/**
+ * @brief 复制select中的聚合函数，聚合算子和投影算子各使用一份
+ */
+static unique_ptr<Expression> copy_aggregate_expr(const AggregateExpr &aggregate_expr)
+{
+  unique_ptr<Expression> child;
+  if (aggregate_expr.child()) {
+    child.reset(new FieldExpr(static_cast<const FieldExpr &>(*aggregate_expr.child()).field()));
+  }
+  unique_ptr<Expression> expr(new AggregateExpr(aggregate_expr.aggregate_type(), std::move(child)));
+  expr->set_name(aggregate_expr.name());
+  return expr;
+}
+
+/**
+ * @brief 创建order by对应的排序算子，没有order by时直接返回child
+ * @details 聚合查询的排序在聚合之后，聚合函数按照名字引用聚合算子的输出
+ */
+static unique_ptr<LogicalOperator> create_sort(SelectStmt *select_stmt, unique_ptr<LogicalOperator> child)
+{
+  const vector<unique_ptr<Expression>> &order_by_exprs = select_stmt->order_by_expressions();
+  if (order_by_exprs.empty()) {
+    return child;
+  }
+
+  vector<unique_ptr<Expression>> sort_exprs;
+  for (const unique_ptr<Expression> &expr : order_by_exprs) {
+    if (expr->type() == ExprType::FIELD) {
+      sort_exprs.emplace_back(new FieldExpr(static_cast<const FieldExpr &>(*expr).field()));
+    } else {
+      sort_exprs.emplace_back(copy_aggregate_expr(static_cast<const AggregateExpr &>(*expr)));
+    }
+  }
+
+  unique_ptr<LogicalOperator> sort_oper(new SortLogicalOperator(std::move(sort_exprs), select_stmt->order_by_ascending()));
+  if (child) {
+    sort_oper->add_child(std::move(child));
+  }
+  return sort_oper;
+}
+
+/**
+ * @brief 创建limit算子，没有limit和offset时直接返回child
+ */
+static unique_ptr<LogicalOperator> create_limit(SelectStmt *select_stmt, unique_ptr<LogicalOperator> child)
+{
+  if (select_stmt->limit() < 0 && select_stmt->offset() == 0) {
+    return child;
+  }
+
+  unique_ptr<LogicalOperator> limit_oper(new LimitLogicalOperator(select_stmt->limit(), select_stmt->offset()));
+  if (child) {
+    limit_oper->add_child(std::move(child));
+  }
+  return limit_oper;
+}
+
+/**
+ * @brief 创建聚合查询的投影，投影中的聚合函数按照名字引用聚合算子的输出
+ * @details order by中的聚合函数没有出现在select中时，也需要由聚合算子计算
+ */
+static unique_ptr<LogicalOperator> create_aggregate_project(SelectStmt *select_stmt, unique_ptr<LogicalOperator> child)
+{
+  vector<unique_ptr<Expression>> group_by_exprs;
+  for (const Field &field : select_stmt->group_by_fields()) {
+    group_by_exprs.emplace_back(new FieldExpr(field));
+  }
+
+  vector<unique_ptr<Expression>> aggregate_exprs;
+  vector<unique_ptr<Expression>> project_exprs;
+  for (const unique_ptr<Expression> &expr : select_stmt->query_expressions()) {
+    if (expr->type() == ExprType::FIELD) {
+      project_exprs.emplace_back(new FieldExpr(static_cast<const FieldExpr &>(*expr).field()));
+    } else {
+      const auto &aggregate_expr = static_cast<const AggregateExpr &>(*expr);
+      aggregate_exprs.emplace_back(copy_aggregate_expr(aggregate_expr));
+      project_exprs.emplace_back(copy_aggregate_expr(aggregate_expr));
+    }
+  }
+  for (const unique_ptr<Expression> &expr : select_stmt->order_by_expressions()) {
+    if (expr->type() != ExprType::AGGREGATION) {
+      continue;
+    }
+    auto iter = std::find_if(aggregate_exprs.begin(), aggregate_exprs.end(),
+        [&expr](const unique_ptr<Expression> &aggregate_expr) { return aggregate_expr->name() == expr->name(); });
+    if (iter == aggregate_exprs.end()) {
+      aggregate_exprs.emplace_back(copy_aggregate_expr(static_cast<const AggregateExpr &>(*expr)));
+    }
+  }
+
+  unique_ptr<LogicalOperator> aggregate_oper(
+      new AggregateLogicalOperator(std::move(group_by_exprs), std::move(aggregate_exprs)));
+  if (child) {
+    aggregate_oper->add_child(std::move(child));
+  }
+
+  unique_ptr<LogicalOperator> project_oper(new ProjectLogicalOperator(std::move(project_exprs)));
+  project_oper->add_child(create_limit(select_stmt, create_sort(select_stmt, std::move(aggregate_oper))));
+  return project_oper;
+}
+
 RC LogicalPlanGenerator::create_plan(
     SelectStmt *select_stmt, unique_ptr<LogicalOperator> &logical_operator)
 {
@@ -90,6 +196,19 @@ RC LogicalPlanGenerator::create_plan(
         fields.push_back(field);
       }
     }
+    // 非聚合查询可以按照不在select中的字段排序
+    for (const unique_ptr<Expression> &expr : select_stmt->order_by_expressions()) {
+      if (expr->type() != ExprType::FIELD) {
+        continue;
+      }
+      const Field &field = static_cast<const FieldExpr &>(*expr).field();
+      auto iter = std::find_if(fields.begin(), fields.end(), [&field](const Field &other) {
+        return 0 == strcmp(other.field_name(), field.field_name());
+      });
+      if (field.table() == table && iter == fields.end()) {
+        fields.push_back(field);
+      }
+    }
 
     unique_ptr<LogicalOperator> table_get_oper(new TableGetLogicalOperator(table, fields, true/*readonly*/));
     if (table_oper == nullptr) {
@@ -109,15 +228,20 @@ RC LogicalPlanGenerator::create_plan(
     return rc;
   }
 
-  unique_ptr<LogicalOperator> project_oper(new ProjectLogicalOperator(all_fields));
   if (predicate_oper) {
     if (table_oper) {
       predicate_oper->add_child(std::move(table_oper));
     }
-    project_oper->add_child(std::move(predicate_oper));
+    table_oper = std::move(predicate_oper);
+  }
+
+  unique_ptr<LogicalOperator> project_oper;
+  if (select_stmt->has_aggregation()) {
+    project_oper = create_aggregate_project(select_stmt, std::move(table_oper));
   } else {
+    project_oper.reset(new ProjectLogicalOperator(all_fields));
     if (table_oper) {
-      project_oper->add_child(std::move(table_oper));
+      project_oper->add_child(create_limit(select_stmt, create_sort(select_stmt, std::move(table_oper))));
     }
   }
 
@@ -125,6 +249,17 @@ RC LogicalPlanGenerator::create_plan(
   return RC::SUCCESS;
 }
 
+static unique_ptr<Expression> create_filter_expr(const FilterObj &filter_obj)
+{
+  if (filter_obj.is_attr) {
+    return make_unique<FieldExpr>(filter_obj.field);
+  }
+  if (filter_obj.param != nullptr) {
+    return make_unique<ParamExpr>(filter_obj.param);
+  }
+  return make_unique<ValueExpr>(filter_obj.value);
+}
+
 RC LogicalPlanGenerator::create_plan(
     FilterStmt *filter_stmt, unique_ptr<LogicalOperator> &logical_operator)
 {
@@ -134,13 +269,8 @@ RC LogicalPlanGenerator::create_plan(
     const FilterObj &filter_obj_left = filter_unit->left();
     const FilterObj &filter_obj_right = filter_unit->right();
 
-    unique_ptr<Expression> left(filter_obj_left.is_attr
-                                         ? static_cast<Expression *>(new FieldExpr(filter_obj_left.field))
-                                         : static_cast<Expression *>(new ValueExpr(filter_obj_left.value)));
-
-    unique_ptr<Expression> right(filter_obj_right.is_attr
-                                          ? static_cast<Expression *>(new FieldExpr(filter_obj_right.field))
-                                          : static_cast<Expression *>(new ValueExpr(filter_obj_right.value)));
+    unique_ptr<Expression> left  = create_filter_expr(filter_obj_left);
+    unique_ptr<Expression> right = create_filter_expr(filter_obj_right);
 
     ComparisonExpr *cmp_expr = new ComparisonExpr(filter_unit->comp(), std::move(left), std::move(right));
     cmp_exprs.emplace_back(cmp_expr);
@@ -209,7 +339,7 @@ RC LogicalPlanGenerator::create_plan(
     return rc;
   }
 
-  logical_operator = unique_ptr<LogicalOperator>(new ExplainLogicalOperator);
+  logical_operator = unique_ptr<LogicalOperator>(new ExplainLogicalOperator(explain_stmt->analyze()));
   logical_operator->add_child(std::move(child_oper));
   return rc;
 }
@@ -23,16 +23,21 @@ See the Mulan PSL v2 for more details. */
 #include "common/log/log.h"
 #include "sql/expr/expression.h"
 #include "sql/operator/logical_operator.h"
+#include "sql/optimizer/cardinality_estimator.h"
 #include "sql/executor/sql_result.h"
 #include "sql/stmt/stmt.h"
 #include "event/sql_event.h"
 #include "event/session_event.h"
+#include "session/session.h"
 
 using namespace std;
 using namespace common;
 
 RC OptimizeStage::handle_request(SQLStageEvent *sql_event)
 {
+  // 优化过程中一直使用同一份统计信息，不受其它会话执行 ANALYZE TABLE 的影响
+  TableStatsSnapshot stats_snapshot;
+
   unique_ptr<LogicalOperator> logical_operator;
   RC rc = create_logical_plan(sql_event, logical_operator);
   if (rc != RC::SUCCESS) {
@@ -68,15 +73,29 @@ RC OptimizeStage::handle_request(SQLStageEvent *sql_event)
 
 RC OptimizeStage::optimize(unique_ptr<LogicalOperator> &oper)
 {
-  // do nothing
-  return RC::SUCCESS;
+  RC rc = join_order_optimizer_.optimize(oper);
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to optimize join order. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  rc = projection_pushdown_.optimize(oper);
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to pushdown projection. rc=%s", strrc(rc));
+  }
+  return rc;
 }
 
 RC OptimizeStage::generate_physical_plan(
     unique_ptr<LogicalOperator> &logical_operator, unique_ptr<PhysicalOperator> &physical_operator)
 {
   RC rc = RC::SUCCESS;
-  rc = physical_plan_generator_.create(*logical_operator, physical_operator);
+  Session *session = Session::current_session();
+  if (session != nullptr && session->execution_mode() == ExecutionMode::CHUNK_ITERATOR) {
+    rc = physical_plan_generator_.create_vec(*logical_operator, physical_operator);
+  } else {
+    rc = physical_plan_generator_.create(*logical_operator, physical_operator);
+  }
   if (rc != RC::SUCCESS) {
     LOG_WARN("failed to create physical operator. rc=%s", strrc(rc));
   }
@@ -19,8 +19,10 @@ See the Mulan PSL v2 for more details. */
 #include "common/rc.h"
 #include "sql/operator/logical_operator.h"
 #include "sql/operator/physical_operator.h"
+#include "sql/optimizer/join_order_optimizer.h"
 #include "sql/optimizer/logical_plan_generator.h"
 #include "sql/optimizer/physical_plan_generator.h"
+#include "sql/optimizer/projection_pushdown.h"
 #include "sql/optimizer/rewriter.h"
 
 class SQLStageEvent;
@@ -59,7 +61,8 @@ private:
 
   /**
    * @brief 优化逻辑计划
-   * @details 当前什么都没做。可以增加每个逻辑计划的代价模型，然后根据代价模型进行优化。
+   * @details 根据估算的代价调整连接的顺序，参考 JoinOrderOptimizer。
+   * 连接顺序确定之后，把需要读取的字段下推到表扫描上，参考 ProjectionPushdown。
    * @param logical_operator 需要优化的逻辑计划
    */
   RC optimize(std::unique_ptr<LogicalOperator> &logical_operator);
@@ -78,4 +81,6 @@ private:
   LogicalPlanGenerator  logical_plan_generator_;  ///< 根据SQL生成逻辑计划
   PhysicalPlanGenerator physical_plan_generator_; ///< 根据逻辑计划生成物理计划
   Rewriter              rewriter_;                ///< 逻辑计划改写
+  JoinOrderOptimizer    join_order_optimizer_;    ///< 连接顺序优化
+  ProjectionPushdown    projection_pushdown_;     ///< 表扫描只输出需要的字段
 };
@@ -12,9 +12,13 @@ See the Mulan PSL v2 for more details. */
 // Created by Wangyunlai on 2022/12/14.
 //
 
+#include <algorithm>
+#include <set>
 #include <utility>
 
 #include "sql/optimizer/physical_plan_generator.h"
+#include "sql/optimizer/cardinality_estimator.h"
+#include "sql/optimizer/projection_pushdown.h"
 #include "sql/operator/table_get_logical_operator.h"
 #include "sql/operator/table_scan_physical_operator.h"
 #include "sql/operator/index_scan_physical_operator.h"
@@ -30,8 +34,32 @@ See the Mulan PSL v2 for more details. */
 #include "sql/operator/explain_physical_operator.h"
 #include "sql/operator/join_logical_operator.h"
 #include "sql/operator/join_physical_operator.h"
+#include "sql/operator/hash_join_physical_operator.h"
+#include "sql/operator/merge_join_physical_operator.h"
+#include "sql/operator/index_nested_loop_join_physical_operator.h"
 #include "sql/operator/calc_logical_operator.h"
 #include "sql/operator/calc_physical_operator.h"
+#include "sql/operator/aggregate_logical_operator.h"
+#include "sql/operator/hash_aggregate_physical_operator.h"
+#include "sql/operator/stream_aggregate_physical_operator.h"
+#include "sql/operator/aggregate_vec_physical_operator.h"
+#include "sql/operator/sort_logical_operator.h"
+#include "sql/operator/sort_physical_operator.h"
+#include "sql/operator/top_n_physical_operator.h"
+#include "sql/operator/limit_logical_operator.h"
+#include "sql/operator/limit_physical_operator.h"
+#include "session/session.h"
+#include "common/global_context.h"
+#include "sql/operator/exchange_physical_operator.h"
+#include "sql/operator/exchange_worker_pool.h"
+#include "sql/operator/table_scan_vec_physical_operator.h"
+#include "sql/operator/predicate_vec_physical_operator.h"
+#include "sql/operator/project_vec_physical_operator.h"
+#include "sql/operator/row_to_vec_physical_operator.h"
+#include "sql/operator/vec_to_row_physical_operator.h"
+#include "storage/table/table.h"
+#include "storage/table/table_stats.h"
+#include "storage/index/index.h"
 #include "sql/expr/expression.h"
 #include "common/log/log.h"
 
@@ -74,6 +102,18 @@ RC PhysicalPlanGenerator::create(LogicalOperator &logical_operator, unique_ptr<P
       return create_plan(static_cast<JoinLogicalOperator &>(logical_operator), oper);
     } break;
 
+    case LogicalOperatorType::AGGREGATION: {
+      return create_plan(static_cast<AggregateLogicalOperator &>(logical_operator), oper);
+    } break;
+
+    case LogicalOperatorType::SORT: {
+      return create_plan(static_cast<SortLogicalOperator &>(logical_operator), oper);
+    } break;
+
+    case LogicalOperatorType::LIMIT: {
+      return create_plan(static_cast<LimitLogicalOperator &>(logical_operator), oper);
+    } break;
+
     default: {
       return RC::INVALID_ARGUMENT;
     }
@@ -81,66 +121,358 @@ RC PhysicalPlanGenerator::create(LogicalOperator &logical_operator, unique_ptr<P
   return rc;
 }
 
-RC PhysicalPlanGenerator::create_plan(TableGetLogicalOperator &table_get_oper, unique_ptr<PhysicalOperator> &oper)
-{
-  vector<unique_ptr<Expression>> &predicates = table_get_oper.predicates();
-  // 看看是否有可以用于索引查找的表达式
-  Table *table = table_get_oper.table();
+namespace {
 
+/**
+ * @brief 一个索引上可以扫描的范围
+ * @details low/high 为UNDEFINED时表示这一侧没有边界
+ */
+struct IndexScanRange
+{
   Index *index = nullptr;
-  ValueExpr *value_expr = nullptr;
+  Value  low;
+  Value  high;
+  bool   low_inclusive  = false;
+  bool   high_inclusive = false;
+
+  /// 确定范围的所有条件。包含参数时执行前需要根据参数的值重新计算范围，见 IndexScanPhysicalOperator::set_range_terms
+  vector<IndexRangeTerm> terms;
+  bool                   parameterized = false;
+
+  bool has_low() const { return low.attr_type() != UNDEFINED; }
+  bool has_high() const { return high.attr_type() != UNDEFINED; }
+
+  bool is_point() const
+  {
+    return has_low() && has_high() && low_inclusive && high_inclusive && low.compare(high) == 0;
+  }
+
+  /**
+   * @brief 下界大于上界，或者相等但是不包含边界时，范围内没有数据
+   */
+  bool is_empty() const
+  {
+    if (!has_low() || !has_high()) {
+      return false;
+    }
+    const int result = low.compare(high);
+    return result > 0 || (result == 0 && !(low_inclusive && high_inclusive));
+  }
+
+  /**
+   * @brief 在多个索引之间选择时的优先级：等值查询、两侧都有边界、只有一侧有边界
+   */
+  int rank() const
+  {
+    if (is_point()) {
+      return 3;
+    }
+    return (has_low() ? 1 : 0) + (has_high() ? 1 : 0);
+  }
+
+  /**
+   * @brief 与 [value, +inf) 或 (value, +inf) 求交集，保留较大的下界
+   */
+  void intersect_low(const Value &value, bool inclusive)
+  {
+    const int result = has_low() ? value.compare(low) : 1;
+    if (result > 0 || (result == 0 && !inclusive)) {
+      low           = value;
+      low_inclusive = inclusive;
+    }
+  }
+
+  void intersect_high(const Value &value, bool inclusive)
+  {
+    const int result = has_high() ? value.compare(high) : -1;
+    if (result < 0 || (result == 0 && !inclusive)) {
+      high           = value;
+      high_inclusive = inclusive;
+    }
+  }
+};
+
+}  // namespace
+
+static bool is_range_constant(const Expression *expr)
+{
+  return expr->type() == ExprType::VALUE || expr->type() == ExprType::PARAM;
+}
+
+/**
+ * @brief 收集表上每个索引可以扫描的范围
+ * @details 查找字段与常量的比较，常量在左边时交换两边。同一个字段上的多个条件取交集，
+ * 比如 a >= 1 and a < 10 and a > 3 得到 (3, 10)。不等于的比较不能缩小范围，不处理。
+ * 条件本身仍然保留在扫描算子中过滤，所以这里的范围只需要包含所有满足条件的数据。
+ */
+static vector<IndexScanRange> collect_index_ranges(Table *table, vector<unique_ptr<Expression>> &predicates)
+{
+  vector<IndexScanRange> ranges;
   for (auto &expr : predicates) {
-    if (expr->type() == ExprType::COMPARISON) {
-      auto comparison_expr = static_cast<ComparisonExpr *>(expr.get());
-      // 简单处理，就找等值查询
-      if (comparison_expr->comp() != EQUAL_TO) {
-        continue;
-      }
+    if (expr->type() != ExprType::COMPARISON) {
+      continue;
+    }
 
-      unique_ptr<Expression> &left_expr = comparison_expr->left();
-      unique_ptr<Expression> &right_expr = comparison_expr->right();
-      // 左右比较的一边最少是一个值
-      if (left_expr->type() != ExprType::VALUE && right_expr->type() != ExprType::VALUE) {
-        continue;
-      }
+    auto comparison_expr = static_cast<ComparisonExpr *>(expr.get());
+    CompOp comp = comparison_expr->comp();
+    if (comp == NOT_EQUAL || comp == NO_OP) {
+      continue;
+    }
 
-      FieldExpr *field_expr = nullptr;
-      if (left_expr->type() == ExprType::FIELD) {
-        ASSERT(right_expr->type() == ExprType::VALUE, "right expr should be a value expr while left is field expr");
-        field_expr = static_cast<FieldExpr *>(left_expr.get());
-        value_expr = static_cast<ValueExpr *>(right_expr.get());
-      } else if (right_expr->type() == ExprType::FIELD) {
-        ASSERT(left_expr->type() == ExprType::VALUE, "left expr should be a value expr while right is a field expr");
-        field_expr = static_cast<FieldExpr *>(right_expr.get());
-        value_expr = static_cast<ValueExpr *>(left_expr.get());
-      }
+    unique_ptr<Expression> &left_expr  = comparison_expr->left();
+    unique_ptr<Expression> &right_expr = comparison_expr->right();
+    FieldExpr  *field_expr    = nullptr;
+    Expression *constant_expr = nullptr;
+    if (left_expr->type() == ExprType::FIELD && is_range_constant(right_expr.get())) {
+      field_expr    = static_cast<FieldExpr *>(left_expr.get());
+      constant_expr = right_expr.get();
+    } else if (is_range_constant(left_expr.get()) && right_expr->type() == ExprType::FIELD) {
+      field_expr    = static_cast<FieldExpr *>(right_expr.get());
+      constant_expr = left_expr.get();
+      comp          = ComparisonExpr::swap_comp(comp);
+    } else {
+      continue;
+    }
 
-      if (field_expr == nullptr) {
-        continue;
-      }
+    const Field &field = field_expr->field();
+    if (field.table() != table) {
+      continue;
+    }
+    Index *index = table->find_index_by_field(field.field_name());
+    if (index == nullptr) {
+      continue;
+    }
 
-      const Field &field = field_expr->field();
-      index = table->find_index_by_field(field.field_name());
-      if (nullptr != index) {
-        break;
+    // 参数按照生成执行计划时绑定的值计算范围，执行时再按照新的值重新计算
+    const bool   is_param       = constant_expr->type() == ExprType::PARAM;
+    const Value &constant_value = is_param ? static_cast<ParamExpr *>(constant_expr)->get_value()
+                                           : static_cast<ValueExpr *>(constant_expr)->get_value();
+    Value value;
+    if (!IndexScanPhysicalOperator::cast_to_index_type(constant_value, field.attr_type(), value)) {
+      continue;
+    }
+
+    auto iter = std::find_if(ranges.begin(), ranges.end(), [index](const IndexScanRange &range) {
+      return range.index == index;
+    });
+    if (iter == ranges.end()) {
+      ranges.emplace_back();
+      iter = std::prev(ranges.end());
+      iter->index = index;
+    }
+    iter->terms.push_back(IndexRangeTerm{comp, &constant_value});
+    iter->parameterized = iter->parameterized || is_param;
+
+    switch (comp) {
+      case EQUAL_TO: {
+        iter->intersect_low(value, true);
+        iter->intersect_high(value, true);
+      } break;
+      case GREAT_EQUAL: iter->intersect_low(value, true); break;
+      case GREAT_THAN: iter->intersect_low(value, false); break;
+      case LESS_EQUAL: iter->intersect_high(value, true); break;
+      case LESS_THAN: iter->intersect_high(value, false); break;
+      default: break;
+    }
+  }
+  return ranges;
+}
+
+/**
+ * @brief 代价模型的参数，以顺序读取一个页面的代价为单位，取值与PostgreSQL的默认值相同
+ */
+static constexpr double SEQ_PAGE_COST        = 1.0;
+static constexpr double RANDOM_PAGE_COST     = 4.0;
+static constexpr double CPU_TUPLE_COST       = 0.01;
+static constexpr double CPU_INDEX_TUPLE_COST = 0.005;
+
+static double estimate_range_selectivity(const TableStats &stats, const IndexScanRange &range)
+{
+  const ColumnStats *column = stats.column(range.index->index_meta().field());
+  if (column == nullptr) {
+    if (range.is_point()) {
+      return CardinalityEstimator::DEFAULT_EQUAL_SELECTIVITY;
+    }
+    const double range_selectivity = CardinalityEstimator::DEFAULT_RANGE_SELECTIVITY;
+    return range.rank() == 2 ? range_selectivity * range_selectivity : range_selectivity;
+  }
+
+  if (range.is_point()) {
+    return column->equal_selectivity(range.low);
+  }
+  return column->range_selectivity(range.has_low() ? &range.low : nullptr, range.low_inclusive,
+      range.has_high() ? &range.high : nullptr, range.high_inclusive);
+}
+
+/**
+ * @brief 表扫描顺序读取所有的数据页面，并检查每一行
+ */
+static double table_scan_cost(double pages, double rows)
+{
+  return pages * SEQ_PAGE_COST + rows * CPU_TUPLE_COST;
+}
+
+/**
+ * @brief 索引扫描先从根节点找到叶子节点，再按照每个索引项随机读取数据页面，最多读取所有的数据页面
+ */
+static double index_scan_cost(double pages, double matched_rows)
+{
+  return RANDOM_PAGE_COST * (1 + std::min(matched_rows, pages)) +
+         matched_rows * (CPU_INDEX_TUPLE_COST + CPU_TUPLE_COST);
+}
+
+/**
+ * @brief 看看是否有可以用于索引查找的表达式
+ * @details 表有统计信息(执行过 ANALYZE TABLE)时，估算每个索引的扫描范围内的行数，
+ * 在表扫描和所有可以使用的索引中选择代价最小的。
+ * 没有统计信息时无法估算代价，按照 IndexScanRange::rank 选择范围最确定的索引。
+ * 范围为空时索引扫描无法表示，不使用索引，由表扫描上的过滤条件得到空结果。
+ * @return 不使用索引时返回false
+ */
+static bool choose_index(Table *table, vector<unique_ptr<Expression>> &predicates, IndexScanRange &best)
+{
+  vector<IndexScanRange> ranges = collect_index_ranges(table, predicates);
+  for (const IndexScanRange &range : ranges) {
+    if (range.is_empty()) {
+      return false;
+    }
+  }
+
+  bool found = false;
+  shared_ptr<const TableStats> stats = CardinalityEstimator::table_stats(table);
+  if (stats == nullptr) {
+    for (IndexScanRange &range : ranges) {
+      if (!found || range.rank() > best.rank()) {
+        best  = std::move(range);
+        found = true;
       }
     }
+    return found;
   }
 
-  if (index != nullptr) {
-    ASSERT(value_expr != nullptr, "got an index but value expr is null ?");
-
-    const Value &value = value_expr->get_value();
-    IndexScanPhysicalOperator *index_scan_oper = new IndexScanPhysicalOperator(
-          table, index, table_get_oper.readonly(), 
-          &value, true /*left_inclusive*/, 
-          &value, true /*right_inclusive*/);
-          
+  const double pages     = table->data_page_count();
+  const double rows      = CardinalityEstimator::table_rows(table);
+  double       best_cost = table_scan_cost(pages, rows);
+  for (IndexScanRange &range : ranges) {
+    const double matched_rows = rows * estimate_range_selectivity(*stats, range);
+    const double cost         = index_scan_cost(pages, matched_rows);
+    LOG_TRACE("index scan cost. table=%s, index=%s, rows=%.1f, cost=%.2f, table scan cost=%.2f",
+              table->name(), range.index->index_meta().name(), matched_rows, cost, table_scan_cost(pages, rows));
+    if (cost < best_cost) {
+      best_cost = cost;
+      best      = std::move(range);
+      found     = true;
+    }
+  }
+  return found;
+}
+
+static IndexScanPhysicalOperator *create_index_scan(
+    TableGetLogicalOperator &table_get_oper, const IndexScanRange &range)
+{
+  auto index_scan_oper = new IndexScanPhysicalOperator(table_get_oper.table(), range.index, table_get_oper.readonly(),
+      range.has_low() ? &range.low : nullptr, range.low_inclusive,
+      range.has_high() ? &range.high : nullptr, range.high_inclusive);
+  if (range.parameterized) {
+    index_scan_oper->set_range_terms(range.terms);
+  }
+  index_scan_oper->set_output_fields(table_get_oper.fields());
+  return index_scan_oper;
+}
+
+/**
+ * @brief 把表达式中的字段绑定到输入tuple中cell的位置上
+ * @details 执行时直接按位置取值。输入中找不到的字段不绑定，执行时仍然按照名字查找
+ * @param schema 计算表达式时输入的tuple的schema
+ */
+static void bind_tuple_cells(Expression *expr, const TupleSchema &schema)
+{
+  if (expr == nullptr) {
+    return;
+  }
+
+  switch (expr->type()) {
+    case ExprType::FIELD: {
+      auto field_expr = static_cast<FieldExpr *>(expr);
+      field_expr->set_cell_index(
+          find_spec(schema.cells(), TupleCellSpec(field_expr->table_name(), field_expr->field_name())));
+    } break;
+    case ExprType::CAST: {
+      bind_tuple_cells(static_cast<CastExpr *>(expr)->child().get(), schema);
+    } break;
+    case ExprType::COMPARISON: {
+      auto comparison_expr = static_cast<ComparisonExpr *>(expr);
+      bind_tuple_cells(comparison_expr->left().get(), schema);
+      bind_tuple_cells(comparison_expr->right().get(), schema);
+    } break;
+    case ExprType::CONJUNCTION: {
+      for (unique_ptr<Expression> &child : static_cast<ConjunctionExpr *>(expr)->children()) {
+        bind_tuple_cells(child.get(), schema);
+      }
+    } break;
+    case ExprType::ARITHMETIC: {
+      auto arithmetic_expr = static_cast<ArithmeticExpr *>(expr);
+      bind_tuple_cells(arithmetic_expr->left().get(), schema);
+      bind_tuple_cells(arithmetic_expr->right().get(), schema);
+    } break;
+    case ExprType::AGGREGATION: {
+      bind_tuple_cells(static_cast<AggregateExpr *>(expr)->child().get(), schema);
+    } break;
+    default: break;
+  }
+}
+
+/**
+ * @brief 绑定在input算子输出的tuple上计算的表达式
+ * @details input算子无法确定输出格式时不绑定
+ */
+static void bind_tuple_cells(vector<unique_ptr<Expression>> &exprs, const PhysicalOperator &input)
+{
+  TupleSchema schema;
+  if (OB_FAIL(input.tuple_schema(schema))) {
+    return;
+  }
+  for (unique_ptr<Expression> &expr : exprs) {
+    bind_tuple_cells(expr.get(), schema);
+  }
+}
+
+static void bind_tuple_cells(Expression *expr, const PhysicalOperator &input)
+{
+  TupleSchema schema;
+  if (OB_SUCC(input.tuple_schema(schema))) {
+    bind_tuple_cells(expr, schema);
+  }
+}
+
+/**
+ * @brief 绑定表扫描上的过滤条件，过滤条件直接在记录上计算，可以访问表中所有的字段
+ */
+static void bind_table_cells(vector<unique_ptr<Expression>> &exprs, const Table *table)
+{
+  TupleSchema schema;
+  RowTuple::table_schema(table, schema);
+  for (unique_ptr<Expression> &expr : exprs) {
+    bind_tuple_cells(expr.get(), schema);
+  }
+}
+
+RC PhysicalPlanGenerator::create_plan(TableGetLogicalOperator &table_get_oper, unique_ptr<PhysicalOperator> &oper)
+{
+  vector<unique_ptr<Expression>> &predicates = table_get_oper.predicates();
+  Table *table = table_get_oper.table();
+
+  IndexScanRange range;
+  if (choose_index(table, predicates, range)) {
+    IndexScanPhysicalOperator *index_scan_oper = create_index_scan(table_get_oper, range);
+    bind_table_cells(predicates, table);
     index_scan_oper->set_predicates(std::move(predicates));
     oper = unique_ptr<PhysicalOperator>(index_scan_oper);
     LOG_TRACE("use index scan");
   } else {
     auto table_scan_oper = new TableScanPhysicalOperator(table, table_get_oper.readonly());
+    table_scan_oper->set_output_fields(table_get_oper.fields());
+    bind_table_cells(predicates, table);
     table_scan_oper->set_predicates(std::move(predicates));
     oper = unique_ptr<PhysicalOperator>(table_scan_oper);
     LOG_TRACE("use table scan");
@@ -152,6 +484,11 @@ RC PhysicalPlanGenerator::create_plan(TableGetLogicalOperator &table_get_oper, u
 RC PhysicalPlanGenerator::create_plan(PredicateLogicalOperator &pred_oper, unique_ptr<PhysicalOperator> &oper)
 {
   vector<unique_ptr<LogicalOperator>> &children_opers = pred_oper.children();
+  if (children_opers.empty()) {
+    // 条件恒为false，见 PredicateRewriteRule
+    oper = make_unique<PredicatePhysicalOperator>(std::move(pred_oper.expressions().front()));
+    return RC::SUCCESS;
+  }
   ASSERT(children_opers.size() == 1, "predicate logical operator's sub oper number should be 1");
 
   LogicalOperator &child_oper = *children_opers.front();
@@ -167,11 +504,45 @@ RC PhysicalPlanGenerator::create_plan(PredicateLogicalOperator &pred_oper, uniqu
   ASSERT(expressions.size() == 1, "predicate logical operator's children should be 1");
 
   unique_ptr<Expression> expression = std::move(expressions.front());
+  bind_tuple_cells(expression.get(), *child_phy_oper);
   oper = unique_ptr<PhysicalOperator>(new PredicatePhysicalOperator(std::move(expression)));
   oper->add_child(std::move(child_phy_oper));
   return rc;
 }
 
+/**
+ * @brief 创建投影的物理算子
+ * @details 投影的表达式只有字段和聚合函数，聚合函数按照名字引用子算子的输出
+ */
+static unique_ptr<PhysicalOperator> create_project_oper(
+    ProjectLogicalOperator &project_oper, unique_ptr<PhysicalOperator> child_phy_oper)
+{
+  ProjectPhysicalOperator *project_operator = new ProjectPhysicalOperator;
+  const vector<Field> &project_fields = project_oper.fields();
+  for (const Field &field : project_fields) {
+    project_operator->add_projection(field.table(), field.meta());
+  }
+  for (const unique_ptr<Expression> &expr : project_oper.expressions()) {
+    if (expr->type() == ExprType::FIELD) {
+      const Field &field = static_cast<FieldExpr *>(expr.get())->field();
+      project_operator->add_projection(field.table(), field.meta());
+    } else {
+      project_operator->add_projection(expr->name().c_str());
+    }
+  }
+
+  if (child_phy_oper) {
+    TupleSchema child_schema;
+    if (OB_SUCC(child_phy_oper->tuple_schema(child_schema))) {
+      project_operator->bind_cells(child_schema);
+    }
+    project_operator->add_child(std::move(child_phy_oper));
+  }
+
+  LOG_TRACE("create a project physical operator");
+  return unique_ptr<PhysicalOperator>(project_operator);
+}
+
 RC PhysicalPlanGenerator::create_plan(ProjectLogicalOperator &project_oper, unique_ptr<PhysicalOperator> &oper)
 {
   vector<unique_ptr<LogicalOperator>> &child_opers = project_oper.children();
@@ -181,26 +552,14 @@ RC PhysicalPlanGenerator::create_plan(ProjectLogicalOperator &project_oper, uniq
   RC rc = RC::SUCCESS;
   if (!child_opers.empty()) {
     LogicalOperator *child_oper = child_opers.front().get();
-    rc = create(*child_oper, child_phy_oper);
+    rc = create_gather_plan(*child_oper, child_phy_oper);
     if (rc != RC::SUCCESS) {
       LOG_WARN("failed to create project logical operator's child physical operator. rc=%s", strrc(rc));
       return rc;
     }
   }
 
-  ProjectPhysicalOperator *project_operator = new ProjectPhysicalOperator;
-  const vector<Field> &project_fields = project_oper.fields();
-  for (const Field &field : project_fields) {
-    project_operator->add_projection(field.table(), field.meta());
-  }
-
-  if (child_phy_oper) {
-    project_operator->add_child(std::move(child_phy_oper));
-  }
-
-  oper = unique_ptr<PhysicalOperator>(project_operator);
-
-  LOG_TRACE("create a project physical operator");
+  oper = create_project_oper(project_oper, std::move(child_phy_oper));
   return rc;
 }
 
@@ -242,7 +601,7 @@ RC PhysicalPlanGenerator::create_plan(ExplainLogicalOperator &explain_oper, uniq
   vector<unique_ptr<LogicalOperator>> &child_opers = explain_oper.children();
 
   RC rc = RC::SUCCESS;
-  unique_ptr<PhysicalOperator> explain_physical_oper(new ExplainPhysicalOperator);
+  unique_ptr<PhysicalOperator> explain_physical_oper(new ExplainPhysicalOperator(explain_oper.analyze()));
   for (unique_ptr<LogicalOperator> &child_oper : child_opers) {
     unique_ptr<PhysicalOperator> child_physical_oper;
     rc = create(*child_oper, child_physical_oper);
@@ -258,6 +617,256 @@ RC PhysicalPlanGenerator::create_plan(ExplainLogicalOperator &explain_oper, uniq
   return rc;
 }
 
+/**
+ * @brief 判断连接条件是否可以作为hash join的key，即 左边的字段 = 右边的字段
+ * @details 浮点数的相等比较有误差范围，不能使用hash，类型不同的字段也不使用hash
+ * @param left_tables 连接左侧访问的表
+ * @param[out] left_key 可以作为key时，返回左侧的字段表达式
+ * @param[out] right_key 可以作为key时，返回右侧的字段表达式
+ */
+static bool extract_join_key(unique_ptr<Expression> &expr, const set<const Table *> &left_tables,
+    unique_ptr<Expression> &left_key, unique_ptr<Expression> &right_key)
+{
+  if (expr->type() != ExprType::COMPARISON) {
+    return false;
+  }
+
+  auto comparison_expr = static_cast<ComparisonExpr *>(expr.get());
+  unique_ptr<Expression> &left = comparison_expr->left();
+  unique_ptr<Expression> &right = comparison_expr->right();
+  if (comparison_expr->comp() != EQUAL_TO || left->type() != ExprType::FIELD || right->type() != ExprType::FIELD) {
+    return false;
+  }
+
+  if (left->value_type() != right->value_type() || left->value_type() == FLOATS) {
+    return false;
+  }
+
+  const bool left_in_left = left_tables.count(static_cast<FieldExpr *>(left.get())->field().table()) > 0;
+  const bool right_in_left = left_tables.count(static_cast<FieldExpr *>(right.get())->field().table()) > 0;
+  if (left_in_left == right_in_left) {
+    return false;
+  }
+
+  left_key = std::move(left_in_left ? left : right);
+  right_key = std::move(left_in_left ? right : left);
+  return true;
+}
+
+/**
+ * @brief 当前会话中单个算子可以使用的内存
+ */
+static int64_t operator_memory_limit()
+{
+  Session *session = Session::current_session();
+  return session != nullptr ? session->operator_memory_limit() : Session::DEFAULT_OPERATOR_MEMORY_LIMIT;
+}
+
+/**
+ * @brief 找到逻辑算子中的表扫描，中间只允许有过滤条件，它们不会改变数据的顺序
+ */
+static TableGetLogicalOperator *find_table_get(LogicalOperator &oper)
+{
+  if (oper.type() == LogicalOperatorType::TABLE_GET) {
+    return static_cast<TableGetLogicalOperator *>(&oper);
+  }
+  if (oper.type() == LogicalOperatorType::PREDICATE && oper.children().size() == 1) {
+    return find_table_get(*oper.children().front());
+  }
+  return nullptr;
+}
+
+/**
+ * @brief 判断逻辑算子是否可以通过索引扫描按照key的顺序输出
+ * @details 如果表上有其它索引可以做等值查询，就不使用key上的索引，因为等值查询的数据量更少
+ * @return 可以按顺序输出时返回使用的索引，否则返回空
+ */
+static Index *find_ordered_index(LogicalOperator &oper, const Expression &key)
+{
+  if (key.type() != ExprType::FIELD) {
+    return nullptr;
+  }
+
+  TableGetLogicalOperator *table_get_oper = find_table_get(oper);
+  const Field &field = static_cast<const FieldExpr &>(key).field();
+  if (table_get_oper == nullptr || table_get_oper->table() != field.table()) {
+    return nullptr;
+  }
+
+  Table *table = table_get_oper->table();
+  Index *index = table->find_index_by_field(field.field_name());
+  if (index == nullptr) {
+    return nullptr;
+  }
+
+  // 其它索引上可以做等值查询时，扫描的数据很少，不使用排序字段上的索引
+  IndexScanRange range;
+  if (choose_index(table, table_get_oper->predicates(), range) && range.index != index && range.is_point()) {
+    return nullptr;
+  }
+  return index;
+}
+
+RC PhysicalPlanGenerator::create_ordered_plan(LogicalOperator &logical_oper, Index *index, unique_ptr<PhysicalOperator> &oper)
+{
+  if (logical_oper.type() == LogicalOperatorType::PREDICATE) {
+    unique_ptr<PhysicalOperator> child_phy_oper;
+    RC rc = create_ordered_plan(*logical_oper.children().front(), index, child_phy_oper);
+    if (OB_FAIL(rc)) {
+      return rc;
+    }
+
+    vector<unique_ptr<Expression>> &expressions = logical_oper.expressions();
+    ASSERT(expressions.size() == 1, "predicate logical operator's children should be 1");
+    bind_tuple_cells(expressions, *child_phy_oper);
+    oper.reset(new PredicatePhysicalOperator(std::move(expressions.front())));
+    oper->add_child(std::move(child_phy_oper));
+    return rc;
+  }
+
+  ASSERT(logical_oper.type() == LogicalOperatorType::TABLE_GET, "ordered plan should be created on table get");
+  auto &table_get_oper = static_cast<TableGetLogicalOperator &>(logical_oper);
+  vector<unique_ptr<Expression>> &predicates = table_get_oper.predicates();
+  Table *table = table_get_oper.table();
+
+  // 索引字段上有范围条件时只扫描这个范围，否则扫描整个索引
+  IndexScanRange range;
+  range.index = index;
+  for (IndexScanRange &index_range : collect_index_ranges(table, predicates)) {
+    if (index_range.index == index && !index_range.is_empty()) {
+      range = std::move(index_range);
+    }
+  }
+
+  IndexScanPhysicalOperator *index_scan_oper = create_index_scan(table_get_oper, range);
+  bind_table_cells(predicates, table);
+  index_scan_oper->set_predicates(std::move(predicates));
+  oper.reset(index_scan_oper);
+  return RC::SUCCESS;
+}
+
+/**
+ * @brief 找到逻辑算子中连接字段上的索引，用于index nested loop join的内表
+ */
+static Index *find_inner_index(LogicalOperator &oper, const Expression &key)
+{
+  if (key.type() != ExprType::FIELD) {
+    return nullptr;
+  }
+
+  TableGetLogicalOperator *table_get_oper = find_table_get(oper);
+  const Field &field = static_cast<const FieldExpr &>(key).field();
+  if (table_get_oper == nullptr || table_get_oper->table() != field.table()) {
+    return nullptr;
+  }
+  return table_get_oper->table()->find_index_by_field(field.field_name());
+}
+
+/**
+ * @brief 判断外表的数据量是否足够小，可以对每一行在内表的索引上查找
+ * @details 外表可以通过索引做等值查询，或者估算的行数远小于内表时，认为外表很小
+ */
+static bool is_small_outer(LogicalOperator &outer, LogicalOperator &inner)
+{
+  static constexpr double SMALL_OUTER_RATIO = 16;
+
+  TableGetLogicalOperator *table_get_oper = find_table_get(outer);
+  if (table_get_oper != nullptr) {
+    IndexScanRange range;
+    if (choose_index(table_get_oper->table(), table_get_oper->predicates(), range) && range.is_point()) {
+      return true;
+    }
+  }
+  return CardinalityEstimator::estimate_rows(outer) * SMALL_OUTER_RATIO <= CardinalityEstimator::estimate_rows(inner);
+}
+
+/**
+ * @brief 取出内表上所有的过滤条件，包括表扫描上面的过滤算子中的条件
+ */
+static void collect_inner_predicates(LogicalOperator &oper, vector<unique_ptr<Expression>> &predicates)
+{
+  vector<unique_ptr<Expression>> &exprs = oper.type() == LogicalOperatorType::TABLE_GET
+                                              ? static_cast<TableGetLogicalOperator &>(oper).predicates()
+                                              : oper.expressions();
+  for (unique_ptr<Expression> &expr : exprs) {
+    predicates.emplace_back(std::move(expr));
+  }
+  exprs.clear();
+
+  for (unique_ptr<LogicalOperator> &child : oper.children()) {
+    collect_inner_predicates(*child, predicates);
+  }
+}
+
+/**
+ * @brief 在hash join的probe端查找读取指定表的扫描算子
+ * @details 只穿过过滤和连接算子，它们输出的key值一定来自下面的扫描，在扫描上丢弃的行不会影响连接结果
+ */
+static void find_probe_scans(PhysicalOperator &oper, const Table *table, vector<PhysicalOperator *> &scans)
+{
+  switch (oper.type()) {
+    case PhysicalOperatorType::TABLE_SCAN: {
+      if (static_cast<TableScanPhysicalOperator &>(oper).table() == table) {
+        scans.push_back(&oper);
+      }
+    } break;
+    case PhysicalOperatorType::INDEX_SCAN: {
+      if (static_cast<IndexScanPhysicalOperator &>(oper).table() == table) {
+        scans.push_back(&oper);
+      }
+    } break;
+    case PhysicalOperatorType::PREDICATE:
+    case PhysicalOperatorType::NESTED_LOOP_JOIN:
+    case PhysicalOperatorType::HASH_JOIN:
+    case PhysicalOperatorType::MERGE_JOIN:
+    case PhysicalOperatorType::INDEX_NESTED_LOOP_JOIN: {
+      for (unique_ptr<PhysicalOperator> &child : oper.children()) {
+        find_probe_scans(*child, table, scans);
+      }
+    } break;
+    default: break;
+  }
+}
+
+/**
+ * @brief 把hash join build端生成的运行时过滤条件下推到probe端的扫描算子上
+ * @details probe端的key都是同一个表的字段，并且probe端只有一个扫描读取这个表时才下推。
+ * 需要在hash join添加了子算子之后调用
+ */
+static void push_down_runtime_filter(HashJoinPhysicalOperator &join_oper)
+{
+  const Table *table = nullptr;
+  vector<const FieldMeta *> key_fields;
+  for (const unique_ptr<Expression> &key : join_oper.probe_keys()) {
+    if (key->type() != ExprType::FIELD) {
+      return;
+    }
+
+    const Field &field = static_cast<const FieldExpr &>(*key).field();
+    if (table != nullptr && table != field.table()) {
+      return;
+    }
+    table = field.table();
+    key_fields.push_back(field.meta());
+  }
+
+  vector<PhysicalOperator *> scans;
+  if (table != nullptr) {
+    find_probe_scans(*join_oper.children()[join_oper.build_left() ? 1 : 0], table, scans);
+  }
+  if (scans.size() != 1) {
+    return;
+  }
+
+  shared_ptr<RuntimeFilter> filter = join_oper.create_runtime_filter();
+  if (scans.front()->type() == PhysicalOperatorType::TABLE_SCAN) {
+    static_cast<TableScanPhysicalOperator *>(scans.front())->add_runtime_filter(filter, key_fields);
+  } else {
+    static_cast<IndexScanPhysicalOperator *>(scans.front())->add_runtime_filter(filter, key_fields);
+  }
+  LOG_TRACE("push down runtime filter to %s. keys=%d", table->name(), static_cast<int>(key_fields.size()));
+}
+
 RC PhysicalPlanGenerator::create_plan(JoinLogicalOperator &join_oper, unique_ptr<PhysicalOperator> &oper)
 {
   RC rc = RC::SUCCESS;
@@ -268,27 +877,947 @@ RC PhysicalPlanGenerator::create_plan(JoinLogicalOperator &join_oper, unique_ptr
     return RC::INTERNAL;
   }
 
-  unique_ptr<PhysicalOperator> join_physical_oper(new NestedLoopJoinPhysicalOperator);
-  for (auto &child_oper : child_opers) {
+  // 连接条件中 左表字段 = 右表字段 的部分作为hash join的key，其它的在连接之后过滤
+  set<const Table *> left_tables;
+  child_opers[0]->collect_tables(left_tables);
+
+  vector<unique_ptr<Expression>> left_keys;
+  vector<unique_ptr<Expression>> right_keys;
+  vector<unique_ptr<Expression>> other_exprs;
+  for (unique_ptr<Expression> &expr : join_oper.expressions()) {
+    unique_ptr<Expression> left_key;
+    unique_ptr<Expression> right_key;
+    if (extract_join_key(expr, left_tables, left_key, right_key)) {
+      left_keys.emplace_back(std::move(left_key));
+      right_keys.emplace_back(std::move(right_key));
+    } else {
+      other_exprs.emplace_back(std::move(expr));
+    }
+  }
+  join_oper.expressions().clear();
+
+  // 生成子算子的物理计划会取走表扫描上的过滤条件，需要提前估算两侧的行数
+  const double left_rows  = CardinalityEstimator::estimate_rows(*child_opers[0]);
+  const double right_rows = CardinalityEstimator::estimate_rows(*child_opers[1]);
+
+  // 一侧数据量很小，另一侧在连接字段上有索引时，使用index nested loop join
+  int    inner_key   = -1;
+  int    inner_side  = -1;
+  Index *inner_index = nullptr;
+  for (size_t i = 0; i < left_keys.size() && inner_key < 0; i++) {
+    for (int side : {1, 0}) {
+      Expression &key = side == 0 ? *left_keys[i] : *right_keys[i];
+      inner_index = find_inner_index(*child_opers[side], key);
+      if (inner_index != nullptr && is_small_outer(*child_opers[1 - side], *child_opers[side])) {
+        inner_key  = static_cast<int>(i);
+        inner_side = side;
+        break;
+      }
+    }
+  }
+
+  // 两侧都可以通过连接key上的索引按顺序扫描时，使用merge join，不需要额外的内存
+  int    merge_key   = -1;
+  Index *left_index  = nullptr;
+  Index *right_index = nullptr;
+  for (size_t i = 0; i < left_keys.size() && merge_key < 0 && inner_key < 0; i++) {
+    left_index  = find_ordered_index(*child_opers[0], *left_keys[i]);
+    right_index = find_ordered_index(*child_opers[1], *right_keys[i]);
+    if (left_index != nullptr && right_index != nullptr) {
+      merge_key = static_cast<int>(i);
+    }
+  }
+
+  vector<unique_ptr<PhysicalOperator>> child_physical_opers;
+  for (size_t i = 0; i < child_opers.size(); i++) {
+    if (static_cast<int>(i) == inner_side) {
+      // 内表直接通过索引访问
+      continue;
+    }
+
     unique_ptr<PhysicalOperator> child_physical_oper;
-    rc = create(*child_oper, child_physical_oper);
+    if (merge_key >= 0) {
+      rc = create_ordered_plan(*child_opers[i], i == 0 ? left_index : right_index, child_physical_oper);
+    } else {
+      rc = create(*child_opers[i], child_physical_oper);
+    }
     if (rc != RC::SUCCESS) {
       LOG_WARN("failed to create physical child oper. rc=%s", strrc(rc));
       return rc;
     }
 
-    join_physical_oper->add_child(std::move(child_physical_oper));
+    child_physical_opers.emplace_back(std::move(child_physical_oper));
   }
 
-  oper = std::move(join_physical_oper);
-  return rc;
-}
+  // index nested loop join和merge join只使用一个key，其它的key作为普通的连接条件
+  const int single_key = inner_key >= 0 ? inner_key : merge_key;
+  unique_ptr<Expression> single_left_key;
+  unique_ptr<Expression> single_right_key;
+  if (single_key >= 0) {
+    single_left_key  = std::move(left_keys[single_key]);
+    single_right_key = std::move(right_keys[single_key]);
+    for (size_t i = 0; i < left_keys.size(); i++) {
+      if (static_cast<int>(i) != single_key) {
+        other_exprs.emplace_back(new ComparisonExpr(EQUAL_TO, std::move(left_keys[i]), std::move(right_keys[i])));
+      }
+    }
+    left_keys.clear();
+    right_keys.clear();
+  }
 
-RC PhysicalPlanGenerator::create_plan(CalcLogicalOperator &logical_oper, std::unique_ptr<PhysicalOperator> &oper)
-{
-  RC rc = RC::SUCCESS;
-  CalcPhysicalOperator *calc_oper = new CalcPhysicalOperator(std::move(logical_oper.expressions()));
-  oper.reset(calc_oper);
-  return rc;
-}
+  unique_ptr<Expression> other_predicate;
+  if (other_exprs.size() == 1) {
+    other_predicate = std::move(other_exprs.front());
+  } else if (other_exprs.size() > 1) {
+    other_predicate.reset(new ConjunctionExpr(ConjunctionExpr::Type::AND, other_exprs));
+  }
+  // 其它条件在连接的结果上计算，连接算子创建之后再绑定
+  Expression *other_predicate_ptr = other_predicate.get();
+
+  // 连接key分别在两侧的tuple上计算。index nested loop join只有外表一个子算子
+  if (inner_key >= 0) {
+    bind_tuple_cells(inner_side == 0 ? single_right_key.get() : single_left_key.get(), *child_physical_opers[0]);
+  } else if (merge_key >= 0) {
+    bind_tuple_cells(single_left_key.get(), *child_physical_opers[0]);
+    bind_tuple_cells(single_right_key.get(), *child_physical_opers[1]);
+  } else if (!left_keys.empty()) {
+    bind_tuple_cells(left_keys, *child_physical_opers[0]);
+    bind_tuple_cells(right_keys, *child_physical_opers[1]);
+  }
+
+  unique_ptr<PhysicalOperator> join_physical_oper;
+  if (inner_key >= 0) {
+    auto &inner_table_get = *find_table_get(*child_opers[inner_side]);
+    vector<unique_ptr<Expression>> inner_predicates;
+    collect_inner_predicates(*child_opers[inner_side], inner_predicates);
+    bind_table_cells(inner_predicates, inner_table_get.table());
+
+    auto index_join_oper = new IndexNestedLoopJoinPhysicalOperator(inner_table_get.table(),
+        inner_index,
+        inner_table_get.readonly(),
+        std::move(inner_side == 0 ? single_right_key : single_left_key),
+        inner_side == 0);
+    index_join_oper->set_inner_fields(inner_table_get.fields());
+    index_join_oper->set_inner_predicates(std::move(inner_predicates));
+    join_physical_oper.reset(index_join_oper);
+    LOG_TRACE("use index nested loop join. inner_left=%d", inner_side == 0);
+  } else if (merge_key >= 0) {
+    auto merge_join_oper = new MergeJoinPhysicalOperator(std::move(single_left_key), std::move(single_right_key));
+    merge_join_oper->set_predicate(std::move(other_predicate));
+    join_physical_oper.reset(merge_join_oper);
+    LOG_TRACE("use merge join");
+  } else if (!left_keys.empty()) {
+    // 使用较小的一侧建立hash表
+    const bool build_left = left_rows <= right_rows;
+    auto hash_join_oper = new HashJoinPhysicalOperator(std::move(left_keys), std::move(right_keys), build_left);
+    hash_join_oper->set_predicate(std::move(other_predicate));
+    hash_join_oper->set_memory_limit(operator_memory_limit());
+    join_physical_oper.reset(hash_join_oper);
+    LOG_TRACE("use hash join. build_left=%d", build_left);
+  } else {
+    auto nlj_oper = new NestedLoopJoinPhysicalOperator;
+    nlj_oper->set_memory_limit(operator_memory_limit());
+    join_physical_oper.reset(nlj_oper);
+  }
+
+  for (unique_ptr<PhysicalOperator> &child_physical_oper : child_physical_opers) {
+    join_physical_oper->add_child(std::move(child_physical_oper));
+  }
+  if (join_physical_oper->type() == PhysicalOperatorType::HASH_JOIN) {
+    push_down_runtime_filter(static_cast<HashJoinPhysicalOperator &>(*join_physical_oper));
+  }
+  bind_tuple_cells(other_predicate_ptr, *join_physical_oper);
+
+  if (other_predicate) {
+    oper.reset(new PredicatePhysicalOperator(std::move(other_predicate)));
+    oper->add_child(std::move(join_physical_oper));
+  } else {
+    oper = std::move(join_physical_oper);
+  }
+  return rc;
+}
+
+/**
+ * @brief 一侧估算的行数不超过这个值时，把这一侧广播给每个并行的hash join，否则两侧都按照key重新分区
+ */
+static constexpr double PARALLEL_BROADCAST_MAX_ROWS = 10000;
+
+static vector<unique_ptr<Expression>> copy_expressions(const vector<unique_ptr<Expression>> &exprs)
+{
+  vector<unique_ptr<Expression>> result;
+  for (const unique_ptr<Expression> &expr : exprs) {
+    result.emplace_back(expr->copy());
+  }
+  return result;
+}
+
+/**
+ * @brief 判断逻辑计划能否拆分成多个处理部分数据的片段，并返回其中连接的个数
+ * @details 只支持全表扫描、过滤以及有等值条件的连接。使用索引的扫描不拆分
+ */
+static bool can_parallelize(LogicalOperator &oper, int &join_num)
+{
+  switch (oper.type()) {
+    case LogicalOperatorType::TABLE_GET: {
+      auto &table_get_oper = static_cast<TableGetLogicalOperator &>(oper);
+      IndexScanRange range;
+      return table_get_oper.readonly() && !choose_index(table_get_oper.table(), table_get_oper.predicates(), range);
+    }
+
+    case LogicalOperatorType::PREDICATE: {
+      return oper.children().size() == 1 && can_parallelize(*oper.children().front(), join_num);
+    }
+
+    case LogicalOperatorType::JOIN: {
+      set<const Table *> left_tables;
+      oper.children()[0]->collect_tables(left_tables);
+      bool has_key = false;
+      for (const unique_ptr<Expression> &expr : oper.expressions()) {
+        unique_ptr<Expression> copy = expr->copy();
+        unique_ptr<Expression> left_key;
+        unique_ptr<Expression> right_key;
+        has_key = has_key || extract_join_key(copy, left_tables, left_key, right_key);
+      }
+      join_num++;
+      return has_key && can_parallelize(*oper.children()[0], join_num) &&
+             can_parallelize(*oper.children()[1], join_num);
+    }
+
+    default: {
+      return false;
+    }
+  }
+}
+
+/**
+ * @brief 并行执行的线程数，不能并行执行时返回1
+ * @details 受会话设置、线程池大小和表的数据页面数限制。每个连接最多增加两个Exchange，
+ * 所有Exchange的生产者需要同时运行
+ */
+static int parallel_degree(LogicalOperator &oper)
+{
+  Session *session = Session::current_session();
+  ExchangeWorkerPool *pool = GCTX.exchange_worker_pool_;
+  if (session == nullptr || pool == nullptr || session->parallel_workers() <= 1) {
+    return 1;
+  }
+
+  int join_num = 0;
+  if (!can_parallelize(oper, join_num)) {
+    return 1;
+  }
+
+  set<const Table *> tables;
+  oper.collect_tables(tables);
+  int32_t max_pages = 0;
+  for (const Table *table : tables) {
+    max_pages = std::max(max_pages, table->data_page_count());
+  }
+
+  const int exchange_num = 1 + 2 * join_num;
+  return std::max(1, std::min({session->parallel_workers(), pool->thread_num() / exchange_num, max_pages}));
+}
+
+RC PhysicalPlanGenerator::create_fragments(
+    LogicalOperator &logical_oper, int dop, vector<unique_ptr<PhysicalOperator>> &fragments)
+{
+  RC rc = RC::SUCCESS;
+  switch (logical_oper.type()) {
+    case LogicalOperatorType::TABLE_GET: {
+      auto &table_get_oper = static_cast<TableGetLogicalOperator &>(logical_oper);
+      for (int i = 0; i < dop; i++) {
+        auto table_scan_oper = new TableScanPhysicalOperator(table_get_oper.table(), table_get_oper.readonly());
+        table_scan_oper->set_output_fields(table_get_oper.fields());
+        table_scan_oper->set_partition(i, dop);
+        vector<unique_ptr<Expression>> predicates = copy_expressions(table_get_oper.predicates());
+        bind_table_cells(predicates, table_get_oper.table());
+        table_scan_oper->set_predicates(std::move(predicates));
+        fragments.emplace_back(table_scan_oper);
+      }
+    } break;
+
+    case LogicalOperatorType::PREDICATE: {
+      vector<unique_ptr<PhysicalOperator>> child_fragments;
+      rc = create_fragments(*logical_oper.children().front(), dop, child_fragments);
+      if (OB_FAIL(rc)) {
+        return rc;
+      }
+
+      for (unique_ptr<PhysicalOperator> &child : child_fragments) {
+        unique_ptr<Expression> expression = logical_oper.expressions().front()->copy();
+        bind_tuple_cells(expression.get(), *child);
+        fragments.emplace_back(new PredicatePhysicalOperator(std::move(expression)));
+        fragments.back()->add_child(std::move(child));
+      }
+    } break;
+
+    case LogicalOperatorType::JOIN: {
+      rc = create_join_fragments(static_cast<JoinLogicalOperator &>(logical_oper), dop, fragments);
+    } break;
+
+    default: {
+      rc = RC::UNIMPLENMENT;
+    } break;
+  }
+  return rc;
+}
+
+/**
+ * @brief 创建Exchange，以及接收每个并行片段数据的接收者
+ * @param keys REPARTITION时每个生产者上的分区key，会绑定到生产者的输出上
+ */
+static vector<unique_ptr<PhysicalOperator>> create_exchange(ExchangeMode mode,
+    vector<unique_ptr<PhysicalOperator>> producers, const vector<unique_ptr<Expression>> &keys, int receiver_num)
+{
+  vector<vector<unique_ptr<Expression>>> partition_keys;
+  if (mode == ExchangeMode::REPARTITION) {
+    for (unique_ptr<PhysicalOperator> &producer : producers) {
+      partition_keys.emplace_back(copy_expressions(keys));
+      bind_tuple_cells(partition_keys.back(), *producer);
+    }
+  }
+
+  auto exchange = make_shared<Exchange>(mode, GCTX.exchange_worker_pool_, std::move(producers), receiver_num);
+  exchange->set_partition_keys(std::move(partition_keys));
+
+  vector<unique_ptr<PhysicalOperator>> receivers;
+  for (int i = 0; i < receiver_num; i++) {
+    receivers.emplace_back(new ExchangePhysicalOperator(exchange, i));
+  }
+  return receivers;
+}
+
+RC PhysicalPlanGenerator::create_join_fragments(
+    JoinLogicalOperator &join_oper, int dop, vector<unique_ptr<PhysicalOperator>> &fragments)
+{
+  vector<unique_ptr<LogicalOperator>> &child_opers = join_oper.children();
+  set<const Table *> left_tables;
+  child_opers[0]->collect_tables(left_tables);
+
+  vector<unique_ptr<Expression>> left_keys;
+  vector<unique_ptr<Expression>> right_keys;
+  vector<unique_ptr<Expression>> other_exprs;
+  for (unique_ptr<Expression> &expr : copy_expressions(join_oper.expressions())) {
+    unique_ptr<Expression> left_key;
+    unique_ptr<Expression> right_key;
+    if (extract_join_key(expr, left_tables, left_key, right_key)) {
+      left_keys.emplace_back(std::move(left_key));
+      right_keys.emplace_back(std::move(right_key));
+    } else {
+      other_exprs.emplace_back(std::move(expr));
+    }
+  }
+  if (left_keys.empty()) {
+    return RC::UNIMPLENMENT;
+  }
+
+  const double left_rows  = CardinalityEstimator::estimate_rows(*child_opers[0]);
+  const double right_rows = CardinalityEstimator::estimate_rows(*child_opers[1]);
+  const bool   build_left = left_rows <= right_rows;
+
+  vector<unique_ptr<PhysicalOperator>> child_fragments[2];
+  for (int side : {0, 1}) {
+    RC rc = create_fragments(*child_opers[side], dop, child_fragments[side]);
+    if (OB_FAIL(rc)) {
+      return rc;
+    }
+  }
+
+  // 较小的一侧足够小时广播给每个连接，另一侧的片段直接作为输入，否则两侧都按照key重新分区
+  vector<unique_ptr<PhysicalOperator>> inputs[2];
+  const int build_side = build_left ? 0 : 1;
+  if (std::min(left_rows, right_rows) <= PARALLEL_BROADCAST_MAX_ROWS) {
+    inputs[build_side]     = create_exchange(ExchangeMode::BROADCAST, std::move(child_fragments[build_side]), {}, dop);
+    inputs[1 - build_side] = std::move(child_fragments[1 - build_side]);
+  } else {
+    inputs[0] = create_exchange(ExchangeMode::REPARTITION, std::move(child_fragments[0]), left_keys, dop);
+    inputs[1] = create_exchange(ExchangeMode::REPARTITION, std::move(child_fragments[1]), right_keys, dop);
+  }
+
+  for (int i = 0; i < dop; i++) {
+    vector<unique_ptr<Expression>> fragment_left_keys  = copy_expressions(left_keys);
+    vector<unique_ptr<Expression>> fragment_right_keys = copy_expressions(right_keys);
+    bind_tuple_cells(fragment_left_keys, *inputs[0][i]);
+    bind_tuple_cells(fragment_right_keys, *inputs[1][i]);
+
+    auto hash_join_oper =
+        new HashJoinPhysicalOperator(std::move(fragment_left_keys), std::move(fragment_right_keys), build_left);
+    hash_join_oper->set_memory_limit(std::max<int64_t>(operator_memory_limit() / dop, 1));
+    hash_join_oper->add_child(std::move(inputs[0][i]));
+    hash_join_oper->add_child(std::move(inputs[1][i]));
+    push_down_runtime_filter(*hash_join_oper);
+
+    if (!other_exprs.empty()) {
+      unique_ptr<Expression> other_predicate;
+      vector<unique_ptr<Expression>> exprs = copy_expressions(other_exprs);
+      if (exprs.size() == 1) {
+        other_predicate = std::move(exprs.front());
+      } else {
+        other_predicate.reset(new ConjunctionExpr(ConjunctionExpr::Type::AND, exprs));
+      }
+      bind_tuple_cells(other_predicate.get(), *hash_join_oper);
+      hash_join_oper->set_predicate(std::move(other_predicate));
+    }
+    fragments.emplace_back(hash_join_oper);
+  }
+  LOG_TRACE("create parallel hash join. dop=%d, build_left=%d", dop, build_left);
+  return RC::SUCCESS;
+}
+
+RC PhysicalPlanGenerator::create_gather_plan(LogicalOperator &logical_oper, unique_ptr<PhysicalOperator> &oper)
+{
+  const int dop = parallel_degree(logical_oper);
+  vector<unique_ptr<PhysicalOperator>> fragments;
+  if (dop <= 1 || OB_FAIL(create_fragments(logical_oper, dop, fragments))) {
+    return create(logical_oper, oper);
+  }
+
+  oper = std::move(create_exchange(ExchangeMode::GATHER, std::move(fragments), {}, 1).front());
+  LOG_TRACE("create parallel plan. dop=%d", dop);
+  return RC::SUCCESS;
+}
+
+RC PhysicalPlanGenerator::create_plan(AggregateLogicalOperator &aggregate_oper, unique_ptr<PhysicalOperator> &oper)
+{
+  vector<unique_ptr<LogicalOperator>> &child_opers = aggregate_oper.children();
+  ASSERT(child_opers.size() == 1, "aggregate logical operator's sub oper number should be 1");
+
+  LogicalOperator &child_oper = *child_opers.front();
+  vector<unique_ptr<Expression>> &group_by_exprs = aggregate_oper.group_by_expressions();
+  vector<unique_ptr<Expression>> &aggregate_exprs = aggregate_oper.aggregate_expressions();
+
+  // 按照分组字段上的索引顺序读取时，相同分组的数据是连续的，可以使用流式聚合
+  Index *index = nullptr;
+  if (group_by_exprs.size() == 1) {
+    index = find_ordered_index(child_oper, *group_by_exprs.front());
+  }
+
+  // 可以并行时，每个片段先做部分聚合，汇总之后再合并相同分组的中间状态
+  const int dop = index == nullptr ? parallel_degree(child_oper) : 1;
+  vector<unique_ptr<PhysicalOperator>> fragments;
+  if (dop > 1 && OB_SUCC(create_fragments(child_oper, dop, fragments))) {
+    vector<unique_ptr<PhysicalOperator>> partial_opers;
+    for (unique_ptr<PhysicalOperator> &fragment : fragments) {
+      vector<unique_ptr<Expression>> partial_group_by_exprs  = copy_expressions(group_by_exprs);
+      vector<unique_ptr<Expression>> partial_aggregate_exprs = copy_expressions(aggregate_exprs);
+      bind_tuple_cells(partial_group_by_exprs, *fragment);
+      bind_tuple_cells(partial_aggregate_exprs, *fragment);
+      if (group_by_exprs.empty()) {
+        partial_opers.emplace_back(new StreamAggregatePhysicalOperator(
+            std::move(partial_group_by_exprs), std::move(partial_aggregate_exprs), AggregateMode::PARTIAL));
+      } else {
+        auto hash_aggregate_oper = new HashAggregatePhysicalOperator(
+            std::move(partial_group_by_exprs), std::move(partial_aggregate_exprs), AggregateMode::PARTIAL);
+        hash_aggregate_oper->set_memory_limit(std::max<int64_t>(operator_memory_limit() / dop, 1));
+        partial_opers.emplace_back(hash_aggregate_oper);
+      }
+      partial_opers.back()->add_child(std::move(fragment));
+    }
+
+    // FINAL按照位置读取中间状态，不需要绑定
+    if (group_by_exprs.empty()) {
+      oper.reset(new StreamAggregatePhysicalOperator(
+          std::move(group_by_exprs), std::move(aggregate_exprs), AggregateMode::FINAL));
+    } else {
+      auto hash_aggregate_oper = new HashAggregatePhysicalOperator(
+          std::move(group_by_exprs), std::move(aggregate_exprs), AggregateMode::FINAL);
+      hash_aggregate_oper->set_memory_limit(operator_memory_limit());
+      oper.reset(hash_aggregate_oper);
+    }
+    oper->add_child(std::move(create_exchange(ExchangeMode::GATHER, std::move(partial_opers), {}, 1).front()));
+    LOG_TRACE("create parallel aggregate. dop=%d", dop);
+    return RC::SUCCESS;
+  }
+
+  RC rc = RC::SUCCESS;
+  unique_ptr<PhysicalOperator> child_phy_oper;
+  if (index != nullptr) {
+    rc = create_ordered_plan(child_oper, index, child_phy_oper);
+  } else {
+    rc = create(child_oper, child_phy_oper);
+  }
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to create aggregate logical operator's child physical operator. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  bind_tuple_cells(group_by_exprs, *child_phy_oper);
+  bind_tuple_cells(aggregate_exprs, *child_phy_oper);
+  if (group_by_exprs.empty() || index != nullptr) {
+    oper.reset(new StreamAggregatePhysicalOperator(std::move(group_by_exprs), std::move(aggregate_exprs)));
+  } else {
+    auto hash_aggregate_oper = new HashAggregatePhysicalOperator(std::move(group_by_exprs), std::move(aggregate_exprs));
+    hash_aggregate_oper->set_memory_limit(operator_memory_limit());
+    oper.reset(hash_aggregate_oper);
+  }
+  oper->add_child(std::move(child_phy_oper));
+  return rc;
+}
+
+RC PhysicalPlanGenerator::create_plan(SortLogicalOperator &sort_oper, unique_ptr<PhysicalOperator> &oper)
+{
+  vector<unique_ptr<LogicalOperator>> &child_opers = sort_oper.children();
+  ASSERT(child_opers.size() == 1, "sort logical operator's sub oper number should be 1");
+
+  unique_ptr<PhysicalOperator> child_phy_oper;
+  RC rc = create_gather_plan(*child_opers.front(), child_phy_oper);
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to create sort logical operator's child physical operator. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  bind_tuple_cells(sort_oper.sort_expressions(), *child_phy_oper);
+  auto sort_phy_oper = make_unique<SortPhysicalOperator>(std::move(sort_oper.sort_expressions()), sort_oper.ascending());
+  sort_phy_oper->set_memory_limit(operator_memory_limit());
+  sort_phy_oper->add_child(std::move(child_phy_oper));
+  oper = std::move(sort_phy_oper);
+  return rc;
+}
+
+/**
+ * @brief 把limit下推到批量读取数据的表扫描算子
+ * @details 按行执行的算子本来就是上层需要一行才读取一行，limit算子输出足够的行之后就不再读取。
+ * 向量化的表扫描每次读取一批数据，需要知道limit才能少读。
+ * 只能穿过与输入一一对应的算子下推，遇到会过滤或者改变行数的算子就停止。
+ */
+static void push_down_limit(PhysicalOperator &oper, int64_t limit)
+{
+  switch (oper.type()) {
+    case PhysicalOperatorType::TABLE_SCAN_VEC: {
+      static_cast<TableScanVecPhysicalOperator &>(oper).set_limit(limit);
+    } break;
+    case PhysicalOperatorType::PROJECT:
+    case PhysicalOperatorType::PROJECT_VEC:
+    case PhysicalOperatorType::VEC_TO_ROW: {
+      if (!oper.children().empty()) {
+        push_down_limit(*oper.children().front(), limit);
+      }
+    } break;
+    default: break;
+  }
+}
+
+RC PhysicalPlanGenerator::create_plan(LimitLogicalOperator &limit_oper, unique_ptr<PhysicalOperator> &oper)
+{
+  return create_limit_plan(limit_oper, false /*vectorized*/, oper);
+}
+
+RC PhysicalPlanGenerator::create_limit_plan(
+    LimitLogicalOperator &limit_oper, bool vectorized, unique_ptr<PhysicalOperator> &oper)
+{
+  vector<unique_ptr<LogicalOperator>> &child_opers = limit_oper.children();
+  ASSERT(child_opers.size() == 1, "limit logical operator's sub oper number should be 1");
+
+  LogicalOperator &child_oper = *child_opers.front();
+  // 需要从子算子读取的行数
+  const int64_t rows = limit_oper.limit() < 0 ? -1 : limit_oper.limit() + limit_oper.offset();
+
+  RC rc = RC::SUCCESS;
+  unique_ptr<PhysicalOperator> child_phy_oper;
+  if (child_oper.type() == LogicalOperatorType::SORT && rows >= 0) {
+    rc = create_top_n_plan(static_cast<SortLogicalOperator &>(child_oper), rows, vectorized, child_phy_oper);
+  } else if (vectorized) {
+    rc = create_vec_row_plan(child_oper, child_phy_oper);
+  } else {
+    rc = create(child_oper, child_phy_oper);
+  }
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to create limit logical operator's child physical operator. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  if (rows >= 0) {
+    push_down_limit(*child_phy_oper, rows);
+  }
+  oper = make_unique<LimitPhysicalOperator>(limit_oper.limit(), limit_oper.offset());
+  oper->add_child(std::move(child_phy_oper));
+  return rc;
+}
+
+RC PhysicalPlanGenerator::create_top_n_plan(
+    SortLogicalOperator &sort_oper, int64_t rows, bool vectorized, unique_ptr<PhysicalOperator> &oper)
+{
+  LogicalOperator &child_oper = *sort_oper.children().front();
+  vector<unique_ptr<Expression>> &sort_exprs = sort_oper.sort_expressions();
+
+  // 索引提供了需要的顺序时不需要排序，按照索引顺序读取，limit算子读到足够的行就停止
+  if (sort_exprs.size() == 1 && sort_oper.ascending().front()) {
+    Index *index = find_ordered_index(child_oper, *sort_exprs.front());
+    if (index != nullptr) {
+      return create_ordered_plan(child_oper, index, oper);
+    }
+  }
+
+  unique_ptr<PhysicalOperator> child_phy_oper;
+  RC rc = vectorized ? create_vec_row_plan(child_oper, child_phy_oper) : create(child_oper, child_phy_oper);
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to create sort logical operator's child physical operator. rc=%s", strrc(rc));
+    return rc;
+  }
 
+  // 需要保留的行很多时，使用可以落盘的排序
+  bind_tuple_cells(sort_exprs, *child_phy_oper);
+  if (rows <= TOP_N_MAX_ROWS) {
+    oper = make_unique<TopNPhysicalOperator>(std::move(sort_exprs), sort_oper.ascending(), rows);
+  } else {
+    auto sort_phy_oper = make_unique<SortPhysicalOperator>(std::move(sort_exprs), sort_oper.ascending());
+    sort_phy_oper->set_memory_limit(operator_memory_limit());
+    oper = std::move(sort_phy_oper);
+  }
+  oper->add_child(std::move(child_phy_oper));
+  return rc;
+}
+
+RC PhysicalPlanGenerator::create_plan(CalcLogicalOperator &logical_oper, std::unique_ptr<PhysicalOperator> &oper)
+{
+  RC rc = RC::SUCCESS;
+  CalcPhysicalOperator *calc_oper = new CalcPhysicalOperator(std::move(logical_oper.expressions()));
+  oper.reset(calc_oper);
+  return rc;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// 向量化执行计划
+
+/**
+ * @brief 将表达式中的字段绑定到chunk中的列
+ * @param fields chunk中每一列对应的字段
+ */
+static RC bind_chunk_columns(Expression *expr, const vector<Field> &fields)
+{
+  if (expr == nullptr) {
+    return RC::SUCCESS;
+  }
+
+  switch (expr->type()) {
+    case ExprType::FIELD: {
+      auto field_expr = static_cast<FieldExpr *>(expr);
+      const Field &field = field_expr->field();
+      for (size_t i = 0; i < fields.size(); i++) {
+        if (fields[i].table() == field.table() && 0 == strcmp(fields[i].field_name(), field.field_name())) {
+          field_expr->set_pos(static_cast<int>(i));
+          return RC::SUCCESS;
+        }
+      }
+      LOG_WARN("cannot bind field %s.%s to chunk column", field.table_name(), field.field_name());
+      return RC::SCHEMA_FIELD_NOT_EXIST;
+    }
+    case ExprType::CAST: {
+      return bind_chunk_columns(static_cast<CastExpr *>(expr)->child().get(), fields);
+    }
+    case ExprType::COMPARISON: {
+      auto comparison_expr = static_cast<ComparisonExpr *>(expr);
+      RC rc = bind_chunk_columns(comparison_expr->left().get(), fields);
+      if (rc != RC::SUCCESS) {
+        return rc;
+      }
+      return bind_chunk_columns(comparison_expr->right().get(), fields);
+    }
+    case ExprType::CONJUNCTION: {
+      for (unique_ptr<Expression> &child : static_cast<ConjunctionExpr *>(expr)->children()) {
+        RC rc = bind_chunk_columns(child.get(), fields);
+        if (rc != RC::SUCCESS) {
+          return rc;
+        }
+      }
+      return RC::SUCCESS;
+    }
+    case ExprType::ARITHMETIC: {
+      auto arithmetic_expr = static_cast<ArithmeticExpr *>(expr);
+      RC rc = bind_chunk_columns(arithmetic_expr->left().get(), fields);
+      if (rc != RC::SUCCESS) {
+        return rc;
+      }
+      return bind_chunk_columns(arithmetic_expr->right().get(), fields);
+    }
+    case ExprType::AGGREGATION: {
+      return bind_chunk_columns(static_cast<AggregateExpr *>(expr)->child().get(), fields);
+    }
+    default: {
+      return RC::SUCCESS;
+    }
+  }
+}
+
+/**
+ * @brief 收集逻辑计划中所有表扫描输出的字段
+ */
+static void collect_table_fields(LogicalOperator &oper, vector<Field> &fields)
+{
+  if (oper.type() == LogicalOperatorType::TABLE_GET) {
+    const vector<Field> &table_fields = static_cast<TableGetLogicalOperator &>(oper).fields();
+    fields.insert(fields.end(), table_fields.begin(), table_fields.end());
+  }
+
+  for (unique_ptr<LogicalOperator> &child : oper.children()) {
+    collect_table_fields(*child, fields);
+  }
+}
+
+/**
+ * @brief 是否是条件恒为false的空计划，见 PredicateRewriteRule
+ */
+static bool is_empty_plan(LogicalOperator &oper)
+{
+  return oper.type() == LogicalOperatorType::PREDICATE && oper.children().empty();
+}
+
+RC PhysicalPlanGenerator::create_vec(LogicalOperator &logical_operator, unique_ptr<PhysicalOperator> &oper)
+{
+  switch (logical_operator.type()) {
+    case LogicalOperatorType::PROJECTION: {
+      if (logical_operator.children().empty()) {
+        return create(logical_operator, oper);
+      }
+
+      // 聚合、排序和limit按行输出，投影也按行执行
+      LogicalOperator &child_oper = *logical_operator.children().front();
+      if (child_oper.type() == LogicalOperatorType::AGGREGATION || child_oper.type() == LogicalOperatorType::SORT ||
+          child_oper.type() == LogicalOperatorType::LIMIT) {
+        unique_ptr<PhysicalOperator> child_phy_oper;
+        RC rc = create_vec_row_plan(child_oper, child_phy_oper);
+        if (OB_FAIL(rc)) {
+          return rc;
+        }
+        oper = create_project_oper(static_cast<ProjectLogicalOperator &>(logical_operator), std::move(child_phy_oper));
+        return rc;
+      }
+
+      return create_vec_row_plan(logical_operator, oper);
+    }
+
+    case LogicalOperatorType::EXPLAIN: {
+      unique_ptr<PhysicalOperator> explain_physical_oper(
+          new ExplainPhysicalOperator(static_cast<ExplainLogicalOperator &>(logical_operator).analyze()));
+      for (unique_ptr<LogicalOperator> &child_oper : logical_operator.children()) {
+        unique_ptr<PhysicalOperator> child_physical_oper;
+        RC rc = create_vec(*child_oper, child_physical_oper);
+        if (rc != RC::SUCCESS) {
+          LOG_WARN("failed to create child physical operator. rc=%s", strrc(rc));
+          return rc;
+        }
+        explain_physical_oper->add_child(std::move(child_physical_oper));
+      }
+      oper = std::move(explain_physical_oper);
+      return RC::SUCCESS;
+    }
+
+    default: {
+      return create(logical_operator, oper);
+    }
+  }
+}
+
+RC PhysicalPlanGenerator::create_vec_row_plan(LogicalOperator &logical_oper, unique_ptr<PhysicalOperator> &oper)
+{
+  switch (logical_oper.type()) {
+    case LogicalOperatorType::AGGREGATION: {
+      return create_vec_plan(static_cast<AggregateLogicalOperator &>(logical_oper), oper);
+    }
+    case LogicalOperatorType::SORT: {
+      return create_vec_plan(static_cast<SortLogicalOperator &>(logical_oper), oper);
+    }
+    case LogicalOperatorType::LIMIT: {
+      return create_limit_plan(static_cast<LimitLogicalOperator &>(logical_oper), true /*vectorized*/, oper);
+    }
+    default: break;
+  }
+
+  if (is_empty_plan(logical_oper)) {
+    // 没有数据，不需要向量化执行
+    return create(logical_oper, oper);
+  }
+
+  vector<Field> output_fields;
+  unique_ptr<PhysicalOperator> vec_oper;
+  RC rc = create_vec_plan(logical_oper, vec_oper, output_fields);
+  if (rc != RC::SUCCESS) {
+    return rc;
+  }
+
+  vector<TupleCellSpec> specs;
+  for (const Field &field : output_fields) {
+    specs.emplace_back(field.table_name(), field.field_name(), field.field_name());
+  }
+  oper = make_unique<VecToRowPhysicalOperator>(specs);
+  oper->add_child(std::move(vec_oper));
+  return rc;
+}
+
+RC PhysicalPlanGenerator::create_vec_plan(SortLogicalOperator &sort_oper, unique_ptr<PhysicalOperator> &oper)
+{
+  unique_ptr<PhysicalOperator> child_phy_oper;
+  RC rc = create_vec_row_plan(*sort_oper.children().front(), child_phy_oper);
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to create sort logical operator's child physical operator. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  bind_tuple_cells(sort_oper.sort_expressions(), *child_phy_oper);
+  auto sort_phy_oper = make_unique<SortPhysicalOperator>(std::move(sort_oper.sort_expressions()), sort_oper.ascending());
+  sort_phy_oper->set_memory_limit(operator_memory_limit());
+  sort_phy_oper->add_child(std::move(child_phy_oper));
+  oper = std::move(sort_phy_oper);
+  return rc;
+}
+
+RC PhysicalPlanGenerator::create_vec_plan(AggregateLogicalOperator &aggregate_oper, unique_ptr<PhysicalOperator> &oper)
+{
+  RC rc = RC::SUCCESS;
+  if (!aggregate_oper.group_by_expressions().empty() || is_empty_plan(*aggregate_oper.children().front())) {
+    // 分组聚合没有向量化实现
+    rc = create(aggregate_oper, oper);
+  } else {
+    vector<Field> child_fields;
+    unique_ptr<PhysicalOperator> child_phy_oper;
+    rc = create_vec_plan(*aggregate_oper.children().front(), child_phy_oper, child_fields);
+    if (OB_FAIL(rc)) {
+      LOG_WARN("failed to create aggregate logical operator's child physical operator. rc=%s", strrc(rc));
+      return rc;
+    }
+
+    vector<unique_ptr<Expression>> &aggregate_exprs = aggregate_oper.aggregate_expressions();
+    vector<TupleCellSpec> specs;
+    for (unique_ptr<Expression> &expr : aggregate_exprs) {
+      rc = bind_chunk_columns(expr.get(), child_fields);
+      if (OB_FAIL(rc)) {
+        return rc;
+      }
+      specs.emplace_back(expr->name().c_str());
+    }
+
+    auto aggregate_vec_oper = make_unique<AggregateVecPhysicalOperator>(std::move(aggregate_exprs));
+    aggregate_vec_oper->add_child(std::move(child_phy_oper));
+    oper = make_unique<VecToRowPhysicalOperator>(specs);
+    oper->add_child(std::move(aggregate_vec_oper));
+  }
+  return rc;
+}
+
+RC PhysicalPlanGenerator::create_vec_plan(
+    LogicalOperator &logical_operator, unique_ptr<PhysicalOperator> &oper, vector<Field> &output_fields)
+{
+  switch (logical_operator.type()) {
+    case LogicalOperatorType::TABLE_GET: {
+      return create_vec_plan(static_cast<TableGetLogicalOperator &>(logical_operator), oper, output_fields);
+    }
+    case LogicalOperatorType::PREDICATE: {
+      return create_vec_plan(static_cast<PredicateLogicalOperator &>(logical_operator), oper, output_fields);
+    }
+    case LogicalOperatorType::PROJECTION: {
+      return create_vec_plan(static_cast<ProjectLogicalOperator &>(logical_operator), oper, output_fields);
+    }
+    default: {
+      // 没有向量化实现的算子，按行执行后再转换为chunk
+      collect_table_fields(logical_operator, output_fields);
+
+      unique_ptr<PhysicalOperator> row_oper;
+      RC rc = create(logical_operator, row_oper);
+      if (rc != RC::SUCCESS) {
+        return rc;
+      }
+      oper = make_unique<RowToVecPhysicalOperator>(output_fields);
+      oper->add_child(std::move(row_oper));
+      return rc;
+    }
+  }
+}
+
+RC PhysicalPlanGenerator::create_vec_plan(
+    TableGetLogicalOperator &table_get_oper, unique_ptr<PhysicalOperator> &oper, vector<Field> &output_fields)
+{
+  vector<unique_ptr<Expression>> &predicates = table_get_oper.predicates();
+  Table *table = table_get_oper.table();
+
+  IndexScanRange range;
+  if (choose_index(table, predicates, range)) {
+    // 索引扫描返回的行数通常很少，没有必要向量化
+    collect_table_fields(table_get_oper, output_fields);
+    unique_ptr<PhysicalOperator> row_oper;
+    RC rc = create_plan(table_get_oper, row_oper);
+    if (rc != RC::SUCCESS) {
+      return rc;
+    }
+    oper = make_unique<RowToVecPhysicalOperator>(output_fields);
+    oper->add_child(std::move(row_oper));
+    return rc;
+  }
+
+  // 过滤条件在chunk上计算，只在过滤条件中出现的字段也需要读取
+  vector<Field> scan_fields = table_get_oper.fields();
+  for (unique_ptr<Expression> &expr : predicates) {
+    ProjectionPushdown::collect_expr_fields(expr.get(), scan_fields);
+  }
+
+  auto table_scan_oper = new TableScanVecPhysicalOperator(table, table_get_oper.readonly());
+  table_scan_oper->set_output_fields(std::move(scan_fields));
+  oper.reset(table_scan_oper);
+  output_fields = table_scan_oper->output_fields();
+
+  for (unique_ptr<Expression> &expr : predicates) {
+    RC rc = bind_chunk_columns(expr.get(), output_fields);
+    if (rc != RC::SUCCESS) {
+      return rc;
+    }
+  }
+  table_scan_oper->set_predicates(std::move(predicates));
+  LOG_TRACE("use vectorized table scan");
+  return RC::SUCCESS;
+}
+
+RC PhysicalPlanGenerator::create_vec_plan(
+    PredicateLogicalOperator &pred_oper, unique_ptr<PhysicalOperator> &oper, vector<Field> &output_fields)
+{
+  vector<unique_ptr<LogicalOperator>> &children_opers = pred_oper.children();
+  ASSERT(children_opers.size() == 1, "predicate logical operator's sub oper number should be 1");
+
+  unique_ptr<PhysicalOperator> child_phy_oper;
+  RC rc = create_vec_plan(*children_opers.front(), child_phy_oper, output_fields);
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to create child operator of predicate operator. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  vector<unique_ptr<Expression>> &expressions = pred_oper.expressions();
+  ASSERT(expressions.size() == 1, "predicate logical operator's children should be 1");
+
+  unique_ptr<Expression> expression = std::move(expressions.front());
+  rc = bind_chunk_columns(expression.get(), output_fields);
+  if (rc != RC::SUCCESS) {
+    return rc;
+  }
+
+  oper = make_unique<PredicateVecPhysicalOperator>(std::move(expression));
+  oper->add_child(std::move(child_phy_oper));
+  return rc;
+}
+
+RC PhysicalPlanGenerator::create_vec_plan(
+    ProjectLogicalOperator &project_oper, unique_ptr<PhysicalOperator> &oper, vector<Field> &output_fields)
+{
+  vector<unique_ptr<LogicalOperator>> &child_opers = project_oper.children();
+  ASSERT(child_opers.size() == 1, "project logical operator's sub oper number should be 1");
+
+  vector<Field> child_fields;
+  unique_ptr<PhysicalOperator> child_phy_oper;
+  RC rc = create_vec_plan(*child_opers.front(), child_phy_oper, child_fields);
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to create project logical operator's child physical operator. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  vector<unique_ptr<Expression>> expressions;
+  for (const Field &field : project_oper.fields()) {
+    auto field_expr = make_unique<FieldExpr>(field);
+    rc = bind_chunk_columns(field_expr.get(), child_fields);
+    if (rc != RC::SUCCESS) {
+      return rc;
+    }
+    expressions.push_back(std::move(field_expr));
+  }
+  output_fields = project_oper.fields();
+
+  oper = make_unique<ProjectVecPhysicalOperator>(std::move(expressions));
+  oper->add_child(std::move(child_phy_oper));
+  return rc;
+}
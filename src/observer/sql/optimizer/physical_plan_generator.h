@@ -28,6 +28,10 @@ class DeleteLogicalOperator;
 class ExplainLogicalOperator;
 class JoinLogicalOperator;
 class CalcLogicalOperator;
+class AggregateLogicalOperator;
+class SortLogicalOperator;
+class LimitLogicalOperator;
+class Index;
 
 /**
  * @brief 物理计划生成器
@@ -38,11 +42,24 @@ class CalcLogicalOperator;
 class PhysicalPlanGenerator 
 {
 public:
+  /**
+   * @brief limit与offset的和不超过这个值时使用Top-N算子，否则先排序再limit
+   */
+  static constexpr int64_t TOP_N_MAX_ROWS = 10000;
+
   PhysicalPlanGenerator() = default;
   virtual ~PhysicalPlanGenerator() = default;
 
   RC create(LogicalOperator &logical_operator, std::unique_ptr<PhysicalOperator> &oper);
 
+  /**
+   * @brief 生成向量化执行的物理计划
+   * @details 查询计划中有向量化实现的部分使用向量化算子，其它的部分使用按行执行的算子，
+   * 两者之间使用RowToVec算子衔接，计划的根节点使用VecToRow算子转换为按行输出。
+   * 不是查询的语句(比如insert)与create相同。
+   */
+  RC create_vec(LogicalOperator &logical_operator, std::unique_ptr<PhysicalOperator> &oper);
+
 private:
   RC create_plan(TableGetLogicalOperator &logical_oper, std::unique_ptr<PhysicalOperator> &oper);
   RC create_plan(PredicateLogicalOperator &logical_oper, std::unique_ptr<PhysicalOperator> &oper);
@@ -52,4 +69,73 @@ private:
   RC create_plan(ExplainLogicalOperator &logical_oper, std::unique_ptr<PhysicalOperator> &oper);
   RC create_plan(JoinLogicalOperator &logical_oper, std::unique_ptr<PhysicalOperator> &oper);
   RC create_plan(CalcLogicalOperator &logical_oper, std::unique_ptr<PhysicalOperator> &oper);
+  RC create_plan(AggregateLogicalOperator &logical_oper, std::unique_ptr<PhysicalOperator> &oper);
+  RC create_plan(SortLogicalOperator &logical_oper, std::unique_ptr<PhysicalOperator> &oper);
+  RC create_plan(LimitLogicalOperator &logical_oper, std::unique_ptr<PhysicalOperator> &oper);
+
+  /**
+   * @brief 生成limit的计划
+   * @param vectorized 子算子是否尽量使用向量化算子
+   */
+  RC create_limit_plan(LimitLogicalOperator &logical_oper, bool vectorized, std::unique_ptr<PhysicalOperator> &oper);
+
+  /**
+   * @brief 生成limit下面排序的计划，只需要输出排序之后的前rows行
+   * @details 有索引提供顺序时按照索引顺序读取，否则使用Top-N算子，rows太大时使用排序算子
+   */
+  RC create_top_n_plan(SortLogicalOperator &logical_oper, int64_t rows, bool vectorized,
+      std::unique_ptr<PhysicalOperator> &oper);
+
+  /**
+   * @brief 生成按照索引顺序输出的计划，用于merge join
+   * @details 逻辑算子只能是表扫描以及它上面的过滤条件
+   */
+  RC create_ordered_plan(LogicalOperator &logical_oper, Index *index, std::unique_ptr<PhysicalOperator> &oper);
+
+  /**
+   * @brief 生成并行执行的计划片段，每个片段处理一部分数据，所有片段输出的并集与串行执行的结果相同
+   * @details 表达式都是复制的，不会修改逻辑计划。不能并行执行时返回UNIMPLENMENT
+   * @param dop 片段的个数
+   */
+  RC create_fragments(
+      LogicalOperator &logical_oper, int dop, std::vector<std::unique_ptr<PhysicalOperator>> &fragments);
+
+  /**
+   * @brief 生成并行的hash join片段，较小的一侧广播给每个片段，或者两侧都按照连接key重新分区
+   */
+  RC create_join_fragments(
+      JoinLogicalOperator &logical_oper, int dop, std::vector<std::unique_ptr<PhysicalOperator>> &fragments);
+
+  /**
+   * @brief 可以并行执行时，生成多个片段并通过GATHER汇总，否则与create相同
+   */
+  RC create_gather_plan(LogicalOperator &logical_oper, std::unique_ptr<PhysicalOperator> &oper);
+
+  /**
+   * @brief 生成按行输出的计划，其中可以向量化的部分使用向量化算子
+   */
+  RC create_vec_row_plan(LogicalOperator &logical_oper, std::unique_ptr<PhysicalOperator> &oper);
+
+  /**
+   * @brief 生成聚合的计划，没有分组的聚合使用向量化的聚合算子
+   */
+  RC create_vec_plan(AggregateLogicalOperator &logical_oper, std::unique_ptr<PhysicalOperator> &oper);
+
+  /**
+   * @brief 生成排序的计划，排序按行执行，子算子尽量向量化
+   */
+  RC create_vec_plan(SortLogicalOperator &logical_oper, std::unique_ptr<PhysicalOperator> &oper);
+
+  /**
+   * @brief 生成向量化的算子
+   * @param[out] output_fields 算子输出的chunk中每一列对应的字段，列ID就是字段在其中的下标
+   */
+  RC create_vec_plan(LogicalOperator &logical_oper, std::unique_ptr<PhysicalOperator> &oper,
+      std::vector<Field> &output_fields);
+  RC create_vec_plan(TableGetLogicalOperator &logical_oper, std::unique_ptr<PhysicalOperator> &oper,
+      std::vector<Field> &output_fields);
+  RC create_vec_plan(PredicateLogicalOperator &logical_oper, std::unique_ptr<PhysicalOperator> &oper,
+      std::vector<Field> &output_fields);
+  RC create_vec_plan(ProjectLogicalOperator &logical_oper, std::unique_ptr<PhysicalOperator> &oper,
+      std::vector<Field> &output_fields);
 };
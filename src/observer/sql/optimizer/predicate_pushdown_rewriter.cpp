@@ -12,9 +12,12 @@ See the Mulan PSL v2 for more details. */
 // Created by Wangyunlai on 2022/12/30.
 //
 
+#include <algorithm>
+
 #include "sql/optimizer/predicate_pushdown_rewriter.h"
 #include "sql/operator/logical_operator.h"
 #include "sql/operator/table_get_logical_operator.h"
+#include "sql/operator/predicate_logical_operator.h"
 #include "sql/expr/expression.h"
 
 RC PredicatePushdownRewriter::rewrite(std::unique_ptr<LogicalOperator> &oper, bool &change_made)
@@ -29,6 +32,10 @@ RC PredicatePushdownRewriter::rewrite(std::unique_ptr<LogicalOperator> &oper, bo
   }
 
   std::unique_ptr<LogicalOperator> &child_oper = oper->children().front();
+  if (child_oper->type() == LogicalOperatorType::JOIN) {
+    return pushdown_to_join(oper, change_made);
+  }
+
   if (child_oper->type() != LogicalOperatorType::TABLE_GET) {
     return rc;
   }
@@ -59,7 +66,11 @@ RC PredicatePushdownRewriter::rewrite(std::unique_ptr<LogicalOperator> &oper, bo
 
   if (!pushdown_exprs.empty()) {
     change_made = true;
-    table_get_oper->set_predicates(std::move(pushdown_exprs));
+    // 连接条件下推时，同一个table get可能会经过多轮下推，这里追加而不是覆盖
+    std::vector<std::unique_ptr<Expression>> &table_predicates = table_get_oper->predicates();
+    for (std::unique_ptr<Expression> &expr : pushdown_exprs) {
+      table_predicates.emplace_back(std::move(expr));
+    }
   }
   return rc;
 }
@@ -101,9 +112,9 @@ RC PredicatePushdownRewriter::get_exprs_can_pushdown(
     // 如果是比较操作，并且比较的左边或右边是表某个列值，那么就下推下去
     auto comparison_expr = static_cast<ComparisonExpr *>(expr.get());
     CompOp comp = comparison_expr->comp();
-    if (comp != EQUAL_TO) {
-      // 简单处理，仅取等值比较。当然还可以取一些范围比较，还有 like % 等操作
-      // 其它的还有 is null 等
+    if (comp == NO_OP) {
+      // 等值和范围比较都可以下推，table get 可以用它们确定索引的扫描范围
+      // 其它的还有 like %、is null 等，现在不支持
       return rc;
     }
 
@@ -114,7 +125,8 @@ RC PredicatePushdownRewriter::get_exprs_can_pushdown(
       return rc;
     }
     if (left_expr->type() != ExprType::FIELD && left_expr->type() != ExprType::VALUE &&
-        right_expr->type() != ExprType::FIELD && right_expr->type() != ExprType::VALUE) {
+        left_expr->type() != ExprType::PARAM && right_expr->type() != ExprType::FIELD &&
+        right_expr->type() != ExprType::VALUE && right_expr->type() != ExprType::PARAM) {
       return rc;
     }
 
@@ -122,3 +134,153 @@ RC PredicatePushdownRewriter::get_exprs_can_pushdown(
   }
   return rc;
 }
+
+bool PredicatePushdownRewriter::collect_expr_tables(Expression *expr, std::set<const Table *> &tables)
+{
+  if (expr == nullptr) {
+    return true;
+  }
+
+  switch (expr->type()) {
+    case ExprType::FIELD: {
+      tables.insert(static_cast<FieldExpr *>(expr)->field().table());
+      return true;
+    }
+    case ExprType::VALUE:
+    case ExprType::PARAM: {
+      return true;
+    }
+    case ExprType::CAST: {
+      return collect_expr_tables(static_cast<CastExpr *>(expr)->child().get(), tables);
+    }
+    case ExprType::COMPARISON: {
+      auto comparison_expr = static_cast<ComparisonExpr *>(expr);
+      return collect_expr_tables(comparison_expr->left().get(), tables) &&
+             collect_expr_tables(comparison_expr->right().get(), tables);
+    }
+    case ExprType::ARITHMETIC: {
+      auto arithmetic_expr = static_cast<ArithmeticExpr *>(expr);
+      return collect_expr_tables(arithmetic_expr->left().get(), tables) &&
+             collect_expr_tables(arithmetic_expr->right().get(), tables);
+    }
+    case ExprType::CONJUNCTION: {
+      auto conjunction_expr = static_cast<ConjunctionExpr *>(expr);
+      for (const std::unique_ptr<Expression> &child : conjunction_expr->children()) {
+        if (!collect_expr_tables(child.get(), tables)) {
+          return false;
+        }
+      }
+      return true;
+    }
+    default: {
+      return false;
+    }
+  }
+}
+
+/**
+ * @brief 把predicate算子中AND连接的条件，分别下推到join树中合适的位置
+ */
+RC PredicatePushdownRewriter::pushdown_to_join(std::unique_ptr<LogicalOperator> &predicate_oper, bool &change_made)
+{
+  std::vector<std::unique_ptr<Expression>> &predicate_oper_exprs = predicate_oper->expressions();
+  if (predicate_oper_exprs.size() != 1) {
+    return RC::SUCCESS;
+  }
+
+  std::unique_ptr<LogicalOperator> &join_oper = predicate_oper->children().front();
+  std::unique_ptr<Expression> &predicate_expr = predicate_oper_exprs.front();
+  bool all_pushed = false;
+  if (predicate_expr->type() == ExprType::CONJUNCTION) {
+    auto conjunction_expr = static_cast<ConjunctionExpr *>(predicate_expr.get());
+    if (conjunction_expr->conjunction_type() == ConjunctionExpr::Type::OR) {
+      return RC::SUCCESS;
+    }
+
+    std::vector<std::unique_ptr<Expression>> &child_exprs = conjunction_expr->children();
+    for (auto iter = child_exprs.begin(); iter != child_exprs.end();) {
+      if (pushdown_to_join_child(join_oper, *iter)) {
+        change_made = true;
+        iter = child_exprs.erase(iter);
+      } else {
+        ++iter;
+      }
+    }
+    all_pushed = child_exprs.empty();
+  } else if (pushdown_to_join_child(join_oper, predicate_expr)) {
+    change_made = true;
+    all_pushed = true;
+  }
+
+  if (all_pushed) {
+    Value value((bool)true);
+    predicate_expr = std::unique_ptr<Expression>(new ValueExpr(value));
+  }
+  return RC::SUCCESS;
+}
+
+/**
+ * @brief 尝试将一个条件下推到join树中
+ * @return 下推成功返回true，这时expr已经被转移走了
+ */
+bool PredicatePushdownRewriter::pushdown_to_join_child(
+    std::unique_ptr<LogicalOperator> &oper, std::unique_ptr<Expression> &expr)
+{
+  std::set<const Table *> tables;
+  if (!collect_expr_tables(expr.get(), tables) || tables.empty()) {
+    return false;
+  }
+
+  std::set<const Table *> oper_tables;
+  oper->collect_tables(oper_tables);
+  if (!std::includes(oper_tables.begin(), oper_tables.end(), tables.begin(), tables.end())) {
+    return false;
+  }
+
+  pushdown_to(oper, expr, tables);
+  return true;
+}
+
+/**
+ * @brief 将条件放到能够计算它的最低的算子上
+ * @param oper 当前算子，它访问的表包含了tables
+ * @param tables 条件中访问的表
+ */
+void PredicatePushdownRewriter::pushdown_to(
+    std::unique_ptr<LogicalOperator> &oper, std::unique_ptr<Expression> &expr, const std::set<const Table *> &tables)
+{
+  if (oper->type() == LogicalOperatorType::JOIN) {
+    for (std::unique_ptr<LogicalOperator> &child : oper->children()) {
+      std::set<const Table *> child_tables;
+      child->collect_tables(child_tables);
+      if (std::includes(child_tables.begin(), child_tables.end(), tables.begin(), tables.end())) {
+        pushdown_to(child, expr, tables);
+        return;
+      }
+    }
+
+    // 条件涉及join两边的表，作为连接条件
+    oper->expressions().emplace_back(std::move(expr));
+    return;
+  }
+
+  if (oper->type() == LogicalOperatorType::PREDICATE) {
+    // 与已有的过滤条件合并
+    std::unique_ptr<Expression> &predicate_expr = oper->expressions().front();
+    if (predicate_expr->type() == ExprType::CONJUNCTION &&
+        static_cast<ConjunctionExpr *>(predicate_expr.get())->conjunction_type() == ConjunctionExpr::Type::AND) {
+      static_cast<ConjunctionExpr *>(predicate_expr.get())->children().emplace_back(std::move(expr));
+    } else {
+      std::vector<std::unique_ptr<Expression>> children;
+      children.emplace_back(std::move(predicate_expr));
+      children.emplace_back(std::move(expr));
+      predicate_expr.reset(new ConjunctionExpr(ConjunctionExpr::Type::AND, children));
+    }
+    return;
+  }
+
+  // 在单表的数据上增加一个过滤算子，下一轮改写时会继续下推到table get中
+  std::unique_ptr<LogicalOperator> predicate_oper(new PredicateLogicalOperator(std::move(expr)));
+  predicate_oper->add_child(std::move(oper));
+  oper = std::move(predicate_oper);
+}
@@ -14,13 +14,19 @@ See the Mulan PSL v2 for more details. */
 
 #pragma once
 
+#include <set>
 #include <vector>
 #include "sql/optimizer/rewrite_rule.h"
 
+class Table;
+
 /**
  * @brief 将一些谓词表达式下推到表数据扫描中
  * @ingroup Rewriter
- * @details 这样可以提前过滤一些数据
+ * @details 这样可以提前过滤一些数据。
+ * 如果谓词下面是连接，就把AND连接的每个条件下推到能计算它的最低的位置：
+ * 只涉及一张表的条件放到这张表上面，涉及多张表的条件作为对应join算子的连接条件，
+ * 这样物理计划就可以根据连接条件选择hash join等算法。
  */
 class PredicatePushdownRewriter : public RewriteRule 
 {
@@ -30,7 +36,18 @@ public:
 
   RC rewrite(std::unique_ptr<LogicalOperator> &oper, bool &change_made) override;
 
+  /**
+   * @brief 收集表达式中访问的表
+   * @return 表达式中有不认识的类型时返回false，这时不能确定它依赖哪些表
+   */
+  static bool collect_expr_tables(Expression *expr, std::set<const Table *> &tables);
+
 private:
   RC get_exprs_can_pushdown(
       std::unique_ptr<Expression> &expr, std::vector<std::unique_ptr<Expression>> &pushdown_exprs);
+
+  RC pushdown_to_join(std::unique_ptr<LogicalOperator> &predicate_oper, bool &change_made);
+  bool pushdown_to_join_child(std::unique_ptr<LogicalOperator> &oper, std::unique_ptr<Expression> &expr);
+  void pushdown_to(std::unique_ptr<LogicalOperator> &oper, std::unique_ptr<Expression> &expr,
+      const std::set<const Table *> &tables);
 };
@@ -39,7 +39,8 @@ RC PredicateRewriteRule::rewrite(std::unique_ptr<LogicalOperator> &oper, bool &c
 
   // 如果仅有的一个子节点是predicate
   // 并且这个子节点可以判断为恒为TRUE，那么可以省略这个子节点，并把他的子节点们（就是孙子节点）接管过来
-  // 如果可以判断恒为false，那么就可以删除子节点
+  // 如果可以判断恒为false，那么就删除predicate下面的所有算子，只留下一个没有子节点的predicate，
+  // 它表示一个空的结果集，上层算子(比如不分组的聚合)依然能够正常执行
   auto value_expr = static_cast<ValueExpr *>(expr.get());
   bool bool_value = value_expr->get_value().get_boolean();
   if (true == bool_value) {
@@ -49,10 +50,11 @@ RC PredicateRewriteRule::rewrite(std::unique_ptr<LogicalOperator> &oper, bool &c
     for (auto &grand_child_oper : grand_child_opers) {
       oper->add_child(std::move(grand_child_oper));
     }
-  } else {
-    child_opers.clear();
+    change_made = true;
+  } else if (!child_oper->children().empty()) {
+    child_oper->children().clear();
+    change_made = true;
   }
 
-  change_made = true;
   return RC::SUCCESS;
 }
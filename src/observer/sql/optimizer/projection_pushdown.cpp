@@ -0,0 +1,154 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#include <string.h>
+
+#include "sql/optimizer/projection_pushdown.h"
+#include "sql/operator/aggregate_logical_operator.h"
+#include "sql/operator/project_logical_operator.h"
+#include "sql/operator/sort_logical_operator.h"
+#include "sql/operator/table_get_logical_operator.h"
+#include "sql/expr/expression.h"
+#include "storage/table/table.h"
+#include "common/log/log.h"
+
+using namespace std;
+
+static bool contains_field(const vector<Field> &fields, const Table *table, const char *field_name)
+{
+  for (const Field &field : fields) {
+    if (field.table() == table && 0 == strcmp(field.field_name(), field_name)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void ProjectionPushdown::collect_expr_fields(Expression *expr, vector<Field> &fields)
+{
+  if (expr == nullptr) {
+    return;
+  }
+
+  switch (expr->type()) {
+    case ExprType::FIELD: {
+      const Field &field = static_cast<FieldExpr *>(expr)->field();
+      if (!contains_field(fields, field.table(), field.field_name())) {
+        fields.push_back(field);
+      }
+    } break;
+    case ExprType::CAST: {
+      collect_expr_fields(static_cast<CastExpr *>(expr)->child().get(), fields);
+    } break;
+    case ExprType::COMPARISON: {
+      auto comparison_expr = static_cast<ComparisonExpr *>(expr);
+      collect_expr_fields(comparison_expr->left().get(), fields);
+      collect_expr_fields(comparison_expr->right().get(), fields);
+    } break;
+    case ExprType::CONJUNCTION: {
+      for (unique_ptr<Expression> &child : static_cast<ConjunctionExpr *>(expr)->children()) {
+        collect_expr_fields(child.get(), fields);
+      }
+    } break;
+    case ExprType::ARITHMETIC: {
+      auto arithmetic_expr = static_cast<ArithmeticExpr *>(expr);
+      collect_expr_fields(arithmetic_expr->left().get(), fields);
+      collect_expr_fields(arithmetic_expr->right().get(), fields);
+    } break;
+    case ExprType::AGGREGATION: {
+      collect_expr_fields(static_cast<AggregateExpr *>(expr)->child().get(), fields);
+    } break;
+    default: break;
+  }
+}
+
+RC ProjectionPushdown::optimize(unique_ptr<LogicalOperator> &oper)
+{
+  if (!oper) {
+    return RC::SUCCESS;
+  }
+
+  vector<Field> fields;
+  collect_fields(*oper, fields);
+  pushdown(*oper, fields);
+  return RC::SUCCESS;
+}
+
+/**
+ * @brief 收集除了表扫描自身过滤条件之外，所有算子引用的字段
+ */
+void ProjectionPushdown::collect_fields(LogicalOperator &oper, vector<Field> &fields)
+{
+  switch (oper.type()) {
+    case LogicalOperatorType::PROJECTION: {
+      for (const Field &field : static_cast<ProjectLogicalOperator &>(oper).fields()) {
+        if (!contains_field(fields, field.table(), field.field_name())) {
+          fields.push_back(field);
+        }
+      }
+    } break;
+    case LogicalOperatorType::AGGREGATION: {
+      auto &aggregate_oper = static_cast<AggregateLogicalOperator &>(oper);
+      for (unique_ptr<Expression> &expr : aggregate_oper.group_by_expressions()) {
+        collect_expr_fields(expr.get(), fields);
+      }
+      for (unique_ptr<Expression> &expr : aggregate_oper.aggregate_expressions()) {
+        collect_expr_fields(expr.get(), fields);
+      }
+    } break;
+    case LogicalOperatorType::SORT: {
+      for (unique_ptr<Expression> &expr : static_cast<SortLogicalOperator &>(oper).sort_expressions()) {
+        collect_expr_fields(expr.get(), fields);
+      }
+    } break;
+    default: break;
+  }
+
+  // 表扫描的 expressions 是空的，过滤条件单独保存在 predicates 中
+  for (unique_ptr<Expression> &expr : oper.expressions()) {
+    collect_expr_fields(expr.get(), fields);
+  }
+
+  for (unique_ptr<LogicalOperator> &child : oper.children()) {
+    collect_fields(*child, fields);
+  }
+}
+
+void ProjectionPushdown::pushdown(LogicalOperator &oper, const vector<Field> &fields)
+{
+  if (oper.type() == LogicalOperatorType::TABLE_GET) {
+    auto &table_get_oper = static_cast<TableGetLogicalOperator &>(oper);
+    Table *table = table_get_oper.table();
+    const TableMeta &table_meta = table->table_meta();
+
+    vector<Field> table_fields;
+    for (int i = table_meta.sys_field_num(); i < table_meta.field_num(); i++) {
+      const FieldMeta *field_meta = table_meta.field(i);
+      if (contains_field(fields, table, field_meta->name())) {
+        table_fields.emplace_back(table, field_meta);
+      }
+    }
+    if (table_fields.empty() && table_meta.field_num() > table_meta.sys_field_num()) {
+      table_fields.emplace_back(table, table_meta.field(table_meta.sys_field_num()));
+    }
+
+    LOG_TRACE("pushdown projection to table %s. fields=%d/%d",
+              table->name(), static_cast<int>(table_fields.size()), table_meta.field_num() - table_meta.sys_field_num());
+    table_get_oper.set_fields(std::move(table_fields));
+  }
+
+  for (unique_ptr<LogicalOperator> &child : oper.children()) {
+    pushdown(*child, fields);
+  }
+}
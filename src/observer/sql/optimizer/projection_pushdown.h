@@ -0,0 +1,50 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+//
+// Created by agent on 2026/10/18.
+//
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "common/rc.h"
+#include "storage/field/field.h"
+
+class Expression;
+class LogicalOperator;
+
+/**
+ * @brief 把需要读取的字段下推到表扫描上
+ * @ingroup SQLStage
+ * @details 收集计划中表扫描之上的所有算子(投影、过滤、连接、聚合、排序)引用的字段，
+ * 每个表扫描只输出这些字段，不再输出表中所有的字段(包括隐藏的事务字段)。
+ * 只在表扫描自己的过滤条件中出现的字段不需要输出，扫描时直接在记录上过滤，
+ * 通过过滤之后才输出需要的字段。
+ * 字段按照在表中定义的顺序输出。没有引用任何字段时(比如 count(*))保留第一个用户字段，
+ * 这样按列执行时chunk中依然有行数。
+ */
+class ProjectionPushdown
+{
+public:
+  RC optimize(std::unique_ptr<LogicalOperator> &oper);
+
+  /**
+   * @brief 收集表达式中引用的字段，已经存在的字段不重复添加
+   */
+  static void collect_expr_fields(Expression *expr, std::vector<Field> &fields);
+
+private:
+  void collect_fields(LogicalOperator &oper, std::vector<Field> &fields);
+  void pushdown(LogicalOperator &oper, const std::vector<Field> &fields);
+};
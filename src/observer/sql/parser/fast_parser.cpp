@@ -0,0 +1,384 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <memory>
+#include <string_view>
+
+#include "sql/parser/fast_parser.h"
+
+using namespace std;
+
+namespace {
+
+/**
+ * @brief 保留的关键字，这些单词不能作为标识符
+ * @details 词法规则(lex_sql.l)中其它的关键字列在语法规则的 non_reserved_keyword 中，
+ * 与语法解析一样可以作为标识符
+ */
+constexpr string_view LEXER_KEYWORDS[] = {
+    "EXIT", "HELP", "DESC", "CREATE", "DROP", "TABLE", "TABLES", "INDEX", "ON", "SHOW", "SYNC",
+    "SELECT", "CALC", "FROM", "WHERE", "AND", "INSERT", "INTO", "VALUES", "DELETE", "UPDATE", "SET",
+    "BEGIN", "COMMIT", "ROLLBACK", "INT", "CHAR", "FLOAT", "LOAD", "DATA", "INFILE", "EXPLAIN",
+};
+
+inline bool is_blank(char ch)
+{
+  // 与词法规则保持一致，'\r'不是空白字符
+  return ch == ' ' || ch == '\t' || ch == '\b' || ch == '\f' || ch == '\n';
+}
+
+inline bool is_id_start(char ch) { return (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') || ch == '_'; }
+inline bool is_digit(char ch) { return ch >= '0' && ch <= '9'; }
+inline bool is_id_char(char ch) { return is_id_start(ch) || is_digit(ch); }
+
+bool is_keyword(string_view word)
+{
+  for (string_view keyword : LEXER_KEYWORDS) {
+    if (word.size() == keyword.size() && strncasecmp(word.data(), keyword.data(), word.size()) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * @brief 按照与lex_sql.l相同的规则切分token，直接填充到语法树中
+ * @details 所有的解析函数在不能识别时返回false，调用方放弃整个语句，不需要恢复状态。
+ * 输出参数为空时只检查语句的格式，不构造语法树
+ */
+class FastParser
+{
+public:
+  explicit FastParser(const char *sql) : sql_(sql), pos_(sql) {}
+
+  /**
+   * @details 先只检查一遍语句的格式，能够识别时再从头解析并构造语法树。
+   * 不能识别的语句在第一个不支持的写法处返回，不申请任何内存，回退到完整的语法解析时几乎没有额外的开销
+   */
+  unique_ptr<ParsedSqlNode> parse()
+  {
+    const SqlCommandFlag flag = parse_statement(nullptr);
+    if (flag == SCF_ERROR) {
+      return nullptr;
+    }
+
+    auto sql_node = make_unique<ParsedSqlNode>(flag);
+    pos_          = sql_;
+    parse_statement(sql_node.get());
+    return sql_node;
+  }
+
+private:
+  /**
+   * @return 语句的类型，不能识别时返回SCF_ERROR
+   */
+  SqlCommandFlag parse_statement(ParsedSqlNode *sql_node)
+  {
+    // 只看第一个字符就可以排除大部分其它类型的语句
+    skip_blank();
+    SqlCommandFlag flag = SCF_ERROR;
+    switch (*pos_) {
+      case 's':
+      case 'S': {
+        if (accept_keyword("SELECT") && parse_select(sql_node == nullptr ? nullptr : &sql_node->selection)) {
+          flag = SCF_SELECT;
+        }
+      } break;
+      case 'i':
+      case 'I': {
+        if (accept_keyword("INSERT") && parse_insert(sql_node == nullptr ? nullptr : &sql_node->insertion)) {
+          flag = SCF_INSERT;
+        }
+      } break;
+      case 'd':
+      case 'D': {
+        if (accept_keyword("DELETE") && parse_delete(sql_node == nullptr ? nullptr : &sql_node->deletion)) {
+          flag = SCF_DELETE;
+        }
+      } break;
+      default: break;
+    }
+    if (flag == SCF_ERROR) {
+      return SCF_ERROR;
+    }
+
+    accept(';');
+    skip_blank();
+    return *pos_ == '\0' ? flag : SCF_ERROR;
+  }
+
+  bool parse_select(SelectSqlNode *selection)
+  {
+    if (accept('*')) {
+      if (selection != nullptr) {
+        selection->attributes.emplace_back().attribute_name = "*";
+      }
+    } else {
+      do {
+        if (!parse_rel_attr(selection == nullptr ? nullptr : &selection->attributes.emplace_back())) {
+          return false;
+        }
+      } while (accept(','));
+      // 语法解析中列表是从后向前构造的，select_stmt会倒序处理
+      if (selection != nullptr) {
+        std::reverse(selection->attributes.begin(), selection->attributes.end());
+      }
+    }
+
+    string_view relation;
+    if (!accept_keyword("FROM") || !parse_identifier(relation)) {
+      return false;
+    }
+    if (selection != nullptr) {
+      selection->relations.emplace_back(relation);
+    }
+    return parse_where(selection == nullptr ? nullptr : &selection->conditions);
+  }
+
+  bool parse_insert(InsertSqlNode *insertion)
+  {
+    string_view relation;
+    if (!accept_keyword("INTO") || !parse_identifier(relation) || !accept_keyword("VALUES") || !accept('(')) {
+      return false;
+    }
+    if (insertion != nullptr) {
+      insertion->relation_name = relation;
+    }
+
+    do {
+      if (!parse_value(insertion == nullptr ? nullptr : &insertion->values.emplace_back())) {
+        return false;
+      }
+    } while (accept(','));
+    return accept(')');
+  }
+
+  bool parse_delete(DeleteSqlNode *deletion)
+  {
+    string_view relation;
+    if (!accept_keyword("FROM") || !parse_identifier(relation)) {
+      return false;
+    }
+    if (deletion != nullptr) {
+      deletion->relation_name = relation;
+    }
+    return parse_where(deletion == nullptr ? nullptr : &deletion->conditions);
+  }
+
+  bool parse_where(vector<ConditionSqlNode> *conditions)
+  {
+    if (!accept_keyword("WHERE")) {
+      return true;
+    }
+
+    do {
+      ConditionSqlNode *condition = nullptr;
+      if (conditions != nullptr) {
+        condition                = &conditions->emplace_back();
+        condition->left_is_attr  = 1;
+        condition->right_is_attr = 0;
+      }
+      if (!parse_rel_attr(condition == nullptr ? nullptr : &condition->left_attr) ||
+          !parse_comp_op(condition == nullptr ? nullptr : &condition->comp) ||
+          !parse_value(condition == nullptr ? nullptr : &condition->right_value)) {
+        return false;
+      }
+    } while (accept_keyword("AND"));
+
+    // condition_list 也是从后向前构造的
+    if (conditions != nullptr) {
+      std::reverse(conditions->begin(), conditions->end());
+    }
+    return true;
+  }
+
+  bool parse_rel_attr(RelAttrSqlNode *attr)
+  {
+    string_view name;
+    if (!parse_identifier(name)) {
+      return false;
+    }
+
+    string_view attribute;
+    const bool  has_relation = accept('.');
+    if (has_relation && !parse_identifier(attribute)) {
+      return false;
+    }
+
+    if (attr != nullptr) {
+      if (has_relation) {
+        attr->relation_name  = name;
+        attr->attribute_name = attribute;
+      } else {
+        attr->attribute_name = name;
+      }
+    }
+    return true;
+  }
+
+  bool parse_comp_op(CompOp *comp)
+  {
+    skip_blank();
+    const char ch     = pos_[0];
+    const char next   = ch == '\0' ? '\0' : pos_[1];
+    CompOp     result = NO_OP;
+    if (ch == '=') {
+      result = EQUAL_TO;
+      pos_ += 1;
+    } else if (ch == '<' && next == '=') {
+      result = LESS_EQUAL;
+      pos_ += 2;
+    } else if ((ch == '<' && next == '>') || (ch == '!' && next == '=')) {
+      result = NOT_EQUAL;
+      pos_ += 2;
+    } else if (ch == '<') {
+      result = LESS_THAN;
+      pos_ += 1;
+    } else if (ch == '>' && next == '=') {
+      result = GREAT_EQUAL;
+      pos_ += 2;
+    } else if (ch == '>') {
+      result = GREAT_THAN;
+      pos_ += 1;
+    } else {
+      return false;
+    }
+
+    if (comp != nullptr) {
+      *comp = result;
+    }
+    return true;
+  }
+
+  bool parse_value(Value *value)
+  {
+    skip_blank();
+    const char *start = pos_;
+    if (*start == '\'' || *start == '"') {
+      const char *end = strchr(start + 1, *start);
+      if (end == nullptr) {
+        return false;
+      }
+
+      const int length = static_cast<int>(end - start - 1);
+      if (value != nullptr && length > 0) {
+        value->set_string(start + 1, length);
+      } else if (value != nullptr) {
+        value->set_string("");
+      }
+      pos_ = end + 1;
+      return true;
+    }
+
+    const char *digits = (*start == '-') ? start + 1 : start;
+    if (!is_digit(*digits)) {
+      return false;
+    }
+
+    const char *end = digits;
+    while (is_digit(*end)) {
+      end++;
+    }
+    bool is_float = false;
+    if (end[0] == '.' && is_digit(end[1])) {
+      is_float = true;
+      end++;
+      while (is_digit(*end)) {
+        end++;
+      }
+    }
+    // 数字后面紧跟字母或者点时，词法规则会切分出其它的token，交给完整的语法解析报错
+    if (is_id_char(*end) || *end == '.') {
+      return false;
+    }
+
+    // atoi/atof遇到非数字字符时停止，与词法规则中对token的转换结果相同
+    if (value != nullptr && is_float) {
+      value->set_float(static_cast<float>(atof(start)));
+    } else if (value != nullptr) {
+      value->set_int(atoi(start));
+    }
+    pos_ = end;
+    return true;
+  }
+
+  bool parse_identifier(string_view &identifier)
+  {
+    skip_blank();
+    if (!is_id_start(*pos_)) {
+      return false;
+    }
+
+    const char *end = pos_ + 1;
+    while (is_id_char(*end)) {
+      end++;
+    }
+    string_view word(pos_, end - pos_);
+    if (is_keyword(word)) {
+      return false;
+    }
+    identifier = word;
+    pos_       = end;
+    return true;
+  }
+
+  bool accept_keyword(const char *keyword)
+  {
+    skip_blank();
+    const size_t length = strlen(keyword);
+    if (strncasecmp(pos_, keyword, length) != 0 || is_id_char(pos_[length])) {
+      return false;
+    }
+    pos_ += length;
+    return true;
+  }
+
+  bool accept(char ch)
+  {
+    skip_blank();
+    if (*pos_ != ch) {
+      return false;
+    }
+    pos_++;
+    return true;
+  }
+
+  void skip_blank()
+  {
+    while (is_blank(*pos_)) {
+      pos_++;
+    }
+  }
+
+private:
+  const char *sql_ = nullptr;
+  const char *pos_ = nullptr;
+};
+
+}  // namespace
+
+bool fast_parse(const char *sql, ParsedSqlResult *sql_result)
+{
+  unique_ptr<ParsedSqlNode> sql_node = FastParser(sql).parse();
+  if (sql_node == nullptr) {
+    return false;
+  }
+
+  sql_result->add_sql_node(std::move(sql_node));
+  return true;
+}
@@ -0,0 +1,33 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#pragma once
+
+#include "sql/parser/parse_defs.h"
+
+/**
+ * @brief 手写的解析器，只识别最常见的几种简单语句
+ * @ingroup SQLParser
+ * @details 点查询、插入和删除占了大部分的请求，这里直接把SQL解析到 ParsedSqlNode 中，
+ * 不经过flex和bison，也不会为每个token申请内存。可以识别的语句有：
+ * - SELECT * | col[, col...] FROM t [WHERE cond [AND cond...]]
+ * - INSERT INTO t VALUES (value[, value...])
+ * - DELETE FROM t [WHERE cond [AND cond...]]
+ * 其中cond是 col comp_op value。解析的结果与完整的语法解析完全相同(包括列表的顺序)，
+ * 遇到不认识的写法，比如参数(?)、聚合函数、多个表、保留的关键字作为标识符等，都交给完整的语法解析处理。
+ * 先检查格式再构造语法树，不能识别的语句在第一个不支持的token处放弃，不会申请内存。
+ * @return 识别成功时把解析后的语句添加到sql_result中并返回true，否则不修改sql_result并返回false
+ */
+bool fast_parse(const char *sql, ParsedSqlResult *sql_result);
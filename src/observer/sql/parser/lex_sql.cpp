@@ -386,8 +386,8 @@ static void yynoreturn yy_fatal_error ( const char* msg , yyscan_t yyscanner );
 	yyg->yy_hold_char = *yy_cp; \
 	*yy_cp = '\0'; \
 	yyg->yy_c_buf_p = yy_cp;
-#define YY_NUM_RULES 57
-#define YY_END_OF_BUFFER 58
+#define YY_NUM_RULES 69
+#define YY_END_OF_BUFFER 70
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -395,26 +395,32 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static const flex_int16_t yy_accept[166] =
+static const flex_int16_t yy_accept[221] =
     {   0,
-        0,    0,    0,    0,   58,   56,    1,    2,   56,   56,
-       56,   40,   41,   52,   50,   42,   51,    6,   53,    3,
-        5,   47,   43,   49,   39,   39,   39,   39,   39,   39,
-       39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
-       39,   57,   46,    0,   54,    0,   55,    3,    0,   44,
-       45,   48,   39,   39,   39,   39,   39,   39,   39,   39,
-       39,   39,   39,   39,   39,   39,   39,   39,   39,   15,
-       39,   39,   39,   39,   39,   39,   39,   39,    4,   22,
-       39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
-       39,   39,   39,   39,   39,   39,   39,   32,   39,   39,
-
-       39,   28,   39,   39,   39,   39,   39,   39,   39,   19,
-       33,   39,   39,   36,   39,    9,   11,    7,   39,   39,
-       20,    8,   39,   39,   39,   24,   35,   39,   39,   16,
-       17,   39,   39,   39,   39,   29,   39,   39,   39,   39,
-       34,   14,   39,   39,   39,   39,   12,   39,   39,   21,
-       30,   10,   26,   39,   37,   23,   39,   18,   13,   27,
-       25,   38,   39,   31,    0
+        0,    0,    0,    0,   70,   68,    1,    2,   68,   68,
+       68,   52,   53,   64,   62,   54,   63,    6,   65,    3,
+        5,   59,   55,   61,   51,   51,   51,   51,   51,   51,
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+       51,   51,   51,   69,   58,    0,   66,    0,   67,    3,
+        0,   56,   57,   60,   51,   51,   51,   51,   51,   40,
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+       51,   51,   51,   51,   51,   51,   15,   51,   51,   51,
+       51,   51,   51,   51,   51,   51,   51,   51,   51,    4,
+       51,   22,   42,   51,   51,   51,   51,   51,   51,   51,
+
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+       51,   51,   51,   32,   51,   51,   51,   51,   51,   51,
+       51,   28,   51,   51,   51,   51,   51,   51,   51,   51,
+       51,   51,   19,   33,   51,   51,   36,   51,   51,    9,
+       11,   51,    7,   51,   51,   20,   51,    8,   51,   51,
+       51,   24,   51,   35,   51,   51,   51,   51,   51,   16,
+       51,   17,   51,   51,   51,   51,   51,   51,   29,   51,
+       51,   51,   51,   51,   51,   34,   39,   14,   51,   51,
+       43,   51,   41,   51,   51,   51,   51,   12,   51,   49,
+       51,   21,   51,   30,   10,   51,   26,   51,   51,   37,
+
+       23,   44,   51,   51,   18,   50,   13,   27,   25,   45,
+       51,   47,   38,   46,   51,   51,   31,   51,   48,    0
     } ;
 
 static const YY_CHAR yy_ec[256] =
@@ -427,12 +433,12 @@ static const YY_CHAR yy_ec[256] =
        15,   15,   15,   15,   15,   15,   15,    1,   16,   17,
        18,   19,    1,    1,   20,   21,   22,   23,   24,   25,
        26,   27,   28,   29,   30,   31,   32,   33,   34,   35,
-       29,   36,   37,   38,   39,   40,   41,   42,   43,   29,
-        1,    1,    1,    1,   29,    1,   44,   45,   46,   47,
+       29,   36,   37,   38,   39,   40,   41,   42,   43,   44,
+        1,    1,    1,    1,   29,    1,   45,   46,   47,   48,
 
-       48,   49,   50,   51,   52,   29,   53,   54,   55,   56,
-       57,   58,   29,   59,   60,   61,   62,   63,   64,   65,
-       66,   29,    1,    1,    1,    1,    1,    1,    1,    1,
+       49,   50,   51,   52,   53,   29,   54,   55,   56,   57,
+       58,   59,   29,   60,   61,   62,   63,   64,   65,   66,
+       67,   68,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
@@ -449,7 +455,7 @@ static const YY_CHAR yy_ec[256] =
         1,    1,    1,    1,    1
     } ;
 
-static const YY_CHAR yy_meta[67] =
+static const YY_CHAR yy_meta[69] =
     {   0,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    2,    1,    1,    1,    1,    2,
@@ -457,114 +463,145 @@ static const YY_CHAR yy_meta[67] =
         2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
         2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
         2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
-        2,    2,    2,    2,    2,    2
+        2,    2,    2,    2,    2,    2,    2,    2
     } ;
 
-static const flex_int16_t yy_base[171] =
+static const flex_int16_t yy_base[226] =
     {   0,
-        0,    0,    0,    0,  435,  436,  436,  436,  416,  428,
-      426,  436,  436,  436,  436,  436,  416,  436,  436,   54,
-      436,   52,  436,  412,   53,   57,   60,   59,   58,   61,
-      406,   74,   69,   67,   73,   76,  111,   70,   78,  101,
-      112,  436,  436,  414,  436,  412,  436,  115,  402,  436,
-      436,  436,    0,  401,  117,  116,  119,  126,  128,  132,
-      129,  134,  138,  133,  140,  142,  167,  164,  166,  400,
-      169,  177,  178,  163,  188,  199,  189,  192,  399,  398,
-      190,  212,  211,  213,  217,  221,  215,  229,  214,  233,
-      235,  237,  241,  239,  238,  249,  245,  261,  244,  267,
-
-      263,  397,  264,  268,  269,  265,  273,  277,  284,  394,
-      391,  287,  288,  390,  289,  389,  388,  386,  304,  291,
-      383,  378,  292,  301,  295,  376,  375,  322,  323,  374,
-      366,  318,  315,  332,  336,  331,  326,  344,  346,  343,
-      329,  310,  348,  347,  358,  350,  360,  359,  362,  307,
-      305,  293,  240,  367,  202,  191,  364,  154,  143,  136,
-       97,   93,  122,   84,  436,  423,  425,  427,   76,   75
+        0,    0,    0,    0,  598,  599,  599,  599,  579,  591,
+      589,  599,  599,  599,  599,  599,  579,  599,  599,   56,
+      599,   54,  599,  568,   55,   59,   62,   61,   63,   64,
+       65,   60,   71,  570,  102,  108,   75,   79,  123,  112,
+      119,  125,  124,  599,  599,  579,  599,  577,  599,   78,
+      567,  599,  599,  599,    0,  565,  144,  127,  137,  564,
+      131,  128,  162,  167,  164,  178,  166,  182,  169,  180,
+      186,  156,  217,  181,  184,  197,  563,  213,  210,  190,
+      215,  228,  236,  233,  237,  234,  235,  245,  249,  561,
+      253,  560,  559,  257,  265,  256,  259,  274,  281,  278,
+
+      280,  284,  282,  292,  287,  290,  298,  288,  296,  307,
+      308,  309,  312,  313,  323,  325,  319,  339,  315,  337,
+      340,  557,  331,  343,  338,  352,  350,  354,  360,  362,
+      363,  364,  556,  555,  375,  371,  553,  369,  376,  551,
+      550,  378,  547,  395,  387,  546,  397,  545,  389,  398,
+      401,  544,  404,  543,  403,  411,  419,  429,  421,  540,
+      420,  537,  430,  431,  436,  433,  443,  445,  535,  448,
+      450,  457,  470,  458,  469,  533,  530,  502,  480,  462,
+      491,  463,  465,  466,  483,  473,  475,  490,  492,  461,
+      493,  455,  494,  405,  393,  499,  386,  508,  516,  379,
+
+      367,  260,  518,  522,  254,  204,  193,  192,  168,  154,
+      519,  138,  116,  103,  523,  525,  100,  532,   88,  599,
+      587,  589,  591,   97,   85
     } ;
 
-static const flex_int16_t yy_def[171] =
+static const flex_int16_t yy_def[226] =
     {   0,
-      165,    1,  166,  166,  165,  165,  165,  165,  165,  167,
-      168,  165,  165,  165,  165,  165,  165,  165,  165,  165,
-      165,  165,  165,  165,  169,  169,  169,  169,  169,  169,
-      169,  169,  169,  169,  169,  169,  169,  169,  169,  169,
-      169,  165,  165,  167,  165,  168,  165,  165,  165,  165,
-      165,  165,  170,  169,  169,  169,  169,  169,  169,  169,
-      169,  169,  169,  169,  169,  169,  169,  169,  169,  169,
-      169,  169,  169,  169,  169,  169,  169,  169,  165,  169,
-      169,  169,  169,  169,  169,  169,  169,  169,  169,  169,
-      169,  169,  169,  169,  169,  169,  169,  169,  169,  169,
-
-      169,  169,  169,  169,  169,  169,  169,  169,  169,  169,
-      169,  169,  169,  169,  169,  169,  169,  169,  169,  169,
-      169,  169,  169,  169,  169,  169,  169,  169,  169,  169,
-      169,  169,  169,  169,  169,  169,  169,  169,  169,  169,
-      169,  169,  169,  169,  169,  169,  169,  169,  169,  169,
-      169,  169,  169,  169,  169,  169,  169,  169,  169,  169,
-      169,  169,  169,  169,    0,  165,  165,  165,  165,  165
+      220,    1,  221,  221,  220,  220,  220,  220,  220,  222,
+      223,  220,  220,  220,  220,  220,  220,  220,  220,  220,
+      220,  220,  220,  220,  224,  224,  224,  224,  224,  224,
+      224,  224,  224,  224,  224,  224,  224,  224,  224,  224,
+      224,  224,  224,  220,  220,  222,  220,  223,  220,  220,
+      220,  220,  220,  220,  225,  224,  224,  224,  224,  224,
+      224,  224,  224,  224,  224,  224,  224,  224,  224,  224,
+      224,  224,  224,  224,  224,  224,  224,  224,  224,  224,
+      224,  224,  224,  224,  224,  224,  224,  224,  224,  220,
+      224,  224,  224,  224,  224,  224,  224,  224,  224,  224,
+
+      224,  224,  224,  224,  224,  224,  224,  224,  224,  224,
+      224,  224,  224,  224,  224,  224,  224,  224,  224,  224,
+      224,  224,  224,  224,  224,  224,  224,  224,  224,  224,
+      224,  224,  224,  224,  224,  224,  224,  224,  224,  224,
+      224,  224,  224,  224,  224,  224,  224,  224,  224,  224,
+      224,  224,  224,  224,  224,  224,  224,  224,  224,  224,
+      224,  224,  224,  224,  224,  224,  224,  224,  224,  224,
+      224,  224,  224,  224,  224,  224,  224,  224,  224,  224,
+      224,  224,  224,  224,  224,  224,  224,  224,  224,  224,
+      224,  224,  224,  224,  224,  224,  224,  224,  224,  224,
+
+      224,  224,  224,  224,  224,  224,  224,  224,  224,  224,
+      224,  224,  224,  224,  224,  224,  224,  224,  224,    0,
+      220,  220,  220,  220,  220
     } ;
 
-static const flex_int16_t yy_nxt[503] =
+static const flex_int16_t yy_nxt[668] =
     {   0,
         6,    7,    8,    9,   10,   11,   12,   13,   14,   15,
        16,   17,   18,   19,   20,   21,   22,   23,   24,   25,
-       26,   27,   28,   29,   30,   31,   32,   33,   31,   31,
-       34,   31,   31,   35,   31,   36,   37,   38,   39,   40,
-       41,   31,   31,   25,   26,   27,   28,   29,   30,   31,
-       32,   33,   31,   34,   31,   31,   35,   31,   36,   37,
-       38,   39,   40,   41,   31,   31,   49,   53,   48,   50,
-       51,   53,   53,   53,   53,   53,   53,   54,   61,   57,
-       56,   53,   62,   53,   53,   55,   58,   53,   53,   75,
-       53,   65,   53,   59,   63,   60,   66,   67,   53,   64,
-
-       69,   68,   61,   57,   56,   70,   62,   53,   55,   71,
-       58,   53,   76,   75,   65,   53,   59,   63,   60,   66,
-       77,   67,   64,   69,   68,   53,   53,   49,   70,   48,
-       53,   53,   71,   53,   72,   76,   53,   73,   78,   80,
-       53,   81,   53,   53,   77,   83,   53,   53,   53,   82,
-       53,  164,   53,   74,   53,   85,   53,   53,   72,   84,
-       90,   73,   78,   80,   87,   81,   86,   91,   53,   83,
-       88,   89,   82,   92,  164,   93,   74,   53,   53,   85,
-       53,   53,   84,   53,   90,   99,   95,   87,   96,   86,
-       91,   53,   53,   88,   89,  104,   92,   94,   93,  100,
-
-       97,   98,   53,   53,   53,   53,   53,  101,  105,   99,
-       95,  103,   96,   53,  102,  108,   53,  109,  104,  107,
-       94,  106,  100,   97,   98,   53,   53,   53,   53,   53,
-      101,   53,  105,  110,  103,   53,  113,  102,  115,  108,
-      114,  109,  107,   53,  112,  106,  111,   53,  117,   53,
-      116,   53,   53,   53,   53,   53,  120,  110,   53,   53,
-      113,  123,  115,   53,  114,  119,  127,  112,  125,  111,
-      118,  117,  121,  122,  116,   53,  124,   53,   53,   53,
-      120,   53,   53,   53,  133,  123,  129,   53,  119,  131,
-      127,   53,  125,  118,  126,  121,  122,  128,   53,  132,
-
-      124,   53,   53,   53,  130,   53,   53,   53,  133,   53,
-      129,  134,  135,  131,  137,   53,  136,  126,   53,   53,
-      128,   53,  132,  140,   53,  138,  139,  130,  141,   53,
-      144,  143,   53,  142,  134,  135,   53,   53,  137,  136,
-       53,  147,  145,   53,  146,   53,   53,  140,  138,  139,
-       53,  141,  148,  144,  143,  149,  142,   53,   53,  150,
-       53,   53,   53,  151,   53,  147,  145,  152,  146,  153,
-      154,  155,   53,   53,   53,  148,   53,  157,   53,  149,
-       53,   53,  160,  150,  156,  163,  151,  158,   53,   53,
-       53,  152,   53,  153,  154,  155,  159,   53,  161,  162,
-
-       53,  157,   53,   53,   53,   53,  160,  156,   53,  163,
-      158,   53,   53,   79,   53,   53,   79,   47,   45,  159,
-       53,  161,  162,   42,   42,   44,   44,   46,   46,   52,
-       48,   47,   45,   43,  165,    5,  165,  165,  165,  165,
-      165,  165,  165,  165,  165,  165,  165,  165,  165,  165,
-      165,  165,  165,  165,  165,  165,  165,  165,  165,  165,
-      165,  165,  165,  165,  165,  165,  165,  165,  165,  165,
-      165,  165,  165,  165,  165,  165,  165,  165,  165,  165,
-      165,  165,  165,  165,  165,  165,  165,  165,  165,  165,
-      165,  165,  165,  165,  165,  165,  165,  165,  165,  165,
-
-      165,  165
+       26,   27,   28,   29,   30,   31,   32,   33,   34,   34,
+       35,   34,   34,   36,   37,   38,   39,   40,   41,   42,
+       43,   34,   34,   34,   25,   26,   27,   28,   29,   30,
+       31,   32,   33,   34,   35,   34,   34,   36,   37,   38,
+       39,   40,   41,   42,   43,   34,   34,   34,   51,   55,
+       50,   52,   53,   55,   55,   55,   55,   55,   55,   55,
+       65,   61,   59,   72,   66,   55,   55,   57,   62,   55,
+       51,   58,   50,   55,   69,   63,   67,   64,   56,   70,
+
+       71,   60,   55,   73,   68,   65,   61,   59,   72,   66,
+       79,   57,   80,   62,   55,   58,   55,   55,   69,   63,
+       67,   64,   55,   70,   71,   60,   55,   73,   68,   74,
+       55,   85,   76,   55,   79,   75,   80,   55,   55,   55,
+       77,   55,   55,   78,   88,   55,   81,   96,   93,   82,
+       89,   55,   55,   86,   74,   87,   85,   76,   55,   75,
+       83,   95,   94,   91,   77,   84,   92,   78,   55,   88,
+       55,   81,   96,   93,   82,   89,   55,   86,   55,   87,
+       55,   55,   55,   55,   83,   95,  110,   94,   91,   84,
+       98,   92,   55,   97,   55,   55,   55,  100,   55,  103,
+
+       55,   99,  107,  116,   55,  104,   55,   55,  101,  105,
+      110,   55,  115,  108,  102,   98,  106,   97,   55,  109,
+      120,  117,  100,  103,   55,   99,  107,   55,  116,   55,
+      104,   55,  101,  119,  105,  118,  115,  108,  102,  111,
+      106,  112,   55,  109,  120,  121,  117,   55,   55,   55,
+       55,   55,  122,  113,  114,  124,  127,  126,  119,   55,
+      118,  123,  128,   55,  111,  125,  112,   55,   55,  121,
+       55,   55,  130,   55,   55,  129,  122,  113,  114,   55,
+      124,  127,  126,  131,  132,  123,  133,  128,   55,  125,
+      135,  134,   55,  136,   55,   55,   55,  130,   55,  129,
+
+      137,   55,   55,  139,   55,  140,   55,  131,  138,  132,
+       55,  133,   55,  142,  135,  134,  141,  145,  136,  146,
+      144,   55,   55,   55,  143,  137,   55,   55,  139,   55,
+      140,  149,  138,   55,  147,  151,  150,   55,  142,   55,
+      141,  148,  145,  146,  144,   55,  152,  154,  143,  157,
+      153,   55,   55,   55,   55,  155,  149,   55,  147,  162,
+      151,  150,  156,  159,   55,  148,   55,  158,   55,  164,
+      152,  160,  154,  157,   55,  153,   55,   55,   55,  155,
+      161,   55,  163,   55,  162,   55,  165,  156,  159,   55,
+       55,  158,   55,   55,  164,  160,  169,  167,  166,  172,
+
+       55,   55,  170,   55,  161,  168,  163,   55,  171,   55,
+      165,   55,   55,  173,  175,   55,  174,   55,   55,   55,
+      169,  167,  166,  172,  176,   55,  182,  170,  179,  168,
+      178,  177,  171,   55,   55,   55,  180,  173,  184,  175,
+      174,  181,  186,   55,   55,   55,  183,   55,  176,  185,
+       55,  182,  179,  188,  178,  177,  191,   55,  187,   55,
+      180,  190,   55,  184,   55,  181,  192,  186,  189,   55,
+      183,   55,   55,  195,  185,   55,   55,   55,  188,   55,
+       55,  191,  187,   55,   55,  194,  190,   55,  193,   55,
+      196,  192,  189,  197,   55,  198,  199,   55,  195,  201,
+
+      202,  203,  204,  200,   55,   55,   55,   55,   55,  194,
+      205,  206,  193,   55,  196,  208,   55,  210,  197,  198,
+      211,  199,   55,  201,  202,  203,  207,  204,  200,  209,
+       55,  212,   55,   55,  205,  206,   55,   55,  216,   55,
+      208,  214,  210,  215,   55,  211,   55,   55,  213,   55,
+      207,   55,  217,  209,   55,  219,  212,   55,   55,   55,
+       55,   55,  218,  216,   55,   55,  214,   55,  215,   55,
+       55,   55,  213,   55,   55,   90,  217,   55,   55,   55,
+      219,   90,   49,   47,   55,   54,  218,   44,   44,   46,
+       46,   48,   48,   50,   49,   47,   45,  220,    5,  220,
+
+      220,  220,  220,  220,  220,  220,  220,  220,  220,  220,
+      220,  220,  220,  220,  220,  220,  220,  220,  220,  220,
+      220,  220,  220,  220,  220,  220,  220,  220,  220,  220,
+      220,  220,  220,  220,  220,  220,  220,  220,  220,  220,
+      220,  220,  220,  220,  220,  220,  220,  220,  220,  220,
+      220,  220,  220,  220,  220,  220,  220,  220,  220,  220,
+      220,  220,  220,  220,  220,  220,  220
     } ;
 
-static const flex_int16_t yy_chk[503] =
+static const flex_int16_t yy_chk[668] =
     {   0,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
@@ -572,56 +609,73 @@ static const flex_int16_t yy_chk[503] =
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,   20,   25,   20,   22,
-       22,   26,   29,   28,   27,   30,  170,  169,   28,   27,
-       26,   34,   28,   33,   38,   25,   27,   35,   32,   38,
-       36,   30,   39,   27,   28,   27,   30,   32,  164,   29,
-
-       34,   33,   28,   27,   26,   35,   28,  162,   25,   36,
-       27,  161,   39,   38,   30,   40,   27,   28,   27,   30,
-       40,   32,   29,   34,   33,   37,   41,   48,   35,   48,
-       56,   55,   36,   57,   37,   39,  163,   37,   41,   55,
-       58,   56,   59,   61,   40,   58,   60,   64,   62,   57,
-      160,  163,   63,   37,   65,   60,   66,  159,   37,   59,
-       64,   37,   41,   55,   62,   56,   61,   64,  158,   58,
-       62,   63,   57,   65,  163,   66,   37,   74,   68,   60,
-       69,   67,   59,   71,   64,   69,   68,   62,   68,   61,
-       64,   72,   73,   62,   63,   74,   65,   67,   66,   71,
-
-       68,   68,   75,   77,   81,  156,   78,   72,   75,   69,
-       68,   73,   68,   76,   72,   78,  155,   81,   74,   77,
-       67,   76,   71,   68,   68,   83,   82,   84,   89,   87,
-       72,   85,   75,   82,   73,   86,   85,   72,   87,   78,
-       86,   81,   77,   88,   84,   76,   83,   90,   89,   91,
-       88,   92,   95,   94,  153,   93,   92,   82,   99,   97,
-       85,   95,   87,   96,   86,   91,   99,   84,   97,   83,
-       90,   89,   93,   94,   88,   98,   96,  101,  103,  106,
-       92,  100,  104,  105,  106,   95,  101,  107,   91,  104,
-       99,  108,   97,   90,   98,   93,   94,  100,  109,  105,
-
-       96,  112,  113,  115,  103,  120,  123,  152,  106,  125,
-      101,  107,  108,  104,  112,  124,  109,   98,  119,  151,
-      100,  150,  105,  119,  142,  113,  115,  103,  120,  133,
-      125,  124,  132,  123,  107,  108,  128,  129,  112,  109,
-      137,  132,  128,  141,  129,  136,  134,  119,  113,  115,
-      135,  120,  133,  125,  124,  134,  123,  140,  138,  135,
-      139,  144,  143,  137,  146,  132,  128,  138,  129,  139,
-      140,  143,  145,  148,  147,  133,  149,  145,  157,  134,
-      131,  154,  148,  135,  144,  157,  137,  146,  130,  127,
-      126,  138,  122,  139,  140,  143,  147,  121,  149,  154,
-
-      118,  145,  117,  116,  114,  111,  148,  144,  110,  157,
-      146,  102,   80,   79,   70,   54,   49,   46,   44,  147,
-       31,  149,  154,  166,  166,  167,  167,  168,  168,   24,
-       17,   11,   10,    9,    5,  165,  165,  165,  165,  165,
-      165,  165,  165,  165,  165,  165,  165,  165,  165,  165,
-      165,  165,  165,  165,  165,  165,  165,  165,  165,  165,
-      165,  165,  165,  165,  165,  165,  165,  165,  165,  165,
-      165,  165,  165,  165,  165,  165,  165,  165,  165,  165,
-      165,  165,  165,  165,  165,  165,  165,  165,  165,  165,
-      165,  165,  165,  165,  165,  165,  165,  165,  165,  165,
-
-      165,  165
+        1,    1,    1,    1,    1,    1,    1,    1,   20,   25,
+       20,   22,   22,   26,   32,   28,   27,   29,   30,   31,
+       28,   27,   26,   32,   28,   33,  225,   25,   27,   37,
+       50,   25,   50,   38,   30,   27,   28,   27,  224,   30,
+
+       31,   26,  219,   33,   29,   28,   27,   26,   32,   28,
+       37,   25,   38,   27,  217,   25,   35,  214,   30,   27,
+       28,   27,   36,   30,   31,   26,   40,   33,   29,   35,
+      213,   40,   36,   41,   37,   35,   38,   39,   43,   42,
+       36,   58,   62,   36,   42,   61,   39,   62,   58,   39,
+       43,   59,  212,   41,   35,   41,   40,   36,   57,   35,
+       39,   61,   59,   57,   36,   39,   57,   36,  210,   42,
+       72,   39,   62,   58,   39,   43,   63,   41,   65,   41,
+       67,   64,  209,   69,   39,   61,   72,   59,   57,   39,
+       64,   57,   66,   63,   70,   74,   68,   66,   75,   67,
+
+       71,   65,   69,   75,   80,   68,  208,  207,   66,   68,
+       72,   76,   74,   70,   66,   64,   68,   63,  206,   71,
+       80,   76,   66,   67,   79,   65,   69,   78,   75,   81,
+       68,   73,   66,   79,   68,   78,   74,   70,   66,   73,
+       68,   73,   82,   71,   80,   81,   76,   84,   86,   87,
+       83,   85,   81,   73,   73,   83,   86,   85,   79,   88,
+       78,   82,   87,   89,   73,   84,   73,   91,  205,   81,
+       96,   94,   89,   97,  202,   88,   81,   73,   73,   95,
+       83,   86,   85,   91,   94,   82,   95,   87,   98,   84,
+       97,   96,  100,   98,  101,   99,  103,   89,  102,   88,
+
+       99,  105,  108,  101,  106,  102,  104,   91,  100,   94,
+      109,   95,  107,  104,   97,   96,  103,  107,   98,  108,
+      106,  110,  111,  112,  105,   99,  113,  114,  101,  119,
+      102,  111,  100,  117,  109,  113,  112,  115,  104,  116,
+      103,  110,  107,  108,  106,  123,  114,  116,  105,  119,
+      115,  120,  125,  118,  121,  117,  111,  124,  109,  125,
+      113,  112,  118,  121,  127,  110,  126,  120,  128,  127,
+      114,  123,  116,  119,  129,  115,  130,  131,  132,  117,
+      124,  201,  126,  138,  125,  136,  128,  118,  121,  135,
+      139,  120,  142,  200,  127,  123,  132,  130,  129,  138,
+
+      197,  145,  135,  149,  124,  131,  126,  195,  136,  144,
+      128,  147,  150,  139,  144,  151,  142,  155,  153,  194,
+      132,  130,  129,  138,  145,  156,  155,  135,  150,  131,
+      149,  147,  136,  157,  161,  159,  151,  139,  157,  144,
+      142,  153,  159,  158,  163,  164,  156,  166,  145,  158,
+      165,  155,  150,  163,  149,  147,  166,  167,  161,  168,
+      151,  165,  170,  157,  171,  153,  167,  159,  164,  192,
+      156,  172,  174,  171,  158,  190,  180,  182,  163,  183,
+      184,  166,  161,  175,  173,  170,  165,  186,  168,  187,
+      172,  167,  164,  173,  179,  174,  175,  185,  171,  180,
+
+      182,  184,  185,  179,  188,  181,  189,  191,  193,  170,
+      186,  187,  168,  196,  172,  189,  178,  193,  173,  174,
+      196,  175,  198,  180,  182,  184,  188,  185,  179,  191,
+      199,  198,  203,  211,  186,  187,  204,  215,  211,  216,
+      189,  203,  193,  204,  177,  196,  218,  176,  199,  169,
+      188,  162,  215,  191,  160,  218,  198,  154,  152,  148,
+      146,  143,  216,  211,  141,  140,  203,  137,  204,  134,
+      133,  122,  199,   93,   92,   90,  215,   77,   60,   56,
+      218,   51,   48,   46,   34,   24,  216,  221,  221,  222,
+      222,  223,  223,   17,   11,   10,    9,    5,  220,  220,
+
+      220,  220,  220,  220,  220,  220,  220,  220,  220,  220,
+      220,  220,  220,  220,  220,  220,  220,  220,  220,  220,
+      220,  220,  220,  220,  220,  220,  220,  220,  220,  220,
+      220,  220,  220,  220,  220,  220,  220,  220,  220,  220,
+      220,  220,  220,  220,  220,  220,  220,  220,  220,  220,
+      220,  220,  220,  220,  220,  220,  220,  220,  220,  220,
+      220,  220,  220,  220,  220,  220,  220
     } ;
 
 /* The intent behind this definition is that it'll catch
@@ -656,7 +710,7 @@ extern int atoi();
 extern double atof();
 
 #define RETURN_TOKEN(token) LOG_DEBUG("%s", #token);return token
-#line 659 "lex_sql.cpp"
+#line 713 "lex_sql.cpp"
 /* Prevent the need for linking with -lfl */
 #define YY_NO_INPUT 1
 /* 不区分大小写 */
@@ -665,7 +719,7 @@ extern double atof();
 /* 1. 匹配的规则长的优先 */
 /* 2. 写在最前面的优先 */
 /* yylval 就可以认为是 yacc 中 %union 定义的结构体(union 结构) */
-#line 668 "lex_sql.cpp"
+#line 722 "lex_sql.cpp"
 
 #define INITIAL 0
 #define STR 1
@@ -951,7 +1005,7 @@ YY_DECL
 #line 75 "lex_sql.l"
 
 
-#line 954 "lex_sql.cpp"
+#line 1008 "lex_sql.cpp"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -978,13 +1032,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 166 )
+				if ( yy_current_state >= 221 )
 					yy_c = yy_meta[yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
 			++yy_cp;
 			}
-		while ( yy_base[yy_current_state] != 436 );
+		while ( yy_base[yy_current_state] != 599 );
 
 yy_find_action:
 		yy_act = yy_accept[yy_current_state];
@@ -1202,92 +1256,152 @@ RETURN_TOKEN(EXPLAIN);
 case 39:
 YY_RULE_SETUP
 #line 117 "lex_sql.l"
-yylval->string=strdup(yytext); RETURN_TOKEN(ID);
+RETURN_TOKEN(GROUP);
 	YY_BREAK
 case 40:
 YY_RULE_SETUP
 #line 118 "lex_sql.l"
-RETURN_TOKEN(LBRACE);
+RETURN_TOKEN(BY);
 	YY_BREAK
 case 41:
 YY_RULE_SETUP
 #line 119 "lex_sql.l"
-RETURN_TOKEN(RBRACE);
+RETURN_TOKEN(ORDER);
 	YY_BREAK
 case 42:
 YY_RULE_SETUP
-#line 121 "lex_sql.l"
-RETURN_TOKEN(COMMA);
+#line 120 "lex_sql.l"
+RETURN_TOKEN(ASC);
 	YY_BREAK
 case 43:
 YY_RULE_SETUP
-#line 122 "lex_sql.l"
-RETURN_TOKEN(EQ);
+#line 121 "lex_sql.l"
+RETURN_TOKEN(LIMIT);
 	YY_BREAK
 case 44:
 YY_RULE_SETUP
-#line 123 "lex_sql.l"
-RETURN_TOKEN(LE);
+#line 122 "lex_sql.l"
+RETURN_TOKEN(OFFSET);
 	YY_BREAK
 case 45:
 YY_RULE_SETUP
-#line 124 "lex_sql.l"
-RETURN_TOKEN(NE);
+#line 123 "lex_sql.l"
+RETURN_TOKEN(ANALYZE);
 	YY_BREAK
 case 46:
 YY_RULE_SETUP
-#line 125 "lex_sql.l"
-RETURN_TOKEN(NE);
+#line 124 "lex_sql.l"
+RETURN_TOKEN(PREPARE);
 	YY_BREAK
 case 47:
 YY_RULE_SETUP
-#line 126 "lex_sql.l"
-RETURN_TOKEN(LT);
+#line 125 "lex_sql.l"
+RETURN_TOKEN(EXECUTE);
 	YY_BREAK
 case 48:
 YY_RULE_SETUP
-#line 127 "lex_sql.l"
-RETURN_TOKEN(GE);
+#line 126 "lex_sql.l"
+RETURN_TOKEN(DEALLOCATE);
 	YY_BREAK
 case 49:
 YY_RULE_SETUP
-#line 128 "lex_sql.l"
-RETURN_TOKEN(GT);
+#line 127 "lex_sql.l"
+RETURN_TOKEN(USING);
 	YY_BREAK
 case 50:
-#line 131 "lex_sql.l"
+YY_RULE_SETUP
+#line 128 "lex_sql.l"
+RETURN_TOKEN(STATUS);
+	YY_BREAK
 case 51:
-#line 132 "lex_sql.l"
+YY_RULE_SETUP
+#line 129 "lex_sql.l"
+yylval->string=strdup(yytext); RETURN_TOKEN(ID);
+	YY_BREAK
 case 52:
-#line 133 "lex_sql.l"
+YY_RULE_SETUP
+#line 130 "lex_sql.l"
+RETURN_TOKEN(LBRACE);
+	YY_BREAK
 case 53:
 YY_RULE_SETUP
-#line 133 "lex_sql.l"
-{return yytext[0];}
+#line 131 "lex_sql.l"
+RETURN_TOKEN(RBRACE);
 	YY_BREAK
 case 54:
-/* rule 54 can match eol */
 YY_RULE_SETUP
-#line 134 "lex_sql.l"
-yylval->string = strdup(yytext); RETURN_TOKEN(SSS);
+#line 133 "lex_sql.l"
+RETURN_TOKEN(COMMA);
 	YY_BREAK
 case 55:
-/* rule 55 can match eol */
 YY_RULE_SETUP
-#line 135 "lex_sql.l"
-yylval->string = strdup(yytext); RETURN_TOKEN(SSS);
+#line 134 "lex_sql.l"
+RETURN_TOKEN(EQ);
 	YY_BREAK
 case 56:
 YY_RULE_SETUP
-#line 137 "lex_sql.l"
-LOG_DEBUG("Unknown character [%c]",yytext[0]); return yytext[0];
+#line 135 "lex_sql.l"
+RETURN_TOKEN(LE);
 	YY_BREAK
 case 57:
 YY_RULE_SETUP
+#line 136 "lex_sql.l"
+RETURN_TOKEN(NE);
+	YY_BREAK
+case 58:
+YY_RULE_SETUP
+#line 137 "lex_sql.l"
+RETURN_TOKEN(NE);
+	YY_BREAK
+case 59:
+YY_RULE_SETUP
 #line 138 "lex_sql.l"
+RETURN_TOKEN(LT);
+	YY_BREAK
+case 60:
+YY_RULE_SETUP
+#line 139 "lex_sql.l"
+RETURN_TOKEN(GE);
+	YY_BREAK
+case 61:
+YY_RULE_SETUP
+#line 140 "lex_sql.l"
+RETURN_TOKEN(GT);
+	YY_BREAK
+case 62:
+#line 143 "lex_sql.l"
+case 63:
+#line 144 "lex_sql.l"
+case 64:
+#line 145 "lex_sql.l"
+case 65:
+YY_RULE_SETUP
+#line 145 "lex_sql.l"
+{return yytext[0];}
+	YY_BREAK
+case 66:
+/* rule 66 can match eol */
+YY_RULE_SETUP
+#line 146 "lex_sql.l"
+yylval->string = strdup(yytext); RETURN_TOKEN(SSS);
+	YY_BREAK
+case 67:
+/* rule 67 can match eol */
+YY_RULE_SETUP
+#line 147 "lex_sql.l"
+yylval->string = strdup(yytext); RETURN_TOKEN(SSS);
+	YY_BREAK
+case 68:
+YY_RULE_SETUP
+#line 149 "lex_sql.l"
+LOG_DEBUG("Unknown character [%c]",yytext[0]); return yytext[0];
+	YY_BREAK
+case 69:
+YY_RULE_SETUP
+#line 150 "lex_sql.l"
 ECHO;
 	YY_BREAK
-#line 1290 "lex_sql.cpp"
+#line 1404 "lex_sql.cpp"
 case YY_STATE_EOF(INITIAL):
 case YY_STATE_EOF(STR):
 	yyterminate();
@@ -1587,7 +1701,7 @@ static int yy_get_next_buffer (yyscan_t yyscanner)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 166 )
+			if ( yy_current_state >= 221 )
 				yy_c = yy_meta[yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
@@ -1616,11 +1730,11 @@ static int yy_get_next_buffer (yyscan_t yyscanner)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 166 )
+		if ( yy_current_state >= 221 )
 			yy_c = yy_meta[yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-	yy_is_jam = (yy_current_state == 165);
+	yy_is_jam = (yy_current_state == 220);
 
 	(void)yyg;
 	return yy_is_jam ? 0 : yy_current_state;
@@ -2443,7 +2557,7 @@ void yyfree (void * ptr , yyscan_t yyscanner)
 
 #define YYTABLES_NAME "yytables"
 
-#line 138 "lex_sql.l"
+#line 150 "lex_sql.l"
 
 
 void scan_string(const char *str, yyscan_t scanner) {
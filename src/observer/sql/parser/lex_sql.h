@@ -542,7 +542,7 @@ extern int yylex \
 #undef yyTABLES_NAME
 #endif
 
-#line 138 "lex_sql.l"
+#line 150 "lex_sql.l"
 
 
 #line 548 "lex_sql.h"
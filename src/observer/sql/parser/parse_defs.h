@@ -38,6 +38,27 @@ struct RelAttrSqlNode
 {
   std::string relation_name;   ///< relation name (may be NULL) 表名
   std::string attribute_name;  ///< attribute name              属性名
+  std::string aggregation;     ///< 聚合函数名，比如count(id)中的count，不是聚合函数时为空
+};
+
+/**
+ * @brief order by中的一项
+ * @ingroup SQLParser
+ */
+struct OrderBySqlNode
+{
+  RelAttrSqlNode attr;              ///< 排序的字段或者聚合函数
+  bool           ascending = true;  ///< 是否升序
+};
+
+/**
+ * @brief limit子句，limit小于0表示没有limit
+ * @ingroup SQLParser
+ */
+struct LimitSqlNode
+{
+  int limit  = -1;  ///< 最多输出多少行
+  int offset = 0;   ///< 跳过前面多少行
 };
 
 /**
@@ -74,13 +95,17 @@ struct ConditionSqlNode
                                    ///< 1时，操作符右边是属性名，0时，是属性值
   RelAttrSqlNode  right_attr;      ///< right-hand side attribute if right_is_attr = TRUE 右边的属性
   Value           right_value;     ///< right-hand side value if right_is_attr = FALSE
+  int             left_param  = -1;   ///< 左边是预编译语句的参数(?)时，参数的序号，从0开始
+  int             right_param = -1;   ///< 右边是参数(?)时，参数的序号
+  const Value    *left_param_value  = nullptr;  ///< 执行预编译语句时绑定的参数，见 PreparedStmt::bind_params
+  const Value    *right_param_value = nullptr;
 };
 
 /**
  * @brief 描述一个select语句
  * @ingroup SQLParser
  * @details 一个正常的select语句描述起来比这个要复杂很多，这里做了简化。
- * 一个select语句由三部分组成，分别是select, from, where。
+ * 一个select语句由三部分组成，分别是select, from, where，另外可以有group by、order by和limit。
  * select部分表示要查询的字段，from部分表示要查询的表，where部分表示查询的条件。
  * 比如 from 中可以是多个表，也可以是另一个查询语句，这里仅仅支持表，也就是 relations。
  * where 条件 conditions，这里表示使用AND串联起来多个条件。正常的SQL语句会有OR，NOT等，
@@ -92,6 +117,9 @@ struct SelectSqlNode
   std::vector<RelAttrSqlNode>     attributes;    ///< attributes in select clause
   std::vector<std::string>        relations;     ///< 查询的表
   std::vector<ConditionSqlNode>   conditions;    ///< 查询条件，使用AND串联起来多个条件
+  std::vector<RelAttrSqlNode>     group_by;      ///< group by 中的字段
+  std::vector<OrderBySqlNode>     order_by;      ///< order by 中的字段，按照SQL中的顺序
+  LimitSqlNode                    limit;         ///< limit 和 offset
 };
 
 /**
@@ -205,6 +233,16 @@ struct DescTableSqlNode
   std::string relation_name;
 };
 
+/**
+ * @brief 描述一个analyze table语句
+ * @ingroup SQLParser
+ * @details 收集表的统计信息，供优化器估算代价
+ */
+struct AnalyzeTableSqlNode
+{
+  std::string relation_name;
+};
+
 /**
  * @brief 描述一个load data语句
  * @ingroup SQLParser
@@ -227,6 +265,37 @@ struct SetVariableSqlNode
   Value       value;
 };
 
+/**
+ * @brief 描述一个prepare语句
+ * @ingroup SQLParser
+ * @details 预编译一个SQL语句。语句中的条件、insert和update的值可以使用?表示参数，
+ * 执行时通过 EXECUTE ... USING 指定参数的值
+ */
+struct PrepareSqlNode
+{
+  std::string name;  ///< 预编译语句的名字
+  std::string sql;   ///< 预编译的SQL
+};
+
+/**
+ * @brief 描述一个execute语句，执行预编译语句
+ * @ingroup SQLParser
+ */
+struct ExecuteSqlNode
+{
+  std::string        name;
+  std::vector<Value> params;  ///< 参数的值，按照参数在SQL中出现的顺序
+};
+
+/**
+ * @brief 描述一个deallocate prepare语句，删除预编译语句
+ * @ingroup SQLParser
+ */
+struct DeallocateSqlNode
+{
+  std::string name;
+};
+
 class ParsedSqlNode;
 
 /**
@@ -239,6 +308,7 @@ class ParsedSqlNode;
 struct ExplainSqlNode
 {
   std::unique_ptr<ParsedSqlNode> sql_node;
+  bool                           analyze = false;  ///< EXPLAIN ANALYZE，执行之后输出每个算子的统计
 };
 
 /**
@@ -271,7 +341,9 @@ enum SqlCommandFlag
   SCF_DROP_INDEX,
   SCF_SYNC,
   SCF_SHOW_TABLES,
+  SCF_SHOW_STATUS,  ///< 显示服务端的统计信息，比如查询缓存的命中次数
   SCF_DESC_TABLE,
+  SCF_ANALYZE_TABLE,
   SCF_BEGIN,        ///< 事务开始语句，可以在这里扩展只读事务
   SCF_COMMIT,
   SCF_CLOG_SYNC,
@@ -281,6 +353,9 @@ enum SqlCommandFlag
   SCF_EXIT,
   SCF_EXPLAIN,
   SCF_SET_VARIABLE, ///< 设置变量
+  SCF_PREPARE,      ///< 预编译语句
+  SCF_EXECUTE,
+  SCF_DEALLOCATE,
 };
 /**
  * @brief 表示一个SQL语句
@@ -301,9 +376,13 @@ public:
   CreateIndexSqlNode        create_index;
   DropIndexSqlNode          drop_index;
   DescTableSqlNode          desc_table;
+  AnalyzeTableSqlNode       analyze_table;
   LoadDataSqlNode           load_data;
   ExplainSqlNode            explain;
   SetVariableSqlNode        set_variable;
+  PrepareSqlNode            prepare;
+  ExecuteSqlNode            execute;
+  DeallocateSqlNode         deallocate;
 
 public:
   ParsedSqlNode();
@@ -323,6 +402,13 @@ public:
     return sql_nodes_;
   }
 
+  /**
+   * @brief 解析到一个参数(?)，返回参数的序号
+   */
+  int add_param() { return param_num_++; }
+  int param_num() const { return param_num_; }
+
 private:
   std::vector<std::unique_ptr<ParsedSqlNode>> sql_nodes_;  ///< 这里记录SQL命令。虽然看起来支持多个，但是当前仅处理一个
+  int param_num_ = 0;  ///< SQL中参数(?)的个数，只有预编译的语句中可以有参数
 };
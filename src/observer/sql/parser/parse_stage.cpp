@@ -23,6 +23,7 @@ See the Mulan PSL v2 for more details. */
 #include "common/log/log.h"
 #include "event/session_event.h"
 #include "event/sql_event.h"
+#include "sql/parser/fast_parser.h"
 #include "sql/parser/parse.h"
 
 using namespace common;
@@ -36,7 +37,10 @@ RC ParseStage::handle_request(SQLStageEvent *sql_event)
 
   ParsedSqlResult parsed_sql_result;
 
-  parse(sql.c_str(), &parsed_sql_result);
+  // 简单的点查询、插入和删除不需要经过完整的语法解析
+  if (!fast_parse(sql.c_str(), &parsed_sql_result)) {
+    parse(sql.c_str(), &parsed_sql_result);
+  }
   if (parsed_sql_result.sql_nodes().empty()) {
     sql_result->set_return_code(RC::SUCCESS);
     sql_result->set_state_string("");
@@ -56,6 +60,14 @@ RC ParseStage::handle_request(SQLStageEvent *sql_event)
     return rc;
   }
 
+  if (parsed_sql_result.param_num() > 0) {
+    // 参数(?)只能出现在预编译的语句中，见 PreparedStmt
+    rc = RC::SQL_SYNTAX;
+    sql_result->set_return_code(rc);
+    sql_result->set_state_string("Parameters are only allowed in prepared statements");
+    return rc;
+  }
+
   sql_event->set_sql_node(std::move(sql_node));
 
   return RC::SUCCESS;
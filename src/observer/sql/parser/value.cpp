@@ -16,6 +16,7 @@ See the Mulan PSL v2 for more details. */
 #include "sql/parser/value.h"
 #include "storage/field/field.h"
 #include "common/log/log.h"
+#include "common/mm/arena.h"
 #include "common/lang/comparator.h"
 #include "common/lang/string.h"
 
@@ -58,6 +59,124 @@ Value::Value(const char *s, int len /*= 0*/)
   set_string(s, len);
 }
 
+Value::Value(const Value &other)
+{
+  copy_from(other);
+}
+
+Value::Value(Value &&other) noexcept
+{
+  *this = std::move(other);
+}
+
+Value &Value::operator=(const Value &other)
+{
+  if (this != &other) {
+    copy_from(other);
+  }
+  return *this;
+}
+
+Value &Value::operator=(Value &&other) noexcept
+{
+  if (this == &other) {
+    return *this;
+  }
+
+  if (other.str_storage_ != StrStorage::HEAP) {
+    copy_from(other);
+    return *this;
+  }
+
+  // 直接接管申请的内存
+  release_string();
+  attr_type_   = other.attr_type_;
+  length_      = other.length_;
+  str_         = other.str_;
+  value_       = other.value_;
+  str_storage_ = StrStorage::HEAP;
+
+  other.str_                   = nullptr;
+  other.str_storage_           = StrStorage::INLINE;
+  other.length_                = 0;
+  other.value_.inline_str_[0]  = '\0';
+  return *this;
+}
+
+void Value::copy_from(const Value &other)
+{
+  if (other.attr_type_ == CHARS) {
+    assign_string(other.data(), other.length_);
+  } else {
+    release_string();
+    value_  = other.value_;
+    length_ = other.length_;
+  }
+  attr_type_ = other.attr_type_;
+}
+
+void Value::release_string()
+{
+  if (str_storage_ == StrStorage::HEAP) {
+    delete[] str_;
+  }
+  str_         = nullptr;
+  str_storage_ = StrStorage::INLINE;
+}
+
+void Value::assign_string(const char *s, int len)
+{
+  if (len < INLINE_STR_SIZE) {
+    // s 可能就是当前保存的字符串
+    memmove(value_.inline_str_, s, len);
+    value_.inline_str_[len] = '\0';
+    release_string();
+  } else if (str_storage_ == StrStorage::HEAP && value_.heap_capacity_ > len) {
+    char *buf = const_cast<char *>(str_);
+    memmove(buf, s, len);
+    buf[len] = '\0';
+  } else {
+    char *buf = new char[len + 1];
+    memcpy(buf, s, len);
+    buf[len] = '\0';
+    release_string();
+    str_                  = buf;
+    str_storage_          = StrStorage::HEAP;
+    value_.heap_capacity_ = len + 1;
+  }
+  length_ = len;
+}
+
+void Value::borrow_data(const char *data, int length)
+{
+  if (attr_type_ != CHARS) {
+    set_data(data, length);
+    return;
+  }
+
+  const int len = strnlen(data, length);
+  if (len >= length || len < INLINE_STR_SIZE) {
+    // 没有'\0'结尾的需要复制，较短的字符串复制到对象内部也不需要申请内存
+    assign_string(data, len);
+    return;
+  }
+
+  release_string();
+  str_         = data;
+  str_storage_ = StrStorage::BORROWED;
+  length_      = len;
+}
+
+void Value::make_owned()
+{
+  if (str_storage_ == StrStorage::BORROWED) {
+    const char *s = str_;
+    str_storage_  = StrStorage::INLINE;
+    str_          = nullptr;
+    assign_string(s, length_);
+  }
+}
+
 void Value::set_data(char *data, int length)
 {
   switch (attr_type_) {
@@ -65,15 +184,18 @@ void Value::set_data(char *data, int length)
       set_string(data, length);
     } break;
     case INTS: {
-      num_value_.int_value_ = *(int *)data;
+      release_string();
+      value_.int_value_ = *(int *)data;
       length_ = length;
     } break;
     case FLOATS: {
-      num_value_.float_value_ = *(float *)data;
+      release_string();
+      value_.float_value_ = *(float *)data;
       length_ = length;
     } break;
     case BOOLEANS: {
-      num_value_.bool_value_ = *(int *)data != 0;
+      release_string();
+      value_.bool_value_ = *(int *)data != 0;
       length_ = length;
     } break;
     default: {
@@ -83,21 +205,24 @@ void Value::set_data(char *data, int length)
 }
 void Value::set_int(int val)
 {
+  release_string();
   attr_type_ = INTS;
-  num_value_.int_value_ = val;
+  value_.int_value_ = val;
   length_ = sizeof(val);
 }
 
 void Value::set_float(float val)
 {
+  release_string();
   attr_type_ = FLOATS;
-  num_value_.float_value_ = val;
+  value_.float_value_ = val;
   length_ = sizeof(val);
 }
 void Value::set_boolean(bool val)
 {
+  release_string();
   attr_type_ = BOOLEANS;
-  num_value_.bool_value_ = val;
+  value_.bool_value_ = val;
   length_ = sizeof(val);
 }
 void Value::set_string(const char *s, int len /*= 0*/)
@@ -105,11 +230,10 @@ void Value::set_string(const char *s, int len /*= 0*/)
   attr_type_ = CHARS;
   if (len > 0) {
     len = strnlen(s, len);
-    str_value_.assign(s, len);
   } else {
-    str_value_.assign(s);
+    len = strlen(s);
   }
-  length_ = str_value_.length();
+  assign_string(s, len);
 }
 
 void Value::set_value(const Value &value)
@@ -122,7 +246,8 @@ void Value::set_value(const Value &value)
       set_float(value.get_float());
     } break;
     case CHARS: {
-      set_string(value.get_string().c_str());
+      assign_string(value.data(), value.length());
+      attr_type_ = CHARS;
     } break;
     case BOOLEANS: {
       set_boolean(value.get_boolean());
@@ -133,14 +258,28 @@ void Value::set_value(const Value &value)
   }
 }
 
+void Value::set_value(const Value &value, common::Arena &arena)
+{
+  if (value.attr_type_ != CHARS || value.length_ < INLINE_STR_SIZE) {
+    *this = value;
+    return;
+  }
+
+  char *data = static_cast<char *>(arena.alloc(value.length_ + 1));
+  memcpy(data, value.data(), value.length_);
+  data[value.length_] = '\0';
+  attr_type_          = CHARS;
+  borrow_data(data, value.length_ + 1);
+}
+
 const char *Value::data() const
 {
   switch (attr_type_) {
     case CHARS: {
-      return str_value_.c_str();
+      return str_storage_ == StrStorage::INLINE ? value_.inline_str_ : str_;
     } break;
     default: {
-      return (const char *)&num_value_;
+      return (const char *)&value_;
     } break;
   }
 }
@@ -150,16 +289,16 @@ std::string Value::to_string() const
   std::stringstream os;
   switch (attr_type_) {
     case INTS: {
-      os << num_value_.int_value_;
+      os << value_.int_value_;
     } break;
     case FLOATS: {
-      os << common::double_to_str(num_value_.float_value_);
+      os << common::double_to_str(value_.float_value_);
     } break;
     case BOOLEANS: {
-      os << num_value_.bool_value_;
+      os << value_.bool_value_;
     } break;
     case CHARS: {
-      os << str_value_;
+      return std::string(data(), length_);
     } break;
     default: {
       LOG_WARN("unsupported attr type: %d", attr_type_);
@@ -173,30 +312,27 @@ int Value::compare(const Value &other) const
   if (this->attr_type_ == other.attr_type_) {
     switch (this->attr_type_) {
       case INTS: {
-        return common::compare_int((void *)&this->num_value_.int_value_, (void *)&other.num_value_.int_value_);
+        return common::compare_int((void *)&this->value_.int_value_, (void *)&other.value_.int_value_);
       } break;
       case FLOATS: {
-        return common::compare_float((void *)&this->num_value_.float_value_, (void *)&other.num_value_.float_value_);
+        return common::compare_float((void *)&this->value_.float_value_, (void *)&other.value_.float_value_);
       } break;
       case CHARS: {
-        return common::compare_string((void *)this->str_value_.c_str(),
-            this->str_value_.length(),
-            (void *)other.str_value_.c_str(),
-            other.str_value_.length());
+        return common::compare_string((void *)this->data(), this->length_, (void *)other.data(), other.length_);
       } break;
       case BOOLEANS: {
-        return common::compare_int((void *)&this->num_value_.bool_value_, (void *)&other.num_value_.bool_value_);
+        return common::compare_int((void *)&this->value_.bool_value_, (void *)&other.value_.bool_value_);
       }
       default: {
         LOG_WARN("unsupported type: %d", this->attr_type_);
       }
     }
   } else if (this->attr_type_ == INTS && other.attr_type_ == FLOATS) {
-    float this_data = this->num_value_.int_value_;
-    return common::compare_float((void *)&this_data, (void *)&other.num_value_.float_value_);
+    float this_data = this->value_.int_value_;
+    return common::compare_float((void *)&this_data, (void *)&other.value_.float_value_);
   } else if (this->attr_type_ == FLOATS && other.attr_type_ == INTS) {
-    float other_data = other.num_value_.int_value_;
-    return common::compare_float((void *)&this->num_value_.float_value_, (void *)&other_data);
+    float other_data = other.value_.int_value_;
+    return common::compare_float((void *)&this->value_.float_value_, (void *)&other_data);
   }
   LOG_WARN("not supported");
   return -1;  // TODO return rc?
@@ -207,20 +343,20 @@ int Value::get_int() const
   switch (attr_type_) {
     case CHARS: {
       try {
-        return (int)(std::stol(str_value_));
+        return (int)(std::stol(data()));
       } catch (std::exception const &ex) {
-        LOG_TRACE("failed to convert string to number. s=%s, ex=%s", str_value_.c_str(), ex.what());
+        LOG_TRACE("failed to convert string to number. s=%s, ex=%s", data(), ex.what());
         return 0;
       }
     }
     case INTS: {
-      return num_value_.int_value_;
+      return value_.int_value_;
     }
     case FLOATS: {
-      return (int)(num_value_.float_value_);
+      return (int)(value_.float_value_);
     }
     case BOOLEANS: {
-      return (int)(num_value_.bool_value_);
+      return (int)(value_.bool_value_);
     }
     default: {
       LOG_WARN("unknown data type. type=%d", attr_type_);
@@ -235,20 +371,20 @@ float Value::get_float() const
   switch (attr_type_) {
     case CHARS: {
       try {
-        return std::stof(str_value_);
+        return std::stof(data());
       } catch (std::exception const &ex) {
-        LOG_TRACE("failed to convert string to float. s=%s, ex=%s", str_value_.c_str(), ex.what());
+        LOG_TRACE("failed to convert string to float. s=%s, ex=%s", data(), ex.what());
         return 0.0;
       }
     } break;
     case INTS: {
-      return float(num_value_.int_value_);
+      return float(value_.int_value_);
     } break;
     case FLOATS: {
-      return num_value_.float_value_;
+      return value_.float_value_;
     } break;
     case BOOLEANS: {
-      return float(num_value_.bool_value_);
+      return float(value_.bool_value_);
     } break;
     default: {
       LOG_WARN("unknown data type. type=%d", attr_type_);
@@ -268,31 +404,31 @@ bool Value::get_boolean() const
   switch (attr_type_) {
     case CHARS: {
       try {
-        float val = std::stof(str_value_);
+        float val = std::stof(data());
         if (val >= EPSILON || val <= -EPSILON) {
           return true;
         }
 
-        int int_val = std::stol(str_value_);
+        int int_val = std::stol(data());
         if (int_val != 0) {
           return true;
         }
 
-        return !str_value_.empty();
+        return length_ > 0;
       } catch (std::exception const &ex) {
-        LOG_TRACE("failed to convert string to float or integer. s=%s, ex=%s", str_value_.c_str(), ex.what());
-        return !str_value_.empty();
+        LOG_TRACE("failed to convert string to float or integer. s=%s, ex=%s", data(), ex.what());
+        return length_ > 0;
       }
     } break;
     case INTS: {
-      return num_value_.int_value_ != 0;
+      return value_.int_value_ != 0;
     } break;
     case FLOATS: {
-      float val = num_value_.float_value_;
+      float val = value_.float_value_;
       return val >= EPSILON || val <= -EPSILON;
     } break;
     case BOOLEANS: {
-      return num_value_.bool_value_;
+      return value_.bool_value_;
     } break;
     default: {
       LOG_WARN("unknown data type. type=%d", attr_type_);
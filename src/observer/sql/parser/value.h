@@ -14,8 +14,13 @@ See the Mulan PSL v2 for more details. */
 
 #pragma once
 
+#include <stdint.h>
 #include <string>
 
+namespace common {
+class Arena;
+}
+
 /**
  * @brief 属性的类型
  * 
@@ -34,12 +39,16 @@ AttrType attr_type_from_string(const char *s);
 
 /**
  * @brief 属性的值
- * 
+ * @details 字符串有三种保存方式：较短的字符串直接保存在对象内部，较长的保存在申请的内存中，
+ * 或者借用外部的内存(比如记录中的字段)，参考 borrow_data。
+ * 不管哪种方式，data() 返回的字符串都以'\0'结尾。
+ * 拷贝或移动一个借用外部内存的Value时，会复制一份字符串，新的Value不再依赖外部的内存。
  */
 class Value 
 {
 public:
   Value() = default;
+  ~Value() { release_string(); }
 
   Value(AttrType attr_type, char *data, int length = 4) : attr_type_(attr_type)
   {
@@ -51,8 +60,10 @@ public:
   explicit Value(bool val);
   explicit Value(const char *s, int len = 0);
 
-  Value(const Value &other) = default;
-  Value &operator=(const Value &other) = default;
+  Value(const Value &other);
+  Value(Value &&other) noexcept;
+  Value &operator=(const Value &other);
+  Value &operator=(Value &&other) noexcept;
 
   void set_type(AttrType type)
   {
@@ -63,12 +74,37 @@ public:
   {
     this->set_data(const_cast<char *>(data), length);
   }
+
+  /**
+   * @brief 与set_data相同，但是字符串不复制，直接引用data中的数据
+   * @details 调用方需要保证在Value使用期间data有效，比如记录所在的页面没有被释放。
+   * 只有字符串在length之内以'\0'结尾时才引用，否则还是复制一份。
+   * 需要在data失效之后继续使用时，调用 make_owned
+   */
+  void borrow_data(const char *data, int length);
+
+  /**
+   * @brief 如果字符串引用的是外部的内存，复制一份，之后不再依赖外部的内存
+   */
+  void make_owned();
+  bool borrowed() const
+  {
+    return str_storage_ == StrStorage::BORROWED;
+  }
+
   void set_int(int val);
   void set_float(float val);
   void set_boolean(bool val);
   void set_string(const char *s, int len = 0);
   void set_value(const Value &value);
 
+  /**
+   * @brief 复制value，较长的字符串复制到arena中并借用，不再单独申请内存
+   * @details 用于hash表等批量保存的数据，调用方需要保证在arena reset之前不再使用。
+   * 借用的Value被拷贝或移动时会复制字符串，所以需要保存在不会移动的位置，比如也在arena中
+   */
+  void set_value(const Value &value, common::Arena &arena);
+
   std::string to_string() const;
 
   int compare(const Value &other) const;
@@ -79,6 +115,18 @@ public:
     return length_;
   }
 
+  /**
+   * @brief 估算占用的内存。较短的字符串以及借用的字符串不需要额外的内存
+   */
+  int64_t memory_size() const
+  {
+    int64_t size = sizeof(Value);
+    if (str_storage_ == StrStorage::HEAP) {
+      size += value_.heap_capacity_;
+    }
+    return size;
+  }
+
   AttrType attr_type() const
   {
     return attr_type_;
@@ -94,14 +142,37 @@ public:
   std::string get_string() const;
   bool get_boolean() const;
 
+  /**
+   * @brief 长度小于这个值的字符串保存在对象内部
+   */
+  static constexpr int INLINE_STR_SIZE = 20;
+
+private:
+  enum class StrStorage : uint8_t
+  {
+    INLINE,    ///< 保存在 value_.inline_str_ 中
+    HEAP,      ///< 保存在申请的内存 str_ 中，容量是 value_.heap_capacity_
+    BORROWED,  ///< 引用外部的内存 str_
+  };
+
+  /**
+   * @brief 复制一份字符串，已经申请的内存足够时直接复用
+   */
+  void assign_string(const char *s, int len);
+  void copy_from(const Value &other);
+  void release_string();
+
 private:
   AttrType attr_type_ = UNDEFINED;
   int length_ = 0;
+  const char *str_ = nullptr;
 
   union {
     int int_value_;
     float float_value_;
     bool bool_value_;
-  } num_value_;
-  std::string str_value_;
-};
\ No newline at end of file
+    char inline_str_[INLINE_STR_SIZE];
+    int heap_capacity_;
+  } value_{};
+  StrStorage str_storage_ = StrStorage::INLINE;
+};
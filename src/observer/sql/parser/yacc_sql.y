@@ -41,6 +41,22 @@ ArithmeticExpr *create_arithmetic_expression(ArithmeticExpr::Type type,
   return expr;
 }
 
+/**
+ * @brief 记录条件中参数(?)的序号
+ * @details 参数按照在SQL中出现的顺序编号。归约一个条件时，条件中的值刚刚解析完成，
+ * 右边的参数是最后一个参数，左边的参数在它之前
+ */
+void set_condition_params(ConditionSqlNode &condition, ParsedSqlResult *sql_result)
+{
+  int next_param = sql_result->param_num();
+  if (!condition.right_is_attr && condition.right_value.attr_type() == UNDEFINED) {
+    condition.right_param = --next_param;
+  }
+  if (!condition.left_is_attr && condition.left_value.attr_type() == UNDEFINED) {
+    condition.left_param = --next_param;
+  }
+}
+
 %}
 
 %define api.pure full
@@ -59,6 +75,7 @@ ArithmeticExpr *create_arithmetic_expression(ArithmeticExpr::Type type,
         DROP
         TABLE
         TABLES
+        STATUS
         INDEX
         CALC
         SELECT
@@ -97,6 +114,17 @@ ArithmeticExpr *create_arithmetic_expression(ArithmeticExpr::Type type,
         LE
         GE
         NE
+        GROUP
+        BY
+        ORDER
+        ASC
+        LIMIT
+        OFFSET
+        ANALYZE
+        PREPARE
+        EXECUTE
+        DEALLOCATE
+        USING
 
 /** union 中定义各种数据类型，真实生成的代码也是union类型，所以不能有非POD类型的数据 **/
 %union {
@@ -112,6 +140,9 @@ ArithmeticExpr *create_arithmetic_expression(ArithmeticExpr::Type type,
   std::vector<Value> *              value_list;
   std::vector<ConditionSqlNode> *   condition_list;
   std::vector<RelAttrSqlNode> *     rel_attr_list;
+  OrderBySqlNode *                  order_by_item;
+  std::vector<OrderBySqlNode> *     order_by_list;
+  LimitSqlNode *                    limit;
   std::vector<std::string> *        relation_list;
   char *                            string;
   int                               number;
@@ -125,12 +156,14 @@ ArithmeticExpr *create_arithmetic_expression(ArithmeticExpr::Type type,
 //非终结符
 
 /** type 定义了各种解析后的结果输出的是什么类型。类型对应了 union 中的定义的成员变量名称 **/
+%type <string>              identifier
 %type <number>              type
 %type <condition>           condition
 %type <value>               value
 %type <number>              number
 %type <comp>                comp_op
 %type <rel_attr>            rel_attr
+%type <rel_attr>            select_item
 %type <attr_infos>          attr_def_list
 %type <attr_info>           attr_def
 %type <value_list>          value_list
@@ -139,6 +172,11 @@ ArithmeticExpr *create_arithmetic_expression(ArithmeticExpr::Type type,
 %type <rel_attr_list>       select_attr
 %type <relation_list>       rel_list
 %type <rel_attr_list>       attr_list
+%type <rel_attr_list>       group_by
+%type <order_by_item>       order_by_item
+%type <order_by_list>       order_by
+%type <order_by_list>       order_by_list
+%type <limit>               limit
 %type <expression>          expression
 %type <expression_list>     expression_list
 %type <sql_node>            calc_stmt
@@ -149,7 +187,9 @@ ArithmeticExpr *create_arithmetic_expression(ArithmeticExpr::Type type,
 %type <sql_node>            create_table_stmt
 %type <sql_node>            drop_table_stmt
 %type <sql_node>            show_tables_stmt
+%type <sql_node>            show_status_stmt
 %type <sql_node>            desc_table_stmt
+%type <sql_node>            analyze_table_stmt
 %type <sql_node>            create_index_stmt
 %type <sql_node>            drop_index_stmt
 %type <sql_node>            sync_stmt
@@ -159,6 +199,9 @@ ArithmeticExpr *create_arithmetic_expression(ArithmeticExpr::Type type,
 %type <sql_node>            load_data_stmt
 %type <sql_node>            explain_stmt
 %type <sql_node>            set_variable_stmt
+%type <sql_node>            prepare_stmt
+%type <sql_node>            execute_stmt
+%type <sql_node>            deallocate_stmt
 %type <sql_node>            help_stmt
 %type <sql_node>            exit_stmt
 %type <sql_node>            command_wrapper
@@ -168,6 +211,9 @@ ArithmeticExpr *create_arithmetic_expression(ArithmeticExpr::Type type,
 %left '+' '-'
 %left '*' '/'
 %nonassoc UMINUS
+/* WHERE 之后的条件可以为空，此时遇到可以作为字段名的关键字时，按照字段名处理 */
+%nonassoc EMPTY_CONDITION
+%nonassoc GROUP ORDER LIMIT
 %%
 
 commands: command_wrapper opt_semicolon  //commands or sqls. parser starts here.
@@ -186,7 +232,9 @@ command_wrapper:
   | create_table_stmt
   | drop_table_stmt
   | show_tables_stmt
+  | show_status_stmt
   | desc_table_stmt
+  | analyze_table_stmt
   | create_index_stmt
   | drop_index_stmt
   | sync_stmt
@@ -196,6 +244,9 @@ command_wrapper:
   | load_data_stmt
   | explain_stmt
   | set_variable_stmt
+  | prepare_stmt
+  | execute_stmt
+  | deallocate_stmt
   | help_stmt
   | exit_stmt
     ;
@@ -236,7 +287,7 @@ rollback_stmt:
     ;
 
 drop_table_stmt:    /*drop table 语句的语法解析树*/
-    DROP TABLE ID {
+    DROP TABLE identifier {
       $$ = new ParsedSqlNode(SCF_DROP_TABLE);
       $$->drop_table.relation_name = $3;
       free($3);
@@ -248,16 +299,30 @@ show_tables_stmt:
     }
     ;
 
+show_status_stmt:
+    SHOW STATUS {
+      $$ = new ParsedSqlNode(SCF_SHOW_STATUS);
+    }
+    ;
+
 desc_table_stmt:
-    DESC ID  {
+    DESC identifier  {
       $$ = new ParsedSqlNode(SCF_DESC_TABLE);
       $$->desc_table.relation_name = $2;
       free($2);
     }
     ;
 
+analyze_table_stmt:
+    ANALYZE TABLE identifier {
+      $$ = new ParsedSqlNode(SCF_ANALYZE_TABLE);
+      $$->analyze_table.relation_name = $3;
+      free($3);
+    }
+    ;
+
 create_index_stmt:    /*create index 语句的语法解析树*/
-    CREATE INDEX ID ON ID LBRACE ID RBRACE
+    CREATE INDEX identifier ON identifier LBRACE identifier RBRACE
     {
       $$ = new ParsedSqlNode(SCF_CREATE_INDEX);
       CreateIndexSqlNode &create_index = $$->create_index;
@@ -271,7 +336,7 @@ create_index_stmt:    /*create index 语句的语法解析树*/
     ;
 
 drop_index_stmt:      /*drop index 语句的语法解析树*/
-    DROP INDEX ID ON ID
+    DROP INDEX identifier ON identifier
     {
       $$ = new ParsedSqlNode(SCF_DROP_INDEX);
       $$->drop_index.index_name = $3;
@@ -281,7 +346,7 @@ drop_index_stmt:      /*drop index 语句的语法解析树*/
     }
     ;
 create_table_stmt:    /*create table 语句的语法解析树*/
-    CREATE TABLE ID LBRACE attr_def attr_def_list RBRACE
+    CREATE TABLE identifier LBRACE attr_def attr_def_list RBRACE
     {
       $$ = new ParsedSqlNode(SCF_CREATE_TABLE);
       CreateTableSqlNode &create_table = $$->create_table;
@@ -316,7 +381,7 @@ attr_def_list:
     ;
     
 attr_def:
-    ID type LBRACE number RBRACE 
+    identifier type LBRACE number RBRACE 
     {
       $$ = new AttrInfoSqlNode;
       $$->type = (AttrType)$2;
@@ -324,7 +389,7 @@ attr_def:
       $$->length = $4;
       free($1);
     }
-    | ID type
+    | identifier type
     {
       $$ = new AttrInfoSqlNode;
       $$->type = (AttrType)$2;
@@ -342,7 +407,7 @@ type:
     | FLOAT_T  { $$=FLOATS; }
     ;
 insert_stmt:        /*insert   语句的语法解析树*/
-    INSERT INTO ID VALUES LBRACE value value_list RBRACE 
+    INSERT INTO identifier VALUES LBRACE value value_list RBRACE 
     {
       $$ = new ParsedSqlNode(SCF_INSERT);
       $$->insertion.relation_name = $3;
@@ -385,10 +450,15 @@ value:
       $$ = new Value(tmp);
       free(tmp);
     }
+    |'?' {
+      // 预编译语句的参数，类型为UNDEFINED，执行时替换成参数的值
+      $$ = new Value();
+      sql_result->add_param();
+    }
     ;
     
 delete_stmt:    /*  delete 语句的语法解析树*/
-    DELETE FROM ID where 
+    DELETE FROM identifier where 
     {
       $$ = new ParsedSqlNode(SCF_DELETE);
       $$->deletion.relation_name = $3;
@@ -400,7 +470,7 @@ delete_stmt:    /*  delete 语句的语法解析树*/
     }
     ;
 update_stmt:      /*  update 语句的语法解析树*/
-    UPDATE ID SET ID EQ value where 
+    UPDATE identifier SET identifier EQ value where 
     {
       $$ = new ParsedSqlNode(SCF_UPDATE);
       $$->update.relation_name = $2;
@@ -415,7 +485,7 @@ update_stmt:      /*  update 语句的语法解析树*/
     }
     ;
 select_stmt:        /*  select 语句的语法解析树*/
-    SELECT select_attr FROM ID rel_list where
+    SELECT select_attr FROM identifier rel_list where group_by order_by limit
     {
       $$ = new ParsedSqlNode(SCF_SELECT);
       if ($2 != nullptr) {
@@ -433,6 +503,22 @@ select_stmt:        /*  select 语句的语法解析树*/
         $$->selection.conditions.swap(*$6);
         delete $6;
       }
+
+      if ($7 != nullptr) {
+        $$->selection.group_by.swap(*$7);
+        delete $7;
+      }
+
+      if ($8 != nullptr) {
+        $$->selection.order_by.swap(*$8);
+        std::reverse($$->selection.order_by.begin(), $$->selection.order_by.end());
+        delete $8;
+      }
+
+      if ($9 != nullptr) {
+        $$->selection.limit = *$9;
+        delete $9;
+      }
       free($4);
     }
     ;
@@ -497,7 +583,7 @@ select_attr:
       attr.attribute_name = "*";
       $$->emplace_back(attr);
     }
-    | rel_attr attr_list {
+    | select_item attr_list {
       if ($2 != nullptr) {
         $$ = $2;
       } else {
@@ -509,12 +595,12 @@ select_attr:
     ;
 
 rel_attr:
-    ID {
+    identifier {
       $$ = new RelAttrSqlNode;
       $$->attribute_name = $1;
       free($1);
     }
-    | ID DOT ID {
+    | identifier DOT identifier {
       $$ = new RelAttrSqlNode;
       $$->relation_name  = $1;
       $$->attribute_name = $3;
@@ -523,12 +609,29 @@ rel_attr:
     }
     ;
 
+select_item:
+    rel_attr {
+      $$ = $1;
+    }
+    | ID LBRACE '*' RBRACE {
+      $$ = new RelAttrSqlNode;
+      $$->aggregation    = $1;
+      $$->attribute_name = "*";
+      free($1);
+    }
+    | ID LBRACE rel_attr RBRACE {
+      $$ = $3;
+      $$->aggregation = $1;
+      free($1);
+    }
+    ;
+
 attr_list:
     /* empty */
     {
       $$ = nullptr;
     }
-    | COMMA rel_attr attr_list {
+    | COMMA select_item attr_list {
       if ($3 != nullptr) {
         $$ = $3;
       } else {
@@ -545,7 +648,7 @@ rel_list:
     {
       $$ = nullptr;
     }
-    | COMMA ID rel_list {
+    | COMMA identifier rel_list {
       if ($3 != nullptr) {
         $$ = $3;
       } else {
@@ -565,11 +668,94 @@ where:
       $$ = $2;  
     }
     ;
-condition_list:
+group_by:
+    /* empty */
+    {
+      $$ = nullptr;
+    }
+    | GROUP BY rel_attr attr_list {
+      if ($4 != nullptr) {
+        $$ = $4;
+      } else {
+        $$ = new std::vector<RelAttrSqlNode>;
+      }
+      $$->emplace_back(*$3);
+      delete $3;
+    }
+    ;
+order_by:
+    /* empty */
+    {
+      $$ = nullptr;
+    }
+    | ORDER BY order_by_item order_by_list {
+      if ($4 != nullptr) {
+        $$ = $4;
+      } else {
+        $$ = new std::vector<OrderBySqlNode>;
+      }
+      $$->emplace_back(std::move(*$3));
+      delete $3;
+    }
+    ;
+order_by_item:
+    select_item {
+      $$ = new OrderBySqlNode;
+      $$->attr = std::move(*$1);
+      delete $1;
+    }
+    | select_item ASC {
+      $$ = new OrderBySqlNode;
+      $$->attr = std::move(*$1);
+      delete $1;
+    }
+    | select_item DESC {
+      $$ = new OrderBySqlNode;
+      $$->attr = std::move(*$1);
+      $$->ascending = false;
+      delete $1;
+    }
+    ;
+order_by_list:
+    /* empty */
+    {
+      $$ = nullptr;
+    }
+    | COMMA order_by_item order_by_list {
+      if ($3 != nullptr) {
+        $$ = $3;
+      } else {
+        $$ = new std::vector<OrderBySqlNode>;
+      }
+      $$->emplace_back(std::move(*$2));
+      delete $2;
+    }
+    ;
+limit:
     /* empty */
     {
       $$ = nullptr;
     }
+    | LIMIT number {
+      $$ = new LimitSqlNode;
+      $$->limit = $2;
+    }
+    | LIMIT number OFFSET number {
+      $$ = new LimitSqlNode;
+      $$->limit  = $2;
+      $$->offset = $4;
+    }
+    | LIMIT number COMMA number {
+      $$ = new LimitSqlNode;
+      $$->offset = $2;
+      $$->limit  = $4;
+    }
+    ;
+condition_list:
+    /* empty */ %prec EMPTY_CONDITION
+    {
+      $$ = nullptr;
+    }
     | condition {
       $$ = new std::vector<ConditionSqlNode>;
       $$->emplace_back(*$1);
@@ -590,6 +776,7 @@ condition:
       $$->right_is_attr = 0;
       $$->right_value = *$3;
       $$->comp = $2;
+      set_condition_params(*$$, sql_result);
 
       delete $1;
       delete $3;
@@ -602,6 +789,7 @@ condition:
       $$->right_is_attr = 0;
       $$->right_value = *$3;
       $$->comp = $2;
+      set_condition_params(*$$, sql_result);
 
       delete $1;
       delete $3;
@@ -626,6 +814,7 @@ condition:
       $$->right_is_attr = 1;
       $$->right_attr = *$3;
       $$->comp = $2;
+      set_condition_params(*$$, sql_result);
 
       delete $1;
       delete $3;
@@ -642,7 +831,7 @@ comp_op:
     ;
 
 load_data_stmt:
-    LOAD DATA INFILE SSS INTO TABLE ID 
+    LOAD DATA INFILE SSS INTO TABLE identifier 
     {
       char *tmp_file_name = common::substr($4, 1, strlen($4) - 2);
       
@@ -660,10 +849,16 @@ explain_stmt:
       $$ = new ParsedSqlNode(SCF_EXPLAIN);
       $$->explain.sql_node = std::unique_ptr<ParsedSqlNode>($2);
     }
+    | EXPLAIN ANALYZE command_wrapper
+    {
+      $$ = new ParsedSqlNode(SCF_EXPLAIN);
+      $$->explain.sql_node = std::unique_ptr<ParsedSqlNode>($3);
+      $$->explain.analyze = true;
+    }
     ;
 
 set_variable_stmt:
-    SET ID EQ value
+    SET identifier EQ value
     {
       $$ = new ParsedSqlNode(SCF_SET_VARIABLE);
       $$->set_variable.name  = $2;
@@ -673,6 +868,83 @@ set_variable_stmt:
     }
     ;
 
+prepare_stmt:
+    PREPARE identifier FROM SSS
+    {
+      char *tmp_sql = common::substr($4, 1, strlen($4) - 2);
+
+      $$ = new ParsedSqlNode(SCF_PREPARE);
+      $$->prepare.name = $2;
+      $$->prepare.sql  = tmp_sql;
+      free($2);
+      free($4);
+      free(tmp_sql);
+    }
+    ;
+
+execute_stmt:
+    EXECUTE identifier
+    {
+      $$ = new ParsedSqlNode(SCF_EXECUTE);
+      $$->execute.name = $2;
+      free($2);
+    }
+    | EXECUTE identifier USING value value_list
+    {
+      $$ = new ParsedSqlNode(SCF_EXECUTE);
+      $$->execute.name = $2;
+      if ($5 != nullptr) {
+        $$->execute.params.swap(*$5);
+        delete $5;
+      }
+      $$->execute.params.emplace_back(*$4);
+      std::reverse($$->execute.params.begin(), $$->execute.params.end());
+      delete $4;
+      free($2);
+    }
+    ;
+
+deallocate_stmt:
+    DEALLOCATE PREPARE identifier
+    {
+      $$ = new ParsedSqlNode(SCF_DEALLOCATE);
+      $$->deallocate.name = $3;
+      free($3);
+    }
+    | DROP PREPARE identifier
+    {
+      $$ = new ParsedSqlNode(SCF_DEALLOCATE);
+      $$->deallocate.name = $3;
+      free($3);
+    }
+    ;
+
+/* 表名、字段名等标识符，除了ID之外也可以是非保留的关键字 */
+identifier:
+    ID {
+      $$ = $1;
+    }
+    | non_reserved_keyword {
+      $$ = strdup(token_name(sql_string, &@1).c_str());
+    }
+    ;
+
+/* 不作为保留字的关键字，在可以使用标识符的地方仍然作为标识符 */
+non_reserved_keyword:
+    GROUP
+    | BY
+    | ORDER
+    | ASC
+    | LIMIT
+    | OFFSET
+    | ANALYZE
+    | PREPARE
+    | EXECUTE
+    | DEALLOCATE
+    | USING
+    | STATUS
+    ;
+
 opt_semicolon: /*empty*/
     | SEMICOLON
     ;
@@ -0,0 +1,85 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#include "sql/plan_cache/plan_cache.h"
+#include "sql/stmt/stmt.h"
+
+using namespace std;
+
+CachedPlan::CachedPlan(const string &key, uint64_t schema_version, vector<Value> params)
+    : key_(key), schema_version_(schema_version), params_(std::move(params))
+{}
+
+CachedPlan::~CachedPlan()
+{
+  operator_.reset();
+}
+
+void CachedPlan::set_stmt(Stmt *stmt, const TupleSchema &schema)
+{
+  stmt_.reset(stmt);
+  tuple_schema_ = schema;
+}
+
+unique_ptr<CachedPlan> PlanCache::acquire(const string &key, uint64_t schema_version)
+{
+  lock_guard<mutex> guard(mutex_);
+
+  unique_ptr<CachedPlan> result;
+  auto range = plan_index_.equal_range(key);
+  for (auto iter = range.first; iter != range.second && result == nullptr;) {
+    PlanList::iterator plan_iter = iter->second;
+    iter = plan_index_.erase(iter);
+    if ((*plan_iter)->schema_version() == schema_version) {
+      result = std::move(*plan_iter);
+    }
+    plans_.erase(plan_iter);
+  }
+  return result;
+}
+
+void PlanCache::release(unique_ptr<CachedPlan> plan)
+{
+  if (plan == nullptr || !plan->has_operator()) {
+    return;
+  }
+
+  lock_guard<mutex> guard(mutex_);
+  const string &key = plan->key();
+  plans_.push_front(std::move(plan));
+  plan_index_.emplace(key, plans_.begin());
+
+  while (plans_.size() > capacity_) {
+    erase(std::prev(plans_.end()));
+  }
+}
+
+size_t PlanCache::size() const
+{
+  lock_guard<mutex> guard(mutex_);
+  return plans_.size();
+}
+
+void PlanCache::erase(PlanList::iterator plan_iter)
+{
+  auto range = plan_index_.equal_range((*plan_iter)->key());
+  for (auto iter = range.first; iter != range.second; ++iter) {
+    if (iter->second == plan_iter) {
+      plan_index_.erase(iter);
+      break;
+    }
+  }
+  plans_.erase(plan_iter);
+}
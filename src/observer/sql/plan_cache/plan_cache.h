@@ -0,0 +1,106 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#pragma once
+
+#include <stdint.h>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "sql/expr/tuple.h"
+#include "sql/operator/physical_operator.h"
+
+class Stmt;
+
+/**
+ * @brief 缓存的执行计划
+ * @details 执行计划中的参数引用params中的值(见 ParamExpr)，再次执行时修改params后重新打开执行计划即可。
+ * 一个执行计划同时只能被一个请求使用，使用时从 PlanCache 中取出，执行完成后放回。
+ */
+class CachedPlan
+{
+public:
+  CachedPlan(const std::string &key, uint64_t schema_version, std::vector<Value> params);
+  ~CachedPlan();
+
+  const std::string &key() const { return key_; }
+  uint64_t           schema_version() const { return schema_version_; }
+
+  /**
+   * @brief 参数的值，个数在创建时确定，执行计划中记录了每个参数的地址，不能修改容器的大小
+   */
+  std::vector<Value> &params() { return params_; }
+
+  /**
+   * @brief 保存生成执行计划的Stmt和返回结果的表头，执行计划中的算子可能引用Stmt中的数据
+   */
+  void set_stmt(Stmt *stmt, const TupleSchema &schema);
+
+  const TupleSchema &tuple_schema() const { return tuple_schema_; }
+
+  std::unique_ptr<PhysicalOperator> take_operator() { return std::move(operator_); }
+  void return_operator(std::unique_ptr<PhysicalOperator> oper) { operator_ = std::move(oper); }
+  bool has_operator() const { return operator_ != nullptr; }
+
+private:
+  std::string                       key_;
+  uint64_t                          schema_version_ = 0;  ///< 生成执行计划时数据库的schema版本
+  std::vector<Value>                params_;
+  std::unique_ptr<Stmt>             stmt_;
+  TupleSchema                       tuple_schema_;
+  std::unique_ptr<PhysicalOperator> operator_;  ///< 最先析构，算子引用了params_和stmt_
+};
+
+/**
+ * @brief 执行计划缓存
+ * @details 按照SQL、参数类型和影响执行计划的会话变量缓存执行计划，相同的key可以有多个执行计划，
+ * 同时执行同一个语句的请求各自使用一个。超过容量时淘汰最久没有使用的执行计划。
+ * 表结构、索引或统计信息变化后数据库的schema版本增加，旧版本的执行计划不再使用。
+ */
+class PlanCache
+{
+public:
+  static constexpr size_t DEFAULT_CAPACITY = 1024;
+
+  explicit PlanCache(size_t capacity = DEFAULT_CAPACITY) : capacity_(capacity) {}
+
+  /**
+   * @brief 取出一个可以使用的执行计划，同时删除过期的执行计划
+   * @return 没有可以使用的执行计划时返回空
+   */
+  std::unique_ptr<CachedPlan> acquire(const std::string &key, uint64_t schema_version);
+
+  /**
+   * @brief 执行完成后放回执行计划
+   */
+  void release(std::unique_ptr<CachedPlan> plan);
+
+  size_t size() const;
+
+private:
+  using PlanList = std::list<std::unique_ptr<CachedPlan>>;
+
+  void erase(PlanList::iterator iter);
+
+private:
+  mutable std::mutex mutex_;
+  size_t             capacity_ = DEFAULT_CAPACITY;
+  PlanList           plans_;  ///< 空闲的执行计划，最近放回的在前面
+  std::unordered_multimap<std::string, PlanList::iterator> plan_index_;
+};
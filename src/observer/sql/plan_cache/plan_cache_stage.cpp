@@ -21,5 +21,155 @@ See the Mulan PSL v2 for more details. */
 #include "common/io/io.h"
 #include "common/lang/string.h"
 #include "common/log/log.h"
+#include "event/session_event.h"
+#include "event/sql_event.h"
+#include "session/session.h"
+#include "sql/parser/parse_defs.h"
+#include "sql/plan_cache/prepared_stmt.h"
+#include "sql/stmt/stmt.h"
+#include "storage/db/db.h"
 
+using namespace std;
 using namespace common;
+
+RC PlanCacheStage::handle_request(SQLStageEvent *sql_event)
+{
+  const unique_ptr<ParsedSqlNode> &sql_node = sql_event->sql_node();
+  if (sql_node == nullptr || sql_node->flag != SCF_EXECUTE) {
+    return RC::SUCCESS;
+  }
+
+  SessionEvent *session_event = sql_event->session_event();
+  SqlResult    *sql_result    = session_event->sql_result();
+  const ExecuteSqlNode &execute = sql_node->execute;
+
+  PreparedStmt *stmt = session_event->session()->find_prepared_stmt(execute.name);
+  if (stmt == nullptr) {
+    LOG_WARN("no such prepared statement. name=%s", execute.name.c_str());
+    sql_result->set_return_code(RC::NOTFOUND);
+    sql_result->set_state_string("Unknown prepared statement " + execute.name);
+    return RC::NOTFOUND;
+  }
+
+  // execute 之后sql_node会被替换，参数需要先复制出来
+  const vector<Value> params = execute.params;
+  return this->execute(sql_event, stmt, params);
+}
+
+RC PlanCacheStage::execute(SQLStageEvent *sql_event, PreparedStmt *stmt, const vector<Value> &params)
+{
+  SessionEvent *session_event = sql_event->session_event();
+  Session      *session       = session_event->session();
+  SqlResult    *sql_result    = session_event->sql_result();
+
+  if (static_cast<int>(params.size()) != stmt->param_num()) {
+    LOG_WARN("wrong number of parameters. name=%s, expect=%d, actual=%d",
+             stmt->name().c_str(), stmt->param_num(), static_cast<int>(params.size()));
+    sql_result->set_return_code(RC::INVALID_ARGUMENT);
+    sql_result->set_state_string("Incorrect number of parameters");
+    return RC::INVALID_ARGUMENT;
+  }
+
+  const string   key            = plan_key(session, stmt->sql(), params);
+  const uint64_t schema_version = session->get_current_db()->schema_version();
+
+  unique_ptr<CachedPlan> plan = plan_cache_.acquire(key, schema_version);
+  if (plan != nullptr) {
+    // 参数的类型是key的一部分，这里只有值不同
+    vector<Value> &plan_params = plan->params();
+    for (size_t i = 0; i < params.size(); i++) {
+      plan_params[i] = params[i];
+    }
+
+    LOG_TRACE("hit plan cache. sql=%s", stmt->sql().c_str());
+    sql_result->set_tuple_schema(plan->tuple_schema());
+    sql_result->set_operator(plan->take_operator());
+    sql_result->set_cached_plan(&plan_cache_, std::move(plan));
+    return RC::SUCCESS;
+  }
+
+  unique_ptr<ParsedSqlNode> sql_node;
+  int param_num = 0;
+  RC rc = PreparedStmt::parse(stmt->sql(), sql_node, param_num);
+  if (OB_FAIL(rc)) {
+    sql_result->set_return_code(rc);
+    sql_result->set_state_string("Failed to parse prepared statement");
+    return rc;
+  }
+
+  plan = make_unique<CachedPlan>(key, schema_version, params);
+  rc = PreparedStmt::bind_params(*sql_node, plan->params());
+  if (OB_FAIL(rc)) {
+    sql_result->set_return_code(rc);
+    return rc;
+  }
+
+  sql_event->set_sql_node(std::move(sql_node));
+  sql_event->set_cached_plan(std::move(plan));
+  return RC::SUCCESS;
+}
+
+RC PlanCacheStage::add_plan(SQLStageEvent *sql_event)
+{
+  unique_ptr<CachedPlan> &plan = sql_event->cached_plan();
+  if (plan == nullptr) {
+    return RC::SUCCESS;
+  }
+
+  Stmt      *stmt       = sql_event->stmt();
+  SqlResult *sql_result = sql_event->session_event()->sql_result();
+  if (stmt == nullptr || (stmt->type() != StmtType::SELECT && stmt->type() != StmtType::DELETE) ||
+      !sql_result->has_operator() || !is_reusable(sql_result->get_operator())) {
+    return RC::SUCCESS;
+  }
+
+  // 执行计划中的算子可能引用Stmt中的数据，由缓存的执行计划管理Stmt
+  plan->set_stmt(stmt, sql_result->tuple_schema());
+  sql_event->set_stmt(nullptr);
+  sql_result->set_cached_plan(&plan_cache_, std::move(plan));
+  return RC::SUCCESS;
+}
+
+string PlanCacheStage::plan_key(Session *session, const string &sql, const vector<Value> &params)
+{
+  // 影响执行计划的会话变量和参数的类型都是key的一部分
+  string key = session->get_current_db_name();
+  key += '\n';
+  key += to_string(static_cast<int>(session->execution_mode()));
+  key += ',';
+  key += to_string(session->operator_memory_limit());
+  key += ',';
+  key += to_string(session->parallel_workers());
+  for (const Value &param : params) {
+    key += ',';
+    key += attr_type_to_string(param.attr_type());
+  }
+  key += '\n';
+  key += sql;
+  return key;
+}
+
+/**
+ * @brief 算子能否在执行结束后重新打开
+ * @details 这些算子在open时重置了所有的执行状态，也没有引用查询的内存统计。
+ * 其它算子比如排序、hash join等，保存了中间结果或者与执行环境相关的状态，不缓存
+ */
+bool PlanCacheStage::is_reusable(const PhysicalOperator *oper)
+{
+  switch (oper->type()) {
+    case PhysicalOperatorType::TABLE_SCAN:
+    case PhysicalOperatorType::INDEX_SCAN:
+    case PhysicalOperatorType::PREDICATE:
+    case PhysicalOperatorType::PROJECT:
+    case PhysicalOperatorType::LIMIT:
+    case PhysicalOperatorType::DELETE: break;
+    default: return false;
+  }
+
+  for (const unique_ptr<PhysicalOperator> &child : const_cast<PhysicalOperator *>(oper)->children()) {
+    if (!is_reusable(child.get())) {
+      return false;
+    }
+  }
+  return true;
+}
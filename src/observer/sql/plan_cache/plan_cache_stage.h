@@ -14,14 +14,51 @@ See the Mulan PSL v2 for more details. */
 
 #pragma once
 
+#include <string>
+#include <vector>
+
 #include "common/rc.h"
+#include "sql/plan_cache/plan_cache.h"
+
+class SQLStageEvent;
+class PreparedStmt;
+class Session;
 
 /**
- * @brief 尝试从Plan的缓存中获取Plan，如果没有命中，则执行Optimizer
+ * @brief 执行预编译的语句，尝试从Plan的缓存中获取Plan，如果没有命中，则执行Optimizer
  * @ingroup SQLStage
- * @details 实际上现在什么都没做。不过PlanCache对数据库的优化提升明显，是一个非常有趣的功能，
- * 感兴趣的同学可以参考OceanBase的实现
+ * @details 只有执行预编译的语句(EXECUTE或者MySQL协议的COM_STMT_EXECUTE)时使用执行计划缓存。
+ * 命中缓存时把参数的值写到缓存的执行计划中，直接执行，跳过resolve和optimize。没有命中时解析预编译的SQL，
+ * 绑定参数后按照正常的流程生成执行计划，执行之后由 add_plan 放到缓存中。
+ * 只缓存可以重复打开的算子组成的执行计划，见 is_reusable。
  */
 class PlanCacheStage
 {
+public:
+  PlanCacheStage() = default;
+  virtual ~PlanCacheStage() = default;
+
+public:
+  /**
+   * @brief 在parse之后调用，处理 EXECUTE 语句
+   */
+  RC handle_request(SQLStageEvent *sql_event);
+
+  /**
+   * @brief 使用指定的参数执行预编译的语句
+   * @details 命中缓存时SqlResult中已经有了执行计划
+   */
+  RC execute(SQLStageEvent *sql_event, PreparedStmt *stmt, const std::vector<Value> &params);
+
+  /**
+   * @brief 在execute之后调用，把生成的执行计划放到缓存中
+   */
+  RC add_plan(SQLStageEvent *sql_event);
+
+private:
+  static std::string plan_key(Session *session, const std::string &sql, const std::vector<Value> &params);
+  static bool is_reusable(const PhysicalOperator *oper);
+
+private:
+  PlanCache plan_cache_;
 };
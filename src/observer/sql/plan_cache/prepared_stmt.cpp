@@ -0,0 +1,125 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#include "sql/plan_cache/prepared_stmt.h"
+#include "common/log/log.h"
+#include "sql/parser/parse.h"
+
+using namespace std;
+
+/**
+ * @brief 遍历SQL中所有的参数
+ * @details visitor的参数依次是参数的序号、参数在语法树中的值、条件中引用参数的指针(不是条件时为空)。
+ * 条件中参数的序号在解析时记录；insert的值按照顺序编号；update的值在条件之前，序号为0
+ */
+template <typename Visitor>
+static void visit_params(ParsedSqlNode &sql_node, Visitor &&visitor)
+{
+  auto visit_conditions = [&visitor](vector<ConditionSqlNode> &conditions) {
+    for (ConditionSqlNode &condition : conditions) {
+      if (condition.left_param >= 0) {
+        visitor(condition.left_param, condition.left_value, &condition.left_param_value);
+      }
+      if (condition.right_param >= 0) {
+        visitor(condition.right_param, condition.right_value, &condition.right_param_value);
+      }
+    }
+  };
+
+  switch (sql_node.flag) {
+    case SCF_SELECT: {
+      visit_conditions(sql_node.selection.conditions);
+    } break;
+    case SCF_DELETE: {
+      visit_conditions(sql_node.deletion.conditions);
+    } break;
+    case SCF_UPDATE: {
+      if (sql_node.update.value.attr_type() == UNDEFINED) {
+        visitor(0, sql_node.update.value, nullptr);
+      }
+      visit_conditions(sql_node.update.conditions);
+    } break;
+    case SCF_INSERT: {
+      int index = 0;
+      for (Value &value : sql_node.insertion.values) {
+        if (value.attr_type() == UNDEFINED) {
+          visitor(index++, value, nullptr);
+        }
+      }
+    } break;
+    case SCF_EXPLAIN: {
+      if (sql_node.explain.sql_node) {
+        visit_params(*sql_node.explain.sql_node, visitor);
+      }
+    } break;
+    default: break;
+  }
+}
+
+RC PreparedStmt::parse(const string &sql, unique_ptr<ParsedSqlNode> &sql_node, int &param_num)
+{
+  ParsedSqlResult parsed_sql_result;
+  ::parse(sql.c_str(), &parsed_sql_result);
+  if (parsed_sql_result.sql_nodes().size() != 1) {
+    LOG_WARN("prepared statement should contain exactly one sql. sql=%s", sql.c_str());
+    return RC::SQL_SYNTAX;
+  }
+
+  sql_node = std::move(parsed_sql_result.sql_nodes().front());
+  if (sql_node->flag == SCF_ERROR) {
+    return RC::SQL_SYNTAX;
+  }
+
+  switch (sql_node->flag) {
+    case SCF_PREPARE:
+    case SCF_EXECUTE:
+    case SCF_DEALLOCATE: {
+      LOG_WARN("cannot prepare a prepare/execute/deallocate statement. sql=%s", sql.c_str());
+      return RC::UNIMPLENMENT;
+    }
+    default: break;
+  }
+
+  // 其它位置的参数(比如 set 语句中的值)没有办法绑定
+  param_num = parsed_sql_result.param_num();
+  int visited = 0;
+  visit_params(*sql_node, [&visited, param_num](int index, Value &, const Value **) {
+    if (index < param_num) {
+      visited++;
+    }
+  });
+  if (visited != param_num) {
+    LOG_WARN("parameters are not allowed here. sql=%s, param num=%d, bindable=%d", sql.c_str(), param_num, visited);
+    return RC::SQL_SYNTAX;
+  }
+  return RC::SUCCESS;
+}
+
+RC PreparedStmt::bind_params(ParsedSqlNode &sql_node, const vector<Value> &params)
+{
+  RC rc = RC::SUCCESS;
+  visit_params(sql_node, [&rc, &params](int index, Value &value, const Value **param_value) {
+    if (index >= static_cast<int>(params.size())) {
+      rc = RC::INVALID_ARGUMENT;
+      return;
+    }
+
+    value = params[index];
+    if (param_value != nullptr) {
+      *param_value = &params[index];
+    }
+  });
+  return rc;
+}
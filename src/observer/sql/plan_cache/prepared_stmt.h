@@ -0,0 +1,63 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#pragma once
+
+#include <stdint.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/rc.h"
+#include "sql/parser/parse_defs.h"
+
+/**
+ * @brief 预编译的语句
+ * @details 通过 PREPARE 语句或者MySQL协议的COM_STMT_PREPARE创建，保存在会话中。
+ * 语句中的条件、insert和update的值可以使用?表示参数，执行时按照参数在SQL中出现的顺序提供参数的值。
+ * 这里只保存SQL，执行时由 PlanCacheStage 查找缓存的执行计划，没有命中时再重新解析。
+ */
+class PreparedStmt
+{
+public:
+  PreparedStmt(uint32_t id, const std::string &name, const std::string &sql, int param_num)
+      : id_(id), name_(name), sql_(sql), param_num_(param_num)
+  {}
+
+  uint32_t           id() const { return id_; }
+  const std::string &name() const { return name_; }
+  const std::string &sql() const { return sql_; }
+  int                param_num() const { return param_num_; }
+
+  /**
+   * @brief 解析一个预编译的SQL
+   * @details 只能解析一条SQL，参数只能出现在条件、insert和update的值中
+   * @param param_num 参数的个数
+   */
+  static RC parse(const std::string &sql, std::unique_ptr<ParsedSqlNode> &sql_node, int &param_num);
+
+  /**
+   * @brief 把参数的值绑定到解析后的SQL上
+   * @details 条件中的参数记录params中对应参数的地址，生成执行计划时使用 ParamExpr 引用参数，
+   * 所以params需要与执行计划一起保存，重新执行时修改params中的值即可
+   */
+  static RC bind_params(ParsedSqlNode &sql_node, const std::vector<Value> &params);
+
+private:
+  uint32_t    id_ = 0;   ///< MySQL协议中使用编号引用预编译的语句
+  std::string name_;     ///< PREPARE 语句中指定的名字
+  std::string sql_;
+  int         param_num_ = 0;
+};
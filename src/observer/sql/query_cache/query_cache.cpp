@@ -0,0 +1,159 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#include <ctype.h>
+#include <algorithm>
+
+#include "sql/query_cache/query_cache.h"
+#include "common/log/log.h"
+#include "storage/db/db.h"
+#include "storage/table/table.h"
+
+using namespace std;
+
+void QueryResult::add_table(const string &table_name, uint64_t data_version)
+{
+  table_versions_.emplace_back(table_name, data_version);
+}
+
+void QueryResult::append_row(vector<Value> row)
+{
+  memory_size_ += sizeof(row);
+  for (const Value &value : row) {
+    memory_size_ += value.memory_size();
+  }
+  rows_.push_back(std::move(row));
+}
+
+bool QueryResult::is_valid(Db *db) const
+{
+  if (db->schema_version() != schema_version_) {
+    return false;
+  }
+
+  for (const auto &[table_name, data_version] : table_versions_) {
+    Table *table = db->find_table(table_name.c_str());
+    if (table == nullptr || table->data_version() != data_version) {
+      return false;
+    }
+  }
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+QueryCache::QueryCache(int64_t memory_limit, int64_t result_limit, size_t max_entries)
+    : memory_limit_(std::max<int64_t>(memory_limit, 0)),
+      result_limit_(std::min(std::max<int64_t>(result_limit, 0), memory_limit_)),
+      max_entries_(max_entries)
+{}
+
+string QueryCache::make_key(const string &db_name, const string &sql)
+{
+  string key = db_name;
+  key.push_back('\n');
+
+  const size_t prefix_size = key.size();
+  char         quote       = 0;
+  bool         blank       = false;
+  for (char ch : sql) {
+    if (quote != 0) {
+      key.push_back(ch);
+      if (ch == quote) {
+        quote = 0;
+      }
+      continue;
+    }
+
+    if (isspace(static_cast<unsigned char>(ch))) {
+      blank = true;
+      continue;
+    }
+
+    if (blank && key.size() > prefix_size) {
+      key.push_back(' ');
+    }
+    blank = false;
+    key.push_back(ch);
+    if (ch == '\'' || ch == '"') {
+      quote = ch;
+    }
+  }
+
+  while (key.size() > prefix_size && (key.back() == ';' || key.back() == ' ')) {
+    key.pop_back();
+  }
+  return key;
+}
+
+shared_ptr<const QueryResult> QueryCache::lookup(const string &key, Db *db)
+{
+  lock_guard<mutex> guard(mutex_);
+  auto iter = index_.find(key);
+  if (iter == index_.end()) {
+    stats_.misses++;
+    return nullptr;
+  }
+
+  EntryList::iterator entry_iter = iter->second;
+  if (!entry_iter->second->is_valid(db)) {
+    LOG_TRACE("query result is out of date. key=%s", key.c_str());
+    erase(entry_iter);
+    stats_.invalidations++;
+    stats_.misses++;
+    return nullptr;
+  }
+
+  entries_.splice(entries_.begin(), entries_, entry_iter);
+  stats_.hits++;
+  return entry_iter->second;
+}
+
+void QueryCache::insert(const string &key, shared_ptr<const QueryResult> result)
+{
+  if (!enabled() || result->memory_size() > result_limit_) {
+    return;
+  }
+
+  lock_guard<mutex> guard(mutex_);
+  auto iter = index_.find(key);
+  if (iter != index_.end()) {
+    erase(iter->second);
+  }
+
+  stats_.memory_size += result->memory_size();
+  entries_.emplace_front(key, std::move(result));
+  index_.emplace(key, entries_.begin());
+  stats_.inserts++;
+
+  while (stats_.memory_size > memory_limit_ || entries_.size() > max_entries_) {
+    erase(std::prev(entries_.end()));
+    stats_.evictions++;
+  }
+}
+
+QueryCacheStats QueryCache::stats() const
+{
+  lock_guard<mutex> guard(mutex_);
+  QueryCacheStats stats = stats_;
+  stats.entries         = static_cast<int64_t>(entries_.size());
+  return stats;
+}
+
+void QueryCache::erase(EntryList::iterator iter)
+{
+  stats_.memory_size -= iter->second->memory_size();
+  index_.erase(iter->first);
+  entries_.erase(iter);
+}
@@ -0,0 +1,139 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#pragma once
+
+#include <stdint.h>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "sql/expr/tuple.h"
+
+class Db;
+
+/**
+ * @brief 缓存的查询结果
+ * @details 除了表头和所有的行之外，还记录了执行查询之前数据库的schema版本和每个表的数据版本，
+ * 任何一个版本变化都说明结果已经过期。
+ */
+class QueryResult
+{
+public:
+  QueryResult(uint64_t schema_version, const TupleSchema &tuple_schema)
+      : schema_version_(schema_version), tuple_schema_(tuple_schema)
+  {}
+
+  void add_table(const std::string &table_name, uint64_t data_version);
+  void append_row(std::vector<Value> row);
+
+  const TupleSchema                     &tuple_schema() const { return tuple_schema_; }
+  const std::vector<std::vector<Value>> &rows() const { return rows_; }
+
+  /**
+   * @brief 估算占用的内存
+   */
+  int64_t memory_size() const { return memory_size_; }
+
+  /**
+   * @brief 数据库的schema以及查询的表中的数据都没有变化
+   */
+  bool is_valid(Db *db) const;
+
+private:
+  uint64_t                                       schema_version_ = 0;
+  std::vector<std::pair<std::string, uint64_t>>  table_versions_;  ///< 表名和执行查询之前表的数据版本
+  TupleSchema                                    tuple_schema_;
+  std::vector<std::vector<Value>>                rows_;
+  int64_t                                        memory_size_ = 0;
+};
+
+/**
+ * @brief 查询缓存的统计信息
+ */
+struct QueryCacheStats
+{
+  int64_t hits          = 0;
+  int64_t misses        = 0;
+  int64_t inserts       = 0;
+  int64_t evictions     = 0;  ///< 超过容量被淘汰的结果
+  int64_t invalidations = 0;  ///< 表中的数据修改之后过期的结果
+  int64_t entries       = 0;
+  int64_t memory_size   = 0;
+};
+
+/**
+ * @brief 查询结果缓存
+ * @details 按照数据库名和规范化之后的SQL缓存只读查询的结果。缓存的结果个数和占用的内存都有上限，
+ * 超过上限时淘汰最久没有使用的结果。结果在查找时检查是否过期，过期的结果直接删除。
+ * 多个会话可以同时使用同一个结果，所以结果一旦放到缓存中就不再修改。
+ */
+class QueryCache
+{
+public:
+  static constexpr int64_t DEFAULT_MEMORY_LIMIT = 64 * 1024 * 1024;
+  static constexpr int64_t DEFAULT_RESULT_LIMIT = 1024 * 1024;
+  static constexpr size_t  DEFAULT_MAX_ENTRIES  = 1024;
+
+  /**
+   * @param memory_limit 所有结果占用的内存上限，为0时不缓存任何结果
+   * @param result_limit 单个结果占用的内存上限，避免一个很大的结果淘汰掉其它所有的结果
+   * @param max_entries  缓存结果的个数上限
+   */
+  QueryCache(int64_t memory_limit = DEFAULT_MEMORY_LIMIT, int64_t result_limit = DEFAULT_RESULT_LIMIT,
+      size_t max_entries = DEFAULT_MAX_ENTRIES);
+
+  bool    enabled() const { return memory_limit_ > 0 && max_entries_ > 0; }
+  int64_t result_limit() const { return result_limit_; }
+
+  /**
+   * @brief 生成缓存的key
+   * @details 合并SQL中连续的空白字符，并删除首尾的空白和分号，引号中的内容保持不变。
+   * 不修改大小写，因为表名和返回的列名都是区分大小写的
+   */
+  static std::string make_key(const std::string &db_name, const std::string &sql);
+
+  /**
+   * @brief 查找缓存的结果
+   * @return 没有缓存或者结果已经过期时返回空
+   */
+  std::shared_ptr<const QueryResult> lookup(const std::string &key, Db *db);
+
+  /**
+   * @brief 缓存一个结果，会替换相同key的结果
+   */
+  void insert(const std::string &key, std::shared_ptr<const QueryResult> result);
+
+  QueryCacheStats stats() const;
+
+private:
+  using Entry     = std::pair<std::string, std::shared_ptr<const QueryResult>>;
+  using EntryList = std::list<Entry>;
+
+  void erase(EntryList::iterator iter);
+
+private:
+  mutable std::mutex mutex_;
+  int64_t            memory_limit_ = DEFAULT_MEMORY_LIMIT;
+  int64_t            result_limit_ = DEFAULT_RESULT_LIMIT;
+  size_t             max_entries_  = DEFAULT_MAX_ENTRIES;
+  EntryList          entries_;  ///< 最近使用的在前面
+  std::unordered_map<std::string, EntryList::iterator> index_;
+  QueryCacheStats    stats_;
+};
@@ -17,14 +17,81 @@ See the Mulan PSL v2 for more details. */
 
 #include "query_cache_stage.h"
 
-#include "common/conf/ini.h"
-#include "common/io/io.h"
-#include "common/lang/string.h"
+#include "common/global_context.h"
 #include "common/log/log.h"
+#include "event/session_event.h"
+#include "event/sql_event.h"
+#include "session/session.h"
+#include "sql/executor/sql_result.h"
+#include "sql/operator/query_result_physical_operator.h"
+#include "sql/query_cache/query_cache.h"
+#include "sql/stmt/select_stmt.h"
+#include "storage/db/db.h"
+#include "storage/table/table.h"
 
-using namespace common;
+using namespace std;
 
 RC QueryCacheStage::handle_request(SQLStageEvent *sql_event)
 {
+  string key;
+  if (!cacheable(sql_event, key)) {
+    return RC::SUCCESS;
+  }
+
+  Session *session = sql_event->session_event()->session();
+  shared_ptr<const QueryResult> result = GCTX.query_cache_->lookup(key, session->get_current_db());
+  if (result == nullptr) {
+    return RC::SUCCESS;
+  }
+
+  LOG_TRACE("hit query cache. rows=%d, sql=%s", static_cast<int>(result->rows().size()), sql_event->sql().c_str());
+  SqlResult *sql_result = sql_event->session_event()->sql_result();
+  sql_result->set_tuple_schema(result->tuple_schema());
+  sql_result->set_operator(make_unique<QueryResultPhysicalOperator>(std::move(result)));
+  return RC::SUCCESS;
+}
+
+RC QueryCacheStage::add_result(SQLStageEvent *sql_event)
+{
+  Stmt      *stmt       = sql_event->stmt();
+  SqlResult *sql_result = sql_event->session_event()->sql_result();
+  if (stmt == nullptr || stmt->type() != StmtType::SELECT || !sql_result->has_operator()) {
+    return RC::SUCCESS;
+  }
+
+  string key;
+  if (!cacheable(sql_event, key)) {
+    return RC::SUCCESS;
+  }
+
+  Db  *db     = sql_event->session_event()->session()->get_current_db();
+  auto result = make_unique<QueryResult>(db->schema_version(), sql_result->tuple_schema());
+  for (Table *table : static_cast<SelectStmt *>(stmt)->tables()) {
+    result->add_table(table->name(), table->data_version());
+  }
+  sql_result->set_query_cache(GCTX.query_cache_, key, std::move(result));
   return RC::SUCCESS;
 }
+
+bool QueryCacheStage::cacheable(SQLStageEvent *sql_event, string &key) const
+{
+  if (GCTX.query_cache_ == nullptr || !GCTX.query_cache_->enabled()) {
+    return false;
+  }
+
+  SessionEvent *session_event = sql_event->session_event();
+  Session      *session       = session_event->session();
+  if (session_event->prepared_stmt() != nullptr || session->is_trx_multi_operation_mode()) {
+    return false;
+  }
+
+  // 在解析之前只能根据SQL的开头判断是不是查询语句，解析之后还会再检查一次
+  const string &sql   = sql_event->sql();
+  size_t        start = sql.find_first_not_of(" \t\r\n");
+  if (start == string::npos || strncasecmp(sql.c_str() + start, "select", 6) != 0) {
+    return false;
+  }
+
+  key = QueryCache::make_key(session->get_current_db_name(), sql);
+  return true;
+}
@@ -14,6 +14,8 @@ See the Mulan PSL v2 for more details. */
 
 #pragma once
 
+#include <string>
+
 #include "common/rc.h"
 
 class SQLStageEvent;
@@ -21,7 +23,8 @@ class SQLStageEvent;
 /**
  * @brief 查询缓存处理
  * @ingroup SQLStage
- * @details 当前什么都没做
+ * @details 缓存只读查询的结果，见 QueryCache。只有自动提交的select语句使用查询缓存，
+ * 显式开启的事务中可能看到自己修改的数据，或者需要看到事务开始时的数据，都不能使用缓存的结果。
  */
 class QueryCacheStage
 {
@@ -30,5 +33,18 @@ public:
   virtual ~QueryCacheStage() = default;
 
 public:
+  /**
+   * @brief 在解析SQL之前查找缓存的结果
+   * @details 命中时直接把结果设置到SqlResult中，不需要再执行后面的阶段
+   */
   RC handle_request(SQLStageEvent *sql_event);
+
+  /**
+   * @brief 执行计划生成之后，让SqlResult在返回结果时把结果保存到缓存中
+   * @details 需要在开始执行之前记录表的数据版本，执行期间有其它事务修改了数据也能判断出结果已经过期
+   */
+  RC add_result(SQLStageEvent *sql_event);
+
+private:
+  bool cacheable(SQLStageEvent *sql_event, std::string &key) const;
 };
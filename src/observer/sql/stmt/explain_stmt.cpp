@@ -16,7 +16,8 @@ See the Mulan PSL v2 for more details. */
 #include "sql/stmt/stmt.h"
 #include "common/log/log.h"
 
-ExplainStmt::ExplainStmt(std::unique_ptr<Stmt> child_stmt) : child_stmt_(std::move(child_stmt))
+ExplainStmt::ExplainStmt(std::unique_ptr<Stmt> child_stmt, bool analyze)
+    : child_stmt_(std::move(child_stmt)), analyze_(analyze)
 {}
 
 RC ExplainStmt::create(Db *db, const ExplainSqlNode &explain, Stmt *&stmt)
@@ -29,6 +30,6 @@ RC ExplainStmt::create(Db *db, const ExplainSqlNode &explain, Stmt *&stmt)
   }
 
   std::unique_ptr<Stmt> child_stmt_ptr = std::unique_ptr<Stmt>(child_stmt);
-  stmt = new ExplainStmt(std::move(child_stmt_ptr));
+  stmt = new ExplainStmt(std::move(child_stmt_ptr), explain.analyze);
   return rc;
 }
@@ -24,7 +24,7 @@ See the Mulan PSL v2 for more details. */
 class ExplainStmt : public Stmt 
 {
 public:
-  ExplainStmt(std::unique_ptr<Stmt> child_stmt);
+  ExplainStmt(std::unique_ptr<Stmt> child_stmt, bool analyze);
   virtual ~ExplainStmt() = default;
 
   StmtType type() const override
@@ -37,8 +37,14 @@ public:
     return child_stmt_.get();
   }
 
+  bool analyze() const
+  {
+    return analyze_;
+  }
+
   static RC create(Db *db, const ExplainSqlNode &query, Stmt *&stmt);
 
 private:
   std::unique_ptr<Stmt> child_stmt_;
+  bool analyze_ = false;
 };
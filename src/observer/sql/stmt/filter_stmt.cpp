@@ -103,7 +103,11 @@ RC FilterStmt::create_filter_unit(Db *db, Table *default_table, std::unordered_m
     filter_unit->set_left(filter_obj);
   } else {
     FilterObj filter_obj;
-    filter_obj.init_value(condition.left_value);
+    if (condition.left_param_value != nullptr) {
+      filter_obj.init_param(condition.left_param_value);
+    } else {
+      filter_obj.init_value(condition.left_value);
+    }
     filter_unit->set_left(filter_obj);
   }
 
@@ -120,7 +124,11 @@ RC FilterStmt::create_filter_unit(Db *db, Table *default_table, std::unordered_m
     filter_unit->set_right(filter_obj);
   } else {
     FilterObj filter_obj;
-    filter_obj.init_value(condition.right_value);
+    if (condition.right_param_value != nullptr) {
+      filter_obj.init_param(condition.right_param_value);
+    } else {
+      filter_obj.init_value(condition.right_value);
+    }
     filter_unit->set_right(filter_obj);
   }
 
@@ -29,6 +29,7 @@ struct FilterObj
   bool is_attr;
   Field field;
   Value value;
+  const Value *param = nullptr;  ///< 预编译语句的参数，执行前绑定，见 ParamExpr
 
   void init_attr(const Field &field)
   {
@@ -41,6 +42,13 @@ struct FilterObj
     is_attr = false;
     this->value = value;
   }
+
+  void init_param(const Value *param)
+  {
+    is_attr = false;
+    this->value = *param;
+    this->param = param;
+  }
 };
 
 class FilterUnit 
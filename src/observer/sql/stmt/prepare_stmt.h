@@ -0,0 +1,71 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#pragma once
+
+#include <string>
+
+#include "sql/stmt/stmt.h"
+
+/**
+ * @brief PREPARE 语句，预编译一个SQL语句，保存在会话中
+ * @ingroup Statement
+ */
+class PrepareStmt : public Stmt
+{
+public:
+  PrepareStmt(const PrepareSqlNode &prepare) : prepare_(prepare)
+  {}
+  virtual ~PrepareStmt() = default;
+
+  StmtType type() const override { return StmtType::PREPARE; }
+
+  const std::string &name() const { return prepare_.name; }
+  const std::string &sql() const { return prepare_.sql; }
+
+  static RC create(const PrepareSqlNode &prepare, Stmt *&stmt)
+  {
+    stmt = new PrepareStmt(prepare);
+    return RC::SUCCESS;
+  }
+
+private:
+  PrepareSqlNode prepare_;
+};
+
+/**
+ * @brief DEALLOCATE PREPARE 语句，删除预编译的语句
+ * @ingroup Statement
+ */
+class DeallocateStmt : public Stmt
+{
+public:
+  DeallocateStmt(const DeallocateSqlNode &deallocate) : name_(deallocate.name)
+  {}
+  virtual ~DeallocateStmt() = default;
+
+  StmtType type() const override { return StmtType::DEALLOCATE; }
+
+  const std::string &name() const { return name_; }
+
+  static RC create(const DeallocateSqlNode &deallocate, Stmt *&stmt)
+  {
+    stmt = new DeallocateStmt(deallocate);
+    return RC::SUCCESS;
+  }
+
+private:
+  std::string name_;
+};
@@ -12,6 +12,8 @@ See the Mulan PSL v2 for more details. */
 // Created by Wangyunlai on 2022/6/6.
 //
 
+#include <algorithm>
+
 #include "sql/stmt/select_stmt.h"
 #include "sql/stmt/filter_stmt.h"
 #include "common/log/log.h"
@@ -36,6 +38,83 @@ static void wildcard_fields(Table *table, std::vector<Field> &field_metas)
   }
 }
 
+/**
+ * @brief 查找聚合函数参数或者group by中的字段，不支持通配符
+ */
+static RC find_field(Db *db, const std::vector<Table *> &tables,
+    const std::unordered_map<std::string, Table *> &table_map, const RelAttrSqlNode &attr, Field &field)
+{
+  Table *table = nullptr;
+  if (common::is_blank(attr.relation_name.c_str())) {
+    if (tables.size() != 1) {
+      LOG_WARN("invalid. I do not know the attr's table. attr=%s", attr.attribute_name.c_str());
+      return RC::SCHEMA_FIELD_MISSING;
+    }
+    table = tables[0];
+  } else {
+    auto iter = table_map.find(attr.relation_name);
+    if (iter == table_map.end()) {
+      LOG_WARN("no such table in from list: %s", attr.relation_name.c_str());
+      return RC::SCHEMA_FIELD_MISSING;
+    }
+    table = iter->second;
+  }
+
+  const FieldMeta *field_meta = table->table_meta().field(attr.attribute_name.c_str());
+  if (nullptr == field_meta) {
+    LOG_WARN("no such field. field=%s.%s.%s", db->name(), table->name(), attr.attribute_name.c_str());
+    return RC::SCHEMA_FIELD_MISSING;
+  }
+
+  field = Field(table, field_meta);
+  return RC::SUCCESS;
+}
+
+/**
+ * @brief 创建select中的聚合函数，名字与SQL中的写法一致，比如 count(*)、sum(t.id)
+ */
+static RC create_aggregate_expr(Db *db, const std::vector<Table *> &tables,
+    const std::unordered_map<std::string, Table *> &table_map, const RelAttrSqlNode &attr,
+    std::unique_ptr<Expression> &expr)
+{
+  AggregateExpr::Type aggregate_type;
+  RC rc = AggregateExpr::type_from_string(attr.aggregation.c_str(), aggregate_type);
+  if (OB_FAIL(rc)) {
+    LOG_WARN("unsupported aggregate function. name=%s", attr.aggregation.c_str());
+    return rc;
+  }
+
+  std::unique_ptr<Expression> child;
+  std::string argument = attr.attribute_name;
+  if (0 == strcmp(attr.attribute_name.c_str(), "*")) {
+    if (aggregate_type != AggregateExpr::Type::AGG_COUNT || !common::is_blank(attr.relation_name.c_str())) {
+      LOG_WARN("only count(*) is supported. function=%s", attr.aggregation.c_str());
+      return RC::INVALID_ARGUMENT;
+    }
+  } else {
+    Field field;
+    rc = find_field(db, tables, table_map, attr, field);
+    if (OB_FAIL(rc)) {
+      return rc;
+    }
+    child.reset(new FieldExpr(field));
+    if (!common::is_blank(attr.relation_name.c_str())) {
+      argument = attr.relation_name + "." + attr.attribute_name;
+    }
+  }
+
+  expr.reset(new AggregateExpr(aggregate_type, std::move(child)));
+  expr->set_name(attr.aggregation + "(" + argument + ")");
+  return RC::SUCCESS;
+}
+
+static bool contains_field(const std::vector<Field> &fields, const Field &field)
+{
+  return std::any_of(fields.begin(), fields.end(), [&field](const Field &other) {
+    return other.table() == field.table() && 0 == strcmp(other.field_name(), field.field_name());
+  });
+}
+
 RC SelectStmt::create(Db *db, const SelectSqlNode &select_sql, Stmt *&stmt)
 {
   if (nullptr == db) {
@@ -65,9 +144,23 @@ RC SelectStmt::create(Db *db, const SelectSqlNode &select_sql, Stmt *&stmt)
 
   // collect query fields in `select` statement
   std::vector<Field> query_fields;
+  std::vector<std::unique_ptr<Expression>> query_expressions;
+  bool has_aggregation = false;
   for (int i = static_cast<int>(select_sql.attributes.size()) - 1; i >= 0; i--) {
     const RelAttrSqlNode &relation_attr = select_sql.attributes[i];
 
+    if (!relation_attr.aggregation.empty()) {
+      std::unique_ptr<Expression> aggregate_expr;
+      RC rc = create_aggregate_expr(db, tables, table_map, relation_attr, aggregate_expr);
+      if (OB_FAIL(rc)) {
+        return rc;
+      }
+      query_expressions.emplace_back(std::move(aggregate_expr));
+      has_aggregation = true;
+      continue;
+    }
+
+    const size_t field_num = query_fields.size();
     if (common::is_blank(relation_attr.relation_name.c_str()) &&
         0 == strcmp(relation_attr.attribute_name.c_str(), "*")) {
       for (Table *table : tables) {
@@ -121,6 +214,95 @@ RC SelectStmt::create(Db *db, const SelectSqlNode &select_sql, Stmt *&stmt)
 
       query_fields.push_back(Field(table, field_meta));
     }
+
+    for (size_t j = field_num; j < query_fields.size(); j++) {
+      query_expressions.emplace_back(new FieldExpr(query_fields[j]));
+    }
+  }
+
+  // collect fields in `group by`
+  std::vector<Field> group_by_fields;
+  for (int i = static_cast<int>(select_sql.group_by.size()) - 1; i >= 0; i--) {
+    const RelAttrSqlNode &relation_attr = select_sql.group_by[i];
+    if (!relation_attr.aggregation.empty()) {
+      LOG_WARN("aggregate function is not allowed in group by. function=%s", relation_attr.aggregation.c_str());
+      return RC::INVALID_ARGUMENT;
+    }
+
+    Field field;
+    RC rc = find_field(db, tables, table_map, relation_attr, field);
+    if (OB_FAIL(rc)) {
+      return rc;
+    }
+    group_by_fields.push_back(field);
+  }
+
+  if (has_aggregation || !group_by_fields.empty()) {
+    // 输出的字段必须出现在group by中，聚合查询需要读取的字段包括聚合函数的参数和分组字段
+    query_fields.clear();
+    for (const std::unique_ptr<Expression> &expr : query_expressions) {
+      if (expr->type() == ExprType::FIELD) {
+        const Field &field = static_cast<FieldExpr *>(expr.get())->field();
+        if (!contains_field(group_by_fields, field)) {
+          LOG_WARN("field should appear in group by or be used in an aggregate function. field=%s.%s",
+                   field.table_name(), field.field_name());
+          return RC::INVALID_ARGUMENT;
+        }
+      } else {
+        const std::unique_ptr<Expression> &child = static_cast<AggregateExpr *>(expr.get())->child();
+        if (child) {
+          query_fields.push_back(static_cast<FieldExpr *>(child.get())->field());
+        }
+      }
+    }
+    query_fields.insert(query_fields.end(), group_by_fields.begin(), group_by_fields.end());
+  } else {
+    query_expressions.clear();
+  }
+
+  // collect `order by`. 聚合查询只能按照分组字段或者聚合函数排序，聚合函数不一定出现在select中
+  const bool is_aggregate_query = !query_expressions.empty();
+  std::vector<std::unique_ptr<Expression>> order_by_exprs;
+  std::vector<bool> order_by_ascending;
+  for (const OrderBySqlNode &order_by : select_sql.order_by) {
+    const RelAttrSqlNode &relation_attr = order_by.attr;
+    std::unique_ptr<Expression> order_by_expr;
+    if (!relation_attr.aggregation.empty()) {
+      if (!is_aggregate_query) {
+        LOG_WARN("aggregate function in order by is only allowed in aggregate query. function=%s",
+                 relation_attr.aggregation.c_str());
+        return RC::INVALID_ARGUMENT;
+      }
+
+      RC rc = create_aggregate_expr(db, tables, table_map, relation_attr, order_by_expr);
+      if (OB_FAIL(rc)) {
+        return rc;
+      }
+      const std::unique_ptr<Expression> &child = static_cast<AggregateExpr *>(order_by_expr.get())->child();
+      if (child) {
+        query_fields.push_back(static_cast<FieldExpr *>(child.get())->field());
+      }
+    } else {
+      Field field;
+      RC rc = find_field(db, tables, table_map, relation_attr, field);
+      if (OB_FAIL(rc)) {
+        return rc;
+      }
+      if (is_aggregate_query && !contains_field(group_by_fields, field)) {
+        LOG_WARN("order by field should appear in group by. field=%s.%s", field.table_name(), field.field_name());
+        return RC::INVALID_ARGUMENT;
+      }
+      order_by_expr.reset(new FieldExpr(field));
+    }
+
+    order_by_exprs.emplace_back(std::move(order_by_expr));
+    order_by_ascending.push_back(order_by.ascending);
+  }
+
+  // 与sqlite一样，limit是负数时表示没有limit
+  if (select_sql.limit.offset < 0) {
+    LOG_WARN("invalid offset. offset=%d", select_sql.limit.offset);
+    return RC::INVALID_ARGUMENT;
   }
 
   LOG_INFO("got %d tables in from stmt and %d fields in query stmt", tables.size(), query_fields.size());
@@ -148,6 +330,12 @@ RC SelectStmt::create(Db *db, const SelectSqlNode &select_sql, Stmt *&stmt)
   // TODO add expression copy
   select_stmt->tables_.swap(tables);
   select_stmt->query_fields_.swap(query_fields);
+  select_stmt->query_expressions_.swap(query_expressions);
+  select_stmt->group_by_fields_.swap(group_by_fields);
+  select_stmt->order_by_expressions_.swap(order_by_exprs);
+  select_stmt->order_by_ascending_.swap(order_by_ascending);
+  select_stmt->limit_  = select_sql.limit.limit;
+  select_stmt->offset_ = select_sql.limit.offset;
   select_stmt->filter_stmt_ = filter_stmt;
   stmt = select_stmt;
   return RC::SUCCESS;
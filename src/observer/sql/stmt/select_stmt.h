@@ -19,6 +19,7 @@ See the Mulan PSL v2 for more details. */
 
 #include "common/rc.h"
 #include "sql/stmt/stmt.h"
+#include "sql/expr/expression.h"
 #include "storage/field/field.h"
 
 class FieldMeta;
@@ -29,6 +30,12 @@ class Table;
 /**
  * @brief 表示select语句
  * @ingroup Statement
+ * @details 有聚合函数或者group by时，query_expressions按照select中的顺序保存输出的列，
+ * 每一列是分组字段(FieldExpr)或者聚合函数(AggregateExpr)，query_fields是查询中用到的所有字段。
+ * 否则query_expressions为空，query_fields就是输出的列。
+ * order_by_expressions是order by中的字段(FieldExpr)或者聚合函数(AggregateExpr)，
+ * 非聚合查询可以按照不在select中的字段排序。
+ * limit小于0表示没有limit。
  */
 class SelectStmt : public Stmt 
 {
@@ -53,6 +60,34 @@ public:
   {
     return query_fields_;
   }
+  const std::vector<std::unique_ptr<Expression>> &query_expressions() const
+  {
+    return query_expressions_;
+  }
+  const std::vector<Field> &group_by_fields() const
+  {
+    return group_by_fields_;
+  }
+  const std::vector<std::unique_ptr<Expression>> &order_by_expressions() const
+  {
+    return order_by_expressions_;
+  }
+  const std::vector<bool> &order_by_ascending() const
+  {
+    return order_by_ascending_;
+  }
+  int limit() const
+  {
+    return limit_;
+  }
+  int offset() const
+  {
+    return offset_;
+  }
+  bool has_aggregation() const
+  {
+    return !query_expressions_.empty();
+  }
   FilterStmt *filter_stmt() const
   {
     return filter_stmt_;
@@ -60,6 +95,12 @@ public:
 
 private:
   std::vector<Field> query_fields_;
+  std::vector<std::unique_ptr<Expression>> query_expressions_;
+  std::vector<Field> group_by_fields_;
+  std::vector<std::unique_ptr<Expression>> order_by_expressions_;
+  std::vector<bool> order_by_ascending_;
+  int limit_  = -1;
+  int offset_ = 0;
   std::vector<Table *> tables_;
   FilterStmt *filter_stmt_ = nullptr;
 };
@@ -0,0 +1,37 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#pragma once
+
+#include "sql/stmt/stmt.h"
+
+/**
+ * @brief 显示服务端统计信息的语句
+ * @ingroup Statement
+ */
+class ShowStatusStmt : public Stmt
+{
+public:
+  ShowStatusStmt() = default;
+  virtual ~ShowStatusStmt() = default;
+
+  StmtType type() const override { return StmtType::SHOW_STATUS; }
+
+  static RC create(Stmt *&stmt)
+  {
+    stmt = new ShowStatusStmt();
+    return RC::SUCCESS;
+  }
+};
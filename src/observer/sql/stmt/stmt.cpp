@@ -21,14 +21,17 @@ See the Mulan PSL v2 for more details. */
 #include "sql/stmt/create_index_stmt.h"
 #include "sql/stmt/create_table_stmt.h"
 #include "sql/stmt/desc_table_stmt.h"
+#include "sql/stmt/analyze_table_stmt.h"
 #include "sql/stmt/help_stmt.h"
 #include "sql/stmt/show_tables_stmt.h"
+#include "sql/stmt/show_status_stmt.h"
 #include "sql/stmt/trx_begin_stmt.h"
 #include "sql/stmt/trx_end_stmt.h"
 #include "sql/stmt/exit_stmt.h"
 #include "sql/stmt/set_variable_stmt.h"
 #include "sql/stmt/load_data_stmt.h"
 #include "sql/stmt/calc_stmt.h"
+#include "sql/stmt/prepare_stmt.h"
 
 RC Stmt::create_stmt(Db *db, ParsedSqlNode &sql_node, Stmt *&stmt)
 {
@@ -61,6 +64,10 @@ RC Stmt::create_stmt(Db *db, ParsedSqlNode &sql_node, Stmt *&stmt)
       return DescTableStmt::create(db, sql_node.desc_table, stmt);
     }
 
+    case SCF_ANALYZE_TABLE: {
+      return AnalyzeTableStmt::create(db, sql_node.analyze_table, stmt);
+    }
+
     case SCF_HELP: {
       return HelpStmt::create(stmt);
     }
@@ -69,6 +76,10 @@ RC Stmt::create_stmt(Db *db, ParsedSqlNode &sql_node, Stmt *&stmt)
       return ShowTablesStmt::create(db, stmt);
     }
 
+    case SCF_SHOW_STATUS: {
+      return ShowStatusStmt::create(stmt);
+    }
+
     case SCF_BEGIN: {
       return TrxBeginStmt::create(stmt);
     }
@@ -86,6 +97,14 @@ RC Stmt::create_stmt(Db *db, ParsedSqlNode &sql_node, Stmt *&stmt)
       return SetVariableStmt::create(sql_node.set_variable, stmt);
     }
 
+    case SCF_PREPARE: {
+      return PrepareStmt::create(sql_node.prepare, stmt);
+    }
+
+    case SCF_DEALLOCATE: {
+      return DeallocateStmt::create(sql_node.deallocate, stmt);
+    }
+
     case SCF_LOAD_DATA: {
       return LoadDataStmt::create(db, sql_node.load_data, stmt);
     }
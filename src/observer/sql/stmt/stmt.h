@@ -41,7 +41,9 @@ class Db;
   DEFINE_ENUM_ITEM(DROP_INDEX)      \
   DEFINE_ENUM_ITEM(SYNC)            \
   DEFINE_ENUM_ITEM(SHOW_TABLES)     \
+  DEFINE_ENUM_ITEM(SHOW_STATUS)     \
   DEFINE_ENUM_ITEM(DESC_TABLE)      \
+  DEFINE_ENUM_ITEM(ANALYZE_TABLE)   \
   DEFINE_ENUM_ITEM(BEGIN)           \
   DEFINE_ENUM_ITEM(COMMIT)          \
   DEFINE_ENUM_ITEM(ROLLBACK)        \
@@ -50,7 +52,9 @@ class Db;
   DEFINE_ENUM_ITEM(EXIT)            \
   DEFINE_ENUM_ITEM(EXPLAIN)         \
   DEFINE_ENUM_ITEM(PREDICATE)       \
-  DEFINE_ENUM_ITEM(SET_VARIABLE)
+  DEFINE_ENUM_ITEM(SET_VARIABLE)    \
+  DEFINE_ENUM_ITEM(PREPARE)         \
+  DEFINE_ENUM_ITEM(DEALLOCATE)
 
 enum class StmtType {
   #define DEFINE_ENUM_ITEM(name)  name,
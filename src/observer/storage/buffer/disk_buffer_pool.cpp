@@ -292,17 +292,26 @@ RC DiskBufferPool::close_file()
   return RC::SUCCESS;
 }
 
+BufferPoolAccessStats &BufferPoolAccessStats::current()
+{
+  static thread_local BufferPoolAccessStats stats;
+  return stats;
+}
+
 RC DiskBufferPool::get_this_page(PageNum page_num, Frame **frame)
 {
   RC rc = RC::SUCCESS;
   *frame = nullptr;
 
+  BufferPoolAccessStats &stats = BufferPoolAccessStats::current();
   Frame *used_match_frame = frame_manager_.get(file_desc_, page_num);
   if (used_match_frame != nullptr) {
     used_match_frame->access();
     *frame = used_match_frame;
+    stats.hits++;
     return RC::SUCCESS;
   }
+  stats.misses++;
 
   std::scoped_lock lock_guard(lock_); // 直接加了一把大锁，其实可以根据访问的页面来细化提高并行度
 
@@ -180,6 +180,20 @@ private:
   PageNum current_page_num_ = -1;
 };
 
+/**
+ * @brief 当前线程访问页面的统计
+ * @ingroup BufferPool
+ * @details 只在当前线程中累加，不需要同步。EXPLAIN ANALYZE 在每个算子执行前后取差值，
+ * 得到算子访问的页面数
+ */
+struct BufferPoolAccessStats
+{
+  uint64_t hits   = 0;  ///< 页面已经在内存中
+  uint64_t misses = 0;  ///< 页面需要从磁盘读取
+
+  static BufferPoolAccessStats &current();
+};
+
 /**
  * @brief BufferPool的实现
  * @ingroup BufferPool
@@ -248,6 +262,11 @@ public:
 
   int file_desc() const;
 
+  /**
+   * @brief 文件中已经分配的页面数，包括第一个头页面
+   */
+  int32_t allocated_pages() const { return file_header_->allocated_pages; }
+
   /**
    * 如果页面是脏的，就将数据刷新到磁盘
    */
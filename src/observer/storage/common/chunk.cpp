@@ -0,0 +1,113 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#include "storage/common/chunk.h"
+
+using namespace std;
+
+void Chunk::add_column(unique_ptr<Column> column, int column_id)
+{
+  columns_.push_back(std::move(column));
+  column_ids_.push_back(column_id);
+}
+
+int Chunk::column_index(int column_id) const
+{
+  for (size_t i = 0; i < column_ids_.size(); i++) {
+    if (column_ids_[i] == column_id) {
+      return static_cast<int>(i);
+    }
+  }
+  return -1;
+}
+
+int Chunk::rows() const
+{
+  if (columns_.empty()) {
+    return 0;
+  }
+  return columns_[0]->count();
+}
+
+int Chunk::capacity() const
+{
+  if (columns_.empty()) {
+    return 0;
+  }
+  return columns_[0]->capacity();
+}
+
+void Chunk::set_selection(vector<int> &&selection)
+{
+  selection_     = std::move(selection);
+  has_selection_ = true;
+}
+
+void Chunk::clear_selection()
+{
+  selection_.clear();
+  has_selection_ = false;
+}
+
+void Chunk::select(const vector<uint8_t> &filter)
+{
+  if (has_selection_) {
+    size_t j = 0;
+    for (size_t i = 0; i < selection_.size(); i++) {
+      const int row = selection_[i];
+      if (filter[row]) {
+        selection_[j++] = row;
+      }
+    }
+    selection_.resize(j);
+    return;
+  }
+
+  const int row_num = rows();
+  selection_.clear();
+  selection_.reserve(row_num);
+  for (int i = 0; i < row_num; i++) {
+    if (filter[i]) {
+      selection_.push_back(i);
+    }
+  }
+  has_selection_ = true;
+}
+
+void Chunk::reference(const Chunk &chunk)
+{
+  reset();
+  for (int i = 0; i < chunk.column_num(); i++) {
+    auto column = make_unique<Column>();
+    column->reference(chunk.column(i));
+    add_column(std::move(column), chunk.column_id(i));
+  }
+  selection_     = chunk.selection_;
+  has_selection_ = chunk.has_selection_;
+}
+
+void Chunk::reset_data()
+{
+  for (auto &column : columns_) {
+    column->reset_data();
+  }
+  clear_selection();
+}
+
+void Chunk::reset()
+{
+  columns_.clear();
+  column_ids_.clear();
+  clear_selection();
+}
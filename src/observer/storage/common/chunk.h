@@ -0,0 +1,111 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <stdint.h>
+
+#include "storage/common/column.h"
+
+/**
+ * @defgroup Chunk
+ * @brief 向量化执行时，算子之间传递的一批数据
+ */
+
+/**
+ * @brief 一批行数据，按列存储
+ * @ingroup Chunk
+ * @details 向量化执行的算子每次调用 next(Chunk &) 处理一批(最多MAX_ROWS行)数据，
+ * 而不是每次处理一行，以摊薄虚函数调用和表达式解释执行的开销。
+ * 每一列都带有一个列ID(column_id)，由生成执行计划时确定，表达式通过它找到需要的列。
+ *
+ * 过滤不会搬移数据，而是记录在选择向量(selection vector)中：选择向量保存了仍然有效的行下标，
+ * 下游算子只处理选择向量中的行。没有选择向量时，所有行都有效。
+ */
+class Chunk
+{
+public:
+  static constexpr int MAX_ROWS = Column::DEFAULT_CAPACITY;
+
+public:
+  Chunk() = default;
+  Chunk(const Chunk &) = delete;
+  Chunk &operator=(const Chunk &) = delete;
+
+  void add_column(std::unique_ptr<Column> column, int column_id);
+
+  Column &column(int idx) { return *columns_[idx]; }
+  const Column &column(int idx) const { return *columns_[idx]; }
+  Column *column_ptr(int idx) { return columns_[idx].get(); }
+
+  int column_id(int idx) const { return column_ids_[idx]; }
+  int column_num() const { return static_cast<int>(columns_.size()); }
+
+  /**
+   * @brief 根据列ID查找列的下标，找不到返回-1
+   */
+  int column_index(int column_id) const;
+
+  /**
+   * @brief 物理行数，包含已经被过滤掉的行
+   */
+  int rows() const;
+  int capacity() const;
+
+  /**
+   * @brief 有效行数，即选择向量中的行数
+   */
+  int active_rows() const { return has_selection_ ? static_cast<int>(selection_.size()) : rows(); }
+
+  /**
+   * @brief 第i个有效行对应的物理行下标
+   */
+  int active_row(int i) const { return has_selection_ ? selection_[i] : i; }
+
+  bool has_selection() const { return has_selection_; }
+  const std::vector<int> &selection() const { return selection_; }
+  void set_selection(std::vector<int> &&selection);
+  void clear_selection();
+
+  /**
+   * @brief 使用过滤结果更新选择向量
+   * @param filter 每个物理行一个字节，非0表示该行满足条件
+   */
+  void select(const std::vector<uint8_t> &filter);
+
+  Value get_value(int col_idx, int row_idx) const { return columns_[col_idx]->get_value(row_idx); }
+
+  /**
+   * @brief 引用另一个chunk的所有列和选择向量，不拷贝数据
+   */
+  void reference(const Chunk &chunk);
+
+  /**
+   * @brief 清空所有列的数据和选择向量，保留列的定义和内存
+   */
+  void reset_data();
+
+  /**
+   * @brief 删除所有列
+   */
+  void reset();
+
+private:
+  std::vector<std::unique_ptr<Column>> columns_;
+  std::vector<int>                     column_ids_;
+  std::vector<int>                     selection_;
+  bool                                 has_selection_ = false;
+};
@@ -0,0 +1,158 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#include <string.h>
+#include <algorithm>
+
+#include "storage/common/column.h"
+#include "common/log/log.h"
+
+Column::Column(const FieldMeta &meta, int capacity)
+{
+  init(meta.type(), meta.len(), capacity);
+}
+
+Column::Column(AttrType attr_type, int attr_len, int capacity)
+{
+  init(attr_type, attr_len, capacity);
+}
+
+Column::~Column()
+{
+  reset();
+}
+
+void Column::reset()
+{
+  if (own_ && data_ != nullptr) {
+    delete[] data_;
+  }
+  data_        = nullptr;
+  own_         = true;
+  count_       = 0;
+  capacity_    = 0;
+  column_type_ = Type::NORMAL_COLUMN;
+}
+
+void Column::init(AttrType attr_type, int attr_len, int capacity)
+{
+  reset();
+  attr_type_ = attr_type;
+  attr_len_  = attr_len;
+  capacity_  = capacity;
+  data_      = new char[static_cast<size_t>(attr_len) * capacity];
+}
+
+void Column::init(const Value &value, int count)
+{
+  reset();
+  column_type_ = Type::CONSTANT_COLUMN;
+  attr_type_   = value.attr_type();
+  attr_len_    = value.length();
+  capacity_    = 1;
+  count_       = count;
+
+  // 多分配一个字节，保证字符串常量总是以'\0'结尾
+  int alloc_len = std::max(attr_len_, static_cast<int>(sizeof(int))) + 1;
+  data_ = new char[alloc_len];
+  memset(data_, 0, alloc_len);
+  memcpy(data_, value.data(), attr_len_);
+}
+
+RC Column::append_one(const char *data)
+{
+  return append(data, 1);
+}
+
+RC Column::append(const char *data, int count)
+{
+  if (!own_ || column_type_ != Type::NORMAL_COLUMN) {
+    LOG_WARN("cannot append to a referenced or constant column");
+    return RC::INTERNAL;
+  }
+  if (count_ + count > capacity_) {
+    LOG_WARN("column is full. count=%d, capacity=%d, append=%d", count_, capacity_, count);
+    return RC::INTERNAL;
+  }
+
+  memcpy(data_ + static_cast<size_t>(count_) * attr_len_, data, static_cast<size_t>(count) * attr_len_);
+  count_ += count;
+  return RC::SUCCESS;
+}
+
+RC Column::append_value(const Value &value)
+{
+  if (count_ >= capacity_) {
+    LOG_WARN("column is full. count=%d, capacity=%d", count_, capacity_);
+    return RC::INTERNAL;
+  }
+
+  char *dst = data_ + static_cast<size_t>(count_) * attr_len_;
+  switch (attr_type_) {
+    case INTS: {
+      int v = value.get_int();
+      memcpy(dst, &v, sizeof(v));
+    } break;
+    case FLOATS: {
+      float v = value.get_float();
+      memcpy(dst, &v, sizeof(v));
+    } break;
+    case BOOLEANS: {
+      int v = value.get_boolean() ? 1 : 0;
+      memcpy(dst, &v, sizeof(v));
+    } break;
+    case CHARS: {
+      memset(dst, 0, attr_len_);
+      if (value.attr_type() == CHARS) {
+        memcpy(dst, value.data(), std::min(value.length(), attr_len_));
+      } else {
+        std::string s = value.to_string();
+        memcpy(dst, s.data(), std::min(static_cast<int>(s.size()), attr_len_));
+      }
+    } break;
+    default: {
+      LOG_WARN("unsupported column type: %d", attr_type_);
+      return RC::INTERNAL;
+    }
+  }
+  count_++;
+  return RC::SUCCESS;
+}
+
+Value Column::get_value(int index) const
+{
+  Value value;
+  value.set_type(attr_type_);
+  if (attr_type_ == CHARS && column_type_ == Type::CONSTANT_COLUMN) {
+    value.set_string(data_);
+  } else {
+    value.set_data(value_at(index), attr_len_);
+  }
+  return value;
+}
+
+void Column::reference(const Column &column)
+{
+  if (this == &column) {
+    return;
+  }
+  reset();
+  column_type_ = column.column_type_;
+  attr_type_   = column.attr_type_;
+  attr_len_    = column.attr_len_;
+  count_       = column.count_;
+  capacity_    = column.capacity_;
+  data_        = column.data_;
+  own_         = false;
+}
@@ -0,0 +1,113 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#pragma once
+
+#include "common/rc.h"
+#include "sql/parser/value.h"
+#include "storage/field/field_meta.h"
+
+/**
+ * @brief 列存格式的一列数据
+ * @ingroup Chunk
+ * @details 每一行占用固定长度(attr_len)的连续内存，与记录中字段的存储格式一致，
+ * 因此从记录中拷贝字段、在算子之间传递数据都不需要做格式转换。
+ * 列有两种形式：普通列，每行一个值；常量列，只保存一个值，但是逻辑上有count行，
+ * 常量表达式计算的结果就是常量列，避免为每一行复制同样的数据。
+ */
+class Column
+{
+public:
+  enum class Type
+  {
+    NORMAL_COLUMN,    ///< 普通列
+    CONSTANT_COLUMN,  ///< 常量列
+  };
+
+  static constexpr int DEFAULT_CAPACITY = 1024;
+
+public:
+  Column() = default;
+  Column(const FieldMeta &meta, int capacity = DEFAULT_CAPACITY);
+  Column(AttrType attr_type, int attr_len, int capacity = DEFAULT_CAPACITY);
+  ~Column();
+
+  Column(const Column &) = delete;
+  Column &operator=(const Column &) = delete;
+
+  /**
+   * @brief 初始化为普通列，会释放之前的数据
+   */
+  void init(AttrType attr_type, int attr_len, int capacity = DEFAULT_CAPACITY);
+
+  /**
+   * @brief 初始化为常量列，逻辑上有count行，每行的值都是value
+   */
+  void init(const Value &value, int count);
+
+  RC append_one(const char *data);
+  RC append(const char *data, int count);
+
+  /**
+   * @brief 追加一个值。如果值的类型与列的类型不同，会做类型转换
+   */
+  RC append_value(const Value &value);
+
+  /**
+   * @brief 获取第index行的值
+   */
+  Value get_value(int index) const;
+
+  /**
+   * @brief 引用另一个列的数据，不拷贝内存
+   * @details 被引用的列在当前列使用期间必须有效
+   */
+  void reference(const Column &column);
+
+  /**
+   * @brief 清空数据，但是保留内存
+   */
+  void reset_data() { count_ = 0; }
+
+  /**
+   * @brief 释放内存，恢复到未初始化的状态
+   */
+  void reset();
+
+  char *data() const { return data_; }
+  /**
+   * @brief 第index行数据的起始地址。常量列所有行都指向同一个地址
+   */
+  const char *value_at(int index) const
+  {
+    return column_type_ == Type::CONSTANT_COLUMN ? data_ : data_ + static_cast<size_t>(index) * attr_len_;
+  }
+
+  int count() const { return count_; }
+  void set_count(int count) { count_ = count; }
+  int capacity() const { return capacity_; }
+
+  AttrType attr_type() const { return attr_type_; }
+  int attr_len() const { return attr_len_; }
+  Type column_type() const { return column_type_; }
+
+private:
+  Type     column_type_ = Type::NORMAL_COLUMN;
+  AttrType attr_type_   = UNDEFINED;
+  int      attr_len_    = -1;
+  int      count_       = 0;
+  int      capacity_    = 0;
+  char    *data_        = nullptr;
+  bool     own_         = true;  ///< 内存是否由当前列分配
+};
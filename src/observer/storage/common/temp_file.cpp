@@ -0,0 +1,268 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include <algorithm>
+
+#include "storage/common/temp_file.h"
+#include "common/io/io.h"
+#include "common/log/log.h"
+#include "common/os/path.h"
+
+using namespace std;
+
+TempFile::TempFile(TempFileManager &manager, string path, int fd)
+    : manager_(manager), path_(std::move(path)), fd_(fd), buffer_(BUFFER_SIZE)
+{
+  manager_.file_count_++;
+}
+
+TempFile::~TempFile()
+{
+  if (fd_ >= 0) {
+    ::close(fd_);
+    fd_ = -1;
+  }
+  if (0 != ::unlink(path_.c_str())) {
+    LOG_WARN("failed to remove temp file. file=%s, error=%s", path_.c_str(), strerror(errno));
+  }
+  manager_.file_count_--;
+}
+
+RC TempFile::write(const char *data, int size)
+{
+  ASSERT(!reading_, "cannot write temp file while reading");
+  while (size > 0) {
+    if (buffer_len_ == buffer_.size()) {
+      RC rc = flush();
+      if (OB_FAIL(rc)) {
+        return rc;
+      }
+    }
+
+    const int n = std::min(size, static_cast<int>(buffer_.size() - buffer_len_));
+    memcpy(buffer_.data() + buffer_len_, data, n);
+    buffer_len_ += n;
+    data += n;
+    size -= n;
+  }
+  return RC::SUCCESS;
+}
+
+/**
+ * 格式：类型(1字节) 长度(4字节) 数据
+ */
+RC TempFile::write_value(const Value &value)
+{
+  const int8_t type = static_cast<int8_t>(value.attr_type());
+  RC rc = write(reinterpret_cast<const char *>(&type), sizeof(type));
+  if (OB_FAIL(rc)) {
+    return rc;
+  }
+
+  switch (value.attr_type()) {
+    case CHARS: {
+      const int32_t len = static_cast<int32_t>(strlen(value.data()));
+      rc = write(reinterpret_cast<const char *>(&len), sizeof(len));
+      if (OB_SUCC(rc)) {
+        rc = write(value.data(), len);
+      }
+    } break;
+    case INTS:
+    case FLOATS: {
+      const int32_t len = 4;
+      rc = write(reinterpret_cast<const char *>(&len), sizeof(len));
+      if (OB_SUCC(rc)) {
+        rc = write(value.data(), len);
+      }
+    } break;
+    case BOOLEANS: {
+      const int32_t len = 4;
+      const int32_t bool_value = value.get_boolean() ? 1 : 0;
+      rc = write(reinterpret_cast<const char *>(&len), sizeof(len));
+      if (OB_SUCC(rc)) {
+        rc = write(reinterpret_cast<const char *>(&bool_value), len);
+      }
+    } break;
+    default: {
+      const int32_t len = 0;
+      rc = write(reinterpret_cast<const char *>(&len), sizeof(len));
+    } break;
+  }
+  return rc;
+}
+
+RC TempFile::flush()
+{
+  if (buffer_len_ == 0) {
+    return RC::SUCCESS;
+  }
+
+  if (0 != common::writen(fd_, buffer_.data(), static_cast<int>(buffer_len_))) {
+    LOG_WARN("failed to write temp file. file=%s, error=%s", path_.c_str(), strerror(errno));
+    return RC::IOERR_WRITE;
+  }
+
+  file_size_ += buffer_len_;
+  manager_.written_bytes_ += buffer_len_;
+  buffer_len_ = 0;
+  return RC::SUCCESS;
+}
+
+RC TempFile::rewind()
+{
+  if (!reading_) {
+    RC rc = flush();
+    if (OB_FAIL(rc)) {
+      return rc;
+    }
+    reading_ = true;
+  }
+
+  if (::lseek(fd_, 0, SEEK_SET) == -1) {
+    LOG_WARN("failed to seek temp file. file=%s, error=%s", path_.c_str(), strerror(errno));
+    return RC::IOERR_SEEK;
+  }
+  buffer_len_ = 0;
+  buffer_pos_ = 0;
+  return RC::SUCCESS;
+}
+
+RC TempFile::fill_buffer()
+{
+  ssize_t n = 0;
+  do {
+    n = ::read(fd_, buffer_.data(), buffer_.size());
+  } while (n < 0 && errno == EINTR);
+
+  if (n < 0) {
+    LOG_WARN("failed to read temp file. file=%s, error=%s", path_.c_str(), strerror(errno));
+    return RC::IOERR_READ;
+  }
+  if (n == 0) {
+    return RC::RECORD_EOF;
+  }
+
+  buffer_len_ = static_cast<size_t>(n);
+  buffer_pos_ = 0;
+  return RC::SUCCESS;
+}
+
+RC TempFile::read(char *data, int size)
+{
+  ASSERT(reading_, "temp file should be rewound before reading");
+  bool first = true;
+  while (size > 0) {
+    if (buffer_pos_ == buffer_len_) {
+      RC rc = fill_buffer();
+      if (rc == RC::RECORD_EOF && !first) {
+        LOG_WARN("temp file is truncated. file=%s", path_.c_str());
+        return RC::IOERR_READ;
+      }
+      if (OB_FAIL(rc)) {
+        return rc;
+      }
+    }
+
+    const int n = std::min(size, static_cast<int>(buffer_len_ - buffer_pos_));
+    memcpy(data, buffer_.data() + buffer_pos_, n);
+    buffer_pos_ += n;
+    data += n;
+    size -= n;
+    first = false;
+  }
+  return RC::SUCCESS;
+}
+
+RC TempFile::read_value(Value &value)
+{
+  int8_t  type = 0;
+  int32_t len  = 0;
+  RC rc = read(reinterpret_cast<char *>(&type), sizeof(type));
+  if (OB_FAIL(rc)) {
+    return rc;
+  }
+
+  rc = read(reinterpret_cast<char *>(&len), sizeof(len));
+  if (OB_FAIL(rc)) {
+    return rc == RC::RECORD_EOF ? RC::IOERR_READ : rc;
+  }
+
+  char  local_buf[16];
+  char *data = local_buf;
+  unique_ptr<char[]> heap_buf;
+  if (len > static_cast<int32_t>(sizeof(local_buf))) {
+    heap_buf.reset(new char[len]);
+    data = heap_buf.get();
+  }
+  if (len > 0) {
+    rc = read(data, len);
+    if (OB_FAIL(rc)) {
+      return rc == RC::RECORD_EOF ? RC::IOERR_READ : rc;
+    }
+  }
+
+  const AttrType attr_type = static_cast<AttrType>(type);
+  if (attr_type == CHARS) {
+    value.set_string(len > 0 ? data : "", len);
+  } else if (len > 0) {
+    value.set_type(attr_type);
+    value.set_data(data, len);
+  } else {
+    value = Value();
+  }
+  return RC::SUCCESS;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+RC TempFileManager::init(const char *dir)
+{
+  dir_ = dir;
+  if (!common::check_directory(dir_)) {
+    LOG_ERROR("failed to create temp file directory. dir=%s", dir);
+    return RC::IOERR_ACCESS;
+  }
+
+  vector<string> files;
+  if (common::list_file(dir_.c_str(), "^.*\\.tmp$", files) < 0) {
+    LOG_WARN("failed to list temp file directory. dir=%s", dir);
+    return RC::IOERR_ACCESS;
+  }
+
+  for (const string &file : files) {
+    const string path = dir_ + "/" + file;
+    if (0 != ::unlink(path.c_str())) {
+      LOG_WARN("failed to remove stale temp file. file=%s, error=%s", path.c_str(), strerror(errno));
+    }
+  }
+  LOG_INFO("temp file manager initialized. dir=%s, removed %d stale files", dir, static_cast<int>(files.size()));
+  return RC::SUCCESS;
+}
+
+RC TempFileManager::create_file(unique_ptr<TempFile> &file)
+{
+  const string path = dir_ + "/" + to_string(getpid()) + "_" + to_string(sequence_++) + ".tmp";
+  int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_EXCL | O_TRUNC, 0600);
+  if (fd < 0) {
+    LOG_WARN("failed to create temp file. file=%s, error=%s", path.c_str(), strerror(errno));
+    return RC::FILE_CREATE;
+  }
+
+  file.reset(new TempFile(*this, path, fd));
+  LOG_TRACE("create temp file %s", path.c_str());
+  return RC::SUCCESS;
+}
@@ -0,0 +1,124 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#pragma once
+
+#include <stdint.h>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/rc.h"
+#include "sql/parser/value.h"
+
+class TempFileManager;
+
+/**
+ * @brief 算子执行过程中使用的临时文件
+ * @ingroup Storage
+ * @details 用于hash join、排序等算子在内存不足时将中间数据写到磁盘。
+ * 临时文件只能顺序写，写完之后调用rewind，再从头顺序读。读写都有缓冲。
+ * 对象析构时删除文件。临时文件不经过buffer pool，也不记录日志。
+ */
+class TempFile
+{
+  friend class TempFileManager;
+
+public:
+  ~TempFile();
+
+  TempFile(const TempFile &) = delete;
+  TempFile &operator=(const TempFile &) = delete;
+
+  RC write(const char *data, int size);
+  RC write_value(const Value &value);
+
+  /**
+   * @brief 结束写入，并把读取位置移动到文件开头
+   */
+  RC rewind();
+
+  /**
+   * @brief 读取指定长度的数据
+   * @return 已经读取到文件末尾时返回RECORD_EOF
+   */
+  RC read(char *data, int size);
+  RC read_value(Value &value);
+
+  const std::string &path() const { return path_; }
+
+  /**
+   * @brief 已经写入的数据量
+   */
+  int64_t size() const { return file_size_ + static_cast<int64_t>(buffer_len_); }
+
+private:
+  TempFile(TempFileManager &manager, std::string path, int fd);
+
+  RC flush();
+  RC fill_buffer();
+
+private:
+  static constexpr int BUFFER_SIZE = 64 * 1024;
+
+  TempFileManager  &manager_;
+  std::string       path_;
+  int               fd_ = -1;
+  std::vector<char> buffer_;
+  size_t            buffer_len_ = 0;  ///< 写入时表示缓冲的数据量，读取时表示缓冲中有效数据的长度
+  size_t            buffer_pos_ = 0;  ///< 读取时在缓冲中的位置
+  int64_t           file_size_  = 0;  ///< 已经写到文件中的数据量
+  bool              reading_    = false;
+};
+
+/**
+ * @brief 临时文件管理器
+ * @ingroup Storage
+ * @details 所有的临时文件都放在一个单独的目录中，与表数据文件分开。
+ * 启动时会清理上次遗留的临时文件。
+ */
+class TempFileManager
+{
+public:
+  TempFileManager() = default;
+  ~TempFileManager() = default;
+
+  /**
+   * @brief 初始化临时文件目录，目录不存在时创建，并删除目录中遗留的临时文件
+   */
+  RC init(const char *dir);
+
+  RC create_file(std::unique_ptr<TempFile> &file);
+
+  const std::string &dir() const { return dir_; }
+
+  /**
+   * @brief 当前存在的临时文件个数
+   */
+  int64_t file_count() const { return file_count_.load(); }
+
+  /**
+   * @brief 累计写入临时文件的数据量
+   */
+  int64_t written_bytes() const { return written_bytes_.load(); }
+
+private:
+  friend class TempFile;
+
+  std::string          dir_;
+  std::atomic<int64_t> sequence_{0};
+  std::atomic<int64_t> file_count_{0};
+  std::atomic<int64_t> written_bytes_{0};
+};
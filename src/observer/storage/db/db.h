@@ -14,6 +14,7 @@ See the Mulan PSL v2 for more details. */
 
 #pragma once
 
+#include <atomic>
 #include <vector>
 #include <string>
 #include <unordered_map>
@@ -60,6 +61,12 @@ public:
 
   CLogManager *clog_manager();
 
+  /**
+   * @brief 表结构、索引或统计信息的版本号，变化后缓存的执行计划失效，见 PlanCache
+   */
+  uint64_t schema_version() const { return schema_version_.load(); }
+  void increase_schema_version() { schema_version_.fetch_add(1); }
+
 private:
   RC open_all_tables();
 
@@ -71,4 +78,6 @@ private:
 
   /// 给每个table都分配一个ID，用来记录日志。这里假设所有的DDL都不会并发操作，所以相关的数据都不上锁
   int32_t next_table_id_ = 0;
+
+  std::atomic<uint64_t> schema_version_{0};
 };
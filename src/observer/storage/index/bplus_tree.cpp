@@ -1864,6 +1864,10 @@ RC BplusTreeScanner::next_entry(RID &rid)
 
 RC BplusTreeScanner::close()
 {
+  // 释放扫描过程中持有的页面和锁，之后可以重新open
+  latch_memo_.release();
+  current_frame_ = nullptr;
+  right_key_ = nullptr;
   inited_ = false;
   LOG_TRACE("bplus tree scanner closed");
   return RC::SUCCESS;
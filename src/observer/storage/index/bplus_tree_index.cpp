@@ -135,6 +135,13 @@ RC BplusTreeIndexScanner::next_entry(RID *rid)
   return tree_scanner_.next_entry(*rid);
 }
 
+RC BplusTreeIndexScanner::reopen(
+    const char *left_key, int left_len, bool left_inclusive, const char *right_key, int right_len, bool right_inclusive)
+{
+  tree_scanner_.close();
+  return tree_scanner_.open(left_key, left_len, left_inclusive, right_key, right_len, right_inclusive);
+}
+
 RC BplusTreeIndexScanner::destroy()
 {
   delete this;
@@ -59,6 +59,8 @@ public:
 
   RC next_entry(RID *rid) override;
   RC destroy() override;
+  RC reopen(const char *left_key, int left_len, bool left_inclusive, const char *right_key, int right_len,
+      bool right_inclusive) override;
 
   RC open(const char *left_key, int left_len, bool left_inclusive, const char *right_key, int right_len,
       bool right_inclusive);
@@ -104,4 +104,11 @@ public:
    */
   virtual RC next_entry(RID *rid) = 0;
   virtual RC destroy() = 0;
+
+  /**
+   * @brief 重新设置扫描范围，从头开始扫描
+   * @details 需要多次扫描同一个索引时(比如index nested loop join)复用扫描器，参数与Index::create_scanner相同
+   */
+  virtual RC reopen(const char *left_key, int left_len, bool left_inclusive, const char *right_key, int right_len,
+      bool right_inclusive) = 0;
 };
@@ -359,6 +359,17 @@ public:
    */
   RC   next(Record &record);
 
+  /**
+   * @brief 只扫描文件的一部分页面，用于并行扫描
+   * @details 页面号对count取模等于index的页面属于这一部分，count个扫描合起来正好是整个文件。
+   * 需要在open_scan之前调用
+   */
+  void set_partition(int index, int count)
+  {
+    partition_index_ = index;
+    partition_count_ = count;
+  }
+
 private:
   /**
    * @brief 获取该文件中的下一条记录
@@ -382,4 +393,6 @@ private:
   RecordPageHandler  record_page_handler_;         ///< 处理文件某页面的记录
   RecordPageIterator record_page_iterator_;        ///< 遍历某个页面上的所有record
   Record             next_record_;                 ///< 获取的记录放在这里缓存起来
+  int                partition_index_  = 0;        ///< 并行扫描时只访问这一部分的页面
+  int                partition_count_  = 1;
 };
\ No newline at end of file
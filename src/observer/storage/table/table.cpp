@@ -15,10 +15,12 @@ See the Mulan PSL v2 for more details. */
 #include <limits.h>
 #include <string.h>
 #include <algorithm>
+#include <random>
 
 #include "common/defs.h"
 #include "storage/table/table.h"
 #include "storage/table/table_meta.h"
+#include "storage/table/table_stats.h"
 #include "common/log/log.h"
 #include "common/lang/string.h"
 #include "storage/buffer/disk_buffer_pool.h"
@@ -179,6 +181,17 @@ RC Table::open(const char *meta_file, const char *base_dir)
     indexes_.push_back(index);
   }
 
+  // 统计信息文件不存在或者损坏时不影响表的使用，只是没有统计信息
+  auto table_stats = std::make_shared<TableStats>();
+  std::string stats_file = table_stats_file(base_dir, name());
+  RC stats_rc = table_stats->load(table_meta_, stats_file);
+  if (stats_rc == RC::SUCCESS) {
+    table_stats_ = std::move(table_stats);
+  } else if (stats_rc != RC::FILE_NOT_EXIST) {
+    LOG_WARN("failed to load table stats, ignore it. table=%s, file=%s, rc=%s",
+             name(), stats_file.c_str(), strrc(stats_rc));
+  }
+
   return rc;
 }
 
@@ -204,6 +217,7 @@ RC Table::insert_record(Record &record)
                 name(), rc2, strrc(rc2));
     }
   }
+  increase_data_version();
   return rc;
 }
 
@@ -263,6 +277,11 @@ const char *Table::name() const
   return table_meta_.name();
 }
 
+int32_t Table::data_page_count() const
+{
+  return data_buffer_pool_->allocated_pages();
+}
+
 const TableMeta &Table::table_meta() const
 {
   return table_meta_;
@@ -341,6 +360,89 @@ RC Table::get_record_scanner(RecordFileScanner &scanner, Trx *trx, bool readonly
   return rc;
 }
 
+std::shared_ptr<const TableStats> Table::table_stats() const
+{
+  std::lock_guard<std::mutex> guard(stats_mutex_);
+  return table_stats_;
+}
+
+/**
+ * 扫描全部数据得到准确的行数，同时对每个字段做蓄水池采样，采样的数据用来生成直方图和估算不同值的个数
+ */
+RC Table::analyze(Trx *trx)
+{
+  static constexpr int64_t SAMPLE_ROWS = 30000;
+
+  const int field_begin = table_meta_.sys_field_num();
+  const int field_num   = table_meta_.field_num() - field_begin;
+  std::vector<std::vector<Value>> samples(field_num);
+
+  RecordFileScanner scanner;
+  RC rc = get_record_scanner(scanner, trx, true/*readonly*/);
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to create scanner while analyzing table. table=%s, rc=%s", name(), strrc(rc));
+    return rc;
+  }
+
+  // 固定随机种子，相同的数据得到相同的统计信息
+  std::mt19937_64 random(table_id());
+  int64_t row_count = 0;
+  Record record;
+  while (scanner.has_next()) {
+    rc = scanner.next(record);
+    if (rc != RC::SUCCESS) {
+      LOG_WARN("failed to scan records while analyzing table. table=%s, rc=%s", name(), strrc(rc));
+      return rc;
+    }
+
+    int64_t slot = row_count;
+    if (row_count >= SAMPLE_ROWS) {
+      slot = std::uniform_int_distribution<int64_t>(0, row_count)(random);
+    }
+    row_count++;
+    if (slot >= SAMPLE_ROWS) {
+      continue;
+    }
+
+    for (int i = 0; i < field_num; i++) {
+      const FieldMeta *field_meta = table_meta_.field(field_begin + i);
+      Value value;
+      value.set_type(field_meta->type());
+      value.set_data(record.data() + field_meta->offset(), field_meta->len());
+      if (slot < static_cast<int64_t>(samples[i].size())) {
+        samples[i][slot] = value;
+      } else {
+        samples[i].push_back(value);
+      }
+    }
+  }
+  scanner.close_scan();
+
+  auto table_stats = std::make_shared<TableStats>();
+  table_stats->set_row_count(row_count);
+  table_stats->set_page_count(data_page_count());
+  for (int i = 0; i < field_num; i++) {
+    const FieldMeta *field_meta = table_meta_.field(field_begin + i);
+    ColumnStats column;
+    column.build(field_meta->name(), field_meta->type(), samples[i], row_count);
+    table_stats->columns().push_back(std::move(column));
+  }
+
+  rc = table_stats->save(table_stats_file(base_dir_.c_str(), name()));
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to save table stats. table=%s, rc=%s", name(), strrc(rc));
+    return rc;
+  }
+
+  {
+    std::lock_guard<std::mutex> guard(stats_mutex_);
+    table_stats_ = std::move(table_stats);
+  }
+  LOG_INFO("analyzed table %s. rows=%ld, sample rows=%d",
+           name(), row_count, field_num > 0 ? static_cast<int>(samples[0].size()) : 0);
+  return rc;
+}
+
 RC Table::create_index(Trx *trx, const FieldMeta *field_meta, const char *index_name)
 {
   if (common::is_blank(index_name) || nullptr == field_meta) {
@@ -445,6 +547,7 @@ RC Table::delete_record(const Record &record)
            name(), index->index_meta().name(), record.rid().to_string().c_str(), strrc(rc));
   }
   rc = record_handler_->delete_record(&record.rid());
+  increase_data_version();
   return rc;
 }
 
@@ -14,8 +14,12 @@ See the Mulan PSL v2 for more details. */
 
 #pragma once
 
+#include <atomic>
 #include <functional>
+#include <memory>
+#include <mutex>
 #include "storage/table/table_meta.h"
+#include "storage/table/table_stats.h"
 
 struct RID;
 class Record;
@@ -87,11 +91,34 @@ public:
 
   RC get_record_scanner(RecordFileScanner &scanner, Trx *trx, bool readonly);
 
+  /**
+   * @brief 扫描表中的数据并采样，收集每个字段的统计信息，保存到统计信息文件中
+   */
+  RC analyze(Trx *trx);
+
+  /**
+   * @brief 表的统计信息，没有执行过 ANALYZE TABLE 时返回空
+   * @details ANALYZE TABLE 会替换统计信息，使用的过程中需要一直持有返回的指针
+   */
+  std::shared_ptr<const TableStats> table_stats() const;
+
   RecordFileHandler *record_handler() const
   {
     return record_handler_;
   }
 
+  /**
+   * @brief 数据文件的页面数，在没有统计信息时用来粗略估计表的大小
+   */
+  int32_t data_page_count() const;
+
+  /**
+   * @brief 表中数据的版本
+   * @details 插入、删除记录以及事务提交修改的数据之后增加，用来判断查询缓存中的结果是否过期
+   */
+  uint64_t data_version() const { return data_version_.load(); }
+  void     increase_data_version() { data_version_.fetch_add(1); }
+
 public:
   int32_t table_id() const { return table_meta_.table_id(); }
   const char *name() const;
@@ -117,4 +144,7 @@ private:
   DiskBufferPool *data_buffer_pool_ = nullptr;   /// 数据文件关联的buffer pool
   RecordFileHandler *record_handler_ = nullptr;  /// 记录操作
   std::vector<Index *> indexes_;
+  mutable std::mutex stats_mutex_;  ///< 保护table_stats_，其它会话可能在ANALYZE的同时读取
+  std::shared_ptr<const TableStats> table_stats_;
+  std::atomic<uint64_t> data_version_{0};
 };
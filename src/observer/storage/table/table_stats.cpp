@@ -0,0 +1,348 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <fstream>
+
+#include <json/json.h>
+
+#include "storage/table/table_stats.h"
+#include "storage/table/table_meta.h"
+#include "common/log/log.h"
+
+using namespace std;
+
+const static Json::StaticString FIELD_NAME("name");
+const static Json::StaticString FIELD_NDV("ndv");
+const static Json::StaticString FIELD_NULL_FRACTION("null_fraction");
+const static Json::StaticString FIELD_MIN("min");
+const static Json::StaticString FIELD_BOUNDS("bounds");
+const static Json::StaticString FIELD_ROW_COUNT("row_count");
+const static Json::StaticString FIELD_PAGE_COUNT("page_count");
+const static Json::StaticString FIELD_COLUMNS("columns");
+
+static Json::Value value_to_json(const Value &value)
+{
+  switch (value.attr_type()) {
+    case INTS: return Json::Value(value.get_int());
+    case FLOATS: return Json::Value(value.get_float());
+    case BOOLEANS: return Json::Value(value.get_boolean());
+    case CHARS: return Json::Value(value.get_string());
+    default: return Json::Value();
+  }
+}
+
+static bool value_from_json(const Json::Value &json_value, AttrType attr_type, Value &value)
+{
+  switch (attr_type) {
+    case INTS: {
+      if (!json_value.isInt()) {
+        return false;
+      }
+      value.set_int(json_value.asInt());
+    } break;
+    case FLOATS: {
+      if (!json_value.isNumeric()) {
+        return false;
+      }
+      value.set_float(json_value.asFloat());
+    } break;
+    case BOOLEANS: {
+      if (!json_value.isBool()) {
+        return false;
+      }
+      value.set_boolean(json_value.asBool());
+    } break;
+    case CHARS: {
+      if (!json_value.isString()) {
+        return false;
+      }
+      value.set_string(json_value.asCString());
+    } break;
+    default: {
+      return false;
+    }
+  }
+  return true;
+}
+
+void ColumnStats::build(const char *name, AttrType attr_type, vector<Value> &sample, int64_t row_count)
+{
+  name_      = name;
+  attr_type_ = attr_type;
+  bounds_.clear();
+  min_ = Value();
+
+  auto null_end = std::partition(sample.begin(), sample.end(), [](const Value &value) {
+    return value.attr_type() == UNDEFINED;
+  });
+  const int64_t null_num = null_end - sample.begin();
+  const int64_t n        = sample.end() - null_end;
+  null_fraction_         = sample.empty() ? 0 : static_cast<double>(null_num) / sample.size();
+  if (n == 0) {
+    ndv_ = 0;
+    return;
+  }
+
+  std::sort(null_end, sample.end(), [](const Value &left, const Value &right) { return left.compare(right) < 0; });
+
+  // 采样中不同值的个数d，以及只出现一次的值的个数f1
+  int64_t d  = 0;
+  int64_t f1 = 0;
+  for (auto iter = null_end; iter != sample.end();) {
+    auto next = iter + 1;
+    while (next != sample.end() && next->compare(*iter) == 0) {
+      ++next;
+    }
+    d++;
+    if (next - iter == 1) {
+      f1++;
+    }
+    iter = next;
+  }
+
+  // 采样是全部数据时就是精确值，否则使用Haas和Stokes的Duj1估算：n*d / (n - f1 + f1*n/N)
+  const double total = std::max(static_cast<double>(n), row_count * (1 - null_fraction_));
+  if (n >= total) {
+    ndv_ = d;
+  } else {
+    const double estimate = n * d / (n - f1 + f1 * n / total);
+    ndv_ = static_cast<int64_t>(std::clamp(estimate, static_cast<double>(d), total));
+  }
+
+  // 等深直方图，每个桶的数据量相同，数据量不足时每个值一个桶
+  min_ = *null_end;
+  const int64_t bucket_num = std::min<int64_t>(HISTOGRAM_BUCKETS, n);
+  for (int64_t i = 1; i <= bucket_num; i++) {
+    bounds_.push_back(*(null_end + (i * n / bucket_num - 1)));
+  }
+}
+
+double ColumnStats::fraction_less(const Value &value) const
+{
+  if (bounds_.empty() || value.compare(min_) <= 0) {
+    return 0;
+  }
+  if (value.compare(bounds_.back()) > 0) {
+    return 1;
+  }
+
+  auto iter = std::lower_bound(bounds_.begin(), bounds_.end(), value, [](const Value &bound, const Value &value) {
+    return bound.compare(value) < 0;
+  });
+  const int    bucket = iter - bounds_.begin();
+  const Value &low    = bucket == 0 ? min_ : bounds_[bucket - 1];
+  const Value &high   = *iter;
+
+  // 数值类型在桶内按照线性分布插值，字符串取桶的一半
+  double pos = 0.5;
+  if (attr_type_ == INTS || attr_type_ == FLOATS) {
+    const double low_value  = low.get_float();
+    const double high_value = high.get_float();
+    pos = high_value > low_value ? (value.get_float() - low_value) / (high_value - low_value) : 0;
+    pos = std::clamp(pos, 0.0, 1.0);
+  }
+  return (bucket + pos) / bounds_.size();
+}
+
+double ColumnStats::fraction_equal(const Value &value) const
+{
+  if (bounds_.empty() || value.compare(min_) < 0 || value.compare(bounds_.back()) > 0) {
+    return 0;
+  }
+
+  const double uniform = 1.0 / std::max<int64_t>(ndv_, 1);
+  auto range = std::equal_range(bounds_.begin(), bounds_.end(), value, [](const Value &left, const Value &right) {
+    return left.compare(right) < 0;
+  });
+  const int bound_num = range.second - range.first;
+  if (bound_num >= 2) {
+    return std::max(uniform, static_cast<double>(bound_num - 1) / bounds_.size());
+  }
+  return uniform;
+}
+
+double ColumnStats::equal_selectivity(const Value &value) const
+{
+  return fraction_equal(value) * (1 - null_fraction_);
+}
+
+double ColumnStats::range_selectivity(
+    const Value *low, bool low_inclusive, const Value *high, bool high_inclusive) const
+{
+  double high_fraction = 1;
+  if (high != nullptr) {
+    high_fraction = fraction_less(*high) + (high_inclusive ? fraction_equal(*high) : 0);
+  }
+  double low_fraction = 0;
+  if (low != nullptr) {
+    low_fraction = fraction_less(*low) + (low_inclusive ? 0 : fraction_equal(*low));
+  }
+  return std::clamp(high_fraction - low_fraction, 0.0, 1.0) * (1 - null_fraction_);
+}
+
+void ColumnStats::to_json(Json::Value &json_value) const
+{
+  json_value[FIELD_NAME]          = name_;
+  json_value[FIELD_NDV]           = static_cast<Json::Int64>(ndv_);
+  json_value[FIELD_NULL_FRACTION] = null_fraction_;
+  if (!bounds_.empty()) {
+    json_value[FIELD_MIN] = value_to_json(min_);
+    Json::Value bounds_value(Json::arrayValue);
+    for (const Value &bound : bounds_) {
+      bounds_value.append(value_to_json(bound));
+    }
+    json_value[FIELD_BOUNDS] = std::move(bounds_value);
+  }
+}
+
+RC ColumnStats::from_json(const TableMeta &table, const Json::Value &json_value, ColumnStats &column)
+{
+  const Json::Value &name_value          = json_value[FIELD_NAME];
+  const Json::Value &ndv_value           = json_value[FIELD_NDV];
+  const Json::Value &null_fraction_value = json_value[FIELD_NULL_FRACTION];
+  if (!name_value.isString() || !ndv_value.isIntegral() || !null_fraction_value.isNumeric()) {
+    LOG_ERROR("Invalid column stats. json value=%s", json_value.toStyledString().c_str());
+    return RC::INTERNAL;
+  }
+
+  const FieldMeta *field = table.field(name_value.asCString());
+  if (nullptr == field) {
+    LOG_WARN("Field of column stats does not exist. table=%s, field=%s", table.name(), name_value.asCString());
+    return RC::SCHEMA_FIELD_MISSING;
+  }
+
+  column.name_          = name_value.asString();
+  column.attr_type_     = field->type();
+  column.ndv_           = ndv_value.asInt64();
+  column.null_fraction_ = null_fraction_value.asDouble();
+  column.min_           = Value();
+  column.bounds_.clear();
+
+  const Json::Value &bounds_value = json_value[FIELD_BOUNDS];
+  if (bounds_value.isNull()) {
+    return RC::SUCCESS;
+  }
+  if (!bounds_value.isArray() || !value_from_json(json_value[FIELD_MIN], column.attr_type_, column.min_)) {
+    LOG_ERROR("Invalid histogram of column stats. json value=%s", json_value.toStyledString().c_str());
+    return RC::INTERNAL;
+  }
+  for (const Json::Value &bound_value : bounds_value) {
+    Value bound;
+    if (!value_from_json(bound_value, column.attr_type_, bound)) {
+      LOG_ERROR("Invalid histogram of column stats. json value=%s", json_value.toStyledString().c_str());
+      return RC::INTERNAL;
+    }
+    column.bounds_.push_back(bound);
+  }
+  return RC::SUCCESS;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+const ColumnStats *TableStats::column(const char *name) const
+{
+  for (const ColumnStats &column : columns_) {
+    if (0 == strcmp(column.name().c_str(), name)) {
+      return &column;
+    }
+  }
+  return nullptr;
+}
+
+/**
+ * 先写到临时文件中再重命名，避免写到一半时留下不完整的文件
+ */
+RC TableStats::save(const string &file) const
+{
+  Json::Value stats_value;
+  stats_value[FIELD_ROW_COUNT]  = static_cast<Json::Int64>(row_count_);
+  stats_value[FIELD_PAGE_COUNT] = page_count_;
+
+  Json::Value columns_value(Json::arrayValue);
+  for (const ColumnStats &column : columns_) {
+    Json::Value column_value;
+    column.to_json(column_value);
+    columns_value.append(std::move(column_value));
+  }
+  stats_value[FIELD_COLUMNS] = std::move(columns_value);
+
+  const string tmp_file = file + ".tmp";
+  fstream fs;
+  fs.open(tmp_file, ios_base::out | ios_base::binary | ios_base::trunc);
+  if (!fs.is_open()) {
+    LOG_ERROR("Failed to open file for write. file name=%s, errmsg=%s", tmp_file.c_str(), strerror(errno));
+    return RC::IOERR_OPEN;
+  }
+
+  Json::StreamWriterBuilder builder;
+  unique_ptr<Json::StreamWriter> writer(builder.newStreamWriter());
+  writer->write(stats_value, &fs);
+  fs.close();
+  if (fs.fail()) {
+    LOG_ERROR("Failed to write table stats. file name=%s", tmp_file.c_str());
+    return RC::IOERR_WRITE;
+  }
+
+  if (0 != ::rename(tmp_file.c_str(), file.c_str())) {
+    LOG_ERROR("Failed to rename tmp stats file (%s) to %s. errmsg=%s", tmp_file.c_str(), file.c_str(), strerror(errno));
+    return RC::IOERR_WRITE;
+  }
+  return RC::SUCCESS;
+}
+
+RC TableStats::load(const TableMeta &table, const string &file)
+{
+  fstream fs;
+  fs.open(file, ios_base::in | ios_base::binary);
+  if (!fs.is_open()) {
+    return RC::FILE_NOT_EXIST;
+  }
+
+  Json::Value stats_value;
+  Json::CharReaderBuilder builder;
+  string errors;
+  if (!Json::parseFromStream(builder, fs, &stats_value, &errors)) {
+    LOG_ERROR("Failed to deserialize table stats. file name=%s, error=%s", file.c_str(), errors.c_str());
+    return RC::INTERNAL;
+  }
+
+  const Json::Value &row_count_value  = stats_value[FIELD_ROW_COUNT];
+  const Json::Value &page_count_value = stats_value[FIELD_PAGE_COUNT];
+  const Json::Value &columns_value    = stats_value[FIELD_COLUMNS];
+  if (!row_count_value.isIntegral() || !page_count_value.isInt() || !columns_value.isArray()) {
+    LOG_ERROR("Invalid table stats. file name=%s", file.c_str());
+    return RC::INTERNAL;
+  }
+
+  vector<ColumnStats> columns;
+  for (const Json::Value &column_value : columns_value) {
+    ColumnStats column;
+    RC rc = ColumnStats::from_json(table, column_value, column);
+    if (rc == RC::SCHEMA_FIELD_MISSING) {
+      continue;
+    }
+    if (OB_FAIL(rc)) {
+      return rc;
+    }
+    columns.push_back(std::move(column));
+  }
+
+  row_count_  = row_count_value.asInt64();
+  page_count_ = page_count_value.asInt();
+  columns_.swap(columns);
+  return RC::SUCCESS;
+}
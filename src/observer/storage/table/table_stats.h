@@ -0,0 +1,124 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18.
+//
+
+#pragma once
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include "common/rc.h"
+#include "sql/parser/value.h"
+
+namespace Json {
+class Value;
+}  // namespace Json
+
+class TableMeta;
+
+/**
+ * @brief 一个字段的统计信息
+ * @ingroup Storage
+ * @details 由 ANALYZE TABLE 对表数据采样得到，包括不同值的个数(NDV)、空值比例和等深直方图。
+ * 直方图把非空的数据按照顺序分成行数相同的若干个桶，记录每个桶的上界，用来估算范围条件的选择率。
+ * 一个值在多个桶的边界上出现时，说明这是一个高频值，等值条件的选择率会按照桶的个数估算。
+ */
+class ColumnStats
+{
+public:
+  static constexpr int HISTOGRAM_BUCKETS = 64;
+
+  ColumnStats() = default;
+  ~ColumnStats() = default;
+
+  /**
+   * @brief 根据采样数据生成统计信息
+   * @param sample 这个字段上的采样数据，会被排序
+   * @param row_count 表的总行数，采样只是其中一部分时，用来估算不同值的个数
+   */
+  void build(const char *name, AttrType attr_type, std::vector<Value> &sample, int64_t row_count);
+
+  const std::string &name() const { return name_; }
+  AttrType           attr_type() const { return attr_type_; }
+  int64_t            ndv() const { return ndv_; }
+  double             null_fraction() const { return null_fraction_; }
+  int                bucket_num() const { return static_cast<int>(bounds_.size()); }
+
+  /**
+   * @brief 估算 field = value 的选择率
+   */
+  double equal_selectivity(const Value &value) const;
+
+  /**
+   * @brief 估算字段在一个范围内的选择率
+   * @details low/high 为空时表示这一侧没有边界
+   */
+  double range_selectivity(const Value *low, bool low_inclusive, const Value *high, bool high_inclusive) const;
+
+  void      to_json(Json::Value &json_value) const;
+  static RC from_json(const TableMeta &table, const Json::Value &json_value, ColumnStats &column);
+
+private:
+  /**
+   * @brief 非空数据中小于value的比例，在桶内按照数值线性插值
+   */
+  double fraction_less(const Value &value) const;
+
+  /**
+   * @brief 非空数据中等于value的比例
+   */
+  double fraction_equal(const Value &value) const;
+
+private:
+  std::string        name_;
+  AttrType           attr_type_     = UNDEFINED;
+  int64_t            ndv_           = 0;
+  double             null_fraction_ = 0;
+  Value              min_;     ///< 最小值，也就是第一个桶的下界
+  std::vector<Value> bounds_;  ///< 每个桶的上界，最后一个是最大值
+};
+
+/**
+ * @brief 表的统计信息
+ * @ingroup Storage
+ * @details 保存在表元数据文件旁边的单独文件中(表名.stats)，格式是JSON。
+ * 表数据变化后统计信息不会自动更新，需要重新执行 ANALYZE TABLE。
+ */
+class TableStats
+{
+public:
+  TableStats() = default;
+  ~TableStats() = default;
+
+  int64_t row_count() const { return row_count_; }
+  int32_t page_count() const { return page_count_; }
+  void    set_row_count(int64_t row_count) { row_count_ = row_count; }
+  void    set_page_count(int32_t page_count) { page_count_ = page_count; }
+
+  std::vector<ColumnStats>       &columns() { return columns_; }
+  const std::vector<ColumnStats> &columns() const { return columns_; }
+
+  /**
+   * @brief 按照字段名查找统计信息，没有时返回空
+   */
+  const ColumnStats *column(const char *name) const;
+
+  RC save(const std::string &file) const;
+  RC load(const TableMeta &table, const std::string &file);
+
+private:
+  int64_t                  row_count_  = 0;
+  int32_t                  page_count_ = 0;  ///< 收集统计信息时数据文件的页面数
+  std::vector<ColumnStats> columns_;
+};
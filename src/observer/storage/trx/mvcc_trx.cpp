@@ -284,6 +284,8 @@ RC MvccTrx::commit_with_trx_id(int32_t commit_xid)
         rc = operation.table()->visit_record(rid, false/*readonly*/, record_updater);
         ASSERT(rc == RC::SUCCESS, "failed to get record while committing. rid=%s, rc=%s",
                rid.to_string().c_str(), strrc(rc));
+        // 修改的数据对其它事务可见之后再增加版本，之前缓存的查询结果都会过期
+        table->increase_data_version();
       } break;
 
       case Operation::Type::DELETE: {
@@ -305,6 +307,7 @@ RC MvccTrx::commit_with_trx_id(int32_t commit_xid)
         rc = operation.table()->visit_record(rid, false/*readonly*/, record_updater);
         ASSERT(rc == RC::SUCCESS, "failed to get record while committing. rid=%s, rc=%s",
                rid.to_string().c_str(), strrc(rc));
+        table->increase_data_version();
       } break;
 
       default: {
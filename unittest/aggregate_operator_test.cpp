@@ -0,0 +1,484 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18
+//
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/global_context.h"
+#include "common/mm/arena.h"
+#include "common/mm/memory_tracker.h"
+#include "sql/operator/hash_aggregate_physical_operator.h"
+#include "sql/operator/stream_aggregate_physical_operator.h"
+#include "storage/common/temp_file.h"
+#include "storage/table/table.h"
+#include "gtest/gtest.h"
+#include "unittest_util.h"
+
+using namespace std;
+
+/**
+ * 输入的每一行是 (k, name, v)，计算
+ * select k, count(*), sum(v), avg(v), max(name), min(v) group by k
+ */
+class AggregateOperatorTest : public testing::Test
+{
+protected:
+  vector<TupleCellSpec> input_specs() const
+  {
+    return {TupleCellSpec("", "k"), TupleCellSpec("", "name"), TupleCellSpec("", "v")};
+  }
+
+  vector<unique_ptr<Expression>> group_by_exprs(bool with_group_by)
+  {
+    vector<unique_ptr<Expression>> exprs;
+    if (with_group_by) {
+      exprs.emplace_back(new FieldExpr(&table_, &field_k_));
+    }
+    return exprs;
+  }
+
+  vector<unique_ptr<Expression>> aggregate_exprs()
+  {
+    vector<unique_ptr<Expression>> exprs;
+    auto add_aggregate = [&exprs](AggregateExpr::Type type, Expression *child, const char *name) {
+      exprs.emplace_back(new AggregateExpr(type, unique_ptr<Expression>(child)));
+      exprs.back()->set_name(name);
+    };
+    add_aggregate(AggregateExpr::Type::AGG_COUNT, nullptr, "count(*)");
+    add_aggregate(AggregateExpr::Type::AGG_SUM, new FieldExpr(&table_, &field_v_), "sum(v)");
+    add_aggregate(AggregateExpr::Type::AGG_AVG, new FieldExpr(&table_, &field_v_), "avg(v)");
+    add_aggregate(AggregateExpr::Type::AGG_MAX, new FieldExpr(&table_, &field_name_), "max(name)");
+    add_aggregate(AggregateExpr::Type::AGG_MIN, new FieldExpr(&table_, &field_v_), "min(v)");
+    return exprs;
+  }
+
+  /**
+   * @brief 执行算子，返回输出的所有行，按照顺序输出时不排序
+   */
+  vector<vector<Value>> run(PhysicalOperator &oper)
+  {
+    vector<vector<Value>> results;
+    EXPECT_EQ(RC::SUCCESS, oper.open(nullptr));
+    RC rc = RC::SUCCESS;
+    while (OB_SUCC(rc = oper.next())) {
+      Tuple *tuple = oper.current_tuple();
+      vector<Value> row(tuple->cell_num());
+      for (int i = 0; i < tuple->cell_num(); i++) {
+        EXPECT_EQ(RC::SUCCESS, tuple->cell_at(i, row[i]));
+      }
+      results.push_back(row);
+    }
+    EXPECT_EQ(RC::RECORD_EOF, rc);
+    EXPECT_EQ(RC::SUCCESS, oper.close());
+    return results;
+  }
+
+  static vector<string> to_strings(const vector<vector<Value>> &rows, bool sorted)
+  {
+    vector<string> results;
+    for (const vector<Value> &row : rows) {
+      string result;
+      for (const Value &cell : row) {
+        result += cell.to_string() + "|";
+      }
+      results.push_back(result);
+    }
+    if (sorted) {
+      sort(results.begin(), results.end());
+    }
+    return results;
+  }
+
+  /**
+   * @brief 直接计算期望的结果
+   */
+  static vector<string> expected_results(const vector<vector<Value>> &rows)
+  {
+    struct State
+    {
+      int64_t count = 0;
+      int64_t sum   = 0;
+      string  max_name;
+      int     min_v = INT32_MAX;
+    };
+
+    map<int, State> states;
+    for (const vector<Value> &row : rows) {
+      State &state = states[row[0].get_int()];
+      state.count++;
+      state.sum += row[2].get_int();
+      state.max_name = max(state.max_name, row[1].get_string());
+      state.min_v    = min(state.min_v, row[2].get_int());
+    }
+
+    vector<vector<Value>> results;
+    for (const auto &[key, state] : states) {
+      results.push_back({Value(key), Value(static_cast<int>(state.count)), Value(static_cast<int>(state.sum)),
+          Value(static_cast<float>(static_cast<double>(state.sum) / state.count)), Value(state.max_name.c_str()),
+          Value(state.min_v)});
+    }
+    return to_strings(results, true /*sorted*/);
+  }
+
+  static vector<vector<Value>> create_rows(int num, int key_num)
+  {
+    vector<vector<Value>> rows;
+    for (int i = 0; i < num; i++) {
+      rows.push_back({Value(i % key_num), Value(("name" + to_string(i % 7)).c_str()), Value(i)});
+    }
+    return rows;
+  }
+
+protected:
+  Table     table_;
+  FieldMeta field_k_{"k", INTS, 0, 4, true};
+  FieldMeta field_name_{"name", CHARS, 4, 10, true};
+  FieldMeta field_v_{"v", INTS, 14, 4, true};
+};
+
+TEST_F(AggregateOperatorTest, test_hash_aggregate)
+{
+  // 分组数超过初始的槽位数，会多次扩容
+  vector<vector<Value>> rows = create_rows(10000, 1000);
+
+  HashAggregatePhysicalOperator oper(group_by_exprs(true), aggregate_exprs());
+  oper.add_child(make_unique<ValuesPhysicalOperator>(input_specs(), rows));
+  vector<vector<Value>> results = run(oper);
+  ASSERT_EQ(1000, static_cast<int>(results.size()));
+  ASSERT_EQ(expected_results(rows), to_strings(results, true /*sorted*/));
+
+  // 聚合函数的结果可以按照名字查找
+  Value cell;
+  ASSERT_EQ(RC::SUCCESS, oper.open(nullptr));
+  ASSERT_EQ(RC::SUCCESS, oper.next());
+  ASSERT_EQ(RC::SUCCESS, oper.current_tuple()->find_cell(TupleCellSpec("count(*)"), cell));
+  ASSERT_EQ(10, cell.get_int());
+  ASSERT_EQ(RC::SUCCESS, oper.close());
+}
+
+TEST_F(AggregateOperatorTest, test_stream_aggregate)
+{
+  vector<vector<Value>> rows = create_rows(5000, 300);
+  sort(rows.begin(), rows.end(), [](const vector<Value> &a, const vector<Value> &b) {
+    return a[0].compare(b[0]) < 0;
+  });
+
+  StreamAggregatePhysicalOperator oper(group_by_exprs(true), aggregate_exprs());
+  oper.add_child(make_unique<ValuesPhysicalOperator>(input_specs(), rows));
+  vector<vector<Value>> results = run(oper);
+
+  // 按照输入的顺序输出分组
+  ASSERT_EQ(300, static_cast<int>(results.size()));
+  for (int i = 0; i < 300; i++) {
+    ASSERT_EQ(i, results[i][0].get_int());
+  }
+  ASSERT_EQ(expected_results(rows), to_strings(results, true /*sorted*/));
+}
+
+TEST_F(AggregateOperatorTest, test_two_phase)
+{
+  vector<vector<Value>> rows = create_rows(9000, 500);
+
+  // 数据分成三份，分别做第一阶段聚合，再合并中间状态
+  vector<vector<Value>> partial_rows;
+  for (int part = 0; part < 3; part++) {
+    vector<vector<Value>> part_rows(rows.begin() + part * 3000, rows.begin() + (part + 1) * 3000);
+    HashAggregatePhysicalOperator partial_oper(group_by_exprs(true), aggregate_exprs(), AggregateMode::PARTIAL);
+    partial_oper.add_child(make_unique<ValuesPhysicalOperator>(input_specs(), part_rows));
+    vector<vector<Value>> results = run(partial_oper);
+    ASSERT_EQ(500, static_cast<int>(results.size()));
+    // key、5个聚合函数，其中AVG有两个值
+    ASSERT_EQ(7, static_cast<int>(results.front().size()));
+    partial_rows.insert(partial_rows.end(), results.begin(), results.end());
+  }
+
+  vector<TupleCellSpec> partial_specs(7, TupleCellSpec("partial"));
+  HashAggregatePhysicalOperator final_oper(group_by_exprs(true), aggregate_exprs(), AggregateMode::FINAL);
+  final_oper.add_child(make_unique<ValuesPhysicalOperator>(partial_specs, partial_rows));
+  vector<vector<Value>> results = run(final_oper);
+  ASSERT_EQ(expected_results(rows), to_strings(results, true /*sorted*/));
+}
+
+TEST_F(AggregateOperatorTest, test_empty_input)
+{
+  // 没有分组时输出一行
+  for (bool use_hash : {true, false}) {
+    unique_ptr<PhysicalOperator> oper;
+    if (use_hash) {
+      oper.reset(new HashAggregatePhysicalOperator(group_by_exprs(false), aggregate_exprs()));
+    } else {
+      oper.reset(new StreamAggregatePhysicalOperator(group_by_exprs(false), aggregate_exprs()));
+    }
+    oper->add_child(make_unique<ValuesPhysicalOperator>(input_specs(), vector<vector<Value>>()));
+    vector<string> results = to_strings(run(*oper), false /*sorted*/);
+    ASSERT_EQ(1, static_cast<int>(results.size()));
+    ASSERT_EQ("0|NULL|NULL|NULL|NULL|", results[0]);
+  }
+
+  // 有分组时没有输出
+  HashAggregatePhysicalOperator hash_oper(group_by_exprs(true), aggregate_exprs());
+  hash_oper.add_child(make_unique<ValuesPhysicalOperator>(input_specs(), vector<vector<Value>>()));
+  ASSERT_TRUE(run(hash_oper).empty());
+
+  StreamAggregatePhysicalOperator stream_oper(group_by_exprs(true), aggregate_exprs());
+  stream_oper.add_child(make_unique<ValuesPhysicalOperator>(input_specs(), vector<vector<Value>>()));
+  ASSERT_TRUE(run(stream_oper).empty());
+}
+
+TEST_F(AggregateOperatorTest, test_query_memory_limit)
+{
+  vector<vector<Value>> rows = create_rows(20000, 20000);
+
+  // hash表不能写临时文件，超过查询的内存限制时返回错误
+  common::MemoryTracker tracker(256 * 1024);
+  common::MemoryTracker::set_current(&tracker);
+  HashAggregatePhysicalOperator oper(group_by_exprs(true), aggregate_exprs());
+  oper.add_child(make_unique<ValuesPhysicalOperator>(input_specs(), rows));
+  ASSERT_EQ(RC::NOMEM, oper.open(nullptr));
+  ASSERT_TRUE(tracker.exceeded());
+  ASSERT_EQ(RC::SUCCESS, oper.close());
+  ASSERT_EQ(0, tracker.used());
+
+  // 限制足够大时正常执行，并记录峰值
+  tracker.set_limit(INT64_MAX);
+  ASSERT_EQ(20000, static_cast<int>(run(oper).size()));
+  ASSERT_EQ(0, tracker.used());
+  ASSERT_GE(tracker.peak(), 256 * 1024);
+
+  // 只统计实际使用的内存，分组很少时不会因为arena中整块的内存超过限制
+  tracker.set_limit(64 * 1024);
+  HashAggregatePhysicalOperator small_oper(group_by_exprs(true), aggregate_exprs());
+  small_oper.add_child(make_unique<ValuesPhysicalOperator>(input_specs(), create_rows(100, 10)));
+  ASSERT_EQ(10, static_cast<int>(run(small_oper).size()));
+  common::MemoryTracker::set_current(nullptr);
+}
+
+/**
+ * @brief hash聚合可以使用临时文件
+ */
+class AggregateSpillTest : public AggregateOperatorTest
+{
+protected:
+  void SetUp() override
+  {
+    // 每个用例使用单独的临时目录，结束后删除
+    test_dir_ = create_temp_dir("aggregate_operator_test");
+    ASSERT_FALSE(test_dir_.empty());
+    ASSERT_EQ(RC::SUCCESS, temp_file_manager_.init(test_dir_.c_str()));
+    GCTX.temp_file_manager_ = &temp_file_manager_;
+  }
+
+  void TearDown() override
+  {
+    GCTX.temp_file_manager_ = nullptr;
+    filesystem::remove_all(test_dir_);
+  }
+
+protected:
+  string          test_dir_;
+  TempFileManager temp_file_manager_;
+};
+
+TEST_F(AggregateSpillTest, test_spill)
+{
+  vector<vector<Value>> rows = create_rows(20000, 5000);
+
+  // 1字节的限制会一直分区到最大次数，之后在内存中聚合
+  for (int64_t memory_limit : {64 * 1024L, 1L}) {
+    HashAggregatePhysicalOperator oper(group_by_exprs(true), aggregate_exprs());
+    oper.set_memory_limit(memory_limit);
+    oper.add_child(make_unique<ValuesPhysicalOperator>(input_specs(), rows));
+    vector<vector<Value>> results = run(oper);
+    ASSERT_TRUE(oper.spilled());
+    ASSERT_EQ(expected_results(rows), to_strings(results, true /*sorted*/));
+    ASSERT_EQ(0, temp_file_manager_.file_count());
+  }
+  ASSERT_GT(temp_file_manager_.written_bytes(), 0);
+
+  // 分区写到临时文件的是子算子输出的中间状态
+  vector<vector<Value>> partial_rows;
+  for (int part = 0; part < 2; part++) {
+    vector<vector<Value>> part_rows(rows.begin() + part * 10000, rows.begin() + (part + 1) * 10000);
+    HashAggregatePhysicalOperator partial_oper(group_by_exprs(true), aggregate_exprs(), AggregateMode::PARTIAL);
+    partial_oper.add_child(make_unique<ValuesPhysicalOperator>(input_specs(), part_rows));
+    vector<vector<Value>> results = run(partial_oper);
+    partial_rows.insert(partial_rows.end(), results.begin(), results.end());
+  }
+
+  vector<TupleCellSpec> partial_specs(7, TupleCellSpec("partial"));
+  HashAggregatePhysicalOperator final_oper(group_by_exprs(true), aggregate_exprs(), AggregateMode::FINAL);
+  final_oper.set_memory_limit(64 * 1024);
+  final_oper.add_child(make_unique<ValuesPhysicalOperator>(partial_specs, partial_rows));
+  vector<vector<Value>> results = run(final_oper);
+  ASSERT_TRUE(final_oper.spilled());
+  ASSERT_EQ(expected_results(rows), to_strings(results, true /*sorted*/));
+}
+
+TEST_F(AggregateSpillTest, test_query_memory_limit)
+{
+  vector<vector<Value>> rows = create_rows(20000, 20000);
+
+  // 可以写临时文件时，超过查询的内存限制也会分区
+  common::MemoryTracker tracker(256 * 1024);
+  {
+    common::QueryArena query_arena(&tracker);
+    common::MemoryTracker::set_current(&tracker);
+    common::QueryArena::set_current(&query_arena);
+    HashAggregatePhysicalOperator oper(group_by_exprs(true), aggregate_exprs());
+    oper.add_child(make_unique<ValuesPhysicalOperator>(input_specs(), rows));
+    vector<vector<Value>> results = run(oper);
+    common::QueryArena::set_current(nullptr);
+    common::MemoryTracker::set_current(nullptr);
+
+    ASSERT_TRUE(oper.spilled());
+    ASSERT_EQ(expected_results(rows), to_strings(results, true /*sorted*/));
+
+    // 每个分区的hash表复用同一批块，close之后都还给了query_arena
+    ASSERT_GT(query_arena.free_blocks(), 0UL);
+    ASSERT_EQ(query_arena.free_blocks() * common::Arena::DEFAULT_BLOCK_SIZE, query_arena.memory_size());
+  }
+  ASSERT_EQ(0, tracker.used());
+}
+
+TEST(MemoryTracker, test_reservation)
+{
+  common::MemoryTracker tracker(1024 * 1024);
+  {
+    common::MemoryReservation reservation;
+    reservation.reset(&tracker);
+
+    // 变化比较小时不同步到tracker
+    ASSERT_TRUE(reservation.update(1000));
+    ASSERT_EQ(0, tracker.used());
+
+    ASSERT_TRUE(reservation.update(100 * 1024));
+    ASSERT_EQ(100 * 1024, tracker.used());
+
+    ASSERT_FALSE(reservation.update(2 * 1024 * 1024));
+    ASSERT_TRUE(tracker.exceeded());
+
+    ASSERT_TRUE(reservation.update(512 * 1024));
+    ASSERT_EQ(512 * 1024, tracker.used());
+    ASSERT_EQ(2 * 1024 * 1024, tracker.peak());
+  }
+  // 析构时释放
+  ASSERT_EQ(0, tracker.used());
+
+  common::MemoryReservation reservation;
+  ASSERT_TRUE(reservation.update(INT64_MAX));
+}
+
+TEST(MemoryTracker, test_small_limit)
+{
+  // 限制比同步的间隔小时也能准确判断
+  common::MemoryTracker     tracker(100);
+  common::MemoryReservation reservation;
+  reservation.reset(&tracker);
+  ASSERT_TRUE(reservation.update(60));
+  ASSERT_EQ(0, tracker.used());
+  ASSERT_TRUE(reservation.update(100));
+  ASSERT_FALSE(reservation.update(101));
+  ASSERT_EQ(101, tracker.used());
+  ASSERT_EQ(101, tracker.peak());
+
+  reservation.update(0);
+  ASSERT_EQ(0, tracker.used());
+  ASSERT_FALSE(tracker.exceeded());
+}
+
+TEST(MemoryTracker, test_unsynced_peak)
+{
+  // 没有同步到tracker中的最大值，在释放时计入峰值
+  common::MemoryTracker tracker;
+  {
+    common::MemoryReservation reservation;
+    reservation.reset(&tracker);
+    ASSERT_TRUE(reservation.update(30 * 1024));
+    ASSERT_TRUE(reservation.update(10 * 1024));
+    ASSERT_EQ(0, tracker.peak());
+
+    // 算子释放内存时
+    ASSERT_TRUE(reservation.update(0));
+    ASSERT_EQ(30 * 1024, tracker.peak());
+    ASSERT_TRUE(reservation.update(40 * 1024));
+  }
+  ASSERT_EQ(0, tracker.used());
+  ASSERT_EQ(40 * 1024, tracker.peak());
+}
+
+TEST(Arena, test_alloc)
+{
+  common::Arena arena(1024);
+  for (size_t size : {1, 7, 16, 100, 300, 1000, 5}) {
+    void *ptr = arena.alloc(size);
+    ASSERT_NE(nullptr, ptr);
+    ASSERT_EQ(0, reinterpret_cast<uintptr_t>(ptr) % alignof(max_align_t));
+    memset(ptr, 0xab, size);
+  }
+  ASSERT_GE(arena.memory_size(), 1024 + 1008UL);
+  // 按照对齐之后的大小统计使用的内存
+  ASSERT_EQ(16 + 16 + 16 + 112 + 304 + 1008 + 16UL, arena.used_size());
+
+  arena.reset();
+  ASSERT_EQ(0UL, arena.memory_size());
+  ASSERT_EQ(0UL, arena.used_size());
+}
+
+TEST(Arena, test_query_arena)
+{
+  common::MemoryTracker tracker;
+  {
+    common::QueryArena query_arena(&tracker);
+    common::Arena      arena;
+    arena.set_source(&query_arena);
+    ASSERT_NE(nullptr, arena.alloc(100));
+    ASSERT_NE(nullptr, arena.alloc(20000));  // 比较大的内存单独一块
+    ASSERT_EQ(common::Arena::DEFAULT_BLOCK_SIZE + 20000, query_arena.memory_size());
+
+    // 普通大小的块留下来复用，空闲的块记录到查询使用的内存中
+    arena.reset();
+    ASSERT_EQ(1UL, query_arena.free_blocks());
+    ASSERT_EQ(common::Arena::DEFAULT_BLOCK_SIZE, query_arena.memory_size());
+    ASSERT_EQ(static_cast<int64_t>(common::Arena::DEFAULT_BLOCK_SIZE), tracker.used());
+
+    ASSERT_NE(nullptr, arena.alloc(100));
+    ASSERT_EQ(0UL, query_arena.free_blocks());
+    ASSERT_EQ(common::Arena::DEFAULT_BLOCK_SIZE, query_arena.memory_size());
+    ASSERT_EQ(0, tracker.used());
+
+    // 空闲的块会超过查询的内存限制时直接释放
+    tracker.set_limit(1024);
+    arena.reset();
+    ASSERT_EQ(0UL, query_arena.free_blocks());
+    ASSERT_EQ(0UL, query_arena.memory_size());
+    ASSERT_NE(nullptr, arena.alloc(100));
+    tracker.set_limit(INT64_MAX);
+    arena.reset();
+  }
+  // 查询结束时释放所有的内存
+  ASSERT_EQ(0, tracker.used());
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,217 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18
+//
+
+#include <memory>
+
+#include "storage/common/chunk.h"
+#include "sql/expr/expression.h"
+#include "sql/expr/aggregator.h"
+#include "gtest/gtest.h"
+
+using namespace std;
+
+/**
+ * @brief 构造一个两列的chunk: 第0列是整数 0..rows-1，第1列是浮点数 i * 0.5
+ */
+static void make_chunk(Chunk &chunk, int rows)
+{
+  auto int_column = make_unique<Column>(INTS, sizeof(int), Chunk::MAX_ROWS);
+  auto float_column = make_unique<Column>(FLOATS, sizeof(float), Chunk::MAX_ROWS);
+  for (int i = 0; i < rows; i++) {
+    float f = i * 0.5f;
+    ASSERT_EQ(RC::SUCCESS, int_column->append_one((const char *)&i));
+    ASSERT_EQ(RC::SUCCESS, float_column->append_one((const char *)&f));
+  }
+  chunk.add_column(std::move(int_column), 0);
+  chunk.add_column(std::move(float_column), 1);
+}
+
+static FieldMeta int_field("c0", INTS, 0, sizeof(int), true);
+static FieldMeta float_field("c1", FLOATS, sizeof(int), sizeof(float), true);
+
+/**
+ * @brief 创建绑定到chunk中第pos列的字段表达式
+ */
+static unique_ptr<Expression> make_field(int pos)
+{
+  auto field_expr = make_unique<FieldExpr>(nullptr, pos == 0 ? &int_field : &float_field);
+  field_expr->set_pos(pos);
+  return field_expr;
+}
+
+TEST(Chunk, test_column)
+{
+  Column column(CHARS, 4, 3);
+  ASSERT_EQ(RC::SUCCESS, column.append_value(Value("abcdef")));
+  ASSERT_EQ(RC::SUCCESS, column.append_value(Value("xy")));
+  ASSERT_EQ(RC::SUCCESS, column.append_value(Value(12)));
+  ASSERT_NE(RC::SUCCESS, column.append_value(Value("full")));
+
+  ASSERT_EQ(3, column.count());
+  EXPECT_EQ("abcd", column.get_value(0).get_string());
+  EXPECT_EQ("xy", column.get_value(1).get_string());
+  EXPECT_EQ("12", column.get_value(2).get_string());
+
+  Column constant;
+  constant.init(Value(7), 100);
+  ASSERT_EQ(Column::Type::CONSTANT_COLUMN, constant.column_type());
+  ASSERT_EQ(100, constant.count());
+  EXPECT_EQ(7, constant.get_value(99).get_int());
+
+  Column ref;
+  ref.reference(column);
+  ASSERT_EQ(column.data(), ref.data());
+  EXPECT_EQ("xy", ref.get_value(1).get_string());
+}
+
+TEST(Chunk, test_selection)
+{
+  Chunk chunk;
+  make_chunk(chunk, 10);
+  ASSERT_EQ(10, chunk.rows());
+  ASSERT_EQ(10, chunk.active_rows());
+  ASSERT_EQ(1, chunk.column_index(1));
+  ASSERT_EQ(-1, chunk.column_index(5));
+
+  vector<uint8_t> even(10);
+  for (int i = 0; i < 10; i++) {
+    even[i] = (i % 2 == 0);
+  }
+  chunk.select(even);
+  ASSERT_EQ(5, chunk.active_rows());
+  EXPECT_EQ(4, chunk.active_row(2));
+
+  vector<uint8_t> less_than_five(10);
+  for (int i = 0; i < 10; i++) {
+    less_than_five[i] = (i < 5);
+  }
+  chunk.select(less_than_five);
+  ASSERT_EQ(3, chunk.active_rows());
+  EXPECT_EQ(0, chunk.active_row(0));
+  EXPECT_EQ(4, chunk.active_row(2));
+
+  chunk.reset_data();
+  ASSERT_EQ(0, chunk.rows());
+  ASSERT_FALSE(chunk.has_selection());
+}
+
+TEST(Chunk, test_comparison_eval)
+{
+  Chunk chunk;
+  make_chunk(chunk, 100);
+
+  ComparisonExpr int_expr(GREAT_EQUAL, make_field(0), make_unique<ValueExpr>(Value(90)));
+  vector<uint8_t> select;
+  ASSERT_EQ(RC::SUCCESS, int_expr.eval(chunk, select));
+  ASSERT_EQ(100, static_cast<int>(select.size()));
+  for (int i = 0; i < 100; i++) {
+    ASSERT_EQ(i >= 90, select[i] != 0) << "row " << i;
+  }
+
+  ComparisonExpr float_expr(LESS_THAN, make_unique<ValueExpr>(Value(10.0f)), make_field(1));
+  ASSERT_EQ(RC::SUCCESS, float_expr.eval(chunk, select));
+  for (int i = 0; i < 100; i++) {
+    ASSERT_EQ(10.0f < i * 0.5f, select[i] != 0) << "row " << i;
+  }
+
+  // 整数和浮点数比较，走逐行比较的路径
+  ComparisonExpr mixed_expr(EQUAL_TO, make_field(0), make_field(1));
+  ASSERT_EQ(RC::SUCCESS, mixed_expr.eval(chunk, select));
+  for (int i = 0; i < 100; i++) {
+    ASSERT_EQ(i == 0, select[i] != 0) << "row " << i;
+  }
+}
+
+TEST(Chunk, test_conjunction_and_arithmetic)
+{
+  Chunk chunk;
+  make_chunk(chunk, 50);
+
+  // (c0 * 2 + 1) > 20 AND c1 < 20.0
+  auto mul = make_unique<ArithmeticExpr>(
+      ArithmeticExpr::Type::MUL, make_field(0), make_unique<ValueExpr>(Value(2)));
+  auto add = make_unique<ArithmeticExpr>(ArithmeticExpr::Type::ADD, std::move(mul), make_unique<ValueExpr>(Value(1)));
+
+  Column arithmetic_column;
+  ASSERT_EQ(RC::SUCCESS, add->get_column(chunk, arithmetic_column));
+  ASSERT_EQ(50, arithmetic_column.count());
+  EXPECT_EQ(21, arithmetic_column.get_value(10).get_int());
+
+  vector<unique_ptr<Expression>> children;
+  children.emplace_back(new ComparisonExpr(GREAT_THAN, std::move(add), make_unique<ValueExpr>(Value(20))));
+  children.emplace_back(new ComparisonExpr(LESS_THAN, make_field(1), make_unique<ValueExpr>(Value(20.0f))));
+  ConjunctionExpr and_expr(ConjunctionExpr::Type::AND, children);
+
+  vector<uint8_t> select;
+  ASSERT_EQ(RC::SUCCESS, and_expr.eval(chunk, select));
+  chunk.select(select);
+  ASSERT_EQ(30, chunk.active_rows());  // 10 <= i < 40
+  EXPECT_EQ(10, chunk.active_row(0));
+  EXPECT_EQ(39, chunk.active_row(29));
+}
+
+TEST(Chunk, test_aggregate)
+{
+  Chunk chunk;
+  make_chunk(chunk, 10);
+
+  vector<uint8_t> filter(10, 0);
+  filter[1] = filter[3] = filter[8] = 1;
+  chunk.select(filter);
+
+  AggregateExpr count_expr(AggregateExpr::Type::AGG_COUNT, nullptr);
+  AggregateExpr sum_expr(AggregateExpr::Type::AGG_SUM, make_field(0));
+  AggregateExpr avg_expr(AggregateExpr::Type::AGG_AVG, make_field(1));
+  AggregateExpr max_expr(AggregateExpr::Type::AGG_MAX, make_field(1));
+
+  auto count = count_expr.create_aggregator();
+  auto sum = sum_expr.create_aggregator();
+  auto avg = avg_expr.create_aggregator();
+  auto max = max_expr.create_aggregator();
+
+  Column int_column;
+  Column float_column;
+  ASSERT_EQ(RC::SUCCESS, sum_expr.child()->get_column(chunk, int_column));
+  ASSERT_EQ(RC::SUCCESS, avg_expr.child()->get_column(chunk, float_column));
+
+  // 累加两次，模拟多个chunk
+  for (int i = 0; i < 2; i++) {
+    ASSERT_EQ(RC::SUCCESS, count->accumulate(chunk, int_column));
+    ASSERT_EQ(RC::SUCCESS, sum->accumulate(chunk, int_column));
+    ASSERT_EQ(RC::SUCCESS, avg->accumulate(chunk, float_column));
+    ASSERT_EQ(RC::SUCCESS, max->accumulate(chunk, float_column));
+  }
+
+  Value result;
+  ASSERT_EQ(RC::SUCCESS, count->evaluate(result));
+  EXPECT_EQ(6, result.get_int());
+  ASSERT_EQ(RC::SUCCESS, sum->evaluate(result));
+  ASSERT_EQ(INTS, result.attr_type());
+  EXPECT_EQ(24, result.get_int());
+  ASSERT_EQ(RC::SUCCESS, avg->evaluate(result));
+  EXPECT_FLOAT_EQ(2.0f, result.get_float());
+  ASSERT_EQ(RC::SUCCESS, max->evaluate(result));
+  EXPECT_FLOAT_EQ(4.0f, result.get_float());
+
+  AggregateExpr::Type type;
+  ASSERT_EQ(RC::SUCCESS, AggregateExpr::type_from_string("Sum", type));
+  ASSERT_EQ(AggregateExpr::Type::AGG_SUM, type);
+  ASSERT_NE(RC::SUCCESS, AggregateExpr::type_from_string("median", type));
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,264 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+
+//
+// Created by agent on 2026/10/18
+//
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "sql/operator/exchange_physical_operator.h"
+#include "sql/operator/exchange_queue.h"
+#include "sql/operator/exchange_worker_pool.h"
+#include "sql/operator/explain_physical_operator.h"
+#include "sql/operator/hash_aggregate_physical_operator.h"
+#include "sql/operator/stream_aggregate_physical_operator.h"
+#include "storage/table/table.h"
+#include "gtest/gtest.h"
+#include "unittest_util.h"
+
+using namespace std;
+
+TEST(ExchangeQueue, test_multi_producer_consumer)
+{
+  const int num_per_producer = 100000;
+  const int producer_num     = 3;
+  const int consumer_num     = 3;
+
+  ExchangeQueue<int>   queue(8);
+  atomic<int>          finished_producers{0};
+  atomic<int64_t>      sum{0};
+  atomic<int>          count{0};
+  vector<thread>       threads;
+  for (int p = 0; p < producer_num; p++) {
+    threads.emplace_back([&]() {
+      ExchangeBackoff backoff;
+      for (int i = 1; i <= num_per_producer; i++) {
+        int value = i;
+        while (!queue.try_push(value)) {
+          backoff.wait();
+        }
+        backoff.reset();
+      }
+      finished_producers++;
+    });
+  }
+  for (int c = 0; c < consumer_num; c++) {
+    threads.emplace_back([&]() {
+      ExchangeBackoff backoff;
+      int             value = 0;
+      while (true) {
+        if (queue.try_pop(value)) {
+          sum += value;
+          count++;
+          backoff.reset();
+        } else if (finished_producers.load() == producer_num) {
+          // 生产者都结束之后再检查一次，避免漏掉最后放入的数据
+          if (!queue.try_pop(value)) {
+            break;
+          }
+          sum += value;
+          count++;
+        } else {
+          backoff.wait();
+        }
+      }
+    });
+  }
+  for (thread &t : threads) {
+    t.join();
+  }
+
+  ASSERT_EQ(producer_num * num_per_producer, count.load());
+  ASSERT_EQ(static_cast<int64_t>(num_per_producer) * (num_per_producer + 1) / 2 * producer_num, sum.load());
+}
+
+/**
+ * 每个生产者输出 (k, v)
+ */
+class ExchangeTest : public testing::Test
+{
+protected:
+  void SetUp() override { ASSERT_EQ(RC::SUCCESS, pool_.init(8)); }
+  void TearDown() override { pool_.cleanup(); }
+
+  vector<unique_ptr<PhysicalOperator>> create_producers(int producer_num, int rows_per_producer, int key_num)
+  {
+    vector<unique_ptr<PhysicalOperator>> producers;
+    for (int p = 0; p < producer_num; p++) {
+      vector<vector<Value>> rows;
+      for (int i = 0; i < rows_per_producer; i++) {
+        const int v = p * rows_per_producer + i;
+        rows.push_back({Value(v % key_num), Value(v)});
+      }
+      producers.emplace_back(new ValuesPhysicalOperator({TupleCellSpec("", "k"), TupleCellSpec("", "v")}, rows));
+    }
+    return producers;
+  }
+
+  /**
+   * @brief 在每个接收者上执行 select k, count(*) group by k，或者没有分组时的 count(*)
+   */
+  unique_ptr<PhysicalOperator> create_count(shared_ptr<Exchange> exchange, int receiver, bool group_by)
+  {
+    vector<unique_ptr<Expression>> group_by_exprs;
+    if (group_by) {
+      group_by_exprs.emplace_back(new FieldExpr(&table_, &field_k_));
+    }
+    vector<unique_ptr<Expression>> aggregate_exprs;
+    aggregate_exprs.emplace_back(new AggregateExpr(AggregateExpr::Type::AGG_COUNT, nullptr));
+    aggregate_exprs.back()->set_name("count(*)");
+
+    unique_ptr<PhysicalOperator> oper;
+    if (group_by) {
+      oper.reset(new HashAggregatePhysicalOperator(std::move(group_by_exprs), std::move(aggregate_exprs)));
+    } else {
+      oper.reset(new StreamAggregatePhysicalOperator(std::move(group_by_exprs), std::move(aggregate_exprs)));
+    }
+    oper->add_child(make_unique<ExchangePhysicalOperator>(std::move(exchange), receiver));
+    return oper;
+  }
+
+  /**
+   * @brief 通过GATHER汇总所有片段的输出，返回每行的字符串表示
+   */
+  vector<string> gather(vector<unique_ptr<PhysicalOperator>> fragments)
+  {
+    auto exchange = make_shared<Exchange>(ExchangeMode::GATHER, &pool_, std::move(fragments), 1);
+    ExchangePhysicalOperator oper(exchange, 0);
+
+    vector<string> results;
+    EXPECT_EQ(RC::SUCCESS, oper.open(nullptr));
+    RC rc = RC::SUCCESS;
+    while (OB_SUCC(rc = oper.next())) {
+      Tuple *tuple = oper.current_tuple();
+      string result;
+      for (int i = 0; i < tuple->cell_num(); i++) {
+        Value cell;
+        EXPECT_EQ(RC::SUCCESS, tuple->cell_at(i, cell));
+        result += cell.to_string() + "|";
+      }
+      results.push_back(result);
+    }
+    EXPECT_EQ(RC::RECORD_EOF, rc);
+    EXPECT_EQ(RC::SUCCESS, oper.close());
+    sort(results.begin(), results.end());
+    return results;
+  }
+
+protected:
+  ExchangeWorkerPool pool_;
+  Table              table_;
+  FieldMeta          field_k_{"k", INTS, 0, 4, true};
+};
+
+TEST_F(ExchangeTest, test_gather)
+{
+  // 每个生产者的行数不是批大小的整数倍
+  vector<string> results = gather(create_producers(3, 1000, 1000000));
+  ASSERT_EQ(3000, static_cast<int>(results.size()));
+
+  vector<string> expected;
+  for (int v = 0; v < 3000; v++) {
+    expected.push_back(to_string(v) + "|" + to_string(v) + "|");
+  }
+  sort(expected.begin(), expected.end());
+  ASSERT_EQ(expected, results);
+
+  // 没有数据
+  ASSERT_TRUE(gather(create_producers(2, 0, 1)).empty());
+}
+
+TEST_F(ExchangeTest, test_repartition)
+{
+  // key相同的行都发给同一个接收者，那么每个接收者分组统计之后，每个key只出现一次
+  const int key_num      = 100;
+  const int receiver_num = 3;
+  auto repartition = make_shared<Exchange>(ExchangeMode::REPARTITION, &pool_, create_producers(2, 3000, key_num),
+      receiver_num);
+  vector<vector<unique_ptr<Expression>>> keys(2);
+  for (vector<unique_ptr<Expression>> &producer_keys : keys) {
+    producer_keys.emplace_back(new FieldExpr(&table_, &field_k_));
+  }
+  repartition->set_partition_keys(std::move(keys));
+
+  vector<unique_ptr<PhysicalOperator>> fragments;
+  for (int i = 0; i < receiver_num; i++) {
+    fragments.push_back(create_count(repartition, i, true /*group_by*/));
+  }
+  vector<string> results = gather(std::move(fragments));
+
+  vector<string> expected;
+  for (int k = 0; k < key_num; k++) {
+    expected.push_back(to_string(k) + "|60|");
+  }
+  sort(expected.begin(), expected.end());
+  ASSERT_EQ(expected, results);
+}
+
+TEST_F(ExchangeTest, test_broadcast)
+{
+  // 每个接收者都收到全部数据
+  const int receiver_num = 3;
+  auto broadcast = make_shared<Exchange>(ExchangeMode::BROADCAST, &pool_, create_producers(2, 1500, 10), receiver_num);
+
+  vector<unique_ptr<PhysicalOperator>> fragments;
+  for (int i = 0; i < receiver_num; i++) {
+    fragments.push_back(create_count(broadcast, i, false /*group_by*/));
+  }
+  ASSERT_EQ(vector<string>(receiver_num, "3000|"), gather(std::move(fragments)));
+}
+
+TEST_F(ExchangeTest, test_explain_analyze)
+{
+  const int receiver_num = 3;
+  auto repartition = make_shared<Exchange>(ExchangeMode::REPARTITION, &pool_, create_producers(2, 3000, 100),
+      receiver_num);
+  vector<vector<unique_ptr<Expression>>> keys(2);
+  for (vector<unique_ptr<Expression>> &producer_keys : keys) {
+    producer_keys.emplace_back(new FieldExpr(&table_, &field_k_));
+  }
+  repartition->set_partition_keys(std::move(keys));
+
+  vector<unique_ptr<PhysicalOperator>> fragments;
+  for (int i = 0; i < receiver_num; i++) {
+    fragments.push_back(create_count(repartition, i, true /*group_by*/));
+  }
+  auto gather_exchange = make_shared<Exchange>(ExchangeMode::GATHER, &pool_, std::move(fragments), 1);
+
+  ExplainPhysicalOperator explain(true /*analyze*/);
+  explain.add_child(make_unique<ExchangePhysicalOperator>(gather_exchange, 0));
+  ASSERT_EQ(RC::SUCCESS, explain.open(nullptr));
+  ASSERT_EQ(RC::SUCCESS, explain.next());
+  Value cell;
+  ASSERT_EQ(RC::SUCCESS, explain.current_tuple()->cell_at(0, cell));
+  ASSERT_EQ(RC::RECORD_EOF, explain.next());
+  ASSERT_EQ(RC::SUCCESS, explain.close());
+
+  // 所有计划片段中对应算子的统计合并在一起
+  const string plan = cell.get_string();
+  EXPECT_NE(string::npos, plan.find("HASH_AGGREGATE [rows=100, loops=3,")) << plan;
+  EXPECT_NE(string::npos, plan.find("EXCHANGE(REPARTITION")) << plan;
+  EXPECT_NE(string::npos, plan.find("TABLE_SCAN [rows=6000, loops=2,")) << plan;
+  EXPECT_NE(string::npos, plan.find("workers=3]")) << plan;
+  EXPECT_NE(string::npos, plan.find("Execution: rows=100,")) << plan;
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
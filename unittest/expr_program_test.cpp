@@ -0,0 +1,271 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+
+//
+// Created by agent on 2026/10/18
+//
+
+#include <string.h>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "sql/expr/expr_program.h"
+#include "sql/expr/expression.h"
+#include "sql/expr/tuple.h"
+#include "storage/common/chunk.h"
+#include "gtest/gtest.h"
+
+using namespace std;
+
+/**
+ * 每行数据是 (id int, f float, s char(8))，记录中的偏移分别是0、4、8。
+ * 对同一个表达式，分别用表达式树和编译后的程序在tuple、记录和chunk上计算，结果应该完全一致。
+ */
+class ExprProgramTest : public testing::Test
+{
+protected:
+  static constexpr int RECORD_SIZE = 16;
+
+  void SetUp() override
+  {
+    mt19937 rng(0);
+    uniform_int_distribution<int> int_dist(-100, 100);
+    const vector<string> strings = {"", "a", "ab", "abc", "b", "m", "zz", "abcdefgh"};
+    for (int i = 0; i < ROWS; i++) {
+      const int id = int_dist(rng);
+      // 部分浮点数与整数的差小于EPSILON，比较时认为相等
+      const float f = (i % 5 == 0) ? static_cast<float>(id) + 1e-7f : int_dist(rng) * 0.25f;
+      const string &s = strings[rng() % strings.size()];
+      rows_.push_back({Value(id), Value(f), Value(s.c_str())});
+
+      char record[RECORD_SIZE];
+      memset(record, 0, sizeof(record));
+      memcpy(record, &id, sizeof(id));
+      memcpy(record + 4, &f, sizeof(f));
+      memcpy(record + 8, s.data(), s.size());  // 8个字符的字符串没有结尾的'\0'
+      records_.insert(records_.end(), record, record + RECORD_SIZE);
+    }
+  }
+
+  /**
+   * @brief 字段表达式，同时绑定tuple中的位置和chunk中的列
+   */
+  unique_ptr<Expression> field(int index)
+  {
+    const FieldMeta *metas[] = {&field_id_, &field_f_, &field_s_};
+    auto field_expr = make_unique<FieldExpr>(nullptr, metas[index]);
+    field_expr->set_cell_index(index);
+    field_expr->set_pos(index);
+    return field_expr;
+  }
+
+  static unique_ptr<Expression> value(const Value &v) { return make_unique<ValueExpr>(v); }
+
+  static unique_ptr<Expression> compare(CompOp op, unique_ptr<Expression> left, unique_ptr<Expression> right)
+  {
+    return make_unique<ComparisonExpr>(op, std::move(left), std::move(right));
+  }
+
+  static unique_ptr<Expression> arithmetic(
+      ArithmeticExpr::Type type, unique_ptr<Expression> left, unique_ptr<Expression> right)
+  {
+    return make_unique<ArithmeticExpr>(type, std::move(left), std::move(right));
+  }
+
+  static unique_ptr<Expression> conjunction(ConjunctionExpr::Type type, vector<unique_ptr<Expression>> children)
+  {
+    return make_unique<ConjunctionExpr>(type, children);
+  }
+
+  template <typename... Args>
+  static vector<unique_ptr<Expression>> list(Args... args)
+  {
+    vector<unique_ptr<Expression>> exprs;
+    (exprs.push_back(std::move(args)), ...);
+    return exprs;
+  }
+
+  void make_chunk(Chunk &chunk)
+  {
+    auto id_column = make_unique<Column>(INTS, 4, ROWS);
+    auto f_column  = make_unique<Column>(FLOATS, 4, ROWS);
+    auto s_column  = make_unique<Column>(CHARS, 8, ROWS);
+    for (int i = 0; i < ROWS; i++) {
+      const char *record = &records_[static_cast<size_t>(i) * RECORD_SIZE];
+      ASSERT_EQ(RC::SUCCESS, id_column->append_one(record));
+      ASSERT_EQ(RC::SUCCESS, f_column->append_one(record + 4));
+      ASSERT_EQ(RC::SUCCESS, s_column->append_one(record + 8));
+    }
+    chunk.add_column(std::move(id_column), 0);
+    chunk.add_column(std::move(f_column), 1);
+    chunk.add_column(std::move(s_column), 2);
+  }
+
+  /**
+   * @brief 在所有的行上对比表达式树和编译后程序的计算结果
+   */
+  void check(Expression &expr)
+  {
+    ExprProgram tuple_program;
+    ExprProgram record_program;
+    ASSERT_EQ(RC::SUCCESS, tuple_program.compile(expr, ExprProgram::FieldSource::TUPLE));
+    ASSERT_EQ(RC::SUCCESS, record_program.compile(expr, ExprProgram::FieldSource::RECORD));
+    ASSERT_EQ(expr.value_type(), tuple_program.result_type());
+
+    vector<uint8_t> expected_select;
+    ValueListTuple tuple;
+    for (int i = 0; i < ROWS; i++) {
+      tuple.set_cells(rows_[i]);
+      Value expected;
+      Value tuple_result;
+      Value record_result;
+      ASSERT_EQ(RC::SUCCESS, expr.get_value(tuple, expected));
+      ASSERT_EQ(RC::SUCCESS, tuple_program.eval(tuple, tuple_result));
+      ASSERT_EQ(RC::SUCCESS, record_program.eval(&records_[static_cast<size_t>(i) * RECORD_SIZE], record_result));
+      ASSERT_EQ(expected.attr_type(), tuple_result.attr_type()) << "row " << i;
+      ASSERT_EQ(expected.to_string(), tuple_result.to_string()) << "row " << i;
+      ASSERT_EQ(expected.to_string(), record_result.to_string()) << "row " << i;
+      expected_select.push_back(expected.get_boolean() ? 1 : 0);
+    }
+
+    if (expr.value_type() != BOOLEANS) {
+      return;
+    }
+
+    Chunk chunk;
+    make_chunk(chunk);
+    ExprProgram chunk_program;
+    vector<uint8_t> select;
+    ASSERT_EQ(RC::SUCCESS, chunk_program.compile(expr, ExprProgram::FieldSource::CHUNK));
+    ASSERT_EQ(RC::SUCCESS, chunk_program.eval(chunk, select));
+    ASSERT_EQ(expected_select, select);
+  }
+
+protected:
+  static constexpr int ROWS = 1000;
+
+  FieldMeta field_id_{"id", INTS, 0, 4, true};
+  FieldMeta field_f_{"f", FLOATS, 4, 4, true};
+  FieldMeta field_s_{"s", CHARS, 8, 8, true};
+
+  vector<vector<Value>> rows_;
+  vector<char>          records_;
+};
+
+TEST_F(ExprProgramTest, test_comparison)
+{
+  for (CompOp op : {EQUAL_TO, LESS_EQUAL, NOT_EQUAL, LESS_THAN, GREAT_EQUAL, GREAT_THAN}) {
+    check(*compare(op, field(0), value(Value(10))));
+    check(*compare(op, value(Value(2.5f)), field(1)));
+    check(*compare(op, field(0), field(1)));  // 整数与浮点数比较
+    check(*compare(op, field(1), field(0)));
+    check(*compare(op, field(2), value(Value("ab"))));
+    check(*compare(op, field(2), value(Value("abcdefgh"))));
+  }
+}
+
+TEST_F(ExprProgramTest, test_arithmetic)
+{
+  using Type = ArithmeticExpr::Type;
+  for (Type type : {Type::ADD, Type::SUB, Type::MUL, Type::DIV}) {
+    check(*arithmetic(type, field(0), value(Value(3))));
+    check(*arithmetic(type, field(1), field(0)));
+    check(*arithmetic(type, value(Value(7)), field(0)));  // 整数除0
+    check(*arithmetic(type, value(Value(1.5f)), field(1)));
+  }
+  check(*arithmetic(Type::NEGATIVE, field(0), nullptr));
+  check(*arithmetic(Type::NEGATIVE, field(1), nullptr));
+
+  // (id + 3) * 2 > f / 0.5
+  check(*compare(GREAT_THAN,
+      arithmetic(Type::MUL, arithmetic(Type::ADD, field(0), value(Value(3))), value(Value(2))),
+      arithmetic(Type::DIV, field(1), value(Value(0.5f)))));
+}
+
+TEST_F(ExprProgramTest, test_conjunction)
+{
+  using Type = ConjunctionExpr::Type;
+  for (Type type : {Type::AND, Type::OR}) {
+    check(*conjunction(type, list(compare(GREAT_THAN, field(0), value(Value(0))),
+                                 compare(LESS_THAN, field(2), value(Value("b"))),
+                                 compare(EQUAL_TO, field(0), field(1)))));
+
+    // 子表达式不是布尔类型时按照 Value::get_boolean 转换
+    check(*conjunction(type, list(field(0), compare(GREAT_EQUAL, field(1), value(Value(0))))));
+    check(*conjunction(type, list(field(1), make_unique<CastExpr>(field(0), BOOLEANS))));
+
+    check(*conjunction(type, vector<unique_ptr<Expression>>()));
+  }
+
+  // (id > 50 AND s <> 'zz') OR (f < -10 AND id <> 3)
+  check(*conjunction(Type::OR,
+      list(conjunction(Type::AND,
+               list(compare(GREAT_THAN, field(0), value(Value(50))), compare(NOT_EQUAL, field(2), value(Value("zz"))))),
+          conjunction(Type::AND,
+              list(compare(LESS_THAN, field(1), value(Value(-10))), compare(NOT_EQUAL, field(0), value(Value(3))))))));
+}
+
+TEST_F(ExprProgramTest, test_common_subexpression)
+{
+  using AType = ArithmeticExpr::Type;
+  using CType = ConjunctionExpr::Type;
+  auto id_plus = [this](int n) { return arithmetic(AType::ADD, field(0), value(Value(n))); };
+
+  // id + 1 只计算一次
+  auto same = conjunction(CType::AND,
+      list(compare(GREAT_THAN, id_plus(1), value(Value(0))), compare(LESS_THAN, id_plus(1), value(Value(50)))));
+  auto different = conjunction(CType::AND,
+      list(compare(GREAT_THAN, id_plus(1), value(Value(0))), compare(LESS_THAN, id_plus(2), value(Value(50)))));
+  check(*same);
+  ExprProgram same_program;
+  ExprProgram different_program;
+  ASSERT_EQ(RC::SUCCESS, same_program.compile(*same, ExprProgram::FieldSource::TUPLE));
+  ASSERT_EQ(RC::SUCCESS, different_program.compile(*different, ExprProgram::FieldSource::TUPLE));
+  ASSERT_EQ(different_program.instr_num() - 1, same_program.instr_num());
+
+  // OR短路时id + 1可能没有计算，后面的条件需要重新计算
+  check(*conjunction(CType::AND,
+      list(conjunction(CType::OR,
+               list(compare(GREAT_THAN, field(0), value(Value(0))), compare(GREAT_THAN, id_plus(1), value(Value(-50))))),
+          compare(LESS_THAN, id_plus(1), value(Value(30))))));
+}
+
+TEST_F(ExprProgramTest, test_unsupported)
+{
+  ExprProgram program;
+
+  // 字符串与数字比较的规则比较特殊，不编译
+  ASSERT_EQ(RC::UNIMPLENMENT, program.compile(*compare(EQUAL_TO, field(2), value(Value(1))), ExprProgram::FieldSource::TUPLE));
+  ASSERT_FALSE(program.compiled());
+
+  // 没有绑定位置的字段
+  FieldExpr unbound(nullptr, &field_id_);
+  ASSERT_EQ(RC::UNIMPLENMENT, program.compile(unbound, ExprProgram::FieldSource::TUPLE));
+  ASSERT_EQ(RC::UNIMPLENMENT, program.compile(unbound, ExprProgram::FieldSource::RECORD));
+  ASSERT_EQ(nullptr, ExprProgram::try_compile(unbound, ExprProgram::FieldSource::CHUNK));
+
+  // 常量表达式
+  auto constant = compare(LESS_THAN, value(Value(1)), value(Value(2.5f)));
+  ASSERT_EQ(RC::SUCCESS, program.compile(*constant, ExprProgram::FieldSource::TUPLE));
+  ASSERT_TRUE(program.compiled());
+  Value result;
+  ASSERT_EQ(RC::SUCCESS, program.eval(ValueListTuple(), result));
+  ASSERT_TRUE(result.get_boolean());
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
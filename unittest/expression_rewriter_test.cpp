@@ -0,0 +1,188 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+
+//
+// Created by agent on 2026/10/18
+//
+
+#include <memory>
+#include <vector>
+
+#include "sql/expr/expression.h"
+#include "sql/operator/predicate_logical_operator.h"
+#include "sql/optimizer/expression_rewriter.h"
+#include "sql/optimizer/predicate_rewrite.h"
+#include "gtest/gtest.h"
+
+using namespace std;
+
+static FieldMeta id_field("id", INTS, 0, 4, true);
+static FieldMeta f_field("f", FLOATS, 4, 4, true);
+
+static unique_ptr<Expression> field(const FieldMeta &meta) { return make_unique<FieldExpr>(nullptr, &meta); }
+
+static unique_ptr<Expression> value(const Value &v) { return make_unique<ValueExpr>(v); }
+
+static unique_ptr<Expression> compare(CompOp op, unique_ptr<Expression> left, unique_ptr<Expression> right)
+{
+  return make_unique<ComparisonExpr>(op, std::move(left), std::move(right));
+}
+
+static unique_ptr<Expression> make_conjunction(ConjunctionExpr::Type type, vector<unique_ptr<Expression>> children)
+{
+  return make_unique<ConjunctionExpr>(type, children);
+}
+
+template <typename... Args>
+static vector<unique_ptr<Expression>> list(Args... args)
+{
+  vector<unique_ptr<Expression>> exprs;
+  (exprs.push_back(std::move(args)), ...);
+  return exprs;
+}
+
+/**
+ * @brief 与OptimizeStage一样反复重写，直到没有变化，返回重写后的表达式
+ */
+static unique_ptr<Expression> rewrite(unique_ptr<Expression> expr)
+{
+  unique_ptr<LogicalOperator> oper(new PredicateLogicalOperator(std::move(expr)));
+  ExpressionRewriter rewriter;
+  bool change_made = false;
+  do {
+    change_made = false;
+    EXPECT_EQ(RC::SUCCESS, rewriter.rewrite(oper, change_made));
+  } while (change_made);
+  return std::move(oper->expressions().front());
+}
+
+static void expect_constant(const unique_ptr<Expression> &expr, bool expected)
+{
+  ASSERT_EQ(ExprType::VALUE, expr->type());
+  ASSERT_EQ(BOOLEANS, expr->value_type());
+  ASSERT_EQ(expected, static_cast<ValueExpr *>(expr.get())->get_value().get_boolean());
+}
+
+TEST(ExpressionRewriter, test_constant_folding)
+{
+  // 3 * (1 + 2) < id  =>  id > 9
+  auto arithmetic = make_unique<ArithmeticExpr>(ArithmeticExpr::Type::MUL,
+      value(Value(3)),
+      make_unique<ArithmeticExpr>(ArithmeticExpr::Type::ADD, value(Value(1)), value(Value(2))));
+  unique_ptr<Expression> expr = rewrite(compare(LESS_THAN, std::move(arithmetic), field(id_field)));
+  ASSERT_EQ(ExprType::COMPARISON, expr->type());
+  auto cmp_expr = static_cast<ComparisonExpr *>(expr.get());
+  ASSERT_EQ(GREAT_THAN, cmp_expr->comp());
+  ASSERT_EQ(ExprType::FIELD, cmp_expr->left()->type());
+  ASSERT_EQ(ExprType::VALUE, cmp_expr->right()->type());
+  ASSERT_EQ(9, static_cast<ValueExpr *>(cmp_expr->right().get())->get_value().get_int());
+
+  // 常量折叠后保留名字
+  auto named = make_unique<ArithmeticExpr>(ArithmeticExpr::Type::DIV, value(Value(7)), value(Value(2)));
+  named->set_name("7/2");
+  expr = rewrite(std::move(named));
+  ASSERT_EQ(ExprType::VALUE, expr->type());
+  ASSERT_EQ("7/2", expr->name());
+  ASSERT_FLOAT_EQ(3.5f, static_cast<ValueExpr *>(expr.get())->get_value().get_float());
+
+  // cast(1) as boolean
+  expr = rewrite(make_unique<CastExpr>(value(Value(1)), BOOLEANS));
+  expect_constant(expr, true);
+}
+
+TEST(ExpressionRewriter, test_tautology_and_contradiction)
+{
+  using Type = ConjunctionExpr::Type;
+  expect_constant(rewrite(compare(EQUAL_TO, field(id_field), field(id_field))), true);
+  expect_constant(rewrite(compare(LESS_THAN, field(f_field), field(f_field))), false);
+
+  // id > 5 AND id < 3
+  expect_constant(rewrite(make_conjunction(Type::AND,
+                      list(compare(GREAT_THAN, field(id_field), value(Value(5))),
+                          compare(LESS_THAN, field(id_field), value(Value(3)))))),
+      false);
+  // id = 2 AND 2 <> id
+  expect_constant(rewrite(make_conjunction(Type::AND,
+                      list(compare(EQUAL_TO, field(id_field), value(Value(2))),
+                          compare(NOT_EQUAL, value(Value(2)), field(id_field))))),
+      false);
+  // id >= 2 AND 3 > id AND (id <= 1 AND 1 = 1)
+  expect_constant(rewrite(make_conjunction(Type::AND,
+                      list(compare(GREAT_EQUAL, field(id_field), value(Value(2))),
+                          compare(GREAT_THAN, value(Value(3)), field(id_field)),
+                          make_conjunction(Type::AND,
+                              list(compare(LESS_EQUAL, field(id_field), value(Value(1))),
+                                  compare(EQUAL_TO, value(Value(1)), value(Value(1)))))))),
+      false);
+  // id >= 2 AND id <= 2 不矛盾
+  unique_ptr<Expression> expr = rewrite(make_conjunction(Type::AND,
+      list(compare(GREAT_EQUAL, field(id_field), value(Value(2))), compare(LESS_EQUAL, field(id_field), value(Value(2))))));
+  ASSERT_EQ(ExprType::CONJUNCTION, expr->type());
+
+  // 浮点数比较有误差范围，不判断是否矛盾
+  expr = rewrite(make_conjunction(Type::AND,
+      list(compare(GREAT_THAN, field(f_field), value(Value(1.0f))), compare(LESS_THAN, field(f_field), value(Value(0.9f))))));
+  ASSERT_EQ(ExprType::CONJUNCTION, expr->type());
+
+  // OR中的false都去掉之后是false
+  expect_constant(rewrite(make_conjunction(Type::OR,
+                      list(compare(EQUAL_TO, value(Value(1)), value(Value(2))),
+                          compare(NOT_EQUAL, field(id_field), field(id_field))))),
+      false);
+}
+
+TEST(ExpressionRewriter, test_duplicated_conditions)
+{
+  using Type = ConjunctionExpr::Type;
+  // id > 1 AND (1 < id AND f < 2.5) AND f < 2.5  =>  id > 1 AND f < 2.5
+  unique_ptr<Expression> expr = rewrite(make_conjunction(Type::AND,
+      list(compare(GREAT_THAN, field(id_field), value(Value(1))),
+          make_conjunction(Type::AND,
+              list(compare(LESS_THAN, value(Value(1)), field(id_field)),
+                  compare(LESS_THAN, field(f_field), value(Value(2.5f))))),
+          compare(LESS_THAN, field(f_field), value(Value(2.5f))))));
+  ASSERT_EQ(ExprType::CONJUNCTION, expr->type());
+  ASSERT_EQ(2, static_cast<int>(static_cast<ConjunctionExpr *>(expr.get())->children().size()));
+
+  // 浮点数常量按照二进制比较，1.0 与 1.0000001 不是重复的条件
+  expr = rewrite(make_conjunction(Type::AND,
+      list(compare(GREAT_THAN, field(f_field), value(Value(1.0f))),
+          compare(GREAT_THAN, field(f_field), value(Value(1.0000001f))))));
+  ASSERT_EQ(ExprType::CONJUNCTION, expr->type());
+}
+
+TEST(ExpressionRewriter, test_empty_plan)
+{
+  // 恒为false的predicate删除下面的算子，成为空的结果集
+  auto scan = make_unique<PredicateLogicalOperator>(value(Value(true)));
+  auto predicate = make_unique<PredicateLogicalOperator>(value(Value(false)));
+  predicate->add_child(std::move(scan));
+  unique_ptr<LogicalOperator> root(new PredicateLogicalOperator(value(Value(true))));
+  root->add_child(std::move(predicate));
+
+  PredicateRewriteRule rule;
+  bool change_made = false;
+  ASSERT_EQ(RC::SUCCESS, rule.rewrite(root, change_made));
+  ASSERT_TRUE(change_made);
+  ASSERT_EQ(1, static_cast<int>(root->children().size()));
+  ASSERT_TRUE(root->children().front()->children().empty());
+
+  // 已经是空的结果集，不再有变化
+  change_made = false;
+  ASSERT_EQ(RC::SUCCESS, rule.rewrite(root, change_made));
+  ASSERT_FALSE(change_made);
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
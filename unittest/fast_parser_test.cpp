@@ -0,0 +1,213 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+
+//
+// Created by agent on 2026/10/18
+//
+
+#include <string>
+#include <vector>
+
+#include "sql/parser/fast_parser.h"
+#include "sql/parser/parse.h"
+#include "gtest/gtest.h"
+
+using namespace std;
+
+static void expect_same_value(const Value &expected, const Value &actual)
+{
+  ASSERT_EQ(expected.attr_type(), actual.attr_type());
+  ASSERT_EQ(expected.to_string(), actual.to_string());
+}
+
+static void expect_same_attrs(const vector<RelAttrSqlNode> &expected, const vector<RelAttrSqlNode> &actual)
+{
+  ASSERT_EQ(expected.size(), actual.size());
+  for (size_t i = 0; i < expected.size(); i++) {
+    ASSERT_EQ(expected[i].relation_name, actual[i].relation_name);
+    ASSERT_EQ(expected[i].attribute_name, actual[i].attribute_name);
+    ASSERT_EQ(expected[i].aggregation, actual[i].aggregation);
+  }
+}
+
+static void expect_same_conditions(const vector<ConditionSqlNode> &expected, const vector<ConditionSqlNode> &actual)
+{
+  ASSERT_EQ(expected.size(), actual.size());
+  for (size_t i = 0; i < expected.size(); i++) {
+    ASSERT_EQ(expected[i].left_is_attr, actual[i].left_is_attr);
+    ASSERT_EQ(expected[i].right_is_attr, actual[i].right_is_attr);
+    ASSERT_EQ(expected[i].comp, actual[i].comp);
+    expect_same_attrs({expected[i].left_attr}, {actual[i].left_attr});
+    expect_same_value(expected[i].right_value, actual[i].right_value);
+  }
+}
+
+/**
+ * @brief 快速解析的结果与完整的语法解析完全相同
+ */
+static void expect_same_as_parser(const char *sql)
+{
+  SCOPED_TRACE(sql);
+  ParsedSqlResult expected_result;
+  parse(sql, &expected_result);
+  ParsedSqlResult actual_result;
+  ASSERT_TRUE(fast_parse(sql, &actual_result));
+
+  ASSERT_EQ(1UL, expected_result.sql_nodes().size());
+  ASSERT_EQ(1UL, actual_result.sql_nodes().size());
+  const ParsedSqlNode &expected = *expected_result.sql_nodes().front();
+  const ParsedSqlNode &actual   = *actual_result.sql_nodes().front();
+  ASSERT_EQ(expected.flag, actual.flag);
+  switch (expected.flag) {
+    case SCF_SELECT: {
+      expect_same_attrs(expected.selection.attributes, actual.selection.attributes);
+      ASSERT_EQ(expected.selection.relations, actual.selection.relations);
+      expect_same_conditions(expected.selection.conditions, actual.selection.conditions);
+    } break;
+    case SCF_INSERT: {
+      ASSERT_EQ(expected.insertion.relation_name, actual.insertion.relation_name);
+      ASSERT_EQ(expected.insertion.values.size(), actual.insertion.values.size());
+      for (size_t i = 0; i < expected.insertion.values.size(); i++) {
+        expect_same_value(expected.insertion.values[i], actual.insertion.values[i]);
+      }
+    } break;
+    case SCF_DELETE: {
+      ASSERT_EQ(expected.deletion.relation_name, actual.deletion.relation_name);
+      expect_same_conditions(expected.deletion.conditions, actual.deletion.conditions);
+    } break;
+    default: {
+      FAIL() << "unexpected sql flag " << expected.flag;
+    }
+  }
+}
+
+TEST(FastParser, test_same_as_parser)
+{
+  const char *sqls[] = {
+      "select * from t",
+      "SELECT * FROM t;",
+      "select id, t.name, age from t where id = 1",
+      "select id from t where id=-1 and name <> 'a b' and score >= 1.5 and t.x != \"\";",
+      "select id from t where a < 1 and b <= 2 and c > 3 and d >= 4 and e = 5 and f <> 6",
+      "  select\tid\nfrom t_1 where id = 10 ;  ",
+      "select t . id from t where t . id = 2",
+      "insert into t values(1, 'abc', 2.5, -3)",
+      "INSERT INTO t VALUES ('')",
+      "delete from t",
+      "delete from t where id = 100 and name = 'x';",
+      "select status, Limit from t where offset = 1",
+      "delete from analyze where using = 2",
+  };
+  for (const char *sql : sqls) {
+    expect_same_as_parser(sql);
+  }
+}
+
+TEST(FastParser, test_fallback)
+{
+  const char *sqls[] = {
+      "select count(*) from t",
+      "select * from t, u",
+      "select * from t where id = ?",
+      "select * from t where id = 1 order by id",
+      "select * from t where id = 1 limit 1",
+      "select * from t where 1 = id",
+      "select * from t where a = b",
+      "select * from t where id = 1abc",
+      "select * from t where id = 1.",
+      "select * from t where id = - 1",
+      "select * from t where id = 1 and",
+      "select * from t where",
+      "select * from data",
+      "select * from t where name = 'abc",
+      "select * from t\r",
+      "select * from t; select * from t",
+      "insert into t values(1), (2)",
+      "delete from t where id = 1 or id = 2",
+      "update t set id = 1",
+      "explain select * from t",
+  };
+  for (const char *sql : sqls) {
+    ParsedSqlResult result;
+    ASSERT_FALSE(fast_parse(sql, &result)) << sql;
+    ASSERT_TRUE(result.sql_nodes().empty());
+  }
+}
+
+/**
+ * @brief 只用一个语句的结果
+ */
+static const ParsedSqlNode *parse_one(const char *sql, ParsedSqlResult &result)
+{
+  EXPECT_EQ(RC::SUCCESS, parse(sql, &result)) << sql;
+  EXPECT_EQ(1UL, result.sql_nodes().size()) << sql;
+  return result.sql_nodes().empty() ? nullptr : result.sql_nodes().front().get();
+}
+
+TEST(Parser, test_non_reserved_keywords)
+{
+  const char *keywords[] = {
+      "status", "group", "by", "order", "asc", "limit", "offset", "analyze", "prepare", "execute", "deallocate",
+      "using"};
+  for (const char *keyword : keywords) {
+    SCOPED_TRACE(keyword);
+    const string word(keyword);
+
+    ParsedSqlResult create_result;
+    const ParsedSqlNode *create =
+        parse_one(("create table " + word + "(" + word + " int, id int);").c_str(), create_result);
+    ASSERT_NE(nullptr, create);
+    ASSERT_EQ(SCF_CREATE_TABLE, create->flag);
+    ASSERT_EQ(word, create->create_table.relation_name);
+    ASSERT_EQ(word, create->create_table.attr_infos.front().name);
+
+    ParsedSqlResult select_result;
+    const ParsedSqlNode *select = parse_one(
+        ("select " + word + "." + word + " from " + word + " where " + word + " = 1 group by " + word + " order by " +
+            word + " asc limit 1 offset 2;").c_str(),
+        select_result);
+    ASSERT_NE(nullptr, select);
+    ASSERT_EQ(SCF_SELECT, select->flag);
+    ASSERT_EQ(word, select->selection.attributes.front().relation_name);
+    ASSERT_EQ(word, select->selection.attributes.front().attribute_name);
+    ASSERT_EQ(vector<string>({word}), select->selection.relations);
+    ASSERT_EQ(word, select->selection.conditions.front().left_attr.attribute_name);
+    ASSERT_EQ(word, select->selection.group_by.front().attribute_name);
+    ASSERT_EQ(word, select->selection.order_by.front().attr.attribute_name);
+    ASSERT_EQ(1, select->selection.limit.limit);
+    ASSERT_EQ(2, select->selection.limit.offset);
+
+    ParsedSqlResult execute_result;
+    const ParsedSqlNode *execute = parse_one(("execute " + word + " using 1;").c_str(), execute_result);
+    ASSERT_NE(nullptr, execute);
+    ASSERT_EQ(SCF_EXECUTE, execute->flag);
+    ASSERT_EQ(word, execute->execute.name);
+  }
+
+  // 标识符保留原来的大小写
+  ParsedSqlResult result;
+  const ParsedSqlNode *node = parse_one("select Status\nfrom T where ORDER = 1", result);
+  ASSERT_NE(nullptr, node);
+  ASSERT_EQ("Status", node->selection.attributes.front().attribute_name);
+  ASSERT_EQ("ORDER", node->selection.conditions.front().left_attr.attribute_name);
+
+  // 作为关键字使用时不受影响
+  ParsedSqlResult show_result;
+  node = parse_one("show status;", show_result);
+  ASSERT_NE(nullptr, node);
+  ASSERT_EQ(SCF_SHOW_STATUS, node->flag);
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
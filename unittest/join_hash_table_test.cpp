@@ -0,0 +1,198 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18
+//
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "sql/operator/join_hash_table.h"
+#include "sql/operator/runtime_filter.h"
+#include "storage/field/field_meta.h"
+#include "gtest/gtest.h"
+
+using namespace std;
+
+TEST(JoinHashTable, test_duplicate_keys)
+{
+  JoinHashTable table;
+  table.init(1, 2);
+
+  // key = i % 100，每个key有10行，按照追加顺序链接
+  const int rows = 1000;
+  for (int i = 0; i < rows; i++) {
+    table.append_row({Value(i % 100)}, {Value(i), Value(to_string(i).c_str())});
+  }
+  table.build();
+  ASSERT_EQ(rows, table.rows());
+
+  for (int key = 0; key < 100; key++) {
+    vector<int> matched;
+    for (int row = table.find({Value(key)}); row >= 0; row = table.next_match(row)) {
+      matched.push_back(table.row_cells(row)[0].get_int());
+    }
+
+    ASSERT_EQ(10, static_cast<int>(matched.size())) << "key " << key;
+    for (int i = 0; i < 10; i++) {
+      EXPECT_EQ(key + i * 100, matched[i]);
+    }
+  }
+
+  EXPECT_EQ(-1, table.find({Value(100)}));
+  EXPECT_EQ(-1, table.find({Value(-1)}));
+}
+
+TEST(JoinHashTable, test_multiple_keys)
+{
+  JoinHashTable table;
+  table.init(2, 1);
+
+  map<pair<int, string>, int> expected;
+  for (int i = 0; i < 300; i++) {
+    const int    a = i % 7;
+    const string b = "s" + to_string(i % 11);
+    table.append_row({Value(a), Value(b.c_str())}, {Value(i)});
+    expected[{a, b}]++;
+  }
+  table.build();
+
+  for (int a = 0; a < 7; a++) {
+    for (int b = 0; b < 11; b++) {
+      const string s = "s" + to_string(b);
+      int count = 0;
+      for (int row = table.find({Value(a), Value(s.c_str())}); row >= 0; row = table.next_match(row)) {
+        ASSERT_EQ(a, table.row_cells(row)[0].get_int() % 7);
+        count++;
+      }
+      EXPECT_EQ((expected[{a, s}]), count);
+    }
+  }
+
+  EXPECT_EQ(-1, table.find({Value(1), Value("s12")}));
+}
+
+TEST(JoinHashTable, test_empty)
+{
+  JoinHashTable table;
+  EXPECT_EQ(-1, table.find({Value(1)}));
+
+  table.init(1, 1);
+  table.build();
+  EXPECT_EQ(0, table.rows());
+  EXPECT_EQ(-1, table.find({Value(1)}));
+
+  table.append_row({Value("a")}, {Value(1)});
+  table.append_row({Value("b")}, {Value(2)});
+  table.build();
+  ASSERT_GE(table.find({Value("b")}), 0);
+  EXPECT_EQ(2, table.row_cells(table.find({Value("b")}))[0].get_int());
+
+  table.clear();
+  EXPECT_EQ(0, table.rows());
+  EXPECT_EQ(-1, table.find({Value("a")}));
+}
+
+TEST(RuntimeFilter, test_bloom_filter)
+{
+  // 两个key，包含字符串，build端使用 [0, 2000) 中的偶数
+  RuntimeFilter filter;
+  auto keys_of = [](int i) { return vector<Value>{Value(i), Value(("s" + to_string(i)).c_str())}; };
+
+  ASSERT_TRUE(filter.may_contain(keys_of(1).data(), 2));  // 没有生成时不过滤
+  filter.reset();
+  for (int i = 0; i < 2000; i += 2) {
+    vector<Value> keys = keys_of(i);
+    filter.add(keys.data(), 2, JoinHashTable::hash_keys(keys.data(), 2));
+  }
+  filter.build();
+  ASSERT_TRUE(filter.ready());
+
+  int false_positives = 0;
+  for (int i = 0; i < 2000; i++) {
+    vector<Value> keys = keys_of(i);
+    if (i % 2 == 0) {
+      ASSERT_TRUE(filter.may_contain(keys.data(), 2));
+    } else if (filter.may_contain(keys.data(), 2)) {
+      false_positives++;
+    }
+  }
+  ASSERT_LT(false_positives, 50);
+}
+
+TEST(RuntimeFilter, test_range_and_empty)
+{
+  RuntimeFilter filter;
+  filter.reset();
+  filter.build();
+  Value key(1);
+  ASSERT_FALSE(filter.may_contain(&key, 1));  // build端没有数据时所有的行都不能匹配
+
+  // 一个整数key时，先用最小值和最大值过滤
+  filter.reset();
+  for (int i = 100; i <= 200; i++) {
+    Value build_key(i);
+    filter.add(&build_key, 1, JoinHashTable::hash_keys(&build_key, 1));
+  }
+  filter.build();
+  for (int i : {100, 150, 200}) {
+    Value probe_key(i);
+    ASSERT_TRUE(filter.may_contain(&probe_key, 1));
+  }
+  for (int i : {-1, 99, 201, 100000}) {
+    Value probe_key(i);
+    ASSERT_FALSE(filter.may_contain(&probe_key, 1));
+  }
+}
+
+TEST(RuntimeFilter, test_scan_filters)
+{
+  // 记录格式：k(int) v(int)，过滤条件在k上
+  FieldMeta field_k("k", INTS, 0, 4, true);
+  auto      filter = make_shared<RuntimeFilter>();
+  filter->reset();
+  for (int i = 0; i < 10; i++) {
+    Value key(i);
+    filter->add(&key, 1, JoinHashTable::hash_keys(&key, 1));
+  }
+
+  ScanRuntimeFilters scan_filters;
+  scan_filters.add(filter, {&field_k});
+  auto check = [&scan_filters](int k) {
+    int record[2] = {k, 0};
+    return scan_filters.check(reinterpret_cast<const char *>(record));
+  };
+
+  // build还没有完成时不过滤
+  ASSERT_TRUE(check(100));
+  filter->build();
+  scan_filters.reset();
+  ASSERT_TRUE(check(5));
+  ASSERT_FALSE(check(100));
+
+  // 大部分行都能通过时，不再检查
+  scan_filters.reset();
+  for (int i = 0; i < ScanRuntimeFilters::SAMPLE_ROWS; i++) {
+    check(i % 10);
+  }
+  ASSERT_TRUE(check(100));
+
+  // 重新打开扫描时重新统计
+  scan_filters.reset();
+  ASSERT_FALSE(check(100));
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
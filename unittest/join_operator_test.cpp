@@ -0,0 +1,427 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18
+//
+
+#include <stdlib.h>
+#include <algorithm>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/global_context.h"
+#include "sql/operator/hash_join_physical_operator.h"
+#include "sql/operator/index_nested_loop_join_physical_operator.h"
+#include "sql/operator/merge_join_physical_operator.h"
+#include "sql/operator/join_physical_operator.h"
+#include "storage/buffer/disk_buffer_pool.h"
+#include "storage/common/temp_file.h"
+#include "storage/table/table.h"
+#include "storage/trx/vacuous_trx.h"
+#include "gtest/gtest.h"
+#include "unittest_util.h"
+
+using namespace std;
+
+class JoinOperatorTest : public testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    // 每个用例使用单独的临时目录，结束后删除
+    test_dir_ = create_temp_dir("join_operator_test");
+    ASSERT_FALSE(test_dir_.empty());
+    ASSERT_EQ(RC::SUCCESS, temp_file_manager_.init(test_dir_.c_str()));
+    GCTX.temp_file_manager_ = &temp_file_manager_;
+  }
+
+  void TearDown() override
+  {
+    GCTX.temp_file_manager_ = nullptr;
+    filesystem::remove_all(test_dir_);
+  }
+
+  /**
+   * @brief 执行 left.a = right.c 的连接，返回排好序的结果
+   */
+  vector<string> join(const vector<vector<Value>> &left_rows, const vector<vector<Value>> &right_rows,
+      int64_t memory_limit, bool build_left, bool &spilled)
+  {
+    vector<unique_ptr<Expression>> left_keys;
+    vector<unique_ptr<Expression>> right_keys;
+    left_keys.emplace_back(new FieldExpr(&table_, &field_a_));
+    right_keys.emplace_back(new FieldExpr(&table_, &field_c_));
+
+    HashJoinPhysicalOperator join_oper(std::move(left_keys), std::move(right_keys), build_left);
+    join_oper.set_memory_limit(memory_limit);
+    join_oper.add_child(unique_ptr<PhysicalOperator>(new ValuesPhysicalOperator(
+        {TupleCellSpec("", "a"), TupleCellSpec("", "b")}, left_rows)));
+    join_oper.add_child(unique_ptr<PhysicalOperator>(new ValuesPhysicalOperator(
+        {TupleCellSpec("", "c"), TupleCellSpec("", "d")}, right_rows)));
+
+    vector<string> results;
+    EXPECT_EQ(RC::SUCCESS, join_oper.open(nullptr));
+    RC rc = RC::SUCCESS;
+    while (OB_SUCC(rc = join_oper.next())) {
+      Tuple *tuple = join_oper.current_tuple();
+      string result;
+      for (int i = 0; i < tuple->cell_num(); i++) {
+        Value cell;
+        EXPECT_EQ(RC::SUCCESS, tuple->cell_at(i, cell));
+        result += cell.to_string() + "|";
+      }
+      results.push_back(result);
+    }
+    EXPECT_EQ(RC::RECORD_EOF, rc);
+    spilled = join_oper.spilled();
+    EXPECT_EQ(RC::SUCCESS, join_oper.close());
+
+    sort(results.begin(), results.end());
+    return results;
+  }
+
+protected:
+  string          test_dir_;
+  TempFileManager temp_file_manager_;
+  Table           table_;
+  FieldMeta       field_a_{"a", INTS, 0, 4, true};
+  FieldMeta       field_c_{"c", INTS, 0, 4, true};
+};
+
+TEST_F(JoinOperatorTest, test_spill)
+{
+  vector<vector<Value>> left_rows;
+  vector<vector<Value>> right_rows;
+  for (int i = 0; i < 3000; i++) {
+    left_rows.push_back({Value(i % 1000), Value(("left" + to_string(i)).c_str())});
+  }
+  for (int i = 0; i < 2000; i++) {
+    right_rows.push_back({Value(i % 1500), Value(("right" + to_string(i)).c_str())});
+  }
+
+  for (bool build_left : {true, false}) {
+    bool spilled = false;
+    vector<string> expected = join(left_rows, right_rows, INT64_MAX, build_left, spilled);
+    ASSERT_FALSE(spilled);
+    // 左表key为0~999，每个key有3行；右表key在0~999之间的共有1500行
+    ASSERT_EQ(4500, static_cast<int>(expected.size()));
+
+    vector<string> results = join(left_rows, right_rows, 4096, build_left, spilled);
+    ASSERT_TRUE(spilled);
+    ASSERT_EQ(expected, results);
+  }
+
+  // 临时文件全部删除
+  ASSERT_EQ(0, temp_file_manager_.file_count());
+  ASSERT_GT(temp_file_manager_.written_bytes(), 0);
+}
+
+TEST_F(JoinOperatorTest, test_spill_skewed_keys)
+{
+  // 所有行的key都相同，无法通过再次分区减少数据量
+  vector<vector<Value>> left_rows;
+  vector<vector<Value>> right_rows;
+  for (int i = 0; i < 500; i++) {
+    left_rows.push_back({Value(1), Value(i)});
+  }
+  for (int i = 0; i < 20; i++) {
+    right_rows.push_back({Value(i % 2), Value(i)});
+  }
+
+  bool spilled = false;
+  vector<string> expected = join(left_rows, right_rows, INT64_MAX, true, spilled);
+  ASSERT_EQ(500 * 10, static_cast<int>(expected.size()));
+
+  vector<string> results = join(left_rows, right_rows, 1024, true, spilled);
+  ASSERT_TRUE(spilled);
+  ASSERT_EQ(expected, results);
+  ASSERT_EQ(0, temp_file_manager_.file_count());
+}
+
+TEST_F(JoinOperatorTest, test_merge_join)
+{
+  // 两侧都按照key有序，key有重复，也有只在一侧出现的
+  vector<vector<Value>> left_rows;
+  vector<vector<Value>> right_rows;
+  for (int i = 0; i < 300; i++) {
+    left_rows.push_back({Value(i / 3), Value(i)});
+  }
+  for (int i = 0; i < 400; i++) {
+    right_rows.push_back({Value(i / 2 + 50), Value(i)});
+  }
+
+  bool spilled = false;
+  vector<string> expected = join(left_rows, right_rows, INT64_MAX, true, spilled);
+  // key 50~99 在两侧都有，左侧3行，右侧2行
+  ASSERT_EQ(50 * 3 * 2, static_cast<int>(expected.size()));
+
+  MergeJoinPhysicalOperator join_oper(
+      unique_ptr<Expression>(new FieldExpr(&table_, &field_a_)), unique_ptr<Expression>(new FieldExpr(&table_, &field_c_)));
+  join_oper.add_child(unique_ptr<PhysicalOperator>(new ValuesPhysicalOperator(
+      {TupleCellSpec("", "a"), TupleCellSpec("", "b")}, left_rows)));
+  join_oper.add_child(unique_ptr<PhysicalOperator>(new ValuesPhysicalOperator(
+      {TupleCellSpec("", "c"), TupleCellSpec("", "d")}, right_rows)));
+
+  // 可以重复执行
+  for (int round = 0; round < 2; round++) {
+    vector<string> results;
+    ASSERT_EQ(RC::SUCCESS, join_oper.open(nullptr));
+    RC rc = RC::SUCCESS;
+    int last_key = -1;
+    while (OB_SUCC(rc = join_oper.next())) {
+      Tuple *tuple = join_oper.current_tuple();
+      string result;
+      for (int i = 0; i < tuple->cell_num(); i++) {
+        Value cell;
+        ASSERT_EQ(RC::SUCCESS, tuple->cell_at(i, cell));
+        result += cell.to_string() + "|";
+        if (i == 0) {
+          // 输出保持左侧的顺序
+          ASSERT_LE(last_key, cell.get_int());
+          last_key = cell.get_int();
+        }
+      }
+      results.push_back(result);
+    }
+    ASSERT_EQ(RC::RECORD_EOF, rc);
+    ASSERT_EQ(RC::SUCCESS, join_oper.close());
+
+    sort(results.begin(), results.end());
+    ASSERT_EQ(expected, results);
+  }
+}
+
+TEST_F(JoinOperatorTest, test_nested_loop_join)
+{
+  vector<vector<Value>> left_rows;
+  vector<vector<Value>> right_rows;
+  for (int i = 0; i < 200; i++) {
+    left_rows.push_back({Value(i), Value(("left" + to_string(i)).c_str())});
+  }
+  for (int i = 0; i < 150; i++) {
+    right_rows.push_back({Value(i), Value(("right" + to_string(i)).c_str())});
+  }
+
+  auto run = [&](int64_t memory_limit, bool &spilled) {
+    NestedLoopJoinPhysicalOperator join_oper;
+    join_oper.set_memory_limit(memory_limit);
+    join_oper.add_child(unique_ptr<PhysicalOperator>(new ValuesPhysicalOperator(
+        {TupleCellSpec("", "a"), TupleCellSpec("", "b")}, left_rows)));
+    join_oper.add_child(unique_ptr<PhysicalOperator>(new ValuesPhysicalOperator(
+        {TupleCellSpec("", "c"), TupleCellSpec("", "d")}, right_rows)));
+
+    vector<string> results;
+    EXPECT_EQ(RC::SUCCESS, join_oper.open(nullptr));
+    spilled = temp_file_manager_.file_count() > 0;
+    RC rc = RC::SUCCESS;
+    while (OB_SUCC(rc = join_oper.next())) {
+      Tuple *tuple = join_oper.current_tuple();
+      string result;
+      for (int i = 0; i < tuple->cell_num(); i++) {
+        Value cell;
+        EXPECT_EQ(RC::SUCCESS, tuple->cell_at(i, cell));
+        result += cell.to_string() + "|";
+      }
+      results.push_back(result);
+    }
+    EXPECT_EQ(RC::RECORD_EOF, rc);
+    EXPECT_EQ(RC::SUCCESS, join_oper.close());
+    sort(results.begin(), results.end());
+    return results;
+  };
+
+  bool spilled = false;
+  vector<string> expected = run(INT64_MAX, spilled);
+  ASSERT_FALSE(spilled);
+  ASSERT_EQ(200 * 150, static_cast<int>(expected.size()));
+
+  // 内表写到临时文件，左表分成多批
+  vector<string> results = run(2048, spilled);
+  ASSERT_TRUE(spilled);
+  ASSERT_EQ(expected, results);
+  ASSERT_EQ(0, temp_file_manager_.file_count());
+}
+
+/**
+ * @brief 内表是磁盘上的表 inner_t(id int, name char(8))，id上有索引，
+ * 第i行的id是i / 2，name是 "n" + i，每个id对应两行
+ */
+class IndexNestedLoopJoinTest : public testing::Test
+{
+protected:
+  static constexpr int INNER_ROWS = 200;
+
+  static void SetUpTestSuite()
+  {
+    if (TrxKit::instance() == nullptr) {
+      ASSERT_EQ(RC::SUCCESS, TrxKit::init_global("vacuous"));
+    }
+  }
+
+  void SetUp() override
+  {
+    test_dir_ = create_temp_dir("index_join_test");
+    ASSERT_FALSE(test_dir_.empty());
+    BufferPoolManager::set_instance(&buffer_pool_manager_);
+
+    vector<AttrInfoSqlNode> attrs = {{INTS, "id", 4}, {CHARS, "name", 8}};
+    const string meta_file = test_dir_ + "/inner_t.table";
+    table_ = make_unique<Table>();
+    const int attr_num = static_cast<int>(attrs.size());
+    ASSERT_EQ(RC::SUCCESS,
+        table_->create(1, meta_file.c_str(), "inner_t", test_dir_.c_str(), attr_num, attrs.data()));
+    for (int i = 0; i < INNER_ROWS; i++) {
+      vector<Value> values = {Value(i / 2), Value(("n" + to_string(i)).c_str())};
+      Record record;
+      ASSERT_EQ(RC::SUCCESS, table_->make_record(static_cast<int>(values.size()), values.data(), record));
+      ASSERT_EQ(RC::SUCCESS, table_->insert_record(record));
+    }
+    ASSERT_EQ(RC::SUCCESS, table_->create_index(&trx_, table_->table_meta().field("id"), "inner_id"));
+    index_ = table_->find_index_by_field("id");
+    ASSERT_NE(nullptr, index_);
+  }
+
+  void TearDown() override
+  {
+    table_.reset();
+    BufferPoolManager::set_instance(nullptr);
+    filesystem::remove_all(test_dir_);
+  }
+
+  /**
+   * @brief 外表的每一行是 (a, b)，执行 outer.a = inner_t.id 的连接，返回排好序的结果
+   */
+  vector<string> join(const vector<vector<Value>> &outer_rows, bool inner_left,
+      vector<unique_ptr<Expression>> inner_predicates = {})
+  {
+    IndexNestedLoopJoinPhysicalOperator join_oper(table_.get(), index_, true /*readonly*/,
+        make_unique<FieldExpr>(&outer_table_, &field_a_), inner_left);
+    join_oper.set_inner_fields({Field(table_.get(), table_->table_meta().field("id")),
+        Field(table_.get(), table_->table_meta().field("name"))});
+    join_oper.set_inner_predicates(std::move(inner_predicates));
+    join_oper.add_child(make_unique<ValuesPhysicalOperator>(
+        vector<TupleCellSpec>{TupleCellSpec("", "a"), TupleCellSpec("", "b")}, outer_rows));
+
+    // 同一个算子打开两次，第二次复用同一个索引扫描器的结果也相同
+    vector<string> results;
+    for (int round = 0; round < 2; round++) {
+      vector<string> round_results;
+      EXPECT_EQ(RC::SUCCESS, join_oper.open(&trx_));
+      RC rc = RC::SUCCESS;
+      while (OB_SUCC(rc = join_oper.next())) {
+        Tuple *tuple = join_oper.current_tuple();
+        string result;
+        for (int i = 0; i < tuple->cell_num(); i++) {
+          Value cell;
+          EXPECT_EQ(RC::SUCCESS, tuple->cell_at(i, cell));
+          result += cell.to_string() + "|";
+        }
+        round_results.push_back(result);
+      }
+      EXPECT_EQ(RC::RECORD_EOF, rc);
+      EXPECT_EQ(RC::SUCCESS, join_oper.close());
+      sort(round_results.begin(), round_results.end());
+      if (round > 0) {
+        EXPECT_EQ(results, round_results);
+      }
+      results.swap(round_results);
+    }
+    return results;
+  }
+
+  /**
+   * @brief 按照内表的数据计算期望的结果
+   * @param accept 内表的第i行是否满足内表上的过滤条件
+   */
+  static vector<string> expected_results(
+      const vector<vector<Value>> &outer_rows, bool inner_left, function<bool(int)> accept = nullptr)
+  {
+    vector<string> results;
+    for (const vector<Value> &outer_row : outer_rows) {
+      const string outer = outer_row[0].to_string() + "|" + outer_row[1].to_string() + "|";
+      for (int i = 0; i < INNER_ROWS; i++) {
+        if (i / 2 != outer_row[0].get_int() || (accept && !accept(i))) {
+          continue;
+        }
+        const string inner = to_string(i / 2) + "|n" + to_string(i) + "|";
+        results.push_back(inner_left ? inner + outer : outer + inner);
+      }
+    }
+    sort(results.begin(), results.end());
+    return results;
+  }
+
+protected:
+  string            test_dir_;
+  BufferPoolManager buffer_pool_manager_;
+  VacuousTrx        trx_;
+  unique_ptr<Table> table_;
+  Index            *index_ = nullptr;
+  Table             outer_table_;
+  FieldMeta         field_a_{"a", INTS, 0, 4, true};
+};
+
+TEST_F(IndexNestedLoopJoinTest, test_reopen_scanner)
+{
+  // 外表的很多行复用同一个索引扫描器，包括在内表中没有匹配的key，以及重复的key
+  vector<vector<Value>> outer_rows;
+  for (int i = 0; i < 300; i++) {
+    const int key = i % 130 - 10;
+    outer_rows.push_back({Value(key), Value(("o" + to_string(i)).c_str())});
+  }
+  outer_rows.push_back({Value(1000), Value("last")});
+
+  for (bool inner_left : {false, true}) {
+    vector<string> expected = expected_results(outer_rows, inner_left);
+    ASSERT_FALSE(expected.empty());
+    ASSERT_EQ(expected, join(outer_rows, inner_left));
+  }
+
+  // 所有的key都没有匹配
+  ASSERT_TRUE(join({{Value(-1), Value("x")}, {Value(INNER_ROWS), Value("y")}}, false).empty());
+  ASSERT_TRUE(join({}, false).empty());
+}
+
+TEST_F(IndexNestedLoopJoinTest, test_inner_predicates)
+{
+  vector<vector<Value>> outer_rows;
+  for (int i = 0; i < 50; i++) {
+    outer_rows.push_back({Value(i * 3), Value(("o" + to_string(i)).c_str())});
+  }
+
+  // 内表上的过滤条件在索引查找到数据之后执行，同一个key的两行可能只保留一行
+  auto predicates = [this]() {
+    vector<unique_ptr<Expression>> exprs;
+    exprs.emplace_back(new ComparisonExpr(NOT_EQUAL,
+        make_unique<FieldExpr>(table_.get(), table_->table_meta().field("name")),
+        make_unique<ValueExpr>(Value("n6"))));
+    exprs.emplace_back(new ComparisonExpr(LESS_THAN,
+        make_unique<FieldExpr>(table_.get(), table_->table_meta().field("id")),
+        make_unique<ValueExpr>(Value(60))));
+    return exprs;
+  };
+  auto accept = [](int i) { return i != 6 && i / 2 < 60; };
+
+  for (bool inner_left : {false, true}) {
+    vector<string> expected = expected_results(outer_rows, inner_left, accept);
+    ASSERT_EQ(expected, join(outer_rows, inner_left, predicates()));
+    ASSERT_LT(expected.size(), expected_results(outer_rows, inner_left).size());
+  }
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
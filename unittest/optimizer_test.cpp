@@ -0,0 +1,868 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18
+//
+
+#include <stdlib.h>
+#include <algorithm>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "common/global_context.h"
+#include "event/session_event.h"
+#include "event/sql_event.h"
+#include "net/communicator.h"
+#include "session/session.h"
+#include "sql/executor/execute_stage.h"
+#include "sql/expr/expression.h"
+#include "sql/operator/join_logical_operator.h"
+#include "sql/operator/table_get_logical_operator.h"
+#include "sql/operator/table_scan_physical_operator.h"
+#include "sql/operator/exchange_worker_pool.h"
+#include "sql/optimizer/cardinality_estimator.h"
+#include "sql/optimizer/join_order_optimizer.h"
+#include "sql/optimizer/optimize_stage.h"
+#include "sql/optimizer/predicate_pushdown_rewriter.h"
+#include "sql/parser/parse_stage.h"
+#include "sql/parser/resolve_stage.h"
+#include "sql/plan_cache/plan_cache_stage.h"
+#include "storage/buffer/disk_buffer_pool.h"
+#include "storage/buffer/page.h"
+#include "storage/common/temp_file.h"
+#include "storage/default/default_handler.h"
+#include "storage/table/table.h"
+#include "storage/table/table_stats.h"
+#include "storage/trx/trx.h"
+#include "gtest/gtest.h"
+#include "unittest_util.h"
+
+using namespace std;
+
+/**
+ * @brief 不与客户端通讯，结果由测试直接从SqlResult中读取
+ */
+class TestCommunicator : public Communicator
+{
+public:
+  explicit TestCommunicator(Session *session) { session_ = session; }
+
+  RC read_event(SessionEvent *&) override { return RC::UNIMPLENMENT; }
+  RC write_result(SessionEvent *, bool &) override { return RC::UNIMPLENMENT; }
+};
+
+/**
+ * @brief 在进程内执行SQL，检查生成的执行计划和执行结果
+ * @details 每个用例在单独的进程中运行(见 gtest_discover_tests)，使用单独的数据目录
+ */
+class OptimizerTest : public testing::Test
+{
+protected:
+  static void SetUpTestSuite()
+  {
+    test_dir_ = create_temp_dir("optimizer_test");
+    ASSERT_FALSE(test_dir_.empty());
+
+    GCTX.buffer_pool_manager_ = new BufferPoolManager();
+    BufferPoolManager::set_instance(GCTX.buffer_pool_manager_);
+    ASSERT_EQ(RC::SUCCESS, TrxKit::init_global("vacuous"));
+    GCTX.trx_kit_ = TrxKit::instance();
+    GCTX.handler_ = new DefaultHandler();
+    DefaultHandler::set_default(GCTX.handler_);
+    ASSERT_EQ(RC::SUCCESS, GCTX.handler_->init(test_dir_.c_str()));
+    GCTX.temp_file_manager_ = new TempFileManager();
+    ASSERT_EQ(RC::SUCCESS, GCTX.temp_file_manager_->init((test_dir_ + "/tmp").c_str()));
+    GCTX.exchange_worker_pool_ = new ExchangeWorkerPool();
+    ASSERT_EQ(RC::SUCCESS, GCTX.exchange_worker_pool_->init(8));
+  }
+
+  static void TearDownTestSuite()
+  {
+    delete GCTX.exchange_worker_pool_;
+    GCTX.exchange_worker_pool_ = nullptr;
+    delete GCTX.temp_file_manager_;
+    GCTX.temp_file_manager_ = nullptr;
+    DefaultHandler::set_default(nullptr);
+    delete GCTX.handler_;
+    GCTX.handler_ = nullptr;
+    BufferPoolManager::set_instance(nullptr);
+    delete GCTX.buffer_pool_manager_;
+    GCTX.buffer_pool_manager_ = nullptr;
+    filesystem::remove_all(test_dir_);
+  }
+
+  Session *session() { return communicator_.session(); }
+  Db      *db() { return session()->get_current_db(); }
+
+  /**
+   * @brief 执行一条SQL，返回的每一行按照 " | " 连接
+   * @details 打开结果之后先调用 on_open，用来在执行过程中修改数据
+   */
+  RC execute(const string &sql, vector<string> *rows = nullptr, function<void()> on_open = nullptr)
+  {
+    SessionEvent  session_event(&communicator_);
+    SQLStageEvent sql_event(&session_event, sql);
+    session_event.set_query(sql);
+
+    common::MemoryTracker *last_tracker = common::MemoryTracker::current();
+    common::QueryArena    *last_arena   = common::QueryArena::current();
+    sql_event.memory_tracker().set_limit(session()->query_memory_limit());
+    common::MemoryTracker::set_current(&sql_event.memory_tracker());
+    common::QueryArena::set_current(&sql_event.query_arena());
+    Session::set_current_session(session());
+    session()->set_current_request(&session_event);
+
+    SqlResult *sql_result = session_event.sql_result();
+    RC rc = parse_stage_.handle_request(&sql_event);
+    if (OB_SUCC(rc)) {
+      rc = plan_cache_stage_.handle_request(&sql_event);
+    }
+    // 命中执行计划缓存时已经有了执行计划
+    const bool cached = sql_result->has_operator();
+    if (OB_SUCC(rc) && !cached) {
+      rc = resolve_stage_.handle_request(&sql_event);
+    }
+    if (OB_SUCC(rc) && !cached) {
+      rc = optimize_stage_.handle_request(&sql_event);
+      rc = rc == RC::UNIMPLENMENT ? RC::SUCCESS : rc;
+    }
+    if (OB_SUCC(rc) && !cached) {
+      rc = execute_stage_.handle_request(&sql_event);
+    }
+    if (OB_SUCC(rc) && !cached) {
+      rc = plan_cache_stage_.add_plan(&sql_event);
+    }
+
+    if (OB_SUCC(rc)) {
+      rc = sql_result->return_code();
+    }
+    if (OB_SUCC(rc) && sql_result->has_operator()) {
+      rc = sql_result->open();
+      if (OB_SUCC(rc) && on_open) {
+        on_open();
+      }
+      Tuple *tuple = nullptr;
+      while (OB_SUCC(rc) && OB_SUCC(rc = sql_result->next_tuple(tuple))) {
+        string row;
+        for (int i = 0; i < tuple->cell_num(); i++) {
+          Value cell;
+          tuple->cell_at(i, cell);
+          row += (i == 0 ? "" : " | ") + cell.to_string();
+        }
+        if (rows != nullptr) {
+          rows->push_back(row);
+        }
+      }
+      rc = rc == RC::RECORD_EOF ? RC::SUCCESS : rc;
+      RC close_rc = sql_result->close();
+      rc = OB_SUCC(rc) ? close_rc : rc;
+    }
+    sql_result->reset_operator();
+
+    session()->set_current_request(nullptr);
+    Session::set_current_session(nullptr);
+    common::QueryArena::set_current(last_arena);
+    common::MemoryTracker::set_current(last_tracker);
+    return rc;
+  }
+
+  /**
+   * @brief 执行SQL并返回排好序的结果
+   */
+  vector<string> query(const string &sql)
+  {
+    vector<string> rows;
+    EXPECT_EQ(RC::SUCCESS, execute(sql, &rows)) << sql;
+    sort(rows.begin(), rows.end());
+    return rows;
+  }
+
+  /**
+   * @brief 返回EXPLAIN输出的执行计划
+   */
+  string explain(const string &sql)
+  {
+    vector<string> rows;
+    EXPECT_EQ(RC::SUCCESS, execute("explain " + sql, &rows)) << sql;
+    EXPECT_EQ(1UL, rows.size()) << sql;
+    return rows.empty() ? "" : rows.front();
+  }
+
+  /**
+   * @brief 返回执行计划中每个表扫描输出的字段，按照先序遍历的顺序
+   */
+  vector<string> scan_fields(const string &sql)
+  {
+    vector<string>                     result;
+    function<void(PhysicalOperator &)> collect = [&](PhysicalOperator &oper) {
+      if (oper.type() == PhysicalOperatorType::TABLE_SCAN) {
+        TupleSchema schema;
+        oper.tuple_schema(schema);
+        string fields;
+        for (int i = 0; i < schema.cell_num(); i++) {
+          fields += string(i == 0 ? "" : ",") + schema.cell_at(i).field_name();
+        }
+        result.push_back(fields);
+      }
+      for (unique_ptr<PhysicalOperator> &child : oper.children()) {
+        collect(*child);
+      }
+    };
+    EXPECT_EQ(RC::SUCCESS, execute(sql, nullptr, [&]() {
+      collect(*session()->current_request()->sql_result()->get_operator());
+    })) << sql;
+    return result;
+  }
+
+  void run(const vector<string> &sqls)
+  {
+    for (const string &sql : sqls) {
+      ASSERT_EQ(RC::SUCCESS, execute(sql)) << sql;
+    }
+  }
+
+  /**
+   * @brief 创建表 name(id int, v int)，插入rows行，id从0开始，v是id % 10，然后收集统计信息
+   */
+  void create_table(const string &name, int rows, bool analyze = true)
+  {
+    ASSERT_EQ(RC::SUCCESS, execute("create table " + name + "(id int, v int);"));
+    for (int i = 0; i < rows; i++) {
+      ASSERT_EQ(RC::SUCCESS,
+          execute("insert into " + name + " values(" + to_string(i) + ", " + to_string(i % 10) + ");"));
+    }
+    if (analyze) {
+      ASSERT_EQ(RC::SUCCESS, execute("analyze table " + name + ";"));
+    }
+  }
+
+  unique_ptr<FieldExpr> field(const string &table_name, const char *field_name)
+  {
+    Table *table = db()->find_table(table_name.c_str());
+    EXPECT_NE(nullptr, table) << table_name;
+    return make_unique<FieldExpr>(table, table->table_meta().field(field_name));
+  }
+
+  unique_ptr<LogicalOperator> table_get(const string &table_name)
+  {
+    Table *table = db()->find_table(table_name.c_str());
+    EXPECT_NE(nullptr, table) << table_name;
+    return make_unique<TableGetLogicalOperator>(table, vector<Field>(), true /*readonly*/);
+  }
+
+  /**
+   * @brief 按照给定的顺序生成左深的连接树，所有的连接条件都放在最上面的连接上，与逻辑计划生成的一致
+   */
+  unique_ptr<LogicalOperator> left_deep_join(
+      const vector<string> &table_names, vector<unique_ptr<Expression>> &&conditions)
+  {
+    unique_ptr<LogicalOperator> oper = table_get(table_names.front());
+    for (size_t i = 1; i < table_names.size(); i++) {
+      unique_ptr<LogicalOperator> join_oper(new JoinLogicalOperator);
+      join_oper->add_child(std::move(oper));
+      join_oper->add_child(table_get(table_names[i]));
+      oper = std::move(join_oper);
+    }
+    for (unique_ptr<Expression> &condition : conditions) {
+      oper->expressions().emplace_back(std::move(condition));
+    }
+    return oper;
+  }
+
+  unique_ptr<Expression> id_equal(const string &left, const string &right)
+  {
+    return make_unique<ComparisonExpr>(EQUAL_TO, field(left, "id"), field(right, "id"));
+  }
+
+  /**
+   * @brief 连接树的形状，比如 (a (b c))
+   */
+  static string join_shape(LogicalOperator &oper)
+  {
+    if (oper.type() != LogicalOperatorType::JOIN) {
+      return static_cast<TableGetLogicalOperator &>(oper).table()->name();
+    }
+    return "(" + join_shape(*oper.children()[0]) + " " + join_shape(*oper.children()[1]) + ")";
+  }
+
+  /**
+   * @brief 检查每个连接条件都在包含它所有表的最低的连接上，返回连接条件的个数
+   * @param cross_joins 没有连接条件的连接个数
+   */
+  static int check_join_conditions(LogicalOperator &oper, int &cross_joins)
+  {
+    if (oper.type() != LogicalOperatorType::JOIN) {
+      return 0;
+    }
+
+    set<const Table *> left_tables;
+    set<const Table *> right_tables;
+    oper.children()[0]->collect_tables(left_tables);
+    oper.children()[1]->collect_tables(right_tables);
+    set<const Table *> all_tables(left_tables);
+    all_tables.insert(right_tables.begin(), right_tables.end());
+    for (unique_ptr<Expression> &expr : oper.expressions()) {
+      set<const Table *> tables;
+      EXPECT_TRUE(PredicatePushdownRewriter::collect_expr_tables(expr.get(), tables));
+      auto covered_by = [&tables](const set<const Table *> &side) {
+        return includes(side.begin(), side.end(), tables.begin(), tables.end());
+      };
+      EXPECT_FALSE(covered_by(left_tables)) << expr->name();
+      EXPECT_FALSE(covered_by(right_tables)) << expr->name();
+      EXPECT_TRUE(covered_by(all_tables)) << expr->name();
+    }
+    cross_joins += oper.expressions().empty() ? 1 : 0;
+    return static_cast<int>(oper.expressions().size()) + check_join_conditions(*oper.children()[0], cross_joins) +
+           check_join_conditions(*oper.children()[1], cross_joins);
+  }
+
+protected:
+  static string test_dir_;
+
+  TestCommunicator communicator_{new Session(Session::default_session())};
+  ParseStage       parse_stage_;
+  PlanCacheStage   plan_cache_stage_;
+  ResolveStage     resolve_stage_;
+  OptimizeStage    optimize_stage_;
+  ExecuteStage     execute_stage_;
+};
+
+string OptimizerTest::test_dir_;
+
+TEST_F(OptimizerTest, test_projection_pushdown)
+{
+  run({"create table wide(id int, name char(16), memo char(32), score float);",
+       "insert into wide values(1, 'a', 'memo1', 1.5);",
+       "insert into wide values(2, 'b', 'memo2', 2.5);"});
+
+  // 表扫描只输出上层引用的字段，只在扫描的过滤条件中出现的字段不输出
+  ASSERT_EQ(vector<string>({"id,memo"}), scan_fields("select memo, id from wide;"));
+  ASSERT_EQ(vector<string>({"name"}), scan_fields("select name from wide where score > 2;"));
+  ASSERT_EQ(vector<string>({"id"}), scan_fields("select count(*) from wide;"));
+  ASSERT_EQ(vector<string>({"1 | memo1", "2 | memo2"}), query("select id, memo from wide;"));
+  ASSERT_EQ(vector<string>({"b"}), query("select name from wide where score > 2;"));
+  ASSERT_EQ(vector<string>({"2"}), query("select count(*) from wide;"));
+
+  // 连接两侧分别输出连接条件和投影中的字段
+  run({"create table narrow(id int, v int);", "insert into narrow values(2, 20);"});
+  ASSERT_EQ(vector<string>({"id,memo", "id"}),
+      scan_fields("select wide.memo from wide, narrow where wide.id = narrow.id;"));
+  ASSERT_EQ(vector<string>({"memo2"}), query("select wide.memo from wide, narrow where wide.id = narrow.id;"));
+}
+
+TEST_F(OptimizerTest, test_field_cell_binding)
+{
+  run({"create table bind_t(id int, name char(8), v int);",
+       "insert into bind_t values(1, 'a', 10);",
+       "insert into bind_t values(2, 'b', 20);",
+       "insert into bind_t values(3, 'c', 30);"});
+
+  ValueListTuple input;
+  input.set_specs({TupleCellSpec("bind_t", "id"), TupleCellSpec("bind_t", "name"), TupleCellSpec("bind_t", "v")});
+  input.set_cells({Value(1), Value("a"), Value(10)});
+
+  // 没有绑定时按照名字查找，绑定之后直接按位置取值，不再比较名字
+  unique_ptr<FieldExpr> v = field("bind_t", "v");
+  Value value;
+  ASSERT_EQ(-1, v->cell_index());
+  ASSERT_EQ(RC::SUCCESS, v->get_value(input, value));
+  ASSERT_EQ(10, value.get_int());
+  v->set_cell_index(0);
+  ASSERT_EQ(RC::SUCCESS, v->get_value(input, value));
+  ASSERT_EQ(1, value.get_int());
+  ASSERT_EQ(0, static_cast<FieldExpr *>(v->copy().get())->cell_index());
+
+  // 投影按照绑定时的schema取值(这里与输入tuple的顺序不同)，schema中没有的cell仍然按照名字查找
+  TupleSchema schema;
+  schema.append_cell("bind_t", "v");
+  schema.append_cell("bind_t", "id");
+  ProjectTuple project;
+  project.add_cell_spec(new TupleCellSpec("bind_t", "v"));
+  project.add_cell_spec(new TupleCellSpec("bind_t", "name"));
+  project.bind_cells(schema);
+  project.set_tuple(&input);
+  ASSERT_EQ(RC::SUCCESS, project.cell_at(0, value));
+  ASSERT_EQ(1, value.get_int());
+  ASSERT_EQ(RC::SUCCESS, project.cell_at(1, value));
+  ASSERT_EQ("a", value.to_string());
+
+  // 裁剪掉的字段不在扫描输出的tuple中，上层的排序和投影按照裁剪后的位置绑定
+  const string sql = "select v, name from bind_t where id > 1 order by v desc;";
+  ASSERT_EQ(vector<string>({"name,v"}), scan_fields(sql));
+  Table *table = db()->find_table("bind_t");
+  TableScanPhysicalOperator scan(table, true /*readonly*/);
+  const TableMeta &table_meta = table->table_meta();
+  scan.set_output_fields({Field(table, table_meta.field("name")), Field(table, table_meta.field("v"))});
+  vector<unique_ptr<Expression>> predicates;
+  predicates.emplace_back(new ComparisonExpr(GREAT_THAN, field("bind_t", "id"), make_unique<ValueExpr>(Value(1))));
+  scan.set_predicates(std::move(predicates));
+  ASSERT_EQ(RC::SUCCESS, scan.open(session()->current_trx()));
+  ASSERT_EQ(RC::SUCCESS, scan.next());
+  Tuple *tuple = scan.current_tuple();
+  ASSERT_EQ(2, tuple->cell_num());
+  ASSERT_EQ(RC::NOTFOUND, tuple->find_cell(TupleCellSpec("bind_t", "id"), value));
+  ASSERT_EQ(RC::SUCCESS, tuple->cell_at(0, value));
+  ASSERT_EQ("b", value.to_string());
+  ASSERT_EQ(RC::SUCCESS, tuple->cell_at(1, value));
+  ASSERT_EQ(20, value.get_int());
+  ASSERT_EQ(RC::SUCCESS, scan.close());
+
+  vector<string> rows;
+  ASSERT_EQ(RC::SUCCESS, execute(sql, &rows));
+  ASSERT_EQ(vector<string>({"30 | c", "20 | b"}), rows);
+  ASSERT_EQ(vector<string>({"b | 20"}), query("select name, v from bind_t where id > 1 and v < 25;"));
+}
+
+TEST_F(OptimizerTest, test_hash_join_build_columns)
+{
+  // build端的表行数少，字符串字段在hash表中保存，probe时不再读取build端的记录
+  run({"create table build_t(id int, name char(16), memo char(32));",
+       "create table probe_t(id int, v int);",
+       "insert into build_t values(1, 'name1', 'memo1');",
+       "insert into build_t values(2, 'name2', 'memo2');",
+       "insert into build_t values(3, 'name3', 'memo3');"});
+  for (int i = 0; i < 60; i++) {
+    ASSERT_EQ(RC::SUCCESS, execute("insert into probe_t values(" + to_string(i % 4) + ", " + to_string(i) + ");"));
+  }
+  run({"analyze table build_t;", "analyze table probe_t;"});
+
+  const string sql =
+      "select build_t.name, build_t.memo, probe_t.v from build_t, probe_t where build_t.id = probe_t.id;";
+  ASSERT_NE(string::npos, explain(sql).find("HASH_JOIN(build=left)\n  ├─TABLE_SCAN(build_t)")) << explain(sql);
+  vector<string> expected = query(sql);
+  ASSERT_EQ(45UL, expected.size());
+  ASSERT_NE(expected.end(), find(expected.begin(), expected.end(), "name3 | memo3 | 59"));
+
+  // 第一行返回时hash表已经建好，之后删除build端的记录，再插入新的记录复用这些记录的位置，
+  // 连接的结果仍然是build时的数据
+  vector<string> rows;
+  ASSERT_EQ(RC::SUCCESS, execute(sql, &rows, [this]() {
+    ASSERT_EQ(RC::SUCCESS, execute("delete from build_t;"));
+    ASSERT_EQ(RC::SUCCESS, execute("insert into build_t values(1, 'other1', 'other1');"));
+    ASSERT_EQ(RC::SUCCESS, execute("insert into build_t values(2, 'other2', 'other2');"));
+    ASSERT_EQ(RC::SUCCESS, execute("insert into build_t values(3, 'other3', 'other3');"));
+  }));
+  sort(rows.begin(), rows.end());
+  ASSERT_EQ(expected, rows);
+
+  ASSERT_EQ(vector<string>({"other1"}), query("select name from build_t where id = 1;"));
+}
+
+TEST_F(OptimizerTest, test_table_stats_snapshot)
+{
+  run({"create table stats_t(id int);",
+       "insert into stats_t values(1);",
+       "insert into stats_t values(2);",
+       "insert into stats_t values(3);",
+       "analyze table stats_t;"});
+  Table *table = db()->find_table("stats_t");
+  ASSERT_NE(nullptr, table);
+
+  TableStatsSnapshot           snapshot;
+  shared_ptr<const TableStats> stats = CardinalityEstimator::table_stats(table);
+  ASSERT_NE(nullptr, stats);
+  ASSERT_EQ(3, stats->row_count());
+
+  // 再次 ANALYZE 替换了表的统计信息，快照中仍然是原来的一份
+  run({"insert into stats_t values(4);", "analyze table stats_t;"});
+  ASSERT_EQ(4, table->table_stats()->row_count());
+  ASSERT_EQ(stats, CardinalityEstimator::table_stats(table));
+  ASSERT_EQ(3, stats->row_count());
+}
+
+TEST_F(OptimizerTest, test_non_reserved_keyword_names)
+{
+  run({"create table s(status int, limit int);",
+       "insert into s values(1, 10);",
+       "insert into s values(2, 20);",
+       "create table order(group int);",
+       "insert into order values(2);"});
+  ASSERT_EQ(vector<string>({"2 | 20"}), query("select status, limit from s where status > 1;"));
+  ASSERT_EQ(vector<string>({"20"}), query("select s.limit from s, order where s.status = order.group;"));
+  ASSERT_EQ(vector<string>({"1", "2"}), query("select status from s group by status order by status desc;"));
+}
+
+TEST_F(OptimizerTest, test_join_order_dp)
+{
+  create_table("big", 1000);
+  create_table("mid", 100);
+  create_table("small", 10);
+
+  // 按照FROM的顺序先连接big和mid会产生100行的中间结果，先连接mid和small只有10行，
+  // 较大的一侧作为左孩子
+  vector<unique_ptr<Expression>> conditions;
+  conditions.push_back(id_equal("big", "mid"));
+  conditions.push_back(id_equal("mid", "small"));
+  unique_ptr<LogicalOperator> oper = left_deep_join({"big", "mid", "small"}, std::move(conditions));
+  ASSERT_EQ(RC::SUCCESS, JoinOrderOptimizer().optimize(oper));
+  ASSERT_EQ("(big (mid small))", join_shape(*oper));
+
+  int cross_joins = 0;
+  ASSERT_EQ(2, check_join_conditions(*oper, cross_joins));
+  ASSERT_EQ(0, cross_joins);
+
+  // 没有连接条件的两个表即使都很小，也不会先做笛卡尔积
+  conditions.clear();
+  conditions.push_back(id_equal("big", "mid"));
+  conditions.push_back(id_equal("big", "small"));
+  oper = left_deep_join({"mid", "small", "big"}, std::move(conditions));
+  ASSERT_EQ(RC::SUCCESS, JoinOrderOptimizer().optimize(oper));
+  ASSERT_EQ("(mid (big small))", join_shape(*oper));
+  ASSERT_EQ(2, check_join_conditions(*oper, cross_joins));
+  ASSERT_EQ(0, cross_joins);
+
+  const string sql = "select count(*) from big, mid, small where big.id = mid.id and mid.id = small.id;";
+  ASSERT_EQ(vector<string>({"10"}), query(sql));
+}
+
+TEST_F(OptimizerTest, test_join_order_greedy)
+{
+  // 超过动态规划的输入个数时使用贪心算法，t0 - t1 - ... - t11 是一条链，t5最小
+  const int                      table_num = JoinOrderOptimizer::DP_MAX_LEAVES + 2;
+  vector<string>                 table_names;
+  vector<unique_ptr<Expression>> conditions;
+  for (int i = 0; i < table_num; i++) {
+    table_names.push_back("t" + to_string(i));
+    create_table(table_names.back(), i == 5 ? 2 : 10 + i);
+    if (i > 0) {
+      conditions.push_back(id_equal(table_names[i - 1], table_names[i]));
+    }
+  }
+
+  unique_ptr<LogicalOperator> oper = left_deep_join(table_names, std::move(conditions));
+  ASSERT_EQ(RC::SUCCESS, JoinOrderOptimizer().optimize(oper));
+
+  // 第一次合并结果最小的t4和t5，之后依次合并与当前部分相邻的表，整个过程都不需要笛卡尔积
+  const string shape = join_shape(*oper);
+  ASSERT_NE(string::npos, shape.find("(t4 t5)")) << shape;
+  int cross_joins = 0;
+  ASSERT_EQ(table_num - 1, check_join_conditions(*oper, cross_joins)) << shape;
+  ASSERT_EQ(0, cross_joins) << shape;
+
+  string sql = "select count(*) from t0";
+  string where;
+  for (int i = 1; i < table_num; i++) {
+    sql += ", t" + to_string(i);
+    where += string(i == 1 ? " where " : " and ") + "t" + to_string(i - 1) + ".id = t" + to_string(i) + ".id";
+  }
+  ASSERT_EQ(vector<string>({"2"}), query(sql + where + ";"));
+}
+
+TEST_F(OptimizerTest, test_join_condition_placement)
+{
+  create_table("a", 40);
+  create_table("b", 30);
+  create_table("c", 20);
+  create_table("d", 10);
+
+  // 只涉及两个表的条件放在连接这两个表的连接上，涉及三个表的条件放在包含这三个表的最低的连接上
+  vector<unique_ptr<Expression>> conditions;
+  conditions.push_back(id_equal("a", "b"));
+  conditions.push_back(id_equal("b", "c"));
+  conditions.push_back(id_equal("c", "d"));
+  conditions.push_back(make_unique<ComparisonExpr>(
+      EQUAL_TO, make_unique<ArithmeticExpr>(ArithmeticExpr::Type::ADD, field("a", "v"), field("b", "v")),
+      field("c", "v")));
+  unique_ptr<LogicalOperator> oper = left_deep_join({"a", "b", "c", "d"}, std::move(conditions));
+  ASSERT_EQ(RC::SUCCESS, JoinOrderOptimizer().optimize(oper));
+
+  int cross_joins = 0;
+  ASSERT_EQ(4, check_join_conditions(*oper, cross_joins)) << join_shape(*oper);
+  ASSERT_EQ(0, cross_joins);
+
+  ASSERT_EQ(vector<string>({"10"}),
+      query("select count(*) from a, b, c, d where a.id = b.id and b.id = c.id and c.id = d.id and a.v = c.v;"));
+}
+
+TEST_F(OptimizerTest, test_join_duplicate_table)
+{
+  create_table("dup_a", 20);
+  create_table("dup_b", 10);
+
+  // 同一张表出现多次时无法区分连接条件涉及哪个输入，保持原来的连接树
+  vector<unique_ptr<Expression>> conditions;
+  conditions.push_back(id_equal("dup_a", "dup_b"));
+  unique_ptr<LogicalOperator> oper = left_deep_join({"dup_a", "dup_b", "dup_a"}, std::move(conditions));
+  ASSERT_EQ(RC::SUCCESS, JoinOrderOptimizer().optimize(oper));
+  ASSERT_EQ("((dup_a dup_b) dup_a)", join_shape(*oper));
+  ASSERT_EQ(1UL, oper->expressions().size());
+  ASSERT_TRUE(oper->children()[0]->expressions().empty());
+}
+
+TEST_F(OptimizerTest, test_hash_join_build_side)
+{
+  create_table("large_t", 200);
+  create_table("tiny_t", 5);
+
+  // 两个表的连接不调整顺序，行数少的一侧作为build端，输出仍然是左表在前
+  ASSERT_NE(string::npos,
+      explain("select * from large_t, tiny_t where large_t.id = tiny_t.id;").find("HASH_JOIN(build=right)"));
+  ASSERT_NE(string::npos,
+      explain("select * from tiny_t, large_t where large_t.id = tiny_t.id;").find("HASH_JOIN(build=left)"));
+  ASSERT_EQ(vector<string>({"3 | 3 | 3 | 3"}),
+      query("select * from tiny_t, large_t where large_t.id = tiny_t.id and tiny_t.id = 3;"));
+
+  // 过滤之后large_t只剩下一行，成为build端
+  ASSERT_NE(string::npos,
+      explain("select * from large_t, tiny_t where large_t.id = tiny_t.id and large_t.id = 3;")
+          .find("HASH_JOIN(build=left)"));
+}
+
+TEST_F(OptimizerTest, test_estimate_with_stats)
+{
+  create_table("est_t", 1000, false /*analyze*/);
+  Table *table = db()->find_table("est_t");
+  ASSERT_NE(nullptr, table);
+
+  // 没有统计信息时按照数据页面装满估算行数，等值条件使用默认的选择率
+  const double page_rows = BP_PAGE_DATA_SIZE / table->table_meta().record_size();
+  ASSERT_EQ(nullptr, table->table_stats());
+  ASSERT_GE(CardinalityEstimator::table_rows(table), 1000);
+  ASSERT_LT(CardinalityEstimator::table_rows(table), 1000 + 2 * page_rows);
+
+  ComparisonExpr equal_expr(EQUAL_TO, field("est_t", "v"), make_unique<ValueExpr>(Value(3)));
+  ComparisonExpr range_expr(LESS_THAN, field("est_t", "id"), make_unique<ValueExpr>(Value(100)));
+  ComparisonExpr join_expr(EQUAL_TO, field("est_t", "v"), field("est_t", "id"));
+  ASSERT_DOUBLE_EQ(CardinalityEstimator::DEFAULT_EQUAL_SELECTIVITY, CardinalityEstimator::selectivity(equal_expr));
+  ASSERT_DOUBLE_EQ(CardinalityEstimator::DEFAULT_RANGE_SELECTIVITY, CardinalityEstimator::selectivity(range_expr));
+  ASSERT_DOUBLE_EQ(1.0 / CardinalityEstimator::table_rows(table), CardinalityEstimator::selectivity(join_expr));
+
+  // 收集统计信息之后使用准确的行数、不同值的个数和直方图
+  run({"analyze table est_t;"});
+  ASSERT_DOUBLE_EQ(1000, CardinalityEstimator::table_rows(table));
+  ASSERT_NEAR(0.1, CardinalityEstimator::selectivity(equal_expr), 0.01);
+  ASSERT_NEAR(0.1, CardinalityEstimator::selectivity(range_expr), 0.02);
+  ASSERT_DOUBLE_EQ(1.0 / 1000, CardinalityEstimator::selectivity(join_expr));
+
+  unique_ptr<LogicalOperator> scan = table_get("est_t");
+  static_cast<TableGetLogicalOperator &>(*scan).predicates().push_back(
+      make_unique<ComparisonExpr>(EQUAL_TO, field("est_t", "v"), make_unique<ValueExpr>(Value(3))));
+  ASSERT_NEAR(100, CardinalityEstimator::estimate_rows(*scan), 10);
+}
+
+TEST_F(OptimizerTest, test_index_nested_loop_join)
+{
+  create_table("inlj_big", 1000);
+  create_table("inlj_mid", 200);
+  create_table("inlj_small", 10);
+  run({"create index inlj_big_id on inlj_big(id);"});
+
+  // 外表很小并且内表在连接字段上有索引时使用index nested loop join，内表可以是左表也可以是右表
+  const string inlj = "INDEX_NESTED_LOOP_JOIN(inlj_big_id ON inlj_big)";
+  ASSERT_NE(string::npos, explain("select * from inlj_small, inlj_big where inlj_small.id = inlj_big.id;").find(inlj));
+  ASSERT_NE(string::npos, explain("select * from inlj_big, inlj_small where inlj_small.id = inlj_big.id;").find(inlj));
+  ASSERT_EQ(vector<string>({"10"}),
+      query("select count(*) from inlj_big, inlj_small where inlj_small.id = inlj_big.id;"));
+
+  // 内表上的过滤条件在索引查找之后执行
+  const string filtered =
+      "select count(*) from inlj_small, inlj_big where inlj_small.id = inlj_big.id and inlj_big.v <> 3;";
+  ASSERT_NE(string::npos, explain(filtered).find(inlj)) << explain(filtered);
+  ASSERT_EQ(vector<string>({"9"}), query(filtered));
+
+  // 外表不够小时使用hash join
+  const string mid_join = "select count(*) from inlj_mid, inlj_big where inlj_mid.id = inlj_big.id;";
+  ASSERT_EQ(string::npos, explain(mid_join).find("INDEX_NESTED_LOOP_JOIN")) << explain(mid_join);
+  ASSERT_NE(string::npos, explain(mid_join).find("HASH_JOIN"));
+  ASSERT_EQ(vector<string>({"200"}), query(mid_join));
+
+  // 过滤之后外表变小，也可以使用内表的索引
+  ASSERT_NE(string::npos,
+      explain("select * from inlj_mid, inlj_big where inlj_mid.id = inlj_big.id and inlj_mid.id < 5;").find(inlj));
+
+  // 内表在连接字段上没有索引时不使用index nested loop join
+  const string no_index = "select count(*) from inlj_small, inlj_mid where inlj_small.id = inlj_mid.id;";
+  ASSERT_EQ(string::npos, explain(no_index).find("INDEX_NESTED_LOOP_JOIN")) << explain(no_index);
+  ASSERT_EQ(vector<string>({"10"}), query(no_index));
+}
+
+TEST_F(OptimizerTest, test_join_key_types)
+{
+  run({"create table key_a(i int, f float, c char(4));",
+       "create table key_b(i int, f float, c char(4));"});
+  for (int i = 0; i < 5; i++) {
+    const string values = to_string(i) + ", " + to_string(i) + ".0, 'c" + to_string(i) + "'";
+    ASSERT_EQ(RC::SUCCESS, execute("insert into key_a values(" + values + ");"));
+    ASSERT_EQ(RC::SUCCESS, execute("insert into key_b values(" + values + ");"));
+  }
+
+  // 类型相同的int、字符串字段可以作为hash join的key
+  for (const char *column : {"i", "c"}) {
+    const string sql = string("select count(*) from key_a, key_b where key_a.") + column + " = key_b." + column + ";";
+    ASSERT_NE(string::npos, explain(sql).find("HASH_JOIN")) << explain(sql);
+    ASSERT_EQ(vector<string>({"5"}), query(sql));
+  }
+
+  // 浮点数的相等比较有误差范围，类型不同的字段比较前需要转换，都不能作为key
+  for (const char *condition : {"key_a.f = key_b.f", "key_a.i = key_b.f", "key_a.f = key_b.i"}) {
+    const string sql = string("select count(*) from key_a, key_b where ") + condition + ";";
+    ASSERT_EQ(string::npos, explain(sql).find("HASH_JOIN")) << explain(sql);
+    ASSERT_NE(string::npos, explain(sql).find("NESTED_LOOP_JOIN")) << explain(sql);
+    ASSERT_EQ(vector<string>({"5"}), query(sql));
+  }
+}
+
+TEST_F(OptimizerTest, test_index_range_merge)
+{
+  // 没有统计信息时按照范围是否确定选择索引，不比较代价
+  create_table("range_t", 100, false /*analyze*/);
+  run({"create index range_id on range_t(id);"});
+
+  // 同一个字段上的多个条件取交集，常量在左边时交换两边
+  struct Case
+  {
+    string condition;
+    string range;
+    int    low;
+    int    high;  ///< 结果是 [low, high) 中的id
+  };
+  const vector<Case> cases = {
+      {"id > 1 and id >= 3 and id < 10", "INDEX_SCAN(range_id ON range_t, [3, 10))", 3, 10},
+      {"id >= 3 and id > 3 and id <= 10 and id < 11", "INDEX_SCAN(range_id ON range_t, (3, 10])", 4, 11},
+      {"id = 5 and id >= 2", "INDEX_SCAN(range_id ON range_t, =5)", 5, 6},
+      {"id >= 5 and id <= 5", "INDEX_SCAN(range_id ON range_t, =5)", 5, 6},
+      {"95 < id", "INDEX_SCAN(range_id ON range_t, (95, +inf))", 96, 100},
+      {"id <> 3 and id <= 2", "INDEX_SCAN(range_id ON range_t, (-inf, 2])", 0, 3},
+  };
+  for (const Case &c : cases) {
+    const string sql = "select id from range_t where " + c.condition + ";";
+    ASSERT_NE(string::npos, explain(sql).find(c.range)) << explain(sql);
+
+    vector<string> expected;
+    for (int id = c.low; id < c.high; id++) {
+      expected.push_back(to_string(id));
+    }
+    sort(expected.begin(), expected.end());
+    ASSERT_EQ(expected, query(sql)) << sql;
+  }
+}
+
+TEST_F(OptimizerTest, test_index_range_empty)
+{
+  create_table("empty_range_t", 100, false /*analyze*/);
+  run({"create index empty_range_id on empty_range_t(id);"});
+
+  // int字段上互相矛盾的条件在重写时就变成了false，不再扫描表
+  const vector<string> conditions = {
+      "id > 10 and id < 5", "id >= 5 and id < 5", "id > 5 and id <= 5", "id = 3 and id = 4"};
+  for (const string &condition : conditions) {
+    const string sql  = "select id from empty_range_t where " + condition + ";";
+    const string plan = explain(sql);
+    ASSERT_EQ(string::npos, plan.find("SCAN")) << plan;
+    ASSERT_TRUE(query(sql).empty()) << sql;
+  }
+
+  // float字段上的条件重写时不判断是否矛盾，索引的范围为空时不使用索引，表扫描上的过滤条件得到空结果
+  run({"create table empty_range_f(f float);", "create index empty_range_f_idx on empty_range_f(f);"});
+  for (int i = 0; i < 10; i++) {
+    ASSERT_EQ(RC::SUCCESS, execute("insert into empty_range_f values(" + to_string(i) + ".5);"));
+  }
+  for (const char *condition : {"f > 5 and f < 3", "f >= 2.5 and f < 2.5"}) {
+    const string sql  = string("select f from empty_range_f where ") + condition + ";";
+    const string plan = explain(sql);
+    ASSERT_EQ(string::npos, plan.find("INDEX_SCAN")) << plan;
+    ASSERT_NE(string::npos, plan.find("TABLE_SCAN(empty_range_f)")) << plan;
+    ASSERT_TRUE(query(sql).empty()) << sql;
+  }
+
+  // 参数在执行时才知道，范围为空时索引扫描不输出数据
+  run({"prepare empty_range_s from 'select id from empty_range_t where id > ? and id < ?';"});
+  ASSERT_TRUE(query("execute empty_range_s using 10, 5;").empty());
+  ASSERT_EQ(vector<string>({"4", "5"}), query("execute empty_range_s using 3, 6;"));
+  ASSERT_TRUE(query("execute empty_range_s using 5, 5;").empty());
+}
+
+TEST_F(OptimizerTest, test_index_range_cast)
+{
+  create_table("cast_t", 20, false /*analyze*/);
+  run({"create index cast_id on cast_t(id);"});
+
+  // 整数值的浮点数常量转换成int作为边界，保留原来是否包含边界
+  auto ids = [](int low, int high) {
+    vector<string> result;
+    for (int id = low; id < high; id++) {
+      result.push_back(to_string(id));
+    }
+    sort(result.begin(), result.end());
+    return result;
+  };
+  string sql = "select id from cast_t where id >= 3.0 and id < 7.0;";
+  ASSERT_NE(string::npos, explain(sql).find("INDEX_SCAN(cast_id ON cast_t, [3, 7))")) << explain(sql);
+  ASSERT_EQ(ids(3, 7), query(sql));
+  sql = "select id from cast_t where id > 3.0 and id <= 7.0;";
+  ASSERT_NE(string::npos, explain(sql).find("INDEX_SCAN(cast_id ON cast_t, (3, 7])")) << explain(sql);
+  ASSERT_EQ(ids(4, 8), query(sql));
+
+  // 有小数部分的常量不能作为int的边界，只用其它条件确定范围，边界两侧的数据都由过滤条件判断
+  sql = "select id from cast_t where id > 2.5 and id < 7;";
+  ASSERT_NE(string::npos, explain(sql).find("INDEX_SCAN(cast_id ON cast_t, (-inf, 7))")) << explain(sql);
+  ASSERT_EQ(ids(3, 7), query(sql));
+  sql = "select id from cast_t where id < 2.5;";
+  ASSERT_NE(string::npos, explain(sql).find("TABLE_SCAN(cast_t)")) << explain(sql);
+  ASSERT_EQ(ids(0, 3), query(sql));
+  ASSERT_TRUE(query("select id from cast_t where id = 2.5;").empty());
+
+  // 超出int范围的常量也不能作为边界
+  sql = "select count(*) from cast_t where id < 3000000000.0;";
+  ASSERT_NE(string::npos, explain(sql).find("TABLE_SCAN(cast_t)")) << explain(sql);
+  ASSERT_EQ(vector<string>({"20"}), query(sql));
+
+  // float字段上的索引，整数常量转换成float
+  run({"create table cast_f(f float);", "create index cast_f_idx on cast_f(f);"});
+  for (int i = 0; i < 20; i++) {
+    ASSERT_EQ(RC::SUCCESS, execute("insert into cast_f values(" + to_string(i * 0.5) + ");"));
+  }
+  sql = "select count(*) from cast_f where f >= 2 and f < 4;";
+  ASSERT_NE(string::npos, explain(sql).find("INDEX_SCAN(cast_f_idx ON cast_f, [2")) << explain(sql);
+  ASSERT_EQ(vector<string>({"4"}), query(sql));
+}
+
+TEST_F(OptimizerTest, test_index_choice)
+{
+  run({"create table choice_t(a int, b int, c int, memo char(200));",
+       "create index choice_a on choice_t(a);",
+       "create index choice_b on choice_t(b);",
+       "create index choice_c on choice_t(c);"});
+  for (int i = 0; i < 1000; i++) {
+    ASSERT_EQ(RC::SUCCESS, execute("insert into choice_t values(" + to_string(i) + ", " + to_string(i % 100) + ", " +
+                                   to_string(i % 10) + ", 'memo');"));
+  }
+
+  // 没有统计信息时优先选择等值查询，其次是两侧都有边界的范围
+  string sql = "select count(*) from choice_t where a > 10 and b = 5 and c > 4;";
+  ASSERT_NE(string::npos, explain(sql).find("INDEX_SCAN(choice_b ON choice_t, =5)")) << explain(sql);
+  ASSERT_EQ(vector<string>({"9"}), query(sql));
+  sql = "select count(*) from choice_t where c < 5 and a > 10 and a < 20;";
+  ASSERT_NE(string::npos, explain(sql).find("INDEX_SCAN(choice_a ON choice_t, (10, 20))")) << explain(sql);
+  ASSERT_EQ(vector<string>({"4"}), query(sql));
+
+  // 有统计信息时比较代价，选择范围内行数最少的索引，范围太大时表扫描更便宜
+  run({"analyze table choice_t;"});
+  sql = "select count(*) from choice_t where c = 0 and b = 0 and a = 500;";
+  ASSERT_NE(string::npos, explain(sql).find("INDEX_SCAN(choice_a ON choice_t, =500)")) << explain(sql);
+  ASSERT_EQ(vector<string>({"1"}), query(sql));
+  sql = "select count(*) from choice_t where b >= 90 and a >= 998;";
+  ASSERT_NE(string::npos, explain(sql).find("INDEX_SCAN(choice_a ON choice_t, [998, +inf))")) << explain(sql);
+  ASSERT_EQ(vector<string>({"2"}), query(sql));
+  sql = "select count(*) from choice_t where a >= 0 and c < 9;";
+  ASSERT_NE(string::npos, explain(sql).find("TABLE_SCAN(choice_t)")) << explain(sql);
+  ASSERT_EQ(vector<string>({"900"}), query(sql));
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
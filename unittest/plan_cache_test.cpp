@@ -0,0 +1,123 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+
+//
+// Created by agent on 2026/10/18
+//
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "sql/operator/limit_physical_operator.h"
+#include "sql/plan_cache/plan_cache.h"
+#include "sql/plan_cache/prepared_stmt.h"
+#include "gtest/gtest.h"
+
+using namespace std;
+
+static unique_ptr<CachedPlan> make_plan(const string &key, uint64_t schema_version)
+{
+  auto plan = make_unique<CachedPlan>(key, schema_version, vector<Value>{Value(1)});
+  plan->return_operator(make_unique<LimitPhysicalOperator>(1, 0));
+  return plan;
+}
+
+TEST(PlanCache, test_acquire_release)
+{
+  PlanCache cache;
+  ASSERT_EQ(nullptr, cache.acquire("a", 1));
+
+  cache.release(make_plan("a", 1));
+  cache.release(make_plan("a", 1));
+  ASSERT_EQ(2UL, cache.size());
+
+  // 同一个key的两个执行计划可以同时被使用
+  unique_ptr<CachedPlan> plan1 = cache.acquire("a", 1);
+  unique_ptr<CachedPlan> plan2 = cache.acquire("a", 1);
+  ASSERT_NE(nullptr, plan1);
+  ASSERT_NE(nullptr, plan2);
+  ASSERT_EQ(nullptr, cache.acquire("a", 1));
+  ASSERT_EQ(nullptr, cache.acquire("b", 1));
+  ASSERT_EQ(0UL, cache.size());
+
+  // 执行失败时算子已经被取走，不再放回缓存
+  plan1->take_operator();
+  cache.release(std::move(plan1));
+  cache.release(std::move(plan2));
+  ASSERT_EQ(1UL, cache.size());
+}
+
+TEST(PlanCache, test_schema_version)
+{
+  PlanCache cache;
+  cache.release(make_plan("a", 1));
+  cache.release(make_plan("b", 1));
+
+  ASSERT_EQ(nullptr, cache.acquire("a", 2));
+  ASSERT_EQ(1UL, cache.size());
+  ASSERT_NE(nullptr, cache.acquire("b", 1));
+}
+
+TEST(PlanCache, test_lru)
+{
+  PlanCache cache(2);
+  cache.release(make_plan("a", 1));
+  cache.release(make_plan("b", 1));
+
+  // 使用a之后，b成为最久没有使用的
+  cache.release(cache.acquire("a", 1));
+  cache.release(make_plan("c", 1));
+  ASSERT_EQ(2UL, cache.size());
+  ASSERT_EQ(nullptr, cache.acquire("b", 1));
+  ASSERT_NE(nullptr, cache.acquire("a", 1));
+  ASSERT_NE(nullptr, cache.acquire("c", 1));
+}
+
+TEST(PreparedStmt, test_parse_and_bind)
+{
+  unique_ptr<ParsedSqlNode> sql_node;
+  int                       param_num = 0;
+  ASSERT_EQ(RC::SUCCESS, PreparedStmt::parse("select * from t where id = ? and ? < name;", sql_node, param_num));
+  ASSERT_EQ(2, param_num);
+
+  vector<Value> params{Value(10), Value("abc")};
+  ASSERT_EQ(RC::SUCCESS, PreparedStmt::bind_params(*sql_node, params));
+  const vector<ConditionSqlNode> &conditions = sql_node->selection.conditions;
+  ASSERT_EQ(2UL, conditions.size());
+  int bound = 0;
+  for (const ConditionSqlNode &condition : conditions) {
+    if (condition.right_param >= 0) {
+      ASSERT_EQ(&params[condition.right_param], condition.right_param_value);
+      bound++;
+    }
+    if (condition.left_param >= 0) {
+      ASSERT_EQ(&params[condition.left_param], condition.left_param_value);
+      bound++;
+    }
+  }
+  ASSERT_EQ(2, bound);
+
+  ASSERT_EQ(RC::SUCCESS, PreparedStmt::parse("insert into t values(?, 'a', ?);", sql_node, param_num));
+  ASSERT_EQ(2, param_num);
+  ASSERT_EQ(RC::SUCCESS, PreparedStmt::bind_params(*sql_node, params));
+  ASSERT_EQ(10, sql_node->insertion.values[0].get_int());
+  ASSERT_EQ(string("abc"), sql_node->insertion.values[2].get_string());
+
+  ASSERT_NE(RC::SUCCESS, PreparedStmt::parse("select * from t; select * from t;", sql_node, param_num));
+  ASSERT_NE(RC::SUCCESS, PreparedStmt::parse("prepare s from 'select * from t';", sql_node, param_num));
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
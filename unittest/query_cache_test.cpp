@@ -0,0 +1,121 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+
+//
+// Created by agent on 2026/10/18
+//
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "sql/query_cache/query_cache.h"
+#include "storage/clog/clog.h"
+#include "storage/db/db.h"
+#include "gtest/gtest.h"
+
+using namespace std;
+
+static shared_ptr<QueryResult> make_result(uint64_t schema_version, int rows)
+{
+  TupleSchema schema;
+  schema.append_cell("id");
+  auto result = make_shared<QueryResult>(schema_version, schema);
+  for (int i = 0; i < rows; i++) {
+    result->append_row({Value(i)});
+  }
+  return result;
+}
+
+TEST(QueryCache, test_make_key)
+{
+  const string key = QueryCache::make_key("sys", "select  *\tfrom t ;");
+  ASSERT_EQ(string("sys\nselect * from t"), key);
+  ASSERT_EQ(key, QueryCache::make_key("sys", "  select * from t"));
+  ASSERT_NE(key, QueryCache::make_key("other", "select * from t"));
+  ASSERT_NE(key, QueryCache::make_key("sys", "SELECT * from t"));
+
+  // 引号中的空白不能合并
+  ASSERT_NE(QueryCache::make_key("sys", "select * from t where name='a b'"),
+            QueryCache::make_key("sys", "select * from t where name='a  b'"));
+}
+
+TEST(QueryCache, test_lookup)
+{
+  Db         db;
+  QueryCache cache;
+  ASSERT_EQ(nullptr, cache.lookup("a", &db));
+
+  cache.insert("a", make_result(db.schema_version(), 10));
+  shared_ptr<const QueryResult> result = cache.lookup("a", &db);
+  ASSERT_NE(nullptr, result);
+  ASSERT_EQ(10UL, result->rows().size());
+
+  // 引用的表不存在
+  auto missing_table = make_result(db.schema_version(), 1);
+  missing_table->add_table("t", 0);
+  cache.insert("b", missing_table);
+  ASSERT_EQ(nullptr, cache.lookup("b", &db));
+
+  db.increase_schema_version();
+  ASSERT_EQ(nullptr, cache.lookup("a", &db));
+
+  QueryCacheStats stats = cache.stats();
+  ASSERT_EQ(1, stats.hits);
+  ASSERT_EQ(3, stats.misses);
+  ASSERT_EQ(2, stats.invalidations);
+  ASSERT_EQ(0, stats.entries);
+  ASSERT_EQ(0, stats.memory_size);
+}
+
+TEST(QueryCache, test_limits)
+{
+  Db db;
+  const int64_t result_size = make_result(0, 10)->memory_size();
+
+  // 内存最多保存两个结果
+  QueryCache cache(result_size * 2 + 1, result_size, 10);
+  cache.insert("a", make_result(0, 10));
+  cache.insert("b", make_result(0, 10));
+  ASSERT_NE(nullptr, cache.lookup("a", &db));
+  cache.insert("c", make_result(0, 10));
+  ASSERT_EQ(nullptr, cache.lookup("b", &db));
+  ASSERT_NE(nullptr, cache.lookup("a", &db));
+  ASSERT_NE(nullptr, cache.lookup("c", &db));
+
+  // 超过单个结果的上限，不缓存
+  cache.insert("d", make_result(0, 11));
+  ASSERT_EQ(nullptr, cache.lookup("d", &db));
+
+  QueryCacheStats stats = cache.stats();
+  ASSERT_EQ(1, stats.evictions);
+  ASSERT_EQ(3, stats.inserts);
+  ASSERT_EQ(2, stats.entries);
+  ASSERT_EQ(result_size * 2, stats.memory_size);
+
+  // 个数的上限
+  QueryCache small_cache(result_size * 10, result_size, 1);
+  small_cache.insert("a", make_result(0, 1));
+  small_cache.insert("b", make_result(0, 1));
+  ASSERT_EQ(nullptr, small_cache.lookup("a", &db));
+  ASSERT_NE(nullptr, small_cache.lookup("b", &db));
+
+  QueryCache disabled(0);
+  ASSERT_FALSE(disabled.enabled());
+  disabled.insert("a", make_result(0, 1));
+  ASSERT_EQ(nullptr, disabled.lookup("a", &db));
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,133 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+//
+// Created by agent on 2026/10/18
+//
+
+#include <random>
+#include <vector>
+
+#include "sql/expr/select_kernel.h"
+#include "gtest/gtest.h"
+
+using namespace std;
+using namespace select_kernel;
+
+static bool expect_int(CompOp op, int32_t l, int32_t r)
+{
+  switch (op) {
+    case EQUAL_TO: return l == r;
+    case NOT_EQUAL: return l != r;
+    case LESS_THAN: return l < r;
+    case LESS_EQUAL: return l <= r;
+    case GREAT_THAN: return l > r;
+    case GREAT_EQUAL: return l >= r;
+    default: return false;
+  }
+}
+
+static bool expect_float(CompOp op, float l, float r)
+{
+  // 与common::compare_float的语义一致
+  const float d = l - r;
+  const int cmp = d > 1e-6f ? 1 : (d < -1e-6f ? -1 : 0);
+  return expect_int(op, cmp, 0);
+}
+
+static bool bit(const vector<uint8_t> &bitmap, int i) { return (bitmap[i / 8] >> (i % 8)) & 1; }
+
+class SelectKernelTest : public testing::TestWithParam<SimdLevel>
+{
+protected:
+  void SetUp() override { actual_level_ = set_simd_level(GetParam()); }
+  void TearDown() override { set_simd_level(SimdLevel::AVX2); }
+
+  SimdLevel actual_level_;
+};
+
+TEST_P(SelectKernelTest, test_int32)
+{
+  mt19937 rng(1);
+  uniform_int_distribution<int32_t> dist(-20, 20);
+
+  const CompOp ops[] = {EQUAL_TO, NOT_EQUAL, LESS_THAN, LESS_EQUAL, GREAT_THAN, GREAT_EQUAL};
+  for (int n : {0, 1, 7, 8, 9, 31, 1024, 1029}) {
+    vector<int32_t> data(n);
+    for (int32_t &v : data) {
+      v = dist(rng);
+    }
+    vector<uint8_t> bitmap((n + 7) / 8 + 1, 0xFF);
+
+    for (CompOp op : ops) {
+      int matched = select_int32(op, data.data(), n, 3, bitmap.data());
+      int expected_matched = 0;
+      for (int i = 0; i < n; i++) {
+        ASSERT_EQ(expect_int(op, data[i], 3), bit(bitmap, i)) << "op=" << op << ", n=" << n << ", i=" << i;
+        expected_matched += expect_int(op, data[i], 3);
+      }
+      ASSERT_EQ(expected_matched, matched);
+      for (int i = n; i < (n + 7) / 8 * 8; i++) {
+        ASSERT_FALSE(bit(bitmap, i));
+      }
+    }
+
+    int matched = select_int32_between(data.data(), n, -5, 5, bitmap.data());
+    int expected_matched = 0;
+    for (int i = 0; i < n; i++) {
+      ASSERT_EQ(data[i] >= -5 && data[i] <= 5, bit(bitmap, i));
+      expected_matched += (data[i] >= -5 && data[i] <= 5);
+    }
+    ASSERT_EQ(expected_matched, matched);
+  }
+}
+
+TEST_P(SelectKernelTest, test_float)
+{
+  mt19937 rng(2);
+  uniform_int_distribution<int32_t> dist(-20, 20);
+
+  const CompOp ops[] = {EQUAL_TO, NOT_EQUAL, LESS_THAN, LESS_EQUAL, GREAT_THAN, GREAT_EQUAL};
+  for (int n : {0, 3, 8, 17, 1000}) {
+    vector<float> data(n);
+    for (float &v : data) {
+      v = dist(rng) * 0.25f;
+    }
+    vector<uint8_t> bitmap((n + 7) / 8 + 1);
+
+    for (CompOp op : ops) {
+      select_float(op, data.data(), n, 1.5f, bitmap.data());
+      for (int i = 0; i < n; i++) {
+        ASSERT_EQ(expect_float(op, data[i], 1.5f), bit(bitmap, i)) << "op=" << op << ", n=" << n << ", i=" << i;
+      }
+    }
+
+    select_float_between(data.data(), n, -1.0f, 2.0f, bitmap.data());
+    for (int i = 0; i < n; i++) {
+      ASSERT_EQ(data[i] >= -1.0f && data[i] <= 2.0f, bit(bitmap, i));
+    }
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(SimdLevels, SelectKernelTest,
+    testing::Values(SimdLevel::SCALAR, SimdLevel::SSE42, SimdLevel::AVX2));
+
+TEST(SelectKernel, test_flip)
+{
+  ASSERT_EQ(GREAT_THAN, flip_comp_op(LESS_THAN));
+  ASSERT_EQ(LESS_EQUAL, flip_comp_op(GREAT_EQUAL));
+  ASSERT_EQ(EQUAL_TO, flip_comp_op(EQUAL_TO));
+  ASSERT_EQ(NOT_EQUAL, flip_comp_op(NOT_EQUAL));
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
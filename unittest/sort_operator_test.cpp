@@ -0,0 +1,342 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18
+//
+
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <filesystem>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "common/global_context.h"
+#include "common/mm/arena.h"
+#include "common/mm/memory_tracker.h"
+#include "sql/operator/limit_physical_operator.h"
+#include "sql/operator/sort_physical_operator.h"
+#include "sql/operator/top_n_physical_operator.h"
+#include "storage/common/temp_file.h"
+#include "storage/table/table.h"
+#include "gtest/gtest.h"
+#include "unittest_util.h"
+
+using namespace std;
+
+/**
+ * 输入的每一行是 (k, name, v)，k是int，name是字符串，v是float
+ */
+class SortOperatorTest : public testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    // 每个用例使用单独的临时目录，结束后删除
+    test_dir_ = create_temp_dir("sort_operator_test");
+    ASSERT_FALSE(test_dir_.empty());
+    ASSERT_EQ(RC::SUCCESS, temp_file_manager_.init(test_dir_.c_str()));
+    GCTX.temp_file_manager_ = &temp_file_manager_;
+  }
+
+  void TearDown() override
+  {
+    GCTX.temp_file_manager_ = nullptr;
+    filesystem::remove_all(test_dir_);
+  }
+
+  static vector<vector<Value>> create_rows(int num)
+  {
+    mt19937 random(num);
+    vector<vector<Value>> rows;
+    for (int i = 0; i < num; i++) {
+      const int k = static_cast<int>(random() % 2001) - 1000;
+      rows.push_back({Value(k), Value(("name" + to_string(random() % 50)).c_str()),
+          Value(static_cast<float>(static_cast<int>(random() % 2001) - 1000) / 8)});
+    }
+    return rows;
+  }
+
+  /**
+   * @param keys 排序的列，每一项是(列号, 是否升序)
+   */
+  vector<vector<Value>> run_sort(const vector<vector<Value>> &rows, const vector<pair<int, bool>> &keys,
+      int64_t memory_limit, int &spilled_runs)
+  {
+    vector<bool> ascending;
+    vector<unique_ptr<Expression>> exprs = sort_exprs(keys, ascending);
+
+    SortPhysicalOperator oper(std::move(exprs), ascending);
+    oper.set_memory_limit(memory_limit);
+    oper.add_child(make_unique<ValuesPhysicalOperator>(input_specs(), rows));
+
+    vector<vector<Value>> results = run(oper);
+    spilled_runs = oper.spilled_runs();
+    EXPECT_EQ(0, temp_file_manager_.file_count());
+    return results;
+  }
+
+  vector<unique_ptr<Expression>> sort_exprs(const vector<pair<int, bool>> &keys, vector<bool> &ascending)
+  {
+    vector<unique_ptr<Expression>> exprs;
+    for (const auto &[column, asc] : keys) {
+      exprs.emplace_back(new FieldExpr(&table_, fields_[column]));
+      ascending.push_back(asc);
+    }
+    return exprs;
+  }
+
+  static vector<vector<Value>> run(PhysicalOperator &oper)
+  {
+    vector<vector<Value>> results;
+    EXPECT_EQ(RC::SUCCESS, oper.open(nullptr));
+    RC rc = RC::SUCCESS;
+    while (OB_SUCC(rc = oper.next())) {
+      Tuple *tuple = oper.current_tuple();
+      vector<Value> row(tuple->cell_num());
+      for (int i = 0; i < tuple->cell_num(); i++) {
+        EXPECT_EQ(RC::SUCCESS, tuple->cell_at(i, row[i]));
+      }
+      results.push_back(row);
+    }
+    EXPECT_EQ(RC::RECORD_EOF, rc);
+    EXPECT_EQ(RC::SUCCESS, oper.close());
+    return results;
+  }
+
+  static vector<TupleCellSpec> input_specs()
+  {
+    return {TupleCellSpec("", "k"), TupleCellSpec("", "name"), TupleCellSpec("", "v")};
+  }
+
+  /**
+   * @brief 使用Value::compare稳定排序得到期望的结果
+   */
+  static vector<vector<Value>> expected_results(vector<vector<Value>> rows, const vector<pair<int, bool>> &keys)
+  {
+    stable_sort(rows.begin(), rows.end(), [&keys](const vector<Value> &left, const vector<Value> &right) {
+      for (const auto &[column, asc] : keys) {
+        const int result = left[column].compare(right[column]);
+        if (result != 0) {
+          return asc ? result < 0 : result > 0;
+        }
+      }
+      return false;
+    });
+    return rows;
+  }
+
+  static vector<string> to_strings(const vector<vector<Value>> &rows)
+  {
+    vector<string> results;
+    for (const vector<Value> &row : rows) {
+      string result;
+      for (const Value &cell : row) {
+        result += cell.to_string() + "|";
+      }
+      results.push_back(result);
+    }
+    return results;
+  }
+
+protected:
+  string          test_dir_;
+  TempFileManager temp_file_manager_;
+  Table           table_;
+  FieldMeta       field_k_{"k", INTS, 0, 4, true};
+  FieldMeta       field_name_{"name", CHARS, 4, 10, true};
+  FieldMeta       field_v_{"v", FLOATS, 14, 4, true};
+  FieldMeta      *fields_[3] = {&field_k_, &field_name_, &field_v_};
+};
+
+TEST(SortKey, test_encode_key)
+{
+  vector<Value> values = {Value(INT32_MIN), Value(-100), Value(-1), Value(0), Value(1), Value(255), Value(256),
+      Value(INT32_MAX)};
+  vector<Value> floats = {Value(-1e10f), Value(-2.5f), Value(-0.0f), Value(0.0f), Value(0.5f), Value(2.5f),
+      Value(1e10f)};
+  vector<Value> strings = {Value(""), Value("a"), Value("ab"), Value("abc"), Value("b"), Value("\xff")};
+
+  for (const vector<Value> *column : {&values, &floats, &strings}) {
+    for (bool ascending : {true, false}) {
+      for (const Value &left : *column) {
+        for (const Value &right : *column) {
+          string left_key;
+          string right_key;
+          SortPhysicalOperator::encode_key(left, left.attr_type(), ascending, left_key);
+          SortPhysicalOperator::encode_key(right, right.attr_type(), ascending, right_key);
+
+          const int expected = ascending ? left.compare(right) : right.compare(left);
+          const int result   = left_key.compare(right_key);
+          ASSERT_EQ(expected < 0, result < 0) << left.to_string() << " vs " << right.to_string();
+          ASSERT_EQ(expected == 0, result == 0) << left.to_string() << " vs " << right.to_string();
+        }
+      }
+    }
+  }
+
+  // 空值比所有值都小，并且与同类型的值长度相同
+  string null_key;
+  string int_key;
+  SortPhysicalOperator::encode_key(Value(), INTS, true, null_key);
+  SortPhysicalOperator::encode_key(Value(INT32_MIN), INTS, true, int_key);
+  ASSERT_EQ(int_key.size(), null_key.size());
+  ASSERT_LT(null_key, int_key);
+}
+
+TEST_F(SortOperatorTest, test_in_memory)
+{
+  vector<vector<Value>> rows = create_rows(5000);
+  const vector<vector<pair<int, bool>>> all_keys = {
+      {{0, true}},                       // 单个int列，使用基数排序
+      {{2, false}, {0, true}},           // 定长的多列
+      {{1, true}, {0, false}},           // 包含字符串，使用比较排序
+      {{1, false}, {2, true}, {0, true}},
+  };
+
+  for (const vector<pair<int, bool>> &keys : all_keys) {
+    int spilled_runs = 0;
+    vector<vector<Value>> results = run_sort(rows, keys, INT64_MAX, spilled_runs);
+    ASSERT_EQ(0, spilled_runs);
+    // 排序是稳定的，与期望的结果完全一致
+    ASSERT_EQ(to_strings(expected_results(rows, keys)), to_strings(results));
+  }
+}
+
+TEST_F(SortOperatorTest, test_spill)
+{
+  vector<vector<Value>> rows = create_rows(20000);
+  const vector<vector<pair<int, bool>>> all_keys = {
+      {{0, false}},
+      {{1, true}, {2, false}},
+  };
+
+  for (const vector<pair<int, bool>> &keys : all_keys) {
+    // 每个run只有几十行，run的个数超过一次归并的路数，需要多次归并
+    int spilled_runs = 0;
+    vector<vector<Value>> results = run_sort(rows, keys, 8 * 1024, spilled_runs);
+    ASSERT_GT(spilled_runs, 64);
+    ASSERT_EQ(to_strings(expected_results(rows, keys)), to_strings(results));
+
+    results = run_sort(rows, keys, 1024 * 1024, spilled_runs);
+    ASSERT_GT(spilled_runs, 1);
+    ASSERT_LE(spilled_runs, 64);
+    ASSERT_EQ(to_strings(expected_results(rows, keys)), to_strings(results));
+  }
+  ASSERT_GT(temp_file_manager_.written_bytes(), 0);
+}
+
+TEST_F(SortOperatorTest, test_query_memory_limit)
+{
+  // 查询的内存限制比MemoryReservation同步的间隔小时，也会写临时文件
+  vector<vector<Value>> rows = create_rows(2000);
+  common::MemoryTracker tracker(8 * 1024);
+  common::MemoryTracker::set_current(&tracker);
+  int spilled_runs = 0;
+  vector<vector<Value>> results = run_sort(rows, {{0, true}}, INT64_MAX, spilled_runs);
+  common::MemoryTracker::set_current(nullptr);
+
+  ASSERT_GT(spilled_runs, 1);
+  ASSERT_EQ(to_strings(expected_results(rows, {{0, true}})), to_strings(results));
+  ASSERT_EQ(0, tracker.used());
+}
+
+TEST_F(SortOperatorTest, test_query_arena)
+{
+  // 较长的字符串也复制到arena中，写临时文件和close之后块都还给了query_arena
+  vector<vector<Value>> rows = create_rows(5000);
+  for (vector<Value> &row : rows) {
+    row[1] = Value((row[1].to_string() + string(40, 'x')).c_str());
+  }
+
+  common::MemoryTracker tracker;
+  {
+    common::QueryArena query_arena(&tracker);
+    common::QueryArena::set_current(&query_arena);
+    for (int64_t memory_limit : {INT64_MAX, int64_t(64 * 1024)}) {
+      int spilled_runs = 0;
+      vector<vector<Value>> results = run_sort(rows, {{1, true}, {0, false}}, memory_limit, spilled_runs);
+      ASSERT_EQ(memory_limit != INT64_MAX, spilled_runs > 0);
+      ASSERT_EQ(to_strings(expected_results(rows, {{1, true}, {0, false}})), to_strings(results));
+      ASSERT_GT(query_arena.free_blocks(), 0UL);
+      ASSERT_EQ(query_arena.free_blocks() * common::Arena::DEFAULT_BLOCK_SIZE, query_arena.memory_size());
+    }
+    common::QueryArena::set_current(nullptr);
+  }
+  ASSERT_EQ(0, tracker.used());
+}
+
+TEST_F(SortOperatorTest, test_empty_input)
+{
+  int spilled_runs = 0;
+  ASSERT_TRUE(run_sort({}, {{0, true}}, INT64_MAX, spilled_runs).empty());
+  ASSERT_TRUE(run_sort({}, {{1, true}}, 0, spilled_runs).empty());
+  ASSERT_EQ(0, spilled_runs);
+}
+
+TEST_F(SortOperatorTest, test_top_n)
+{
+  vector<vector<Value>> rows = create_rows(3000);
+  const vector<vector<pair<int, bool>>> all_keys = {
+      {{0, true}},
+      {{1, false}, {2, true}},
+  };
+
+  for (const vector<pair<int, bool>> &keys : all_keys) {
+    const vector<string> expected = to_strings(expected_results(rows, keys));
+    for (int limit : {0, 1, 10, 2999, 3000, 5000}) {
+      vector<bool> ascending;
+      vector<unique_ptr<Expression>> exprs = sort_exprs(keys, ascending);
+      TopNPhysicalOperator oper(std::move(exprs), ascending, limit);
+      oper.add_child(make_unique<ValuesPhysicalOperator>(input_specs(), rows));
+
+      // 与完整排序之后的前limit行完全一致
+      vector<string> results = to_strings(run(oper));
+      const int num = min(limit, static_cast<int>(rows.size()));
+      ASSERT_EQ(vector<string>(expected.begin(), expected.begin() + num), results) << "limit=" << limit;
+    }
+  }
+}
+
+TEST_F(SortOperatorTest, test_limit)
+{
+  vector<vector<Value>> rows = create_rows(100);
+  const vector<string> all_rows = to_strings(rows);
+
+  struct Case
+  {
+    int limit;
+    int offset;
+  };
+  for (const Case &c : {Case{10, 0}, Case{10, 95}, Case{0, 0}, Case{-1, 30}, Case{5, 200}}) {
+    LimitPhysicalOperator oper(c.limit, c.offset);
+    oper.add_child(make_unique<ValuesPhysicalOperator>(input_specs(), rows));
+    auto *child = static_cast<ValuesPhysicalOperator *>(oper.children().front().get());
+
+    const int begin = min(c.offset, 100);
+    const int end   = c.limit < 0 ? 100 : min(c.offset + c.limit, 100);
+    ASSERT_EQ(vector<string>(all_rows.begin() + begin, all_rows.begin() + end), to_strings(run(oper)));
+
+    // 输出足够的行之后不再从子算子读取
+    if (c.limit >= 0 && c.offset + c.limit < 100) {
+      ASSERT_EQ(c.offset + c.limit, child->next_count());
+    }
+  }
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,143 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18
+//
+
+
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+#include "storage/table/table_meta.h"
+#include "storage/table/table_stats.h"
+#include "storage/trx/trx.h"
+#include "gtest/gtest.h"
+
+using namespace std;
+
+static vector<Value> int_values(int num, int (*gen)(int))
+{
+  vector<Value> values;
+  for (int i = 0; i < num; i++) {
+    values.emplace_back(gen(i));
+  }
+  return values;
+}
+
+TEST(ColumnStats, test_uniform)
+{
+  vector<Value> sample = int_values(10000, [](int i) { return 9999 - i; });
+  ColumnStats column;
+  column.build("id", INTS, sample, 10000);
+  ASSERT_EQ(10000, column.ndv());
+  ASSERT_EQ(ColumnStats::HISTOGRAM_BUCKETS, column.bucket_num());
+  ASSERT_DOUBLE_EQ(0, column.null_fraction());
+
+  Value v100(100), v1000(1000), v5000(5000), v20000(20000), v_neg(-1);
+  ASSERT_NEAR(0.0001, column.equal_selectivity(v100), 1e-6);
+  ASSERT_EQ(0, column.equal_selectivity(v20000));
+  ASSERT_NEAR(0.01, column.range_selectivity(nullptr, false, &v100, false), 0.002);
+  ASSERT_NEAR(0.4, column.range_selectivity(&v1000, true, &v5000, false), 0.01);
+  ASSERT_NEAR(0.5, column.range_selectivity(&v5000, true, nullptr, false), 0.01);
+  ASSERT_EQ(0, column.range_selectivity(&v20000, true, nullptr, false));
+  ASSERT_EQ(1, column.range_selectivity(&v_neg, false, nullptr, false));
+  ASSERT_EQ(0, column.range_selectivity(&v5000, true, &v1000, true));
+}
+
+TEST(ColumnStats, test_skewed)
+{
+  // 90%的数据都是0，其它的值各不相同
+  vector<Value> sample = int_values(10000, [](int i) { return i % 10 == 0 ? i : 0; });
+  ColumnStats column;
+  column.build("k", INTS, sample, 10000);
+  ASSERT_EQ(1000, column.ndv());
+
+  Value zero(0), ten(10);
+  ASSERT_GT(column.equal_selectivity(zero), 0.85);
+  ASSERT_LT(column.equal_selectivity(ten), 0.01);
+}
+
+TEST(ColumnStats, test_sampled_ndv)
+{
+  // 采样1%的唯一值，估算的NDV应该接近总行数，而不是采样中的不同值个数
+  vector<Value> sample = int_values(1000, [](int i) { return i * 100; });
+  ColumnStats column;
+  column.build("id", INTS, sample, 100000);
+  ASSERT_GT(column.ndv(), 50000);
+  ASSERT_LE(column.ndv(), 100000);
+
+  // 采样中每个值都出现很多次，说明不同值很少
+  sample = int_values(1000, [](int i) { return i % 5; });
+  column.build("k", INTS, sample, 100000);
+  ASSERT_EQ(5, column.ndv());
+}
+
+TEST(TableStats, test_save_load)
+{
+  AttrInfoSqlNode attrs[] = {{INTS, "id", 4}, {CHARS, "name", 8}, {FLOATS, "score", 4}};
+  TableMeta table_meta;
+  ASSERT_EQ(RC::SUCCESS, table_meta.init(1, "t", 3, attrs));
+
+  TableStats stats;
+  stats.set_row_count(300);
+  stats.set_page_count(3);
+  vector<Value> ids   = int_values(300, [](int i) { return i; });
+  vector<Value> names;
+  vector<Value> scores;
+  for (int i = 0; i < 300; i++) {
+    names.emplace_back(("n" + to_string(i % 30)).c_str());
+    scores.emplace_back(i / 2.0f);
+  }
+  const char *field_names[] = {"id", "name", "score"};
+  const AttrType field_types[] = {INTS, CHARS, FLOATS};
+  vector<Value> *samples[] = {&ids, &names, &scores};
+  for (int i = 0; i < 3; i++) {
+    ColumnStats column;
+    column.build(field_names[i], field_types[i], *samples[i], 300);
+    stats.columns().push_back(column);
+  }
+
+  const string file = "table_stats_test.stats";
+  ASSERT_EQ(RC::SUCCESS, stats.save(file));
+
+  TableStats loaded;
+  ASSERT_EQ(RC::SUCCESS, loaded.load(table_meta, file));
+  remove(file.c_str());
+
+  ASSERT_EQ(300, loaded.row_count());
+  ASSERT_EQ(3, loaded.page_count());
+  ASSERT_EQ(3, static_cast<int>(loaded.columns().size()));
+  ASSERT_EQ(nullptr, loaded.column("nosuch"));
+
+  Value low(10.0f), high("n2");
+  for (const char *name : field_names) {
+    const ColumnStats *expected = stats.column(name);
+    const ColumnStats *column   = loaded.column(name);
+    ASSERT_NE(nullptr, column);
+    ASSERT_EQ(expected->ndv(), column->ndv());
+    ASSERT_EQ(expected->bucket_num(), column->bucket_num());
+  }
+  ASSERT_DOUBLE_EQ(stats.column("score")->range_selectivity(&low, true, nullptr, false),
+      loaded.column("score")->range_selectivity(&low, true, nullptr, false));
+  ASSERT_DOUBLE_EQ(stats.column("name")->range_selectivity(nullptr, false, &high, true),
+      loaded.column("name")->range_selectivity(nullptr, false, &high, true));
+
+  ASSERT_EQ(RC::FILE_NOT_EXIST, loaded.load(table_meta, "table_stats_test.nosuch"));
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  // 初始化表元数据时需要事务模块提供的系统字段
+  TrxKit::init_global("vacuous");
+  return RUN_ALL_TESTS();
+}
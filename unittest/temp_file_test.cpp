@@ -0,0 +1,116 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18
+//
+
+#include <stdlib.h>
+#include <unistd.h>
+#include <filesystem>
+#include <memory>
+#include <string>
+
+#include "storage/common/temp_file.h"
+#include "gtest/gtest.h"
+#include "unittest_util.h"
+
+using namespace std;
+
+class TempFileTest : public testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    // 每个用例使用单独的临时目录，结束后删除
+    test_dir_ = create_temp_dir("temp_file_test");
+    ASSERT_FALSE(test_dir_.empty());
+  }
+
+  void TearDown() override { filesystem::remove_all(test_dir_); }
+
+protected:
+  string test_dir_;
+};
+
+TEST_F(TempFileTest, test_write_read)
+{
+  TempFileManager manager;
+  ASSERT_EQ(RC::SUCCESS, manager.init(test_dir_.c_str()));
+
+  string path;
+  {
+    unique_ptr<TempFile> file;
+    ASSERT_EQ(RC::SUCCESS, manager.create_file(file));
+    ASSERT_EQ(1, manager.file_count());
+    path = file->path();
+
+    // 写入的数据超过缓冲区大小
+    const int count = 50000;
+    for (int i = 0; i < count; i++) {
+      ASSERT_EQ(RC::SUCCESS, file->write_value(Value(i)));
+      ASSERT_EQ(RC::SUCCESS, file->write_value(Value(i * 0.5f)));
+      ASSERT_EQ(RC::SUCCESS, file->write_value(Value(to_string(i).c_str())));
+    }
+    ASSERT_EQ(RC::SUCCESS, file->write_value(Value("")));
+    ASSERT_EQ(RC::SUCCESS, file->write_value(Value(true)));
+    ASSERT_EQ(RC::SUCCESS, file->rewind());
+    ASSERT_EQ(file->size(), manager.written_bytes());
+
+    // 可以重复读取
+    for (int round = 0; round < 2; round++) {
+      Value value;
+      for (int i = 0; i < count; i++) {
+        ASSERT_EQ(RC::SUCCESS, file->read_value(value));
+        ASSERT_EQ(INTS, value.attr_type());
+        ASSERT_EQ(i, value.get_int());
+        ASSERT_EQ(RC::SUCCESS, file->read_value(value));
+        ASSERT_EQ(FLOATS, value.attr_type());
+        ASSERT_EQ(i * 0.5f, value.get_float());
+        ASSERT_EQ(RC::SUCCESS, file->read_value(value));
+        ASSERT_EQ(CHARS, value.attr_type());
+        ASSERT_EQ(to_string(i), value.get_string());
+      }
+      ASSERT_EQ(RC::SUCCESS, file->read_value(value));
+      ASSERT_EQ(CHARS, value.attr_type());
+      ASSERT_EQ("", value.get_string());
+      ASSERT_EQ(RC::SUCCESS, file->read_value(value));
+      ASSERT_EQ(BOOLEANS, value.attr_type());
+      ASSERT_TRUE(value.get_boolean());
+      ASSERT_EQ(RC::RECORD_EOF, file->read_value(value));
+      ASSERT_EQ(RC::SUCCESS, file->rewind());
+    }
+  }
+
+  // 析构时删除文件
+  ASSERT_EQ(0, manager.file_count());
+  ASSERT_NE(0, ::access(path.c_str(), F_OK));
+}
+
+TEST_F(TempFileTest, test_remove_stale_files)
+{
+  TempFileManager manager;
+  ASSERT_EQ(RC::SUCCESS, manager.init(test_dir_.c_str()));
+
+  const string stale_file = test_dir_ + "/stale.tmp";
+  FILE *f = fopen(stale_file.c_str(), "w");
+  ASSERT_NE(nullptr, f);
+  fclose(f);
+
+  TempFileManager manager2;
+  ASSERT_EQ(RC::SUCCESS, manager2.init(test_dir_.c_str()));
+  ASSERT_NE(0, ::access(stale_file.c_str(), F_OK));
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,88 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18
+//
+
+#pragma once
+
+#include <stdlib.h>
+#include <filesystem>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "sql/expr/tuple.h"
+#include "sql/operator/physical_operator.h"
+
+/**
+ * @brief 按照给定的数据输出ValueListTuple的算子，算子测试中作为子算子使用
+ */
+class ValuesPhysicalOperator : public PhysicalOperator
+{
+public:
+  ValuesPhysicalOperator(const std::vector<TupleCellSpec> &specs, std::vector<std::vector<Value>> rows)
+      : rows_(std::move(rows))
+  {
+    tuple_.set_specs(specs);
+  }
+
+  PhysicalOperatorType type() const override { return PhysicalOperatorType::TABLE_SCAN; }
+
+  RC open(Trx *) override
+  {
+    index_ = -1;
+    return RC::SUCCESS;
+  }
+  RC next() override
+  {
+    next_count_++;
+    if (++index_ >= static_cast<int>(rows_.size())) {
+      return RC::RECORD_EOF;
+    }
+    tuple_.set_cells(rows_[index_]);
+    return RC::SUCCESS;
+  }
+  RC close() override { return RC::SUCCESS; }
+  Tuple *current_tuple() override { return &tuple_; }
+
+  RC tuple_schema(TupleSchema &schema) const override
+  {
+    for (const TupleCellSpec &spec : tuple_.specs()) {
+      schema.append_cell(spec);
+    }
+    return RC::SUCCESS;
+  }
+
+  /**
+   * @brief 调用next的次数，用于检查父算子是否提前结束
+   */
+  int next_count() const { return next_count_; }
+
+private:
+  std::vector<std::vector<Value>> rows_;
+  ValueListTuple                  tuple_;
+  int                             index_      = -1;
+  int                             next_count_ = 0;
+};
+
+/**
+ * @brief 在系统的临时目录下创建一个新的目录，名字以prefix开头
+ * @return 创建的目录，失败时返回空字符串。使用者负责删除
+ */
+inline std::string create_temp_dir(const char *prefix)
+{
+  std::string dir = (std::filesystem::temp_directory_path() / (std::string(prefix) + "_XXXXXX")).string();
+  if (mkdtemp(dir.data()) == nullptr) {
+    return std::string();
+  }
+  return dir;
+}
@@ -0,0 +1,113 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created by agent on 2026/10/18
+//
+
+#include <string.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "sql/parser/value.h"
+#include "gtest/gtest.h"
+
+using namespace std;
+
+TEST(Value, test_inline_and_heap_string)
+{
+  Value short_value("hello");
+  ASSERT_EQ(5, short_value.length());
+  ASSERT_STREQ("hello", short_value.data());
+  ASSERT_EQ(static_cast<int64_t>(sizeof(Value)), short_value.memory_size());
+
+  const string long_str(100, 'x');
+  Value long_value(long_str.c_str());
+  ASSERT_EQ(long_str, long_value.get_string());
+  ASSERT_GT(long_value.memory_size(), static_cast<int64_t>(sizeof(Value)) + 100);
+
+  // 移动时直接接管申请的内存
+  const char *buf = long_value.data();
+  Value moved(std::move(long_value));
+  ASSERT_EQ(buf, moved.data());
+  ASSERT_EQ(long_str, moved.get_string());
+
+  // 改成数值类型之后再改回字符串
+  moved.set_int(10);
+  ASSERT_EQ(10, moved.get_int());
+  moved.set_string("abc");
+  ASSERT_EQ(0, moved.compare(Value("abc")));
+
+  vector<Value> values;
+  for (int i = 0; i < 100; i++) {
+    values.emplace_back(string(i, 'a' + i % 26).c_str());
+  }
+  for (int i = 0; i < 100; i++) {
+    ASSERT_EQ(string(i, 'a' + i % 26), values[i].get_string());
+  }
+}
+
+TEST(Value, test_borrow_data)
+{
+  // 模拟记录中的一个char(40)字段
+  char field[40];
+  memset(field, 0, sizeof(field));
+  const string str(30, 'b');
+  memcpy(field, str.c_str(), str.size());
+
+  Value value;
+  value.set_type(CHARS);
+  value.borrow_data(field, sizeof(field));
+  ASSERT_TRUE(value.borrowed());
+  ASSERT_EQ(field, value.data());
+  ASSERT_EQ(30, value.length());
+  ASSERT_EQ(static_cast<int64_t>(sizeof(Value)), value.memory_size());
+
+  // 拷贝和移动之后不再依赖原来的内存
+  Value copied(value);
+  Value moved(std::move(value));
+  ASSERT_FALSE(copied.borrowed());
+  ASSERT_FALSE(moved.borrowed());
+  ASSERT_NE(field, copied.data());
+  ASSERT_NE(field, moved.data());
+
+  Value owned;
+  owned.set_type(CHARS);
+  owned.borrow_data(field, sizeof(field));
+  owned.make_owned();
+  ASSERT_FALSE(owned.borrowed());
+
+  field[0] = 'c';
+  ASSERT_EQ(str, copied.get_string());
+  ASSERT_EQ(str, moved.get_string());
+  ASSERT_EQ(str, owned.get_string());
+
+  // 字段写满时没有'\0'结尾，需要复制
+  char full[4] = {'a', 'b', 'c', 'd'};
+  Value full_value;
+  full_value.set_type(CHARS);
+  full_value.borrow_data(full, sizeof(full));
+  ASSERT_FALSE(full_value.borrowed());
+  ASSERT_STREQ("abcd", full_value.data());
+
+  // 数值类型与set_data相同
+  int int_data = 5;
+  Value int_value;
+  int_value.set_type(INTS);
+  int_value.borrow_data(reinterpret_cast<const char *>(&int_data), sizeof(int_data));
+  ASSERT_EQ(5, int_value.get_int());
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}